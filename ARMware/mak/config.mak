@@ -105,7 +105,7 @@ OBJFILE_NAME_FILE = $(BUILD_MAK_DIR)/custom.share.files \
 # gcc implementations.
 # Thus, if there are newer gcc versions, like gcc-3.4.3 or gcc-4.0,
 # then I may turn on this '-Winline' flags again.
-CUSTOM_CFLAGS = -pipe -march=pentium4 -mfpmath=sse,387 -Wall -W -Wundef -Wwrite-strings -Wredundant-decls -Wpointer-arith -Woverloaded-virtual -Wconversion `pkg-config gtkmm-2.4 --cflags`
+CUSTOM_CFLAGS = -pipe -march=pentium4 -mfpmath=sse,387 -Wall -W -Wundef -Wwrite-strings -Wredundant-decls -Wpointer-arith -Woverloaded-virtual -Wconversion `pkg-config gtkmm-2.4 gthread-2.0 --cflags`
 
 ifeq ($(CONFIG_DATABASE), XML)
 CUSTOM_CFLAGS += `pkg-config --cflags libxml++-2.6`
@@ -213,16 +213,15 @@ OPTI_CFLAGS += -D'USE_SHIFTER_CARRY=0'
 #
 # ENABLE_DRAWING_ASM is more beautiful, and !ENABLE_DRAWING_ASM is uglier.
 
-ifeq ($(DEBUG_MODE), true)
-CUSTOM_CFLAGS += -D'ENABLE_DRAWING_ASM=0'
-else
+# The drawing codes are SSE2 & AVX2 intrinsics in src/PixelConvert.cpp now,
+# which don't have the register problem above, thus they are built in the
+# debug mode as well. ENABLE_DRAWING_ASM only allows them to be selected at
+# run time by CPUID, and all of them draw the same screen as the scalar one.
 
 ifeq ($(ENABLE_DRAWING_ASM), true)
 CUSTOM_CFLAGS += -D'ENABLE_DRAWING_ASM=1'
 else
 CUSTOM_CFLAGS += -D'ENABLE_DRAWING_ASM=0'
-endif
-
 endif
 OPTI_CFLAGS += -D'ENABLE_DRAWING_ASM=1'
 
@@ -559,9 +558,16 @@ CUSTOM_CFLAGS += -D'PRINT_CHUNKS_LENGTH=0'
 endif
 OPTI_CFLAGS += -D'PRINT_CHUNKS_LENGTH=0'
 
+ifeq ($(PROFILE_DT_COMPILE), true)
+CUSTOM_CFLAGS += -D'PROFILE_DT_COMPILE=1'
+else
+CUSTOM_CFLAGS += -D'PROFILE_DT_COMPILE=0'
+endif
+OPTI_CFLAGS += -D'PROFILE_DT_COMPILE=0'
+
 # Initialize LDFLAGS
 
-LDFLAGS = `pkg-config gtkmm-2.4 --libs`
+LDFLAGS = `pkg-config gtkmm-2.4 gthread-2.0 --libs`
 
 ifeq ($(CONFIG_DATABASE), GDBM)
 LDFLAGS += -lgdbm
@@ -20,17 +20,21 @@
 #include <unistd.h>
 #include <fcntl.h>
 #include <errno.h>
+#include <sys/select.h>
 
+/* The host side of a serial port attached by ARMWARE_SERIAL_<n>=pty:<link>,
+ * i.e. <link>.
+ */
 int
-open_port(void)
+open_port(char const *path)
 {
   int fd; /* File descriptor for the port */
   
-  fd = open("/dev/ClientSideSSP", O_RDWR | O_NOCTTY | O_NDELAY);
+  fd = open(path, O_RDWR | O_NOCTTY | O_NDELAY);
   
   if (-1 == fd)
   {
-    perror("open_port: Unable to open /dev/ttyf1 - ");
+    perror("open_port: Unable to open the serial port - ");
   }
   else
   {
@@ -43,13 +47,26 @@ open_port(void)
 int
 main(int argc, char **argv)
 {
-  int fd = open_port();
+  int fd;
   char buffer[1024];
   int num;
   int i;
   fd_set fds;
   struct timeval tv;
   
+  if (argc != 2)
+  {
+    fprintf(stderr, "usage: %s <serial port>\n", argv[0]);
+    return 1;
+  }
+  
+  fd = open_port(argv[1]);
+  
+  if (-1 == fd)
+  {
+    return 1;
+  }
+  
   tv.tv_sec = 1;
   tv.tv_usec = 0;
   
@@ -84,7 +84,7 @@ USE_SHIFTER_CARRY = false
 # Because in the second example, 'make' will treat 'true # work as expected when DEBUG_MODE==false'
 # as the whole parameter to 'ENABLE_DRAWING_ASM' rather than a simple 'true'.
 
-# work as expected when DEBUG_MODE==false
+# the SSE2 & AVX2 drawing codes, selected at run time by CPUID
 ENABLE_DRAWING_ASM = true
 
 # work as expected when DEBUG_MODE==false
@@ -147,4 +147,7 @@ DUMP_CPU_INFO_MORE_DETAIL = false
 CHECK_CHUNK_CODE = false
 PRINT_CHUNKS_LENGTH = false
 
+# work as expected when ENABLE_DYNAMIC_TRANSLATOR==true
+PROFILE_DT_COMPILE = false
+
 COMPARE_TO_ALTERNATIVE_DPI = false
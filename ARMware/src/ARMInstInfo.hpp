@@ -48,7 +48,7 @@ namespace ARMware
     typedef void (*FunctionPtr_DT)(Inst const, bool const);
 #endif
     
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
     // :NOTE: Wei 2004-Nov-4:
     //
     // Used in ARM instruction printing.
@@ -61,11 +61,14 @@ namespace ARMware
     {
       // Attribute
       
-      FunctionPtr_TC const mp_func_TC;
+      // :NOTE: one threaded code function per translation mode, indexed by
+      // Core::m_translation_mode. Only the memory instructions have different
+      // variants, the others use the same function in every slot.
+      FunctionPtr_TC mp_func_TC[TRANSLATION_MODE_NUMBER];
 #if ENABLE_DYNAMIC_TRANSLATOR
       FunctionPtr_DT const mp_func_DT;
 #endif
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
       FunctionPtr_PRINT const mp_func_PRINT;
 #endif
       
@@ -75,18 +78,45 @@ namespace ARMware
 #if ENABLE_DYNAMIC_TRANSLATOR
               , FunctionPtr_DT const func_DT
 #endif
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
+              ,FunctionPtr_PRINT const func_PRINT
+#endif
+              )
+#if ENABLE_DYNAMIC_TRANSLATOR
+        : mp_func_DT(func_DT)
+#endif
+#if ENABLE_DYNAMIC_TRANSLATOR
+          , mp_func_PRINT(func_PRINT)
+#endif
+      {
+        for (uint32_t i = 0; i < TRANSLATION_MODE_NUMBER; ++i)
+        {
+          mp_func_TC[i] = func_TC;
+        }
+      }
+      
+      // Memory instructions
+      ArgList(FunctionPtr_TC const func_TC_mmu_off,
+              FunctionPtr_TC const func_TC_mmu_on,
+              FunctionPtr_TC const func_TC_mmu_on_fcse
+#if ENABLE_DYNAMIC_TRANSLATOR
+              , FunctionPtr_DT const func_DT
+#endif
+#if ENABLE_DYNAMIC_TRANSLATOR
               ,FunctionPtr_PRINT const func_PRINT
 #endif
               )
-        : mp_func_TC(func_TC)
 #if ENABLE_DYNAMIC_TRANSLATOR
-          , mp_func_DT(func_DT)
+        : mp_func_DT(func_DT)
 #endif
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
           , mp_func_PRINT(func_PRINT)
 #endif
-      { }
+      {
+        mp_func_TC[TRANSLATION_MMU_OFF] = func_TC_mmu_off;
+        mp_func_TC[TRANSLATION_MMU_ON] = func_TC_mmu_on;
+        mp_func_TC[TRANSLATION_MMU_ON_FCSE] = func_TC_mmu_on_fcse;
+      }
     };
     typedef struct ArgList ArgList;
     
@@ -156,8 +186,8 @@ namespace ARMware
     // Inquiry
     
     inline FunctionPtr_TC
-    func_TC() const
-    { return mp_arg_list->mp_func_TC; }
+    func_TC(TranslationModeEnum const mode) const
+    { return mp_arg_list->mp_func_TC[mode]; }
     
 #if ENABLE_DYNAMIC_TRANSLATOR
     inline FunctionPtr_DT
@@ -165,7 +195,7 @@ namespace ARMware
     { return mp_arg_list->mp_func_DT; }
 #endif
     
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
     inline FunctionPtr_PRINT
     func_PRINT() const
     { return mp_arg_list->mp_func_PRINT; }
@@ -25,7 +25,7 @@
 #include "Type.hpp"
 #include "platform_dep.hpp"
 
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
 #include "Inst/Inst.hpp"
 #endif
 
@@ -107,6 +107,25 @@ namespace ARMware
   };
   typedef enum UsageEnum UsageEnum;
   
+  // How Core translates a virtual address.
+  //
+  // The interpreter & the threaded code have a variant of every memory
+  // instruction for each of the first 3 modes, and Core selects the variant
+  // when CP15 c1 or c13 is written (see Core::invalidate_translation()).
+  //
+  // TRANSLATION_ANY looks at the current mode on every access, it is used by
+  // the dynamic translated codes & the rarely used paths.
+  enum TranslationModeEnum
+  {
+    TRANSLATION_MMU_OFF,
+    TRANSLATION_MMU_ON,      // the FCSE PID is 0
+    TRANSLATION_MMU_ON_FCSE,
+    TRANSLATION_ANY
+  };
+  typedef enum TranslationModeEnum TranslationModeEnum;
+  
+  uint32_t const TRANSLATION_MODE_NUMBER = TRANSLATION_ANY;
+  
   enum CoreMode
   {
     MODE_USR = 0x10, // 0b10000
@@ -166,7 +185,7 @@ namespace ARMware
     return regNum = static_cast<CoreRegNum>(regNum - 1);
   }
   
-#if ENABLE_INST_RECALL || (ENABLE_DYNAMIC_TRANSLATOR && PRINT_CHUNK_CODE)
+#if ENABLE_INST_RECALL || ENABLE_DYNAMIC_TRANSLATOR
   inline char const *
   CoreRegName(CoreRegNum const i)
   {
@@ -197,7 +216,7 @@ namespace ARMware
   
 #endif
   
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
   inline char const *
   CondName(InstCond const cond)
   {
@@ -15,10 +15,169 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 //
 
+#include <cstring>
+
 #include "AddressSpace.hpp"
+#include "Core.hpp"
+#include "Log.hpp"
+#include "MachineType.hpp"
+
+#include "AddressSpace.tcc"
 
 namespace ARMware
 {
+  ///////////////////////////////// Private ///////////////////////////////////
+  //=============================== Handlers ==================================
+  
+  template<typename T_pointer, T_pointer AddressSpace::*T_device, typename T_return>
+  uint32_t
+  AddressSpace::get_device(AddressSpace const * const self,
+                           uint32_t const address,
+                           bool & /* exception_occur */)
+  {
+    return (self->*T_device)->template get_data<T_return>(address);
+  }
+  
+  template<typename T_pointer, T_pointer AddressSpace::*T_device, typename T_store>
+  void
+  AddressSpace::put_device(AddressSpace * const self,
+                           uint32_t const address,
+                           uint32_t const value)
+  {
+    (self->*T_device)->put_data(address, static_cast<T_store>(value));
+  }
+  
+  // DRAM is loaded from m_host_table and stored by put_data() directly,
+  // these 2 are only for completeness.
+  template<typename T_return>
+  uint32_t
+  AddressSpace::get_dram(AddressSpace const * const self,
+                         uint32_t const address,
+                         bool & /* exception_occur */)
+  {
+    return self->mp_memory->get_data<T_return>(address & MachineType::DRAM_SIZE);
+  }
+  
+  template<typename T_store>
+  void
+  AddressSpace::put_dram(AddressSpace * const self,
+                         uint32_t const address,
+                         uint32_t const value)
+  {
+    self->mp_memory->put_data(address & MachineType::DRAM_SIZE, static_cast<T_store>(value));
+  }
+  
+  uint32_t
+  AddressSpace::get_nonexistent(AddressSpace const * const /* self */,
+                                uint32_t const address,
+                                bool & /* exception_occur */)
+  {
+    // :NOTE: Wei 2003-Dec-07:
+    //
+    // However, due to simplicity, I return 0 in this situation.
+#if TRACE_UNKNOWN_MEMORY_ADDR
+    g_log_file << "Get data from unknown address: " << std::hex << address << std::endl;
+#else
+    (void)address;
+#endif
+    return 0;
+  }
+  
+  uint32_t
+  AddressSpace::get_reserved(AddressSpace const * const /* self */,
+                             uint32_t const /* address */,
+                             bool &exception_occur)
+  {
+    exception_occur = true;
+    return 0;
+  }
+  
+  uint32_t
+  AddressSpace::get_unknown(AddressSpace const * const /* self */,
+                            uint32_t const /* address */,
+                            bool & /* exception_occur */)
+  {
+    assert(!"Should not reach here.");
+    return 0;
+  }
+  
+  void
+  AddressSpace::put_ignored(AddressSpace * const /* self */,
+                            uint32_t const address,
+                            uint32_t const /* value */)
+  {
+    // :NOTE: Wei 2004-Jan-12:
+    //
+    // familiar bootldr will check 0x4000076C
+    // (the DPDR register's address of HP Jornada),
+    // so that I have to let it pass, and don't use assert() here.
+#if TRACE_UNKNOWN_MEMORY_ADDR
+    g_log_file << "Put data to unknown address: " << std::hex << address << std::endl;
+#else
+    (void)address;
+#endif
+  }
+  
+  void
+  AddressSpace::put_unknown(AddressSpace * const /* self */,
+                            uint32_t const address,
+                            uint32_t const value)
+  {
+    g_log_file << std::hex << "address = " << address << std::endl;
+    g_log_file << std::hex << "value = " << value << std::endl;
+    assert(!"Should not reach here.");
+  }
+  
+  //============================== Operation ==================================
+  
+  void
+  AddressSpace::set_handler(RegionEnum const region, GetHandler const get, PutHandler const put)
+  {
+    for (uint32_t width = 0; width < WIDTH_COUNT; ++width)
+    {
+      m_regions[region].m_get[width] = get;
+      m_regions[region].m_put[width] = put;
+    }
+  }
+  
+  template<typename T_pointer, T_pointer AddressSpace::*T_device>
+  void
+  AddressSpace::set_device(RegionEnum const region)
+  {
+    Region &entry = m_regions[region];
+    
+    entry.m_get[width_index<uint8_t>()] = &get_device<T_pointer, T_device, uint8_t>;
+    entry.m_get[width_index<uint16_t>()] = &get_device<T_pointer, T_device, uint16_t>;
+    entry.m_get[width_index<uint32_t>()] = &get_device<T_pointer, T_device, uint32_t>;
+    
+    entry.m_put[width_index<uint8_t>()] = &put_device<T_pointer, T_device, uint8_t>;
+    entry.m_put[width_index<uint16_t>()] = &put_device<T_pointer, T_device, uint16_t>;
+    entry.m_put[width_index<uint32_t>()] = &put_device<T_pointer, T_device, uint32_t>;
+  }
+  
+  void
+  AddressSpace::set_region(uint32_t const first, uint32_t const last, RegionEnum const region)
+  {
+    for (uint32_t idx = (first >> REGION_SHIFT); idx <= (last >> REGION_SHIFT); ++idx)
+    {
+      m_region_table[idx] = &(m_regions[region]);
+    }
+  }
+  
+  void
+  AddressSpace::set_host(uint32_t const first,
+                         uint32_t const last,
+                         uint8_t const * const host,
+                         uint32_t const mask)
+  {
+    for (uint32_t idx = (first >> REGION_SHIFT); idx <= (last >> REGION_SHIFT); ++idx)
+    {
+      m_host_table[idx] = ((0 == host)
+                           ? 0
+                           : &(host[(idx << REGION_SHIFT) & mask]));
+    }
+  }
+  
   ////////////////////////////////// Public ///////////////////////////////////
   //============================== Life cycle =================================
   
@@ -40,6 +199,100 @@ namespace ARMware
       mpLCDController(0),
       mpOsTimer(os_timer)
   {
+    memset(m_host_table, 0, sizeof(m_host_table));
+    
+    // The handlers of a device read its pointer at the time of the access,
+    // thus the devices can be registered later.
+    set_handler(REGION_NONEXISTENT, &get_nonexistent, &put_ignored);
+    set_handler(REGION_RESERVED, &get_reserved, &put_ignored);
+    set_handler(REGION_UNKNOWN, &get_unknown, &put_unknown);
+    
+    m_regions[REGION_DRAM].m_get[width_index<uint8_t>()] = &get_dram<uint8_t>;
+    m_regions[REGION_DRAM].m_get[width_index<uint16_t>()] = &get_dram<uint16_t>;
+    m_regions[REGION_DRAM].m_get[width_index<uint32_t>()] = &get_dram<uint32_t>;
+    m_regions[REGION_DRAM].m_put[width_index<uint8_t>()] = &put_dram<uint8_t>;
+    m_regions[REGION_DRAM].m_put[width_index<uint16_t>()] = &put_dram<uint16_t>;
+    m_regions[REGION_DRAM].m_put[width_index<uint32_t>()] = &put_dram<uint32_t>;
+    
+    set_device<RomFile *, &AddressSpace::mpRomFile>(REGION_ROM);
+    set_device<Egpio *, &AddressSpace::mpEgpio>(REGION_EGPIO);
+    set_device<Serial_1 *, &AddressSpace::mpSerial_1>(REGION_SERIAL_1);
+    set_device<Serial_2 *, &AddressSpace::mpSerial_2>(REGION_SERIAL_2);
+    set_device<Serial_3 *, &AddressSpace::mpSerial_3>(REGION_SERIAL_3);
+    set_device<OsTimer * const, &AddressSpace::mpOsTimer>(REGION_OS_TIMER);
+    set_device<RTC *, &AddressSpace::mpRTC>(REGION_RTC);
+    set_device<PowerManager *, &AddressSpace::mpPowerManager>(REGION_POWER_MANAGER);
+    set_device<ResetController *, &AddressSpace::mpResetController>(REGION_RESET_CONTROLLER);
+    set_device<GPIOControlBlock *, &AddressSpace::mp_GPIO_control_block>(REGION_GPIO_CONTROL_BLOCK);
+    set_device<IntController *, &AddressSpace::mp_int_controller>(REGION_INT_CONTROLLER);
+    set_device<PPC *, &AddressSpace::mpPPC>(REGION_PPC);
+    set_device<MemoryConf *, &AddressSpace::mp_memory_conf>(REGION_MEMORY_CONF);
+    set_device<LCDController *, &AddressSpace::mpLCDController>(REGION_LCD_CONTROLLER);
+    
+    // :SA-1110 Developer's Manual: Wei 2003-Dec-07:
+    //
+    // Static Bank 0 ~ 3 (4 * 128 MB), PCMCIA Socket 0 ~ 1 (2 * 256 MB),
+    // Static Bank 4 ~ 5 (2 * 128 MB)
+    set_region(0x00000000, 0x4FFFFFFF, REGION_NONEXISTENT);
+    
+    // :H3600: Wei 2003-Dec-07:
+    //
+    // onboard flash ROM (16 MB)
+    set_region(0x00000000, 0x00FFFFFF, REGION_ROM);
+    set_region(0x49000000, 0x49FFFFFF, REGION_EGPIO);
+    
+    // :SA-1110 Developer's Manual: Wei 2003-Dec-07:
+    //
+    // Reserved (768 MB)
+    set_region(0x50000000, 0x7FFFFFFF, REGION_RESERVED);
+    
+    // :SA-1110 Developer's Manual: Wei 2003-Dec-07:
+    //
+    // Peripheral Control Module Registers (256 MB)
+    // System Control Module Registers (256 MB)
+    // Memory and Expansion Registers (256 MB)
+    // LCD and DMA Registers (256 MB)
+    set_region(0x80000000, 0xBFFFFFFF, REGION_UNKNOWN);
+    
+    set_region(0x80010000, 0x8002FFFF, REGION_SERIAL_1);
+    set_region(0x80030000, 0x8003FFFF, REGION_SERIAL_2);
+    set_region(0x80050000, 0x8005FFFF, REGION_SERIAL_3);
+    
+    set_region(0x90000000, 0x9000FFFF, REGION_OS_TIMER);
+    set_region(0x90010000, 0x9001FFFF, REGION_RTC);
+    set_region(0x90020000, 0x9002FFFF, REGION_POWER_MANAGER);
+    set_region(0x90030000, 0x9003FFFF, REGION_RESET_CONTROLLER);
+    set_region(0x90040000, 0x9004FFFF, REGION_GPIO_CONTROL_BLOCK);
+    set_region(0x90050000, 0x9005FFFF, REGION_INT_CONTROLLER);
+    set_region(0x90060000, 0x9006FFFF, REGION_PPC);
+    
+    set_region(0xA0000000, 0xA000FFFF, REGION_MEMORY_CONF);
+    
+    // :NOTE: Wei 2004-Jan-13:
+    //
+    // The LCD controller is selected by the bit 20, the DMA controller
+    // (not emulated yet) by the others.
+    for (uint32_t address = 0xB0100000; address < 0xB1000000; address += 0x200000)
+    {
+      set_region(address, address + 0xFFFFF, REGION_LCD_CONTROLLER);
+    }
+    
+    // :SA-1110 Developer's Manual: Wei 2003-Dec-07:
+    //
+    // DRAM Bank 0 (128 MB)
+    set_region(0xC0000000, 0xC7FFFFFF, REGION_DRAM);
+    
+    // :SA-1110 Developer's Manual: Wei 2003-Dec-07:
+    //
+    // DRAM Bank 1 ~ 3 (3 * 128 MB), Zero Bank (128 MB)
+    //
+    // Reads from the zero bank return 0, and writes to it have no effect.
+    set_region(0xC8000000, 0xE7FFFFFF, REGION_NONEXISTENT);
+    
+    // :SA-1110 Developer's Manual: Wei 2003-Dec-07:
+    //
+    // Reserved (384 MB)
+    set_region(0xE8000000, 0xFFFFFFFF, REGION_RESERVED);
   }
   
   // :NOTE: Wei 2003-Dec-23:
@@ -49,5 +302,46 @@ namespace ARMware
   // And this automated inline version will cause me have to include the definition of the 
   // class IntController, etc, rather than just forward declaration the class IntController, etc.
   AddressSpace::~AddressSpace()
-  { }
+  { }  
+  //============================== Operation ==================================
+  
+  void
+  AddressSpace::RegisterMemory(Memory * const memory)
+  {
+    mp_memory = memory;
+    
+    // :NOTE: Wei 2004-Apr-24:
+    //
+    // Take an example, say H3600, it has a 32MB dram entity, and a 128MB dram bank0.
+    // Althought StrongARM may issue an physical address between 32MB ~ 128MB
+    // into the physical address bus, the outside dram module may or may not response
+    // a data abort signal to StrongARM.
+    //
+    // Some outside dram module just ignore several most significent digits for simplicitly,
+    // so that when StrongARM issue an physical address between 32MB ~ 128MB,
+    // the outside dram module will make it access to the 0 ~ 32MB memory space.
+    set_host(0xC0000000, 0xC7FFFFFF, mp_memory->get_memory_buffer(), MachineType::DRAM_SIZE);
+  }
+  
+  void
+  AddressSpace::RegisterRomFile(RomFile * const romFile)
+  {
+    mpRomFile = romFile;
+    
+    mpRomFile->register_address_space(this);
+    
+    update_rom_region();
+  }
+  
+  void
+  AddressSpace::update_rom_region()
+  {
+#if LOAD_ROM_INTO_MEMORY
+    set_host(0x00000000, 0x00FFFFFF, mpRomFile->read_array_data(), MachineType::FLASH_SIZE - 1);
+#endif
+    
+    // The host addresses of the flash ROM kept outside (see Core::fetch_inst())
+    // are stale now.
+    mp_core->invalidate_translation();
+  }
 }
@@ -45,14 +45,87 @@ namespace ARMware
   class LCDController;
   class OsTimer;
   
+  // The physical address space is decoded through a region table of
+  // REGION_SIZE slots, which is built once in the constructor from the
+  // SA-1110 memory map, rather than through a switch on every access.
+  //
+  // A slot of m_host_table is the host address of the slot, when the slot
+  // can be loaded from directly (DRAM, and the flash ROM in the read array
+  // mode), otherwise 0. A slot of m_region_table points to the Region which
+  // owns the slot, and the other accesses are dispatched through the
+  // handlers of it.
   typedef class AddressSpace AddressSpace;
   class AddressSpace
   {
   private:
     
+    enum RegionEnum
+    {
+      // :SA-1110 Developer's Manual: Wei 2003-Dec-07:
+      //
+      // Reads from nonexistent memory are not detected in hardware.
+      // In case no memory is selected on a read,
+      // the value last driven on the data bus is returned.
+      //
+      // Writes to nonexistent memory are not detected in hardware.
+      REGION_NONEXISTENT,
+      
+      // :SA-1110 Developer's Manual: p.124: Wei 2003-Dec-07
+      //
+      // Reads from reserved address locations will result in a data abort exception.
+      // Writes to reserved address space will have no effect.
+      REGION_RESERVED,
+      
+      // Not emulated yet.
+      REGION_UNKNOWN,
+      
+      REGION_ROM,
+      REGION_DRAM,
+      REGION_EGPIO,
+      REGION_SERIAL_1,
+      REGION_SERIAL_2,
+      REGION_SERIAL_3,
+      REGION_OS_TIMER,
+      REGION_RTC,
+      REGION_POWER_MANAGER,
+      REGION_RESET_CONTROLLER,
+      REGION_GPIO_CONTROL_BLOCK,
+      REGION_INT_CONTROLLER,
+      REGION_PPC,
+      REGION_MEMORY_CONF,
+      REGION_LCD_CONTROLLER,
+      
+      REGION_TOTAL
+    };
+    typedef enum RegionEnum RegionEnum;
+    
+    // One handler for each access width (see width_index()), the value is
+    // passed in uint32_t whatever the width is.
+    static uint32_t const WIDTH_COUNT = 3;
+    
+    typedef uint32_t (FASTCALL *GetHandler)(AddressSpace const * const self,
+                                            uint32_t const address,
+                                            bool &exception_occur);
+    typedef void (FASTCALL *PutHandler)(AddressSpace * const self,
+                                        uint32_t const address,
+                                        uint32_t const value);
+    
+    struct Region
+    {
+      GetHandler m_get[WIDTH_COUNT];
+      PutHandler m_put[WIDTH_COUNT];
+    };
+    typedef struct Region Region;
+    
+    // 64 KB is the finest granularity at which the SA-1110 decodes its
+    // peripheral registers.
+    static uint32_t const REGION_SHIFT = 16;
+    static uint32_t const REGION_SIZE = (1 << REGION_SHIFT);
+    static uint32_t const REGION_COUNT = (1 << (32 - REGION_SHIFT));
+    
     // Attribute
     
-    Core              * const mp_core; // used for ENABLE_INST_RECALL
+    Core              * const mp_core; // used for ENABLE_INST_RECALL, MmioProfiler & update_rom_region()
     IntController     *mp_int_controller;
     GPIOControlBlock  *mp_GPIO_control_block;
     Serial_1          *mpSerial_1;
@@ -69,6 +142,76 @@ namespace ARMware
     LCDController     *mpLCDController;
     OsTimer           * const mpOsTimer;
     
+    uint8_t const *m_host_table[REGION_COUNT];
+    Region const *m_region_table[REGION_COUNT];
+    
+    Region m_regions[REGION_TOTAL];
+    
+    // Operation
+    
+    void set_handler(RegionEnum const region, GetHandler const get, PutHandler const put);
+    
+    template<typename T_pointer, T_pointer AddressSpace::*T_device>
+    void set_device(RegionEnum const region);
+    
+    void set_region(uint32_t const first, uint32_t const last, RegionEnum const region);
+    void set_host(uint32_t const first, uint32_t const last, uint8_t const * const host, uint32_t const mask);
+    
+    template<typename T_return>
+    T_return FASTCALL get_device_data(uint32_t const address, bool &exception_occur) const;
+    
+    template<typename T_store>
+    void FASTCALL put_device_data(uint32_t const address, T_store const value);
+    
+    // Handlers
+    
+    template<typename T_pointer, T_pointer AddressSpace::*T_device, typename T_return>
+    static uint32_t FASTCALL get_device(AddressSpace const * const self,
+                                        uint32_t const address,
+                                        bool &exception_occur);
+    
+    template<typename T_pointer, T_pointer AddressSpace::*T_device, typename T_store>
+    static void FASTCALL put_device(AddressSpace * const self,
+                                    uint32_t const address,
+                                    uint32_t const value);
+    
+    template<typename T_return>
+    static uint32_t FASTCALL get_dram(AddressSpace const * const self,
+                                      uint32_t const address,
+                                      bool &exception_occur);
+    
+    template<typename T_store>
+    static void FASTCALL put_dram(AddressSpace * const self,
+                                  uint32_t const address,
+                                  uint32_t const value);
+    
+    static uint32_t FASTCALL get_nonexistent(AddressSpace const * const self,
+                                             uint32_t const address,
+                                             bool &exception_occur);
+    
+    static uint32_t FASTCALL get_reserved(AddressSpace const * const self,
+                                          uint32_t const address,
+                                          bool &exception_occur);
+    
+    static uint32_t FASTCALL get_unknown(AddressSpace const * const self,
+                                         uint32_t const address,
+                                         bool &exception_occur);
+    
+    static void FASTCALL put_ignored(AddressSpace * const self,
+                                     uint32_t const address,
+                                     uint32_t const value);
+    
+    static void FASTCALL put_unknown(AddressSpace * const self,
+                                     uint32_t const address,
+                                     uint32_t const value);
+    
+    // Inquery
+    
+    template<typename T_data>
+    static inline uint32_t
+    width_index()
+    { return (sizeof(T_data) >> 1); }
+    
   public:
     
     // Life cycle
@@ -117,9 +260,7 @@ namespace ARMware
     RegisterEgpio(Egpio * const egpio)
     { mpEgpio = egpio; }
     
-    inline void
-    RegisterMemory(Memory * const memory)
-    { mp_memory = memory; }
+    void RegisterMemory(Memory * const memory);
     
     inline void
     RegisterMemoryConf(MemoryConf * const memory_conf)
@@ -133,9 +274,11 @@ namespace ARMware
     RegisterResetController(ResetController * const resetController)
     { mpResetController = resetController; }
     
-    inline void
-    RegisterRomFile(RomFile * const romFile)
-    { mpRomFile = romFile; }
+    void RegisterRomFile(RomFile * const romFile);
+    
+    // Called by RomFile whenever the flash enters or leaves the read array
+    // mode.
+    void update_rom_region();
     
     inline void
     RegisterLCDController(LCDController * const lcdController)
@@ -146,6 +289,23 @@ namespace ARMware
     
     template<typename T_store>
     void FASTCALL put_data(uint32_t const address, T_store const value);
+    
+    // A store to the DRAM offset 'offset' which is known already, for
+    // FastMem.
+    template<typename T_store>
+    void FASTCALL put_dram_data(uint32_t const offset, T_store const value);
+    
+    // Inquery
+    
+    // The host address which 'address' can be loaded from directly,
+    // until update_rom_region() is called. 0 if there is none.
+    inline uint8_t const *
+    host_addr(uint32_t const address) const
+    {
+      uint8_t const * const host = m_host_table[address >> REGION_SHIFT];
+      
+      return ((0 == host) ? 0 : &(host[address & (REGION_SIZE - 1)]));
+    }
   };
 }
 
@@ -28,27 +28,27 @@ namespace ARMware
   //============================= Operation ===================================
   
   void
-  AtmelMicro::get_data_from_serial_port(std::vector<uint8_t> const &fifo)
+  AtmelMicro::get_data_from_serial_port(UartFifo &fifo)
   {
-    for (std::vector<uint8_t>::const_iterator iter = fifo.begin();
-         iter != fifo.end();
-         ++iter)
+    uint8_t ch;
+    
+    while (true == fifo.pop(ch))
     {
       switch (m_get_state)
       {
       case STATE_SOF:
-        assert(SOF == (*iter));
+        assert(SOF == ch);
         
         m_get_state = STATE_ID_LEN;
         break;
         
       case STATE_ID_LEN:
 #if CHECK_AMTEL_CHKSUM
-        m_chk = (*iter);
+        m_chk = ch;
 #endif
         
-        m_id = ((*iter) & 0xF0);
-        m_len = ((*iter) & 0x0F);
+        m_id = (ch & 0xF0);
+        m_len = (ch & 0x0F);
         
         if (0 == m_len)
         {
@@ -62,10 +62,10 @@ namespace ARMware
         
       case STATE_DATA:
 #if CHECK_AMTEL_CHKSUM
-        m_chk += (*iter);
+        m_chk += ch;
 #endif
         
-        m_data[m_read] = (*iter);
+        m_data[m_read] = ch;
         
         ++m_read;
         
@@ -78,7 +78,7 @@ namespace ARMware
         
       case STATE_CHK:
 #if CHECK_AMTEL_CHKSUM
-        assert(m_chk == (*iter));
+        assert(m_chk == ch);
 #endif
         
         switch (m_id)
@@ -157,7 +157,7 @@ namespace ARMware
   }
   
   void
-  AtmelMicro::put_data_to_serial_port(std::deque<uint8_t> &rx_fifo)
+  AtmelMicro::put_data_to_serial_port(UartFifo &rx_fifo)
   {
     if (0 == m_response.size())
     {
@@ -167,7 +167,7 @@ namespace ARMware
     {
       while (m_response.size() != 0)
       {
-        rx_fifo.push_back(m_response.front());
+        rx_fifo.push(m_response.front());
         
         m_response.pop_front();
         
@@ -21,6 +21,7 @@
 #include <deque>
 
 #include "Type.hpp"
+#include "Uart.hpp"
 
 #include "Gtk/MachineScreen.hpp"
 
@@ -218,8 +219,8 @@ namespace ARMware
     
     // Operation
     
-    void get_data_from_serial_port(std::vector<uint8_t> const &fifo);
-    void put_data_to_serial_port(std::deque<uint8_t> &rx_fifo);
+    void get_data_from_serial_port(UartFifo &fifo);
+    void put_data_to_serial_port(UartFifo &rx_fifo);
     
     inline void
     receive_touch_panel_pen_down_event(GdkEventButton const * const event)
@@ -28,6 +28,7 @@
 // * redundany memory operation elimination
 // * algebraic canonicalization
 // * SSA form based linear scan register allocation
+// * direct device register accesses for the constant address loads & stores
 
 // :TODO: Wei 2005-May-24:
 //
@@ -47,6 +48,7 @@
 
 #if ENABLE_DYNAMIC_TRANSLATOR
 #include <algorithm>
+#include <cstring>
 #include <queue>
 #endif
 
@@ -65,6 +67,16 @@
 #include "Compiler/x86/Register.hpp"
 #include "Compiler/x86/MachineDep.hpp"
 #include "Compiler/x86/NativeEmitter.hpp"
+#include "Compiler/JitSymbolExport.hpp"
+#include "Compiler/CodeCache.hpp"
+#include "Compiler/GuestRegTracker.hpp"
+#include "Compiler/MmioSite.hpp"
+#include "MmioProfiler.hpp"
+#include "Global_DT.hpp"
+
+#if PROFILE_DT_COMPILE
+#include "Compiler/CompileProfiler.hpp"
+#endif
 
 #include "Utils/Number.hpp"
 
@@ -361,6 +373,28 @@ namespace ARMware
     // Clean up the threaded code buffer.
     
     clean_tc_buffer();
+    
+#if ENABLE_DYNAMIC_TRANSLATOR
+    // The native codes of this chunk go away with it.
+    if ((ST_DYNAMIC == m_status) &&
+        (false == m_scratch) &&
+        (true == g_jit_symbol_export.is_enabled()))
+    {
+      g_jit_symbol_export.retire(this);
+    }
+    
+    if ((mp_native_code != 0) && (true == g_code_cache.owns(mp_native_code)))
+    {
+      g_code_cache.release(mp_native_code, m_native_code_size);
+    }
+    
+    for (std::vector<MmioSite *>::const_iterator iter = m_mmio_sites.begin();
+         iter != m_mmio_sites.end();
+         ++iter)
+    {
+      delete *iter;
+    }
+#endif
   }
 #endif
 
@@ -558,9 +592,7 @@ namespace ARMware
     
     mp_worklist_bb = 0;
     
-#if PRINT_CHUNK_CODE
     BasicBlock::BB_SEQUENCE_IDX = 0;
-#endif
   }
   
   inline void
@@ -586,17 +618,23 @@ namespace ARMware
   {
     init_dynamic_compiler();
     
+    if (true == MmioSite::is_enabled())
+    {
+      g_guest_reg_tracker.analyze(mp_first_arm_inst_info, m_length, m_start_paddr);
+    }
+    
     do
     {
-#if PRINT_CHUNK_CODE
-      // :NOTE: Wei 2004-Oct-30:
-      //
-      // Print the original ARM codes.
-      g_log_file << std::dec
-                 << m_arm_idx
-                 << ": ";
-      (mp_curr_arm_inst_info->func_PRINT())(mp_curr_arm_inst_info->inst());
-#endif
+      if (true == m_print_code)
+      {
+        // :NOTE: Wei 2004-Oct-30:
+        //
+        // Print the original ARM codes.
+        g_chunk_code_log << std::dec
+                         << m_arm_idx
+                         << ": ";
+        (mp_curr_arm_inst_info->func_PRINT())(mp_curr_arm_inst_info->inst());
+      }
       
 #if CHECK_CHUNK_CODE
       m_finish_setting_cond_block = false;
@@ -757,13 +795,13 @@ namespace ARMware
 #if PRINT_CHUNK_CODE
       if (orig_mir != target_mir)
       {
-        g_log_file << "<opt> eliminate redundant jump: "
-                   << mir->idx()
-                   << ", "
-                   << orig_mir->idx()
-                   << "->"
-                   << target_mir->idx()
-                   << std::endl;
+        g_chunk_code_log << "<opt> eliminate redundant jump: "
+                         << mir->idx()
+                         << ", "
+                         << orig_mir->idx()
+                         << "->"
+                         << target_mir->idx()
+                         << std::endl;
       }
 #endif
       
@@ -982,8 +1020,8 @@ namespace ARMware
           }
           
 #if PRINT_CHUNK_CODE
-          g_log_file << prev_bb->sequence_idx()
-                     << ": ";
+          g_chunk_code_log << prev_bb->sequence_idx()
+                           << ": ";
           
           prev_bb->dump_info();
 #endif
@@ -1326,8 +1364,8 @@ namespace ARMware
 #if PRINT_CHUNK_CODE
     assert(prev_bb != 0);
     
-    g_log_file << prev_bb->sequence_idx()
-               << ": ";
+    g_chunk_code_log << prev_bb->sequence_idx()
+                     << ": ";
     
     prev_bb->dump_info();
 #endif
@@ -2041,35 +2079,35 @@ namespace ARMware
     }
     
 #if PRINT_CHUNK_CODE
-    g_log_file << std::dec
-               << m_vertex[1]->df_number()
-               << "("
-               << m_vertex[1]->sequence_idx()
-               << "): dom: "
-               << m_dominator[1]
-               << ": ";
+    g_chunk_code_log << std::dec
+                     << m_vertex[1]->df_number()
+                     << "("
+                     << m_vertex[1]->sequence_idx()
+                     << "): dom: "
+                     << m_dominator[1]
+                     << ": ";
     
     for (std::vector<BasicBlock *>::const_iterator iter = m_vertex[1]->dominanced_by_me().begin();
          iter != m_vertex[1]->dominanced_by_me().end();
          ++iter)
     {
-      g_log_file << (*iter)->df_number()
-                 << " ";
+      g_chunk_code_log << (*iter)->df_number()
+                       << " ";
     }
     
-    g_log_file << ": ";
+    g_chunk_code_log << ": ";
     
     for (std::vector<BasicBlock::SuccBBInfo>::const_iterator iter = m_vertex[1]->succ_bb().begin();
          iter != m_vertex[1]->succ_bb().end();
          ++iter)
     {
-      g_log_file << (*iter).bb()->df_number()
-                 << "("
-                 << (*iter).bb()->sequence_idx()
-                 << ") ";
+      g_chunk_code_log << (*iter).bb()->df_number()
+                       << "("
+                       << (*iter).bb()->sequence_idx()
+                       << ") ";
     }
     
-    g_log_file << std::endl;
+    g_chunk_code_log << std::endl;
     
     if (m_df_number > 1)
     {
@@ -2082,34 +2120,34 @@ namespace ARMware
       
       while (dominator_iter != m_dominator.end())
       {
-        g_log_file << m_vertex[i]->df_number()
-                   << "("
-                   << m_vertex[i]->sequence_idx()
-                   << "): dom: "
-                   << (*dominator_iter)
-                   << ": ";
+        g_chunk_code_log << m_vertex[i]->df_number()
+                         << "("
+                         << m_vertex[i]->sequence_idx()
+                         << "): dom: "
+                         << (*dominator_iter)
+                         << ": ";
         
         for (std::vector<BasicBlock *>::const_iterator iter = m_vertex[i]->dominanced_by_me().begin();
              iter != m_vertex[i]->dominanced_by_me().end();
              ++iter)
         {
-          g_log_file << (*iter)->df_number()
-                     << " ";
+          g_chunk_code_log << (*iter)->df_number()
+                           << " ";
         }
         
-        g_log_file << ": ";
+        g_chunk_code_log << ": ";
         
         for (std::vector<BasicBlock::SuccBBInfo>::const_iterator iter = m_vertex[i]->succ_bb().begin();
              iter != m_vertex[i]->succ_bb().end();
              ++iter)
         {
-          g_log_file << (*iter).bb()->df_number()
-                     << "("
-                     << (*iter).bb()->sequence_idx()
-                     << ") ";
+          g_chunk_code_log << (*iter).bb()->df_number()
+                           << "("
+                           << (*iter).bb()->sequence_idx()
+                           << ") ";
         }
         
-        g_log_file << std::endl;
+        g_chunk_code_log << std::endl;
         
 #if CHECK_CHUNK_CODE
         assert(((*dominator_iter) <= m_df_number) && ((*dominator_iter) >= 1) && ((*dominator_iter) != i));
@@ -2122,7 +2160,7 @@ namespace ARMware
       }
     }
     
-    g_log_file << std::endl;
+    g_chunk_code_log << std::endl;
 #endif
   }
   
@@ -2298,8 +2336,8 @@ namespace ARMware
         {
           (*iter)->dump_info<false>();
           
-          g_log_file << " lives global, but its iterated dominance frontier is 0."
-                     << std::endl;
+          g_chunk_code_log << " lives global, but its iterated dominance frontier is 0."
+                           << std::endl;
         }
 #endif
         
@@ -2313,11 +2351,11 @@ namespace ARMware
           if (true == ((*bb_iter)->is_var_live_in(*iter)))
           {
 #if PRINT_CHUNK_CODE
-            g_log_file << "Insert phi for ";
+            g_chunk_code_log << "Insert phi for ";
             (*iter)->dump_info<false>();
-            g_log_file << " at "
-                       << (*bb_iter)->sequence_idx();
-            g_log_file << std::endl;
+            g_chunk_code_log << " at "
+                             << (*bb_iter)->sequence_idx();
+            g_chunk_code_log << std::endl;
 #endif
             
             (*bb_iter)->add_phi_node(*iter);
@@ -2326,9 +2364,9 @@ namespace ARMware
           else
           {
             (*iter)->dump_info<false>();
-            g_log_file << " lives global, but it is not live at bb: "
-                       << (*bb_iter)->sequence_idx()
-                       << std::endl;
+            g_chunk_code_log << " lives global, but it is not live at bb: "
+                             << (*bb_iter)->sequence_idx()
+                             << std::endl;
           }
 #endif
         }
@@ -2336,7 +2374,7 @@ namespace ARMware
     }
     
 #if PRINT_CHUNK_CODE
-    g_log_file << std::endl;
+    g_chunk_code_log << std::endl;
 #endif
   }
   
@@ -2583,9 +2621,9 @@ namespace ARMware
       else
       {
 #if PRINT_CHUNK_CODE_MORE_DETAIL
-        g_log_file << "checking live var info for bb: "
-                   << (*iter)->sequence_idx()
-                   << std::endl;
+        g_chunk_code_log << "checking live var info for bb: "
+                         << (*iter)->sequence_idx()
+                         << std::endl;
 #endif
         
         for (uint32_t i = 0; i < var_number; ++i)
@@ -2600,8 +2638,8 @@ namespace ARMware
             
 #if PRINT_CHUNK_CODE_MORE_DETAIL
             m_used_var_table[i]->dump_info<false>();
-            g_log_file << " lives global."
-                       << std::endl;
+            g_chunk_code_log << " lives global."
+                             << std::endl;
 #endif
             
             m_used_var_table[i]->set_live_global();
@@ -2652,7 +2690,6 @@ namespace ARMware
     }
   }
   
-#if PRINT_CHUNK_CODE
   void
   Chunk::dump_mir_info() const
   {
@@ -2676,20 +2713,20 @@ namespace ARMware
     // Dump MIR info.
     curr_mir = mp_mir_head;
     
-    g_log_file << std::endl;
+    g_chunk_code_log << std::endl;
     
     do
     {
-      g_log_file << std::dec
-                << curr_mir->idx()
-                << ": ";
+      g_chunk_code_log << std::dec
+                      << curr_mir->idx()
+                      << ": ";
       curr_mir->dump_info();
       
       curr_mir = curr_mir->next_mir();
     }
     while (curr_mir != 0);
     
-    g_log_file << std::endl;
+    g_chunk_code_log << std::endl;
   }
     
   void
@@ -2699,15 +2736,13 @@ namespace ARMware
          iter != var->iterated_dominance_frontier().end();
          ++iter)
     {
-      g_log_file << (*iter)->df_number()
-                 << " ";
+      g_chunk_code_log << (*iter)->df_number()
+                       << " ";
     }
     
-    g_log_file << std::endl;
+    g_chunk_code_log << std::endl;
   }
-#endif
   
-#if PRINT_CHUNK_CODE
   template<bool T_ssa_form, bool T_use_global_idx, bool T_print_memory_operation_idx>
   void
   Chunk::print_lir_code() const
@@ -2740,7 +2775,7 @@ namespace ARMware
       {
         m_used_var_table[i]->dump_info<true>();
         
-        g_log_file << " ";
+        g_chunk_code_log << " ";
       }
     }
   }
@@ -2758,23 +2793,22 @@ namespace ARMware
       }
       else
       {
-        g_log_file << (*iter)->sequence_idx()
-                   << std::endl;
+        g_chunk_code_log << (*iter)->sequence_idx()
+                         << std::endl;
         
-        g_log_file << "in: ";
+        g_chunk_code_log << "in: ";
         
         dump_live_var_info_internal((*iter)->in());
         
-        g_log_file << std::endl
-                   << "out: ";
+        g_chunk_code_log << std::endl
+                         << "out: ";
         
         dump_live_var_info_internal((*iter)->out());
         
-        g_log_file << std::endl;
+        g_chunk_code_log << std::endl;
       }
     }
   }
-#endif
   
 #if CHECK_CHUNK_CODE
   void
@@ -2820,22 +2854,22 @@ namespace ARMware
     compute_dominance_frontier(mp_root_bb);
     
 #if PRINT_CHUNK_CODE
-    g_log_file << "====== dominance frontier ======"
-               << std::endl;
+    g_chunk_code_log << "====== dominance frontier ======"
+                     << std::endl;
     
     for (uint32_t i = 1; i <= m_df_number; ++i)
     {
-      g_log_file << i
-                 << "("
-                 << m_vertex[i]->sequence_idx()
-                 << "): ";
+      g_chunk_code_log << i
+                       << "("
+                       << m_vertex[i]->sequence_idx()
+                       << "): ";
       
       m_vertex[i]->dump_dominance_frontier();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
     }
     
-    g_log_file << std::endl;
+    g_chunk_code_log << std::endl;
 #endif
     
     // :NOTE: Wei 2004-Oct-23:
@@ -2865,7 +2899,7 @@ namespace ARMware
     determine_live_global_var();
     
 #if PRINT_CHUNK_CODE
-    g_log_file << std::endl;
+    g_chunk_code_log << std::endl;
 #endif
     
     // :NOTE: Wei 2004-Dec-21:
@@ -3921,11 +3955,11 @@ namespace ARMware
                   }
                   
 #if PRINT_CHUNK_CODE
-                  g_log_file << "Replace redundant SCALAR operation: ";
+                  g_chunk_code_log << "Replace redundant SCALAR operation: ";
                   target_lir->dest().front()->variable()->dump_info<true>();
-                  g_log_file << " -> ";
+                  g_chunk_code_log << " -> ";
                   (*iter)->variable()->dump_info<true>();
-                  g_log_file << std::endl;
+                  g_chunk_code_log << std::endl;
 #endif
                   
                   for (std::vector<OperandKind *>::const_iterator oper_iter = curr_lir->operand().begin();
@@ -4041,7 +4075,7 @@ namespace ARMware
                 if (target_lir != 0)
                 {
 #if PRINT_CHUNK_CODE
-                  g_log_file << "Replace redundant LOAD operation: ";
+                  g_chunk_code_log << "Replace redundant LOAD operation: ";
 #endif
                   
                   switch (target_lir->kind())
@@ -4076,9 +4110,9 @@ namespace ARMware
                   }
                   
 #if PRINT_CHUNK_CODE
-                  g_log_file << " -> ";
+                  g_chunk_code_log << " -> ";
                   curr_lir->dest().front()->variable()->dump_info<true>();
-                  g_log_file << std::endl;
+                  g_chunk_code_log << std::endl;
 #endif
                   
                   curr_lir->set_kind(LIR::MOV_R_2_R);
@@ -4168,9 +4202,9 @@ namespace ARMware
 #endif
                 
 #if PRINT_CHUNK_CODE
-                g_log_file << "Remove STORE operation: ";
+                g_chunk_code_log << "Remove STORE operation: ";
                 curr_lir->operand().front()->variable()->dump_info<true>();
-                g_log_file << std::endl;
+                g_chunk_code_log << std::endl;
 #endif
                 
                 if (curr_lir->prev_lir() != 0)
@@ -4985,9 +5019,9 @@ namespace ARMware
     
 #if PRINT_CHUNK_CODE_MORE_DETAIL
     live2->attached_var()->dump_info<true>();
-    g_log_file << " joins to ";
+    g_chunk_code_log << " joins to ";
     live1->attached_var()->dump_info<true>();
-    g_log_file << std::endl;
+    g_chunk_code_log << std::endl;
 #endif
     
     // x.join <- REP(y)
@@ -5229,7 +5263,7 @@ namespace ARMware
             
 #if PRINT_CHUNK_CODE_MORE_DETAIL
             mp_unhandled_tail->dump_info();
-            g_log_file << std::endl;
+            g_chunk_code_log << std::endl;
 #endif
           }
         }
@@ -5237,8 +5271,8 @@ namespace ARMware
     }
     
 #if PRINT_CHUNK_CODE_MORE_DETAIL
-    g_log_file << "=================="
-               << std::endl;
+    g_chunk_code_log << "=================="
+                     << std::endl;
 #endif
     
     // :NOTE: Wei 2005-Feb-26:
@@ -5273,7 +5307,7 @@ namespace ARMware
 #if PRINT_CHUNK_CODE_MORE_DETAIL
       curr->dump_info();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
 #endif
     }
 #endif
@@ -5339,13 +5373,13 @@ namespace ARMware
       mp_unhandled_head = mp_unhandled_head->next_unhandled();
       
 #if PRINT_CHUNK_CODE_MORE_DETAIL
-      g_log_file << "alloc ";
+      g_chunk_code_log << "alloc ";
       
       cur->dump_info();
       
-      g_log_file << " free=0x"
-                 << std::hex
-                 << free.front();
+      g_chunk_code_log << " free=0x"
+                       << std::hex
+                       << free.front();
 #endif
       
 #if CHECK_CHUNK_CODE
@@ -5486,9 +5520,9 @@ namespace ARMware
       std::vector<uint32_t> f = free;
       
 #if PRINT_CHUNK_CODE_MORE_DETAIL
-      g_log_file << " f=0x"
-                 << std::hex
-                 << f.front();
+      g_chunk_code_log << " f=0x"
+                       << std::hex
+                       << f.front();
 #endif
       
       // :NOTE: Wei 2005-Feb-21:
@@ -5499,7 +5533,7 @@ namespace ARMware
         if (true == (*iter)->overlap(cur))
         {
 #if PRINT_CHUNK_CODE_MORE_DETAIL
-          g_log_file << ", kick(in) ";
+          g_chunk_code_log << ", kick(in) ";
           (*iter)->dump_info();
 #endif
           
@@ -5537,7 +5571,7 @@ namespace ARMware
 #endif
             
 #if PRINT_CHUNK_CODE_MORE_DETAIL
-            g_log_file << ", kick(un) ";
+            g_chunk_code_log << ", kick(un) ";
             unhandled->dump_info();
 #endif
             
@@ -5652,20 +5686,20 @@ namespace ARMware
         assert(cur->attached_var()->access_times() < Register::UNLIMITED_VALUE);
         
 #if PRINT_CHUNK_CODE_MORE_DETAIL
-        g_log_file << ": "
-                   << cur->attached_var()->access_times()
-                   << ": ";
+        g_chunk_code_log << ": "
+                         << cur->attached_var()->access_times()
+                         << ": ";
         
         for (std::vector<Register::RegisterWeight>::const_iterator weight_iter = weight.begin();
              weight_iter != weight.end();
              ++weight_iter)
         {
-          g_log_file << " ";
+          g_chunk_code_log << " ";
           (*weight_iter).dump_info();
-          g_log_file << " ";
+          g_chunk_code_log << " ";
         }
         
-        g_log_file.flush();
+        g_chunk_code_log.flush();
 #endif
         
         if (cur->attached_var()->access_times() < weight.front().m_weight)
@@ -5675,7 +5709,7 @@ namespace ARMware
           //   assign a memory location to cur and move cur to handled
           
 #if PRINT_CHUNK_CODE_MORE_DETAIL
-          g_log_file << " -> mem";
+          g_chunk_code_log << " -> mem";
 #endif
           
           assert(0 == cur->preallocated_reg());
@@ -5754,7 +5788,7 @@ namespace ARMware
           assert(cur->preallocated_reg() != 0);
           
 #if PRINT_CHUNK_CODE_MORE_DETAIL
-          g_log_file << " -> scratch others";
+          g_chunk_code_log << " -> scratch others";
           cur->preallocated_reg()->dump_info();
 #endif
           
@@ -5781,7 +5815,7 @@ namespace ARMware
         }
         
 #if PRINT_CHUNK_CODE_MORE_DETAIL
-        g_log_file << " -> ";
+        g_chunk_code_log << " -> ";
         cur->preallocated_reg()->dump_info();
 #endif
         
@@ -5793,7 +5827,7 @@ namespace ARMware
       }
       
 #if PRINT_CHUNK_CODE_MORE_DETAIL
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
 #endif
       
 #if CHECK_CHUNK_CODE
@@ -5837,6 +5871,46 @@ namespace ARMware
     return new_bb;
   }
   
+  // 'inst' is the current ARM instruction, which is a LDR or STR with an
+  // immediate offset and no writeback.
+  //
+  // @0: its base register isn't known to be a constant, so the native codes
+  // should call 'generic' as usual.
+  MmioSite *
+  Chunk::new_mmio_site(Inst const inst, DTFunc_t const generic)
+  {
+    if (false == MmioSite::is_enabled())
+    {
+      return 0;
+    }
+    
+    uint32_t base;
+    
+    if ((CR_PC == static_cast<CoreRegNum>(inst.mImmLSW.mRd)) ||
+        (false == g_guest_reg_tracker.find_value(m_arm_idx,
+                                                 static_cast<CoreRegNum>(inst.mImmLSW.mRn),
+                                                 base)))
+    {
+      return 0;
+    }
+    
+    uint32_t const vaddr = ((inst.mImmLSW.mUbit != 0)
+                            ? (base + inst.mImmLSW.mOff)
+                            : (base - inst.mImmLSW.mOff));
+    
+    // The devices only have word aligned registers.
+    if (vaddr & 3)
+    {
+      return 0;
+    }
+    
+    MmioSite * const site = new MmioSite(inst, reinterpret_cast<MmioSite::GenericFunc>(generic), base);
+    
+    m_mmio_sites.push_back(site);
+    
+    return site;
+  }
+  
   void
   Chunk::check_end_a_cond_block(uint32_t const changed_cond)
   {
@@ -6087,6 +6161,32 @@ namespace ARMware
     gp_core->calculate_average_native_code_buffer_size(m_native_code_buffer.size(), m_length);
   }
   
+  // Moves the native codes into g_code_cache, if it has room. This has to
+  // be done before link_labels(), which patches the branches relative to
+  // where the codes are.
+  void
+  Chunk::place_native_code()
+  {
+    m_native_code_size = m_native_code_buffer.size();
+    
+    // A scratch chunk is never executed.
+    uint8_t * const code = ((true == m_scratch) ? 0 : g_code_cache.allocate(m_native_code_size));
+    
+    if (0 == code)
+    {
+      mp_native_code = &(m_native_code_buffer.front());
+      
+      return;
+    }
+    
+    memcpy(code, &(m_native_code_buffer.front()), m_native_code_size);
+    
+    mp_native_code = code;
+    
+    // Give the memory of the buffer back.
+    std::vector<uint8_t>().swap(m_native_code_buffer);
+  }
+  
   uint32_t
   Chunk::stack_size() const
   {
@@ -6117,10 +6217,10 @@ namespace ARMware
             assert((*iter)->bb()->native_buffer_offset() == (*iter)->bb()->lir_normal_head()->native_buffer_offset());
           }
           
-          assert((*iter)->bb()->native_buffer_offset() < m_native_code_buffer.size());
+          assert((*iter)->bb()->native_buffer_offset() < m_native_code_size);
 #endif
           
-          target_addr = reinterpret_cast<uint32_t>(&(m_native_code_buffer[(*iter)->bb()->native_buffer_offset()]));
+          target_addr = reinterpret_cast<uint32_t>(&(mp_native_code[(*iter)->bb()->native_buffer_offset()]));
           break;
           
         case Label::ROUTINE:
@@ -6156,33 +6256,33 @@ namespace ARMware
           {
           case Label::ABSOLUTE:
 #if PRINT_CHUNK_CODE_MORE_DETAIL
-            g_log_file << "absolute target addr => 0x"
-                       << std::hex
-                       << target_addr
-                       << std::endl;
+            g_chunk_code_log << "absolute target addr => 0x"
+                             << std::hex
+                             << target_addr
+                             << std::endl;
 #endif
             
             real_value = target_addr;
             break;
             
           case Label::RELATIVE_TO_NEXT:
-            assert((*patch_iter).offset() < m_native_code_buffer.size());
-            assert(((*patch_iter).offset() + 4) <= m_native_code_buffer.size());
+            assert((*patch_iter).offset() < m_native_code_size);
+            assert(((*patch_iter).offset() + 4) <= m_native_code_size);
             
 #if PRINT_CHUNK_CODE_MORE_DETAIL
-            g_log_file << "relative target addr => 0x"
-                       << std::hex
-                       << target_addr
-                       << " - 0x"
-                       << reinterpret_cast<uint32_t>((&(m_native_code_buffer[(*patch_iter).offset() + 4])))
-                       << " = 0x";
+            g_chunk_code_log << "relative target addr => 0x"
+                             << std::hex
+                             << target_addr
+                             << " - 0x"
+                             << reinterpret_cast<uint32_t>((&(mp_native_code[(*patch_iter).offset() + 4])))
+                             << " = 0x";
 #endif
             
-            real_value = target_addr - reinterpret_cast<uint32_t>((&(m_native_code_buffer[(*patch_iter).offset() + 4])));
+            real_value = target_addr - reinterpret_cast<uint32_t>((&(mp_native_code[(*patch_iter).offset() + 4])));
             
 #if PRINT_CHUNK_CODE_MORE_DETAIL
-            g_log_file << real_value
-                       << std::endl;
+            g_chunk_code_log << real_value
+                             << std::endl;
 #endif
             break;
             
@@ -6192,20 +6292,20 @@ namespace ARMware
             break;
           }
           
-          assert(((*patch_iter).offset() + 0) < m_native_code_buffer.size());
-          assert(((*patch_iter).offset() + 1) < m_native_code_buffer.size());
-          assert(((*patch_iter).offset() + 2) < m_native_code_buffer.size());
-          assert(((*patch_iter).offset() + 3) < m_native_code_buffer.size());
+          assert(((*patch_iter).offset() + 0) < m_native_code_size);
+          assert(((*patch_iter).offset() + 1) < m_native_code_size);
+          assert(((*patch_iter).offset() + 2) < m_native_code_size);
+          assert(((*patch_iter).offset() + 3) < m_native_code_size);
           
-          assert(0 == m_native_code_buffer[(*patch_iter).offset() + 0]);
-          assert(0 == m_native_code_buffer[(*patch_iter).offset() + 1]);
-          assert(0 == m_native_code_buffer[(*patch_iter).offset() + 2]);
-          assert(0 == m_native_code_buffer[(*patch_iter).offset() + 3]);
+          assert(0 == mp_native_code[(*patch_iter).offset() + 0]);
+          assert(0 == mp_native_code[(*patch_iter).offset() + 1]);
+          assert(0 == mp_native_code[(*patch_iter).offset() + 2]);
+          assert(0 == mp_native_code[(*patch_iter).offset() + 3]);
           
-          m_native_code_buffer[(*patch_iter).offset() + 0] = static_cast<uint8_t>(real_value >> 0);
-          m_native_code_buffer[(*patch_iter).offset() + 1] = static_cast<uint8_t>(real_value >> 8);
-          m_native_code_buffer[(*patch_iter).offset() + 2] = static_cast<uint8_t>(real_value >> 16);
-          m_native_code_buffer[(*patch_iter).offset() + 3] = static_cast<uint8_t>(real_value >> 24);
+          mp_native_code[(*patch_iter).offset() + 0] = static_cast<uint8_t>(real_value >> 0);
+          mp_native_code[(*patch_iter).offset() + 1] = static_cast<uint8_t>(real_value >> 8);
+          mp_native_code[(*patch_iter).offset() + 2] = static_cast<uint8_t>(real_value >> 16);
+          mp_native_code[(*patch_iter).offset() + 3] = static_cast<uint8_t>(real_value >> 24);
         }
       }
 #if CHECK_CHUNK_CODE
@@ -6284,9 +6384,9 @@ namespace ARMware
         else
         {
 #if PRINT_CHUNK_CODE
-          g_log_file << "<opt> dead basic block elimination: "
-                     << (*iter)->sequence_idx()
-                     << std::endl;
+          g_chunk_code_log << "<opt> dead basic block elimination: "
+                           << (*iter)->sequence_idx()
+                           << std::endl;
 #endif
         }
         
@@ -6333,14 +6433,33 @@ namespace ARMware
     
     gp_chunk = this;
     
+#if PROFILE_DT_COMPILE
+    g_compile_profiler.begin_chunk(this);
+    g_compile_profiler.begin_pass();
+#endif
+    
     translate_chunk_to_MIR();
     
-#if PRINT_CHUNK_CODE
-    dump_mir_info();
+#if PROFILE_DT_COMPILE
+    g_compile_profiler.end_pass(CompileProfiler::PASS_TRANSLATE_TO_MIR);
+#endif
+    
+    if (true == m_print_code)
+    {
+      dump_mir_info();
+    }
+    
+#if PROFILE_DT_COMPILE
+    g_compile_profiler.begin_pass();
 #endif
     
     eliminate_redundant_cond_code_calculation_and_link_bb();
     
+#if PROFILE_DT_COMPILE
+    g_compile_profiler.end_pass(CompileProfiler::PASS_ELIMINATE_COND_CODE);
+    g_compile_profiler.begin_pass();
+#endif
+    
     m_LIR_number = 0;
     
     assert(mp_mir_head->bb() == mp_root_bb);
@@ -6379,6 +6498,10 @@ namespace ARMware
     
     mp_root_bb->translate_MIR_to_LIR();
     
+#if PROFILE_DT_COMPILE
+    g_compile_profiler.end_pass(CompileProfiler::PASS_MIR_TO_LIR);
+#endif
+    
 #if CHECK_CHUNK_CODE
     check_bb_link_relationship();
 #endif
@@ -6399,42 +6522,100 @@ namespace ARMware
       mp_root_bb = new_root_bb;
     }
     
+#if PROFILE_DT_COMPILE
+    g_compile_profiler.begin_pass();
+#endif
+    
     convert_to_ssa_form();
     
+#if PROFILE_DT_COMPILE
+    g_compile_profiler.end_pass(CompileProfiler::PASS_CONVERT_TO_SSA);
+    g_compile_profiler.begin_pass();
+#endif
+    
     build_postorder_list(mp_root_bb);
     
     find_scc_component(mp_root_bb);
     
     preform_sccvn();
     
+#if PROFILE_DT_COMPILE
+    g_compile_profiler.end_pass(CompileProfiler::PASS_SCCVN);
+    g_compile_profiler.begin_pass();
+#endif
+    
     AVAIL_analysis();
     
+#if PROFILE_DT_COMPILE
+    g_compile_profiler.end_pass(CompileProfiler::PASS_AVAIL);
+    g_compile_profiler.begin_pass();
+#endif
+    
     fully_static_redundancy_elimination();
     
+#if PROFILE_DT_COMPILE
+    g_compile_profiler.end_pass(CompileProfiler::PASS_FSRE);
+    g_compile_profiler.begin_pass();
+#endif
+    
     linear_scan_register_allocation();
     
+#if PROFILE_DT_COMPILE
+    g_compile_profiler.end_pass(CompileProfiler::PASS_LINEAR_SCAN);
+#endif
+    
 #if CHECK_CHUNK_CODE
     check_bb_link_relationship();
 #endif
     
-#if PRINT_CHUNK_CODE
-    print_lir_code<true, true, false>();
-#endif
+    if (true == m_print_code)
+    {
+      print_lir_code<true, true, false>();
+    }
     
     // :NOTE: Wei 2004-Dec-24:
     //
     // last stage: emit native codes.
     
+#if PROFILE_DT_COMPILE
+    g_compile_profiler.begin_pass();
+#endif
+    
     emit_native_code(mp_root_bb);
+    place_native_code();
+    
+#if PROFILE_DT_COMPILE
+    g_compile_profiler.end_pass(CompileProfiler::PASS_EMIT_NATIVE_CODE);
+    g_compile_profiler.begin_pass();
+#endif
     
     link_labels();
     
+#if PROFILE_DT_COMPILE
+    g_compile_profiler.end_pass(CompileProfiler::PASS_LINK_LABELS);
+#endif
+    
+    if ((false == m_scratch) && (true == g_jit_symbol_export.is_enabled()))
+    {
+      g_jit_symbol_export.publish(this);
+    }
+    
 #if CHECK_CHUNK_CODE
     check_all_used_labels_linked();
 #endif
     
+#if PROFILE_DT_COMPILE
+    g_compile_profiler.record_products(this);
+    g_compile_profiler.begin_pass();
+#endif
+    
     cleanup_compiler_intermedia_product();
     
+#if PROFILE_DT_COMPILE
+    g_compile_profiler.end_pass(CompileProfiler::PASS_CLEANUP);
+    g_compile_profiler.end_chunk(this);
+#endif
+    
 #if CHECK_CHUNK_CODE
     BasicBlock::check_delete_all_into_memory_pool();
     DAGNode::check_delete_all_into_memory_pool();
@@ -6507,5 +6688,26 @@ namespace ARMware
                                               find_const_var(4),
                                               find_global_var(Variable::CR_PC)));
   }
+  
+  // The PC of a dynamic translated chunk isn't up to date in the middle of
+  // the chunk, thus when the MMIO profiler is on, a memory instruction tells
+  // the core its index in the chunk before it accesses the memory, so that
+  // the profiler can get its address from Core::access_pc().
+  void
+  Chunk::record_access_idx_DT()
+  {
+    if (true == g_mmio_profiler.is_enabled())
+    {
+      Label * const routine_label =
+        add_new_label(new Label(static_cast<LabelRoutine *>(0),
+                                reinterpret_cast<DTFunc_t>(set_access_idx_DT)));
+      
+      append_mir<MIR_FOR_NORMAL>(new MIR(static_cast<MIRCall_1 *>(0),
+                                         routine_label,
+                                         find_const_var(m_arm_idx)));
+      
+      append_mir<MIR_FOR_NORMAL>(new MIR(static_cast<MIRRetrieve *>(0), 1, 0));
+    }
+  }
 #endif // #if ENABLE_DYNAMIC_TRANSLATOR
 }
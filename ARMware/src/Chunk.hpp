@@ -20,13 +20,14 @@
 
 #if ENABLE_THREADED_CODE || ENABLE_DYNAMIC_TRANSLATOR
 
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
 #include <iostream>
 #endif
 
 #include "MemoryPool.hpp"
 #include "ARMInstInfo.hpp"
 #include "HashTable.hpp"
+#include "RuntimeStats.hpp"
 
 #if ENABLE_DYNAMIC_TRANSLATOR
 #include <vector>
@@ -43,6 +44,7 @@ namespace ARMware
   class MIR;
   class ConditionBlock;
   class Tuple;
+  class MmioSite;
   
   typedef class Chunk Chunk;
   class Chunk : public MemoryPool<Chunk, 128>
@@ -129,9 +131,7 @@ namespace ARMware
     // to implement this temp variable table, rather than STL's container.
     uint32_t m_temp_var_number;
     
-#if PRINT_CHUNK_CODE
     uint32_t m_temp_var_sequence_number;
-#endif
     
     HashTable<Variable> m_const_table;
     
@@ -185,6 +185,9 @@ namespace ARMware
     
     std::vector<uint8_t> m_native_code_buffer;
     
+    // Used by the native codes, thus they live as long as this chunk.
+    std::vector<MmioSite *> m_mmio_sites;
+    
     // :NOTE: Wei 2004-Oct-19:
     //
     // This is the ROOT node of the Depth-First Search spanning tree among all basic blocks.
@@ -229,6 +232,26 @@ namespace ARMware
     BasicBlock *mp_postorder_bb_tail;
     
     uint32_t m_scc_dfs_num;
+    
+    // Where the native codes are executed from: a block of g_code_cache,
+    // or m_native_code_buffer itself when there is none.
+    uint8_t *mp_native_code;
+    uint32_t m_native_code_size;
+    
+    // The number of ARM instructions executed in the native codes,
+    // used by ChunkInspector to find the hot chunks.
+    uint64_t m_exec_inst_number;
+    
+    // A scratch chunk is compiled only to look at its intermediate
+    // products (ChunkInspector & the chunk corpus replay), and is never
+    // executed, thus its native codes are not exported.
+    bool m_scratch;
+    
+    // Print the ARM codes, the MIR & the LIR with the register assignments
+    // into g_chunk_code_log while compiling. Always on in PRINT_CHUNK_CODE
+    // builds, otherwise only ChunkInspector turns it on for its scratch chunks.
+    bool m_print_code;
+    
     std::vector<BasicBlock *> m_scc_stack;
     
   public:
@@ -319,7 +342,6 @@ namespace ARMware
     void check_live_interval_and_lir_idx(LIR * const curr_lir, Variable * const var);
 #endif
     
-#if PRINT_CHUNK_CODE
     void dump_mir_info() const;
     
     template<bool T_ssa_form, bool T_use_global_idx, bool T_print_memory_operation_idx>
@@ -330,7 +352,6 @@ namespace ARMware
     
     void dump_iterated_dominance_frontier_for_var(Variable * const var);
     void dump_iterated_dominance_frontier();
-#endif
     
 #endif // #if ENABLE_DYNAMIC_TRANSLATOR
     
@@ -352,9 +373,7 @@ namespace ARMware
         mp_memory_var_head(0),
         m_memory_operation_number(0),
         m_temp_var_number(0),
-#if PRINT_CHUNK_CODE
         m_temp_var_sequence_number(0),
-#endif
         mp_mir_head(0)
 #if CHECK_CHUNK_CODE
         , m_finish_setting_cond_block(false)
@@ -362,13 +381,24 @@ namespace ARMware
         , mp_unhandled_head(0),
         m_postorder_idx(0),
         mp_postorder_bb_head(0),
-        m_scc_dfs_num(0)
+        m_scc_dfs_num(0),
+        mp_native_code(0),
+        m_native_code_size(0),
+        m_exec_inst_number(0),
+        m_scratch(false),
+#if PRINT_CHUNK_CODE
+        m_print_code(true)
+#else
+        m_print_code(false)
+#endif
 #endif
     {
 #if ENABLE_DYNAMIC_TRANSLATOR
       m_global_var_table.resize(Variable::GLOBAL_VAR_TOTAL);
       m_memory_var_table.resize(Variable::GLOBAL_VAR_TOTAL);
 #endif
+      
+      g_runtime_stats.increase(RuntimeStats::CHUNK_CREATE);
     }
     
     ~Chunk();
@@ -711,6 +741,7 @@ namespace ARMware
     MIR *insert_switch_statement_DT(Variable * const value_var,
                                     Label * const table_base_label);
     MIR *incre_PC_DT();
+    void record_access_idx_DT();
     
     void rename_variable();
 #endif
@@ -803,11 +834,9 @@ namespace ARMware
       
       if (Variable::TEMP == T_type)
       {
-#if PRINT_CHUNK_CODE
         var->set_sequence_idx(m_temp_var_sequence_number);
         
         ++m_temp_var_sequence_number;
-#endif
         
         ++m_temp_var_number;
       }
@@ -917,6 +946,7 @@ namespace ARMware
     
     void emit_native_code_real(BasicBlock * const bb);
     void emit_native_code(BasicBlock * const bb);
+    void place_native_code();
     
     void link_labels();
     
@@ -1065,9 +1095,63 @@ namespace ARMware
       return label;
     }
     
+    MmioSite *new_mmio_site(Inst const inst, DTFunc_t const generic);
+    
     inline uint8_t const *
     native_code_begin() const
-    { return &(m_native_code_buffer.front()); }
+    { return mp_native_code; }
+    
+    inline uint32_t
+    native_code_size() const
+    { return m_native_code_size; }
+    
+    inline void
+    increase_exec_inst_number(uint32_t const number)
+    { m_exec_inst_number += number; }
+    
+    inline uint64_t
+    exec_inst_number() const
+    { return m_exec_inst_number; }
+    
+    inline void
+    set_scratch()
+    { m_scratch = true; }
+    
+    inline void
+    set_print_code()
+    { m_print_code = true; }
+    
+#if PROFILE_DT_COMPILE
+    inline uint32_t
+    mir_number() const
+    { return m_all_mir.size(); }
+    
+    inline uint32_t
+    lir_number() const
+    { return m_all_lir_by_bfs.size(); }
+    
+    inline uint32_t
+    bb_number() const
+    { return m_bb_table.size(); }
+    
+    inline uint32_t
+    var_number() const
+    {
+      uint32_t number = m_temp_var_number;
+      
+      for (Variable *var = mp_global_var_head; var != 0; var = var->next_link_var())
+      {
+        ++number;
+      }
+      
+      for (Variable *var = mp_memory_var_head; var != 0; var = var->next_link_var())
+      {
+        ++number;
+      }
+      
+      return number;
+    }
+#endif
 #endif
   };
   
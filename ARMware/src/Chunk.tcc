@@ -362,8 +362,8 @@ namespace ARMware
     assert(curr_mir != 0);
     
 #if PRINT_CHUNK_CODE
-    g_log_file << "<opt> breaking condition block."
-               << std::endl;
+    g_chunk_code_log << "<opt> breaking condition block."
+                     << std::endl;
 #endif
     
     Label * const label = add_new_label(
@@ -59,6 +59,10 @@ namespace ARMware
     // Thus, I break up the whole memory space into 1kb pages.
     HashTable<Chunk> *mp_chunk_table[TABLE_ENTRY_COUNT];
     
+    // Whether the chunks in each native page have ever been flushed,
+    // used to count the chunks compiled again after a self-modified code.
+    bool m_page_flushed[TABLE_ENTRY_COUNT];
+    
     Core * const mp_core;
     Chunk *mp_curr_chunk;
     
@@ -85,6 +89,7 @@ namespace ARMware
       for (uint32_t i = 0; i < TABLE_ENTRY_COUNT; ++i)
       {
         mp_chunk_table[i] = 0;
+        m_page_flushed[i] = false;
       }
     }
     
@@ -132,6 +137,10 @@ namespace ARMware
       
       assert(table_idx < TABLE_ENTRY_COUNT);
       
+      g_runtime_stats.increase(RuntimeStats::CHUNK_FLUSH);
+      
+      m_page_flushed[table_idx] = true;
+      
       if (mp_chunk_table[table_idx] != 0)
       {
         if (cal_table_idx(mp_curr_chunk->start_paddr()) == table_idx)
@@ -153,6 +162,38 @@ namespace ARMware
         mp_chunk_table[table_idx]->flush_all(excluded_chunk);
       }
     }
+    
+#if ENABLE_DYNAMIC_TRANSLATOR
+    inline void
+    collect_dynamic_chunks(std::vector<Chunk *> &chunks)
+    {
+      for (uint32_t i = 0; i < TABLE_ENTRY_COUNT; ++i)
+      {
+        if (mp_chunk_table[i] != 0)
+        {
+          for (Chunk *chunk = mp_chunk_table[i]->walk_first();
+               chunk != 0;
+               chunk = mp_chunk_table[i]->walk_next())
+          {
+            if (Chunk::ST_DYNAMIC == chunk->status())
+            {
+              chunks.push_back(chunk);
+            }
+          }
+        }
+      }
+    }
+#endif
+    
+    // Inquery
+    
+    inline bool
+    is_page_flushed(uint32_t const paddr) const
+    {
+      assert(cal_table_idx(paddr) < TABLE_ENTRY_COUNT);
+      
+      return m_page_flushed[cal_table_idx(paddr)];
+    }
   };
 }
 #endif // ENABLE_THREADED_CODE
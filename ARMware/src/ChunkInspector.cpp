@@ -0,0 +1,231 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+#if ENABLE_DYNAMIC_TRANSLATOR
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <sstream>
+
+#include "ChunkInspector.hpp"
+#include "Chunk.hpp"
+#include "Log.hpp"
+
+namespace ARMware
+{
+  ChunkInspector g_chunk_inspector;
+  
+  namespace
+  {
+#if LINUX
+    void
+    usr2_handler(int /* signum */)
+    {
+      g_chunk_inspector.request();
+    }
+#endif
+    
+    inline bool
+    hotter_chunk(Chunk const * const a, Chunk const * const b)
+    {
+      return a->exec_inst_number() > b->exec_inst_number();
+    }
+  }
+  
+  ///////////////////////////////// Private ///////////////////////////////////
+  
+  void
+  ChunkInspector::dump_native_code(Chunk const * const chunk)
+  {
+    uint8_t const * const code = chunk->native_code_begin();
+    uint32_t const size = chunk->native_code_size();
+    
+    m_report << "---- x86 codes at 0x" << std::hex << reinterpret_cast<uintptr_t>(code)
+             << ", " << std::dec << size << " bytes ----" << std::endl;
+    
+    m_report << std::hex << std::setfill('0');
+    
+    for (uint32_t i = 0; i < size; ++i)
+    {
+      m_report << std::setw(2) << static_cast<uint32_t>(code[i])
+               << (((15 == (i & 15)) || ((i + 1) == size)) ? '\n' : ' ');
+    }
+    
+    m_report << std::setfill(' ') << std::dec;
+    
+    std::ostringstream bin_path;
+    
+    bin_path << m_output_dir << "/chunk-" << m_report_number
+             << "-" << std::hex << chunk->start_paddr() << ".bin";
+    
+    {
+      std::ofstream bin(bin_path.str().c_str(), std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+      
+      bin.write(reinterpret_cast<char const *>(code), size);
+    }
+    
+#if LINUX
+    std::ostringstream command;
+    
+    command << "objdump -D -b binary -m i386 --adjust-vma=0x"
+            << std::hex << reinterpret_cast<uintptr_t>(code)
+            << " '" << bin_path.str() << "' 2>/dev/null";
+    
+    FILE * const objdump = popen(command.str().c_str(), "r");
+    
+    if (objdump != 0)
+    {
+      char line[256];
+      
+      while (fgets(line, sizeof(line), objdump) != 0)
+      {
+        m_report << line;
+      }
+      
+      pclose(objdump);
+    }
+#endif
+  }
+  
+  ///////////////////////////////// Public ////////////////////////////////////
+  //============================== Life cycle =================================
+  
+  ChunkInspector::ChunkInspector()
+    : m_enable(false),
+      m_requested(0),
+      m_top_number(DEFAULT_TOP_NUMBER),
+      m_report_number(0),
+      mp_saved_code_log_buf(0)
+  { }
+  
+  //============================== Operation ==================================
+  
+  void
+  ChunkInspector::init()
+  {
+    char const * const output_dir = getenv("ARMWARE_CHUNK_INSPECT");
+    
+    if (0 == output_dir)
+    {
+      return;
+    }
+    
+    m_output_dir = output_dir;
+    
+    char const * const top_number = getenv("ARMWARE_CHUNK_INSPECT_TOP");
+    
+    if (top_number != 0)
+    {
+      m_top_number = strtoul(top_number, 0, 10);
+      
+      if (0 == m_top_number)
+      {
+        m_top_number = DEFAULT_TOP_NUMBER;
+      }
+    }
+    
+#if LINUX
+    struct sigaction sa;
+    
+    sa.sa_handler = usr2_handler;
+    sigemptyset(&sa.sa_mask);
+    sa.sa_flags = SA_RESTART;
+    
+    sigaction(SIGUSR2, &sa, 0);
+#endif
+    
+    m_enable = true;
+  }
+  
+  void
+  ChunkInspector::select_hot_chunks(std::vector<Chunk *> &chunks) const
+  {
+    std::sort(chunks.begin(), chunks.end(), hotter_chunk);
+    
+    if (chunks.size() > m_top_number)
+    {
+      chunks.resize(m_top_number);
+    }
+  }
+  
+  // @false: the report can not be created, and the request is dropped.
+  bool
+  ChunkInspector::begin_report()
+  {
+    m_requested = 0;
+    
+    if (false == m_enable)
+    {
+      return false;
+    }
+    
+    ++m_report_number;
+    
+    std::ostringstream path;
+    
+    path << m_output_dir << "/chunks-" << m_report_number << ".txt";
+    
+    m_report.open(path.str().c_str(), std::ios_base::out | std::ios_base::trunc);
+    
+    if (false == m_report.is_open())
+    {
+      g_log_file << "Chunk inspector: can not open " << path.str() << std::endl;
+      return false;
+    }
+    
+    g_log_file << "Chunk inspector: writing " << path.str() << std::endl;
+    
+    return true;
+  }
+  
+  void
+  ChunkInspector::begin_chunk(Chunk const * const chunk)
+  {
+    m_report << "==== chunk 0x" << std::hex << chunk->start_paddr()
+             << ": " << std::dec << chunk->length() << " ARM instructions, "
+             << chunk->exec_inst_number() << " executed ====" << std::endl;
+    
+    // The chunk code printers write into g_chunk_code_log,
+    // temporarily point it to the report.
+    g_chunk_code_log.flush();
+    
+    mp_saved_code_log_buf = g_chunk_code_log.rdbuf(m_report.rdbuf());
+  }
+  
+  void
+  ChunkInspector::end_chunk(Chunk const * const chunk)
+  {
+    g_chunk_code_log.flush();
+    g_chunk_code_log.rdbuf(mp_saved_code_log_buf);
+    
+    dump_native_code(chunk);
+    
+    m_report << std::endl;
+  }
+  
+  void
+  ChunkInspector::end_report()
+  {
+    m_report.close();
+  }
+}
+
+#endif // #if ENABLE_DYNAMIC_TRANSLATOR
@@ -0,0 +1,109 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+#ifndef ChunkInspector_hpp
+#define ChunkInspector_hpp
+
+#if ENABLE_DYNAMIC_TRANSLATOR
+
+#include <csignal>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "Type.hpp"
+
+namespace ARMware
+{
+  class Chunk;
+  
+  // On-demand dump of the hottest dynamic translated chunks.
+  //
+  // ARMWARE_CHUNK_INSPECT=<directory> turns it on, then every SIGUSR2
+  // (Ex: kill -USR2 <pid>) writes <directory>/chunks-<N>.txt, which
+  // contains the top ARMWARE_CHUNK_INSPECT_TOP chunks (10 by default)
+  // ordered by the number of ARM instructions executed in them.
+  //
+  // For each chunk, it contains:
+  //
+  // * the ARM disassembly, the MIR & the optimized LIR with the register
+  //   assignments. The intermediate products are gone once a chunk is
+  //   compiled, thus they are printed by recompiling a scratch copy of
+  //   that chunk with g_chunk_code_log pointed to the report,
+  // * the emitted x86 codes, both in hex and disassembled by objdump
+  //   if it can be found in $PATH. The raw bytes are also kept in
+  //   <directory>/chunk-<N>-<paddr>.bin.
+  //
+  // The dump is done from Core::check_periphery() on the emulation thread,
+  // outside of any chunk.
+  typedef class ChunkInspector ChunkInspector;
+  class ChunkInspector
+  {
+  private:
+    
+    static uint32_t const DEFAULT_TOP_NUMBER = 10;
+    
+    // Attribute
+    
+    bool m_enable;
+    volatile sig_atomic_t m_requested;
+    
+    std::string m_output_dir;
+    uint32_t m_top_number;
+    uint32_t m_report_number;
+    
+    std::ofstream m_report;
+    std::streambuf *mp_saved_code_log_buf;
+    
+    // Operation
+    
+    void dump_native_code(Chunk const * const chunk);
+  
+  public:
+    
+    // Life cycle
+    
+    ChunkInspector();
+    
+    // Operation
+    
+    void init();
+    
+    inline void
+    request()
+    { m_requested = 1; }
+    
+    void select_hot_chunks(std::vector<Chunk *> &chunks) const;
+    
+    bool begin_report();
+    void begin_chunk(Chunk const * const chunk);
+    void end_chunk(Chunk const * const chunk);
+    void end_report();
+    
+    // Inquery
+    
+    inline bool
+    is_requested() const
+    { return (m_requested != 0); }
+  };
+  
+  extern ChunkInspector g_chunk_inspector;
+}
+
+#endif // #if ENABLE_DYNAMIC_TRANSLATOR
+
+#endif
@@ -88,25 +88,22 @@
 
 namespace ARMware
 {
-#if PRINT_CHUNK_CODE
   uint32_t BasicBlock::BB_SEQUENCE_IDX = 0;
-#endif
   
   ///////////////////////////////// Private ///////////////////////////////////
   //============================== Operation ==================================
   
-#if PRINT_CHUNK_CODE  
   void
   BasicBlock::dump_dag_tree(DAGNode * const node, uint32_t const level) const
   {
     for (uint32_t i = 0; i < level; ++i)
     {
-      g_log_file << "  ";
+      g_chunk_code_log << "  ";
     }
     
     node->dump_info();
     
-    g_log_file << std::endl;
+    g_chunk_code_log << std::endl;
     
     std::deque<ChildInfo> const &children = node->children();
     
@@ -125,11 +122,10 @@ namespace ARMware
          iter != m_dominance_frontier.end();
          ++iter)
     {
-      g_log_file << (*iter)->sequence_idx()
-                 << " ";
+      g_chunk_code_log << (*iter)->sequence_idx()
+                       << " ";
     }
   }
-#endif
   
   inline DAGNode *
   BasicBlock::find_var_dag_node(Variable * const var)
@@ -477,9 +473,9 @@ namespace ARMware
               gp_chunk->find_const_var(~(child_info.peek_first_usable_attached_var()->const_num()));
             
 #if PRINT_CHUNK_CODE
-            g_log_file << "constant folding: ";
+            g_chunk_code_log << "constant folding: ";
             node->dump_info();
-            g_log_file << std::endl;
+            g_chunk_code_log << std::endl;
 #endif
             
             // :NOTE: Wei 2005-Apr-15:
@@ -1080,9 +1076,7 @@ namespace ARMware
     assert(mp_mir_head != 0);
     assert(0 == mp_mir_tail->next_mir());
     
-#if PRINT_CHUNK_CODE || CHECK_CHUNK_CODE
     DAGNode::reset_static_sequence_idx();
-#endif
     
     for (MIR *curr_mir = mp_mir_head;
          curr_mir != 0;
@@ -1650,9 +1644,9 @@ namespace ARMware
   BasicBlock::check_ssa_form()
   {
 #if PRINT_CHUNK_CODE
-    g_log_file << "SSA checking... "
-               << m_sequence_idx
-               << std::endl;
+    g_chunk_code_log << "SSA checking... "
+                     << m_sequence_idx
+                     << std::endl;
 #endif
     
     for (LIR *curr_lir = mp_lir_head;
@@ -1664,7 +1658,6 @@ namespace ARMware
   }
 #endif
   
-#if PRINT_CHUNK_CODE  
   uint32_t
   BasicBlock::start_inst_idx() const
   {
@@ -1674,21 +1667,20 @@ namespace ARMware
   void
   BasicBlock::dump_info() const
   {
-    g_log_file << "start inst index: "
-               << std::dec
-               << mp_mir_head->idx();
+    g_chunk_code_log << "start inst index: "
+                     << std::dec
+                     << mp_mir_head->idx();
     
     for (std::vector<SuccBBInfo>::const_iterator iter = m_succ_bb.begin();
          iter != m_succ_bb.end();
          ++iter)
     {
-      g_log_file << ", "
-                 << (*iter).bb()->start_inst_idx();
+      g_chunk_code_log << ", "
+                       << (*iter).bb()->start_inst_idx();
     }
     
-    g_log_file << std::endl;
+    g_chunk_code_log << std::endl;
   }
-#endif
 }
 
 #endif
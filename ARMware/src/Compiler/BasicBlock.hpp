@@ -205,9 +205,7 @@ namespace ARMware
     
     uint32_t m_native_buffer_offset;
     
-#if PRINT_CHUNK_CODE
     uint32_t m_sequence_idx;
-#endif
     
 #if CHECK_CHUNK_CODE
     bool m_already_check_ssa_form;
@@ -349,9 +347,7 @@ namespace ARMware
     void relink_possible_added_bb();
     void translate_MIR_to_LIR_internal();
     
-#if PRINT_CHUNK_CODE
     void dump_dag_tree(DAGNode * const node, uint32_t const level) const;
-#endif
     
 #if CHECK_CHUNK_CODE || PRINT_CHUNK_CODE
     template<CheckAncestorNumberTiming T_timing>
@@ -360,9 +356,7 @@ namespace ARMware
     
   public:
     
-#if PRINT_CHUNK_CODE
     static uint32_t BB_SEQUENCE_IDX;
-#endif
     
     // Life cycle
     
@@ -397,9 +391,7 @@ namespace ARMware
 #endif
         mp_next_scc_bb(0),
         m_in_worklist(false)
-#if PRINT_CHUNK_CODE
       , m_sequence_idx(BB_SEQUENCE_IDX++)
-#endif
 #if CHECK_CHUNK_CODE
       , m_already_check_ssa_form(false)
 #endif
@@ -605,13 +597,11 @@ namespace ARMware
     void check_label_linked() const;
 #endif
     
-#if PRINT_CHUNK_CODE
     template<bool T_ssa_enabled, bool T_use_global_idx, bool T_print_memory_operation_idx>
     void dump_lir_info() const;
     
     void dump_info() const;
     void dump_dominance_frontier();
-#endif
     
     // Access
     
@@ -740,11 +730,9 @@ namespace ARMware
     set_scc_low_num(uint32_t const num)
     { m_scc_low_num = num; }
     
-#if PRINT_CHUNK_CODE
     inline void
     set_sequence_idx(uint32_t const sequence_idx)
     { m_sequence_idx = sequence_idx; }
-#endif
     
 #if CHECK_CHUNK_CODE
     inline void
@@ -861,13 +849,11 @@ namespace ARMware
     void check_ssa_form();
 #endif
     
-#if PRINT_CHUNK_CODE
     inline uint32_t
     sequence_idx() const
     { return m_sequence_idx; }
     
     uint32_t start_inst_idx() const;
-#endif
     
 #if CHECK_CHUNK_CODE
     inline bool
@@ -231,9 +231,9 @@ namespace ARMware
     assert(true == node->is_usable());
     
 #if PRINT_CHUNK_CODE
-    g_log_file << "remove dead node: ";
+    g_chunk_code_log << "remove dead node: ";
     node->dump_info();
-    g_log_file << std::endl;
+    g_chunk_code_log << std::endl;
 #endif
     
     node->cleanup_attached_var();
@@ -329,31 +329,30 @@ namespace ARMware
     return lir;
   }
   
-#if PRINT_CHUNK_CODE
   template<bool T_ssa_enabled, bool T_use_global_idx, bool T_print_memory_operation_idx>
   void
   BasicBlock::dump_lir_info() const
   {
     if (true == T_ssa_enabled)
     {
-      g_log_file << std::dec
-                 << m_sequence_idx
-                 << ": ";
+      g_chunk_code_log << std::dec
+                       << m_sequence_idx
+                       << ": ";
       
       for (std::vector<SuccBBInfo>::const_iterator iter = m_succ_bb.begin();
            iter != m_succ_bb.end();
            ++iter)
       {
-        g_log_file << (*iter).bb()->sequence_idx()
-                   << " ";
+        g_chunk_code_log << (*iter).bb()->sequence_idx()
+                         << " ";
       }
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
     }
     else
     {
-      g_log_file << "--- LIR codes ---"
-                 << std::endl;
+      g_chunk_code_log << "--- LIR codes ---"
+                       << std::endl;
     }
     
     assert(mp_lir_head != 0);
@@ -363,18 +362,18 @@ namespace ARMware
     
     do
     {
-      g_log_file << std::dec;
+      g_chunk_code_log << std::dec;
       
       if (false == T_use_global_idx)
       {
-        g_log_file << inst_idx;
+        g_chunk_code_log << inst_idx;
       }
       else
       {
-        g_log_file << curr_lir->idx();
+        g_chunk_code_log << curr_lir->idx();
       }
       
-      g_log_file << ": ";
+      g_chunk_code_log << ": ";
       
       curr_lir->dump_info<T_ssa_enabled, T_print_memory_operation_idx>();
       
@@ -384,9 +383,8 @@ namespace ARMware
     }
     while (curr_lir != 0);
     
-    g_log_file << std::endl;
+    g_chunk_code_log << std::endl;
   }
-#endif
 }
 
 #endif
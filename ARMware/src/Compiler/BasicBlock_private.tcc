@@ -68,13 +68,13 @@ namespace ARMware
     switch (T_timing)
     {
     case BEFORE_DEAD_CODE_ELIMINATION:
-      g_log_file << "--- before dead code elimination ---"
-                 << std::endl;
+      g_chunk_code_log << "--- before dead code elimination ---"
+                       << std::endl;
       break;
       
     case AFTER_CONSTANT_FOLDING:
-      g_log_file << "--- after constant folding ---"
-                 << std::endl;
+      g_chunk_code_log << "--- after constant folding ---"
+                       << std::endl;
       break;
       
     default:
@@ -97,7 +97,7 @@ namespace ARMware
     }
     
 #if PRINT_CHUNK_CODE
-    g_log_file << std::endl;
+    g_chunk_code_log << std::endl;
 #endif
   }
 #endif
@@ -145,9 +145,9 @@ namespace ARMware
                                  child_1.peek_first_usable_attached_var()->const_num()));
     
 #if PRINT_CHUNK_CODE
-    g_log_file << "constant folding (process 2 constant var): ";
+    g_chunk_code_log << "constant folding (process 2 constant var): ";
     node->dump_info();
-    g_log_file << std::endl;
+    g_chunk_code_log << std::endl;
 #endif
     
     if (NEED_MOVE == determine_constant_folding_type(node))
@@ -211,9 +211,9 @@ namespace ARMware
     assert(0 == child_0.node()->global_attached_var_def_cnt());
     
 #if PRINT_CHUNK_CODE
-    g_log_file << "constant folding: ";
+    g_chunk_code_log << "constant folding: ";
     node->dump_info();
-    g_log_file << std::endl;
+    g_chunk_code_log << std::endl;
 #endif
     
     child_1.node()->
@@ -352,9 +352,9 @@ namespace ARMware
                                                      child_1_child_1.peek_first_usable_attached_var()->const_num())));
                       
 #if PRINT_CHUNK_CODE
-                      g_log_file << "constant folding (process 3 constant var): ";
+                      g_chunk_code_log << "constant folding (process 3 constant var): ";
                       node->dump_info();
-                      g_log_file << std::endl;
+                      g_chunk_code_log << std::endl;
 #endif
                       
                       if (NEED_MOVE == determine_constant_folding_type(node))
@@ -435,9 +435,9 @@ namespace ARMware
                   case DAG_AND:
                   case DAG_OR:
 #if PRINT_CHUNK_CODE
-                    g_log_file << "constant folding: ";
+                    g_chunk_code_log << "constant folding: ";
                     node->dump_info();
-                    g_log_file << std::endl;
+                    g_chunk_code_log << std::endl;
 #endif
                     
                     child_0.node()->
@@ -495,9 +495,9 @@ namespace ARMware
                 case DAG_AND:
                 case DAG_OR:
 #if PRINT_CHUNK_CODE
-                  g_log_file << "constant folding: ";
+                  g_chunk_code_log << "constant folding: ";
                   node->dump_info();
-                  g_log_file << std::endl;
+                  g_chunk_code_log << std::endl;
 #endif
                   
                   child_0.node()->
@@ -603,9 +603,9 @@ namespace ARMware
                                                      child_1.peek_first_usable_attached_var()->const_num()));
                         
 #if PRINT_CHUNK_CODE
-                        g_log_file << "constant folding (process 3 constant var): ";
+                        g_chunk_code_log << "constant folding (process 3 constant var): ";
                         node->dump_info();
-                        g_log_file << std::endl;
+                        g_chunk_code_log << std::endl;
 #endif
                         
                         if (NEED_MOVE == determine_constant_folding_type(node))
@@ -686,9 +686,9 @@ namespace ARMware
                       //   |      |
                       // const    x
 #if PRINT_CHUNK_CODE
-                      g_log_file << "constant folding: ";
+                      g_chunk_code_log << "constant folding: ";
                       node->dump_info();
-                      g_log_file << std::endl;
+                      g_chunk_code_log << std::endl;
 #endif
                       
                       child_1.node()->
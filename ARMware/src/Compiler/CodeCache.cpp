@@ -0,0 +1,171 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+#if ENABLE_DYNAMIC_TRANSLATOR
+
+#include <cassert>
+
+#include "CodeCache.hpp"
+
+#include "../Log.hpp"
+
+namespace ARMware
+{
+  CodeCache g_code_cache;
+  
+  ///////////////////////////////// Public ////////////////////////////////////
+  //============================== Life cycle =================================
+  
+  CodeCache::CodeCache()
+    : mp_region(0),
+      m_huge_page(HUGE_PAGE_NONE),
+      m_full_reported(false)
+  { }
+  
+  CodeCache::~CodeCache()
+  {
+    if (mp_region != 0)
+    {
+      memory_release(mp_region, REGION_SIZE, m_huge_page);
+    }
+  }
+  
+  //============================== Operation ==================================
+  
+  void
+  CodeCache::init()
+  {
+    // The chunks of the previous machine are gone with its Core.
+    if (mp_region != 0)
+    {
+      m_free_blocks.clear();
+      m_free_blocks[0] = REGION_SIZE;
+      
+      return;
+    }
+    
+    // The native codes are never write protected, thus the explicit huge
+    // pages can be used as well.
+    m_huge_page = huge_page_setting();
+    
+    mp_region = static_cast<uint8_t *>(memory_allocate(REGION_SIZE, m_huge_page, true));
+    
+    if ((0 == mp_region) && (HUGE_PAGE_EXPLICIT == m_huge_page))
+    {
+      g_log_file << "CodeCache: not enough huge pages reserved (see /proc/sys/vm/nr_hugepages), "
+                 << "use the native pages instead." << std::endl;
+      
+      m_huge_page = HUGE_PAGE_NONE;
+      
+      mp_region = static_cast<uint8_t *>(memory_allocate(REGION_SIZE, m_huge_page, true));
+    }
+    
+    if (0 == mp_region)
+    {
+      g_log_file << "CodeCache: can not allocate the code cache, "
+                 << "the native codes stay in the buffers of the chunks." << std::endl;
+      
+      return;
+    }
+    
+    m_free_blocks[0] = REGION_SIZE;
+  }
+  
+  uint8_t *
+  CodeCache::allocate(uint32_t const size)
+  {
+    if (0 == mp_region)
+    {
+      return 0;
+    }
+    
+    uint32_t const needed = aligned_size(size);
+    
+    // First fit.
+    for (std::map<uint32_t, uint32_t>::iterator iter = m_free_blocks.begin();
+         iter != m_free_blocks.end();
+         ++iter)
+    {
+      if (iter->second >= needed)
+      {
+        uint32_t const offset = iter->first;
+        uint32_t const remain = iter->second - needed;
+        
+        m_free_blocks.erase(iter);
+        
+        if (remain != 0)
+        {
+          m_free_blocks[offset + needed] = remain;
+        }
+        
+        return &(mp_region[offset]);
+      }
+    }
+    
+    if (false == m_full_reported)
+    {
+      g_log_file << "CodeCache: the code cache is full, "
+                 << "the native codes of the new chunks stay in their own buffers." << std::endl;
+      
+      m_full_reported = true;
+    }
+    
+    return 0;
+  }
+  
+  void
+  CodeCache::release(uint8_t * const code, uint32_t const size)
+  {
+    assert(true == owns(code));
+    
+    uint32_t const offset = (code - mp_region);
+    uint32_t released = aligned_size(size);
+    
+    // Merge with the following free block.
+    std::map<uint32_t, uint32_t>::iterator next = m_free_blocks.lower_bound(offset);
+    
+    assert((m_free_blocks.end() == next) || (next->first >= (offset + released)));
+    
+    if ((next != m_free_blocks.end()) && ((offset + released) == next->first))
+    {
+      released += next->second;
+      
+      m_free_blocks.erase(next);
+    }
+    
+    // Merge with the preceding free block.
+    std::map<uint32_t, uint32_t>::iterator prev = m_free_blocks.lower_bound(offset);
+    
+    if (prev != m_free_blocks.begin())
+    {
+      --prev;
+      
+      assert((prev->first + prev->second) <= offset);
+      
+      if ((prev->first + prev->second) == offset)
+      {
+        prev->second += released;
+        
+        return;
+      }
+    }
+    
+    m_free_blocks[offset] = released;
+  }
+}
+
+#endif // #if ENABLE_DYNAMIC_TRANSLATOR
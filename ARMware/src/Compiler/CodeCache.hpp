@@ -0,0 +1,97 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+#ifndef CodeCache_hpp
+#define CodeCache_hpp
+
+#if ENABLE_DYNAMIC_TRANSLATOR
+
+#include <map>
+
+#include "../Type.hpp"
+#include "../platform_dep.hpp"
+
+namespace ARMware
+{
+  // One executable region which holds the native codes of all the dynamic
+  // translated chunks, rather than a heap block per chunk, so that it can
+  // be backed by the host huge pages (ARMWARE_HUGE_PAGES, see
+  // huge_page_setting()) and the hot chunks share a few host iTLB entries.
+  //
+  // A chunk copies its native codes here before linking its labels (the
+  // relative branches depend on where the codes are), and gives the block
+  // back when it is destroyed. The free blocks are kept by their offsets,
+  // and the neighbouring ones are merged.
+  //
+  // When the region is full, or it is not initialized (the chunk corpus
+  // replay), allocate() returns 0, and the chunk executes its codes from
+  // its own buffer as before.
+  typedef class CodeCache CodeCache;
+  class CodeCache
+  {
+  private:
+    
+    static uint32_t const REGION_SIZE = 16 * 1024 * 1024;
+    static uint32_t const ALIGNMENT = 16;
+    
+    // Attribute
+    
+    uint8_t *mp_region;
+    HugePageEnum m_huge_page;
+    
+    // offset => size
+    std::map<uint32_t, uint32_t> m_free_blocks;
+    
+    bool m_full_reported;
+    
+    // Inquery
+    
+    static inline uint32_t
+    aligned_size(uint32_t const size)
+    { return ((size + (ALIGNMENT - 1)) & ~(ALIGNMENT - 1)); }
+    
+  public:
+    
+    // Life cycle
+    
+    CodeCache();
+    ~CodeCache();
+    
+    // Operation
+    
+    void init();
+    
+    uint8_t *allocate(uint32_t const size);
+    void release(uint8_t * const code, uint32_t const size);
+    
+    // Inquery
+    
+    inline bool
+    owns(uint8_t const * const code) const
+    {
+      return ((mp_region != 0) &&
+              (code >= mp_region) &&
+              (code < (mp_region + REGION_SIZE)));
+    }
+  };
+  
+  extern CodeCache g_code_cache;
+}
+
+#endif // #if ENABLE_DYNAMIC_TRANSLATOR
+
+#endif
@@ -0,0 +1,299 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+#if ENABLE_DYNAMIC_TRANSLATOR && PROFILE_DT_COMPILE
+
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+#include "CompileProfiler.hpp"
+
+#include "../Chunk.hpp"
+#include "../Log.hpp"
+
+namespace ARMware
+{
+  CompileProfiler g_compile_profiler;
+  
+  namespace
+  {
+    char const * const PASS_NAME[CompileProfiler::PASS_TOTAL] =
+    {
+      "MIR",
+      "CondCode",
+      "LIR",
+      "SSA",
+      "SCCVN",
+      "AVAIL",
+      "FSRE",
+      "LinearScan",
+      "Emit",
+      "Link",
+      "Cleanup"
+    };
+  }
+  
+  ///////////////////////////////// Private ///////////////////////////////////
+  
+  void
+  CompileProfiler::capture_chunk(Chunk const * const chunk)
+  {
+    // One chunk per line:
+    //
+    // <start paddr> <length> <ARM instruction 0> <ARM instruction 1> ...
+    //
+    // The addresses and the instructions are in hex, the length is in decimal.
+    m_corpus_file << std::hex << chunk->start_paddr()
+                  << ' ' << std::dec << chunk->length()
+                  << std::hex;
+    
+    for (uint32_t i = 0; i < chunk->length(); ++i)
+    {
+      m_corpus_file << ' ' << chunk->peek_arm_inst_info(i)->inst().mRawData;
+    }
+    
+    m_corpus_file << std::dec << std::endl;
+  }
+  
+  // One row per length bucket, one column per bin. Only the bins between
+  // the fastest and the slowest chunk of all buckets are printed, and the
+  // label of a column is the lower bound of its bin (2^N cycles).
+  void
+  CompileProfiler::dump_histogram(std::ostream &os, uint32_t const pass) const
+  {
+    uint32_t first_bin = HISTOGRAM_BIN_NUMBER;
+    uint32_t last_bin = 0;
+    
+    for (uint32_t i = 0; i < BUCKET_NUMBER; ++i)
+    {
+      for (uint32_t j = 0; j < HISTOGRAM_BIN_NUMBER; ++j)
+      {
+        if (m_bucket[i].m_histogram[pass][j] != 0)
+        {
+          if (j < first_bin)
+          {
+            first_bin = j;
+          }
+          
+          if (j > last_bin)
+          {
+            last_bin = j;
+          }
+        }
+      }
+    }
+    
+    if (HISTOGRAM_BIN_NUMBER == first_bin)
+    {
+      return;
+    }
+    
+    os << "-- " << ((HISTOGRAM_TOTAL == pass) ? "Total" : PASS_NAME[pass])
+       << " cycles per chunk --" << std::endl;
+    
+    os << "length  ";
+    
+    for (uint32_t j = first_bin; j <= last_bin; ++j)
+    {
+      std::ostringstream label;
+      
+      label << "2^" << j;
+      
+      os << ' ' << std::setw(8) << label.str();
+    }
+    
+    os << std::endl;
+    
+    for (uint32_t i = 0; i < BUCKET_NUMBER; ++i)
+    {
+      Bucket const &bucket = m_bucket[i];
+      
+      if (0 == bucket.m_chunk_number)
+      {
+        continue;
+      }
+      
+      if (i != (BUCKET_NUMBER - 1))
+      {
+        os << std::setw(3) << (i * BUCKET_WIDTH) << '-'
+           << std::setw(3) << (i * BUCKET_WIDTH + BUCKET_WIDTH - 1);
+      }
+      else
+      {
+        os << ">=" << std::setw(3) << (i * BUCKET_WIDTH) << "  ";
+      }
+      
+      os << ' ';
+      
+      for (uint32_t j = first_bin; j <= last_bin; ++j)
+      {
+        os << ' ' << std::setw(8) << bucket.m_histogram[pass][j];
+      }
+      
+      os << std::endl;
+    }
+  }
+  
+  ///////////////////////////////// Public ////////////////////////////////////
+  //============================== Life cycle =================================
+  
+  CompileProfiler::CompileProfiler()
+    : m_pass_start(0),
+      m_curr_mir_number(0),
+      m_curr_lir_number(0),
+      m_curr_bb_number(0),
+      m_curr_var_number(0),
+      m_chunk_number(0),
+      m_capture_corpus(false)
+  {
+    memset(m_bucket, 0, sizeof(m_bucket));
+    memset(m_curr_cycles, 0, sizeof(m_curr_cycles));
+    
+    char const * const corpus_file = getenv("ARMWARE_DT_CAPTURE_CORPUS");
+    
+    if (corpus_file != 0)
+    {
+      m_corpus_file.open(corpus_file, std::ios_base::out | std::ios_base::app);
+      
+      m_capture_corpus = m_corpus_file.is_open();
+    }
+  }
+  
+  //============================== Operation ==================================
+  
+  void
+  CompileProfiler::begin_chunk(Chunk const * const chunk)
+  {
+    memset(m_curr_cycles, 0, sizeof(m_curr_cycles));
+    
+    if (true == m_capture_corpus)
+    {
+      capture_chunk(chunk);
+    }
+  }
+  
+  // The intermediate products are deleted in
+  // Chunk::cleanup_compiler_intermedia_product(), thus their numbers
+  // have to be recorded before that stage.
+  void
+  CompileProfiler::record_products(Chunk const * const chunk)
+  {
+    m_curr_mir_number = chunk->mir_number();
+    m_curr_lir_number = chunk->lir_number();
+    m_curr_bb_number = chunk->bb_number();
+    m_curr_var_number = chunk->var_number();
+  }
+  
+  void
+  CompileProfiler::end_chunk(Chunk const * const chunk)
+  {
+    Bucket &bucket = m_bucket[bucket_idx(chunk->length())];
+    uint64_t total_cycles = 0;
+    
+    for (uint32_t i = 0; i < PASS_TOTAL; ++i)
+    {
+      bucket.m_cycles[i] += m_curr_cycles[i];
+      ++bucket.m_histogram[i][histogram_bin(m_curr_cycles[i])];
+      
+      total_cycles += m_curr_cycles[i];
+    }
+    
+    ++bucket.m_histogram[HISTOGRAM_TOTAL][histogram_bin(total_cycles)];
+    
+    if (total_cycles > bucket.m_max_total_cycles)
+    {
+      bucket.m_max_total_cycles = total_cycles;
+    }
+    
+    ++bucket.m_chunk_number;
+    
+    bucket.m_mir_number += m_curr_mir_number;
+    bucket.m_lir_number += m_curr_lir_number;
+    bucket.m_bb_number += m_curr_bb_number;
+    bucket.m_var_number += m_curr_var_number;
+    bucket.m_native_code_size += chunk->native_code_size();
+    
+    ++m_chunk_number;
+    
+    if (0 == (m_chunk_number % DUMP_FREQ))
+    {
+      dump(g_log_file);
+    }
+  }
+  
+  // Every number of the first table is the average per chunk of that
+  // bucket, except the 'max' column which is the slowest chunk of that
+  // bucket. The histograms follow it.
+  void
+  CompileProfiler::dump(std::ostream &os) const
+  {
+    os << "== DT compile profile: " << m_chunk_number << " chunks ==" << std::endl;
+    
+    os << "length   chunks";
+    
+    for (uint32_t i = 0; i < PASS_TOTAL; ++i)
+    {
+      os << ' ' << std::setw(10) << PASS_NAME[i];
+    }
+    
+    os << "        max    MIR    LIR     BB    Var  Bytes" << std::endl;
+    
+    for (uint32_t i = 0; i < BUCKET_NUMBER; ++i)
+    {
+      Bucket const &bucket = m_bucket[i];
+      
+      if (0 == bucket.m_chunk_number)
+      {
+        continue;
+      }
+      
+      if (i != (BUCKET_NUMBER - 1))
+      {
+        os << std::setw(3) << (i * BUCKET_WIDTH) << '-'
+           << std::setw(3) << (i * BUCKET_WIDTH + BUCKET_WIDTH - 1);
+      }
+      else
+      {
+        os << ">=" << std::setw(3) << (i * BUCKET_WIDTH) << "  ";
+      }
+      
+      os << ' ' << std::setw(8) << bucket.m_chunk_number;
+      
+      for (uint32_t j = 0; j < PASS_TOTAL; ++j)
+      {
+        os << ' ' << std::setw(10) << (bucket.m_cycles[j] / bucket.m_chunk_number);
+      }
+      
+      os << ' ' << std::setw(10) << bucket.m_max_total_cycles
+         << ' ' << std::setw(6) << (bucket.m_mir_number / bucket.m_chunk_number)
+         << ' ' << std::setw(6) << (bucket.m_lir_number / bucket.m_chunk_number)
+         << ' ' << std::setw(6) << (bucket.m_bb_number / bucket.m_chunk_number)
+         << ' ' << std::setw(6) << (bucket.m_var_number / bucket.m_chunk_number)
+         << ' ' << std::setw(6) << (bucket.m_native_code_size / bucket.m_chunk_number)
+         << std::endl;
+    }
+    
+    for (uint32_t i = 0; i <= HISTOGRAM_TOTAL; ++i)
+    {
+      dump_histogram(os, i);
+    }
+  }
+}
+
+#endif // #if ENABLE_DYNAMIC_TRANSLATOR && PROFILE_DT_COMPILE
@@ -0,0 +1,183 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+#ifndef CompileProfiler_hpp
+#define CompileProfiler_hpp
+
+#if ENABLE_DYNAMIC_TRANSLATOR && PROFILE_DT_COMPILE
+
+#include <cassert>
+#include <fstream>
+
+#include "../Type.hpp"
+#include "../platform_dep.hpp"
+
+namespace ARMware
+{
+  class Chunk;
+  
+  // Collects the time spent in each stage of Chunk::gen_dt_code(),
+  // grouped by the chunk length (10 ARM instructions per bucket, the same
+  // bucketing as PRINT_CHUNKS_LENGTH), together with the size of the
+  // intermediate products of each chunk.
+  //
+  // Besides the averages, every length bucket keeps a histogram of the
+  // cycles of each pass (and of the whole compilation) per chunk, in power
+  // of 2 bins, so that the slow tail of a pass isn't hidden by its average.
+  //
+  // If the environment variable ARMWARE_DT_CAPTURE_CORPUS is set,
+  // every compiled chunk is also appended into that file, so that the
+  // same chunks can be fed into the compiler again later by
+  // 'armware --replay-chunk-corpus' (see ChunkCorpusReplay).
+  typedef class CompileProfiler CompileProfiler;
+  class CompileProfiler
+  {
+  public:
+    
+    enum PassEnum
+    {
+      PASS_TRANSLATE_TO_MIR,
+      PASS_ELIMINATE_COND_CODE,
+      PASS_MIR_TO_LIR,
+      PASS_CONVERT_TO_SSA,
+      PASS_SCCVN,
+      PASS_AVAIL,
+      PASS_FSRE,
+      PASS_LINEAR_SCAN,
+      PASS_EMIT_NATIVE_CODE,
+      PASS_LINK_LABELS,
+      PASS_CLEANUP,
+      
+      PASS_TOTAL
+    };
+    typedef enum PassEnum PassEnum;
+  
+  private:
+    
+    static uint32_t const BUCKET_WIDTH = 10;
+    
+    // 0~199 in 20 buckets, and the last one for chunks longer than 199.
+    static uint32_t const BUCKET_NUMBER = 21;
+    
+    // Dump the statistics into the log file once every DUMP_FREQ compiled
+    // chunks.
+    static uint32_t const DUMP_FREQ = 1024;
+    
+    // The bin i counts the chunks which took [2^i, 2^(i+1)) cycles, and
+    // the last one counts all the slower chunks.
+    static uint32_t const HISTOGRAM_BIN_NUMBER = 32;
+    
+    // The histogram of the whole compilation follows the ones of the
+    // passes.
+    static uint32_t const HISTOGRAM_TOTAL = PASS_TOTAL;
+    
+    struct Bucket
+    {
+      uint32_t m_chunk_number;
+      
+      uint64_t m_cycles[PASS_TOTAL];
+      uint64_t m_max_total_cycles;
+      
+      uint64_t m_mir_number;
+      uint64_t m_lir_number;
+      uint64_t m_bb_number;
+      uint64_t m_var_number;
+      uint64_t m_native_code_size;
+      
+      uint32_t m_histogram[PASS_TOTAL + 1][HISTOGRAM_BIN_NUMBER];
+    };
+    typedef struct Bucket Bucket;
+    
+    // Attribute
+    
+    Bucket m_bucket[BUCKET_NUMBER];
+    
+    uint64_t m_pass_start;
+    uint64_t m_curr_cycles[PASS_TOTAL];
+    
+    uint32_t m_curr_mir_number;
+    uint32_t m_curr_lir_number;
+    uint32_t m_curr_bb_number;
+    uint32_t m_curr_var_number;
+    
+    uint32_t m_chunk_number;
+    
+    bool m_capture_corpus;
+    std::ofstream m_corpus_file;
+    
+    // Operation
+    
+    inline uint32_t
+    bucket_idx(uint32_t const length) const
+    {
+      uint32_t const idx = length / BUCKET_WIDTH;
+      
+      return (idx < (BUCKET_NUMBER - 1)) ? idx : (BUCKET_NUMBER - 1);
+    }
+    
+    static inline uint32_t
+    histogram_bin(uint64_t cycles)
+    {
+      uint32_t bin = 0;
+      
+      while ((cycles > 1) && (bin < (HISTOGRAM_BIN_NUMBER - 1)))
+      {
+        cycles >>= 1;
+        ++bin;
+      }
+      
+      return bin;
+    }
+    
+    void capture_chunk(Chunk const * const chunk);
+    void dump_histogram(std::ostream &os, uint32_t const pass) const;
+  
+  public:
+    
+    // Life cycle
+    
+    CompileProfiler();
+    
+    // Operation
+    
+    void begin_chunk(Chunk const * const chunk);
+    void record_products(Chunk const * const chunk);
+    void end_chunk(Chunk const * const chunk);
+    
+    inline void
+    begin_pass()
+    {
+      m_pass_start = read_time_stamp_counter();
+    }
+    
+    inline void
+    end_pass(PassEnum const pass)
+    {
+      assert(pass < PASS_TOTAL);
+      
+      m_curr_cycles[pass] += (read_time_stamp_counter() - m_pass_start);
+    }
+    
+    void dump(std::ostream &os) const;
+  };
+  
+  extern CompileProfiler g_compile_profiler;
+}
+
+#endif // #if ENABLE_DYNAMIC_TRANSLATOR && PROFILE_DT_COMPILE
+
+#endif
@@ -34,11 +34,8 @@ namespace ARMware
   /////////////////////////////////////////////////////////////////////////////
   // Private ==================================================================
   
-#if PRINT_CHUNK_CODE || CHECK_CHUNK_CODE
   uint32_t DAGNode::s_sequence_idx;
-#endif
   
-#if PRINT_CHUNK_CODE
   std::string const DAGNode::KIND_NAME[] =
   {
     "DAG_VAR_TEMP",
@@ -93,7 +90,6 @@ namespace ARMware
     "DAG_LOAD_LABEL",
     "DAG_LOAD"
   };
-#endif
   
 #if CHECK_CHUNK_CODE  
   void
@@ -124,7 +120,6 @@ namespace ARMware
   /////////////////////////////////////////////////////////////////////////////
   // Public == Operation ======================================================
     
-#if PRINT_CHUNK_CODE
   void
   DAGNode::dump_attached_var() const
   {
@@ -144,22 +139,22 @@ namespace ARMware
   void
   DAGNode::dump_info() const
   {
-    g_log_file << "<"
-               << std::dec
-               << m_sequence_idx
-               << "> "
-               << KIND_NAME[m_kind]
-               << " ["
-               << ((m_in_flags & SIGN_FLAG) ? "N" : "-")
-               << ((m_in_flags & ZERO_FLAG) ? "Z" : "-")
-               << ((m_in_flags & CARRY_FLAG) ? "C" : "-")
-               << ((m_in_flags & OVERFLOW_FLAG) ? "V" : "-")
-               << "] ["
-               << ((m_out_flags & SIGN_FLAG) ? "N" : "-")
-               << ((m_out_flags & ZERO_FLAG) ? "Z" : "-")
-               << ((m_out_flags & CARRY_FLAG) ? "C" : "-")
-               << ((m_out_flags & OVERFLOW_FLAG) ? "V" : "-")
-               << "] ";
+    g_chunk_code_log << "<"
+                     << std::dec
+                     << m_sequence_idx
+                     << "> "
+                     << KIND_NAME[m_kind]
+                     << " ["
+                     << ((m_in_flags & SIGN_FLAG) ? "N" : "-")
+                     << ((m_in_flags & ZERO_FLAG) ? "Z" : "-")
+                     << ((m_in_flags & CARRY_FLAG) ? "C" : "-")
+                     << ((m_in_flags & OVERFLOW_FLAG) ? "V" : "-")
+                     << "] ["
+                     << ((m_out_flags & SIGN_FLAG) ? "N" : "-")
+                     << ((m_out_flags & ZERO_FLAG) ? "Z" : "-")
+                     << ((m_out_flags & CARRY_FLAG) ? "C" : "-")
+                     << ((m_out_flags & OVERFLOW_FLAG) ? "V" : "-")
+                     << "] ";
     
     switch (m_kind)
     {
@@ -226,14 +221,13 @@ namespace ARMware
       // :NOTE: Wei 2004-Nov-10:
       //
       // Dump attached variables.
-      g_log_file << " (";
+      g_chunk_code_log << " (";
       
       dump_attached_var();
       
-      g_log_file << ")";
+      g_chunk_code_log << ")";
     }
   }
-#endif
   
   // :NOTE: Wei 2004-Nov-26:
   //
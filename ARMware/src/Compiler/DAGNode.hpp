@@ -67,13 +67,11 @@ namespace ARMware
     
     // Attribute
     
-#if PRINT_CHUNK_CODE || CHECK_CHUNK_CODE
     static std::string const KIND_NAME[DAG_KIND_TOTAL];
     
     static uint32_t s_sequence_idx;
     
     uint32_t m_sequence_idx;
-#endif
     
     DAGKindEnum m_kind;
     
@@ -215,10 +213,8 @@ namespace ARMware
       }
     }
     
-#if PRINT_CHUNK_CODE
     template<VarAttachedTypeEnum T_attach>
     void dump_attached_var_internal() const;
-#endif
     
     friend class MemoryPool<DAGNode, 512>;
     
@@ -241,9 +237,7 @@ namespace ARMware
       
       m_usable = true;
       
-#if PRINT_CHUNK_CODE || CHECK_CHUNK_CODE
       m_sequence_idx = s_sequence_idx++;
-#endif
     }
     
     inline
@@ -663,11 +657,9 @@ namespace ARMware
     
     // Inquiry
     
-#if PRINT_CHUNK_CODE || CHECK_CHUNK_CODE
     inline uint32_t
     sequence_idx() const
     { return m_sequence_idx; }
-#endif
     
     inline DAGKindEnum
     kind() const
@@ -740,7 +732,6 @@ namespace ARMware
     
     // Access
     
-#if PRINT_CHUNK_CODE || CHECK_CHUNK_CODE
     static void
     reset_static_sequence_idx()
     { s_sequence_idx = 0; }
@@ -748,7 +739,6 @@ namespace ARMware
     inline void
     set_sequence_idx(uint32_t const idx)
     { m_sequence_idx = idx; }
-#endif
     
     inline void
     clear_usable()
@@ -1129,10 +1119,8 @@ namespace ARMware
     void ensure_var_attached(Variable * const var) const;
 #endif
     
-#if PRINT_CHUNK_CODE
     void dump_attached_var() const;
     void dump_info() const;
-#endif
   };
 }
 
@@ -17,9 +17,7 @@
 
 #if ENABLE_DYNAMIC_TRANSLATOR
 
-#if PRINT_CHUNK_CODE
 #include "../Log.hpp"
-#endif
 
 namespace ARMware
 {
@@ -42,7 +40,6 @@ namespace ARMware
   }
 #endif
   
-#if PRINT_CHUNK_CODE
   template<VarAttachedTypeEnum T_attach>
   void
   DAGNode::dump_attached_var_internal() const
@@ -53,10 +50,9 @@ namespace ARMware
     {
       (*iter)->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
     }
   }
-#endif
   
   template<VarAttachedTypeEnum T_attach>
   inline void
@@ -0,0 +1,429 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+
+#if ENABLE_DYNAMIC_TRANSLATOR
+
+#include "GuestRegTracker.hpp"
+
+#include "../Core.hpp"
+#include "../ARMInstInfo.hpp"
+#include "../Utils/Number.hpp"
+
+namespace ARMware
+{
+  GuestRegTracker g_guest_reg_tracker;
+  
+  namespace
+  {
+    enum DPIOpcodeEnum
+    {
+      DPI_AND = 0x0,
+      DPI_EOR = 0x1,
+      DPI_SUB = 0x2,
+      DPI_RSB = 0x3,
+      DPI_ADD = 0x4,
+      DPI_TST = 0x8,
+      DPI_CMN = 0xB,
+      DPI_ORR = 0xC,
+      DPI_MOV = 0xD,
+      DPI_BIC = 0xE,
+      DPI_MVN = 0xF
+    };
+    typedef enum DPIOpcodeEnum DPIOpcodeEnum;
+    
+    inline uint32_t
+    reg_bit(uint32_t const inst, uint32_t const lsb)
+    { return 1 << ((inst >> lsb) & 0xF); }
+    
+    inline bool
+    is_branch(uint32_t const inst)
+    { return (0x0A000000 == (inst & 0x0E000000)); }
+    
+    // The chunk index of the target of a B or BL instruction, which may be
+    // outside the chunk.
+    inline int32_t
+    branch_target(uint32_t const inst, uint32_t const arm_idx)
+    {
+      int32_t const offset = (static_cast<int32_t>(inst << 8) >> 8);
+      
+      return static_cast<int32_t>(arm_idx) + 2 + offset;
+    }
+  }
+  
+  ///////////////////////////////// Private ///////////////////////////////////
+  //============================== Operation ==================================
+  
+  // ALL_REGS means the instruction may change the processor mode (and then
+  // the register bank), or do something I don't follow.
+  uint32_t
+  GuestRegTracker::written_regs(uint32_t const inst)
+  {
+    bool const is_load = ((inst & (1 << 20)) != 0);
+    bool const writeback = ((inst & (1 << 21)) != 0);
+    bool const pre_idx = ((inst & (1 << 24)) != 0);
+    
+    switch ((inst >> 25) & 0x7)
+    {
+    case 0x0:
+      if (0x00000090 == (inst & 0x0FC000F0))
+      {
+        // MUL, MLA
+        return reg_bit(inst, 16);
+      }
+      else if (0x00800090 == (inst & 0x0F8000F0))
+      {
+        // UMULL, UMLAL, SMULL, SMLAL
+        return reg_bit(inst, 16) | reg_bit(inst, 12);
+      }
+      else if (0x01000090 == (inst & 0x0FB00FF0))
+      {
+        // SWP, SWPB
+        return reg_bit(inst, 12);
+      }
+      else if (0x00000090 == (inst & 0x00000090))
+      {
+        // LDRH, STRH, LDRSB, LDRSH
+        return (((true == is_load) ? reg_bit(inst, 12) : 0) |
+                (((false == pre_idx) || (true == writeback)) ? reg_bit(inst, 16) : 0));
+      }
+      else if (0x010F0000 == (inst & 0x0FBF0FFF))
+      {
+        // MRS
+        return reg_bit(inst, 12);
+      }
+      else if (0x01000000 == (inst & 0x0D900000))
+      {
+        // MSR, BX, and the undefined ones.
+        return ALL_REGS;
+      }
+      // Fall through
+      
+    case 0x1:
+      if (0x03000000 == (inst & 0x0F900000))
+      {
+        // MSR with an immediate, and the undefined ones.
+        return ALL_REGS;
+      }
+      
+      switch ((inst >> 21) & 0xF)
+      {
+      case DPI_TST:
+      case 0x9: // TEQ
+      case 0xA: // CMP
+      case DPI_CMN:
+        return 0;
+        
+      default:
+        if ((CR_PC == ((inst >> 12) & 0xF)) && ((inst & (1 << 20)) != 0))
+        {
+          // Restore CPSR from SPSR.
+          return ALL_REGS;
+        }
+        
+        return reg_bit(inst, 12);
+      }
+      
+    case 0x3:
+      if (inst & (1 << 4))
+      {
+        // Undefined
+        return ALL_REGS;
+      }
+      // Fall through
+      
+    case 0x2:
+      // LDR, STR, LDRB, STRB, LDRT, STRT, LDRBT, STRBT
+      return (((true == is_load) ? reg_bit(inst, 12) : 0) |
+              (((false == pre_idx) || (true == writeback)) ? reg_bit(inst, 16) : 0));
+      
+    case 0x4:
+      // LDM, STM
+      if ((true == is_load) && ((inst & (1 << 22)) != 0))
+      {
+        return ALL_REGS;
+      }
+      
+      return (((true == is_load) ? (inst & 0xFFFF) : 0) |
+              ((true == writeback) ? reg_bit(inst, 16) : 0));
+      
+    case 0x5:
+      // B, BL
+      return (inst & (1 << 24)) ? (1 << CR_LR) : 0;
+      
+    case 0x6:
+      // LDC, STC
+      return (true == writeback) ? reg_bit(inst, 16) : 0;
+      
+    case 0x7:
+    default:
+      if (inst & (1 << 24))
+      {
+        // SWI
+        return ALL_REGS;
+      }
+      else if ((inst & (1 << 4)) && (true == is_load))
+      {
+        // MRC
+        return reg_bit(inst, 12);
+      }
+      else
+      {
+        // MCR, CDP
+        return 0;
+      }
+    }
+  }
+  
+  // @true: the unconditional instruction 'inst' sets 'rd' to the constant
+  // 'value'.
+  bool
+  GuestRegTracker::fold_constant(State const &state,
+                                 uint32_t const inst,
+                                 uint32_t const arm_idx,
+                                 CoreRegNum &rd,
+                                 uint32_t &value) const
+  {
+    if (static_cast<uint32_t>(AL) != (inst & 0xF0000000))
+    {
+      return false;
+    }
+    
+    rd = static_cast<CoreRegNum>((inst >> 12) & 0xF);
+    
+    if (CR_PC == rd)
+    {
+      return false;
+    }
+    
+    CoreRegNum const rn = static_cast<CoreRegNum>((inst >> 16) & 0xF);
+    
+    if (0x02000000 == (inst & 0x0E000000))
+    {
+      // Data processing with an immediate.
+      uint32_t const rotate = ((inst >> 8) & 0xF) << 1;
+      uint32_t const imm = ((0 == rotate)
+                            ? (inst & 0xFF)
+                            : RotateRight(inst & 0xFF, rotate));
+      
+      uint32_t const opcode = (inst >> 21) & 0xF;
+      
+      switch (opcode)
+      {
+      case DPI_MOV: value = imm; return true;
+      case DPI_MVN: value = ~imm; return true;
+        
+      case DPI_AND:
+      case DPI_EOR:
+      case DPI_SUB:
+      case DPI_RSB:
+      case DPI_ADD:
+      case DPI_ORR:
+      case DPI_BIC:
+        break;
+        
+      default:
+        return false;
+      }
+      
+      if ((CR_PC == rn) || (0 == (state.m_known & (1 << rn))))
+      {
+        return false;
+      }
+      
+      uint32_t const rn_value = state.m_value[rn];
+      
+      switch (opcode)
+      {
+      case DPI_AND: value = rn_value & imm; break;
+      case DPI_EOR: value = rn_value ^ imm; break;
+      case DPI_SUB: value = rn_value - imm; break;
+      case DPI_RSB: value = imm - rn_value; break;
+      case DPI_ADD: value = rn_value + imm; break;
+      case DPI_ORR: value = rn_value | imm; break;
+      case DPI_BIC: value = rn_value & ~imm; break;
+      default: assert(!"Should not reach here."); return false;
+      }
+      
+      return true;
+    }
+    else if ((0x051F0000 == (inst & 0x0F7F0000)) && (0 == (inst & 3)))
+    {
+      // LDR <Rd>, [PC, #+/-<offset_12>]
+      //
+      // The literal has to be in the same page as the chunk, otherwise its
+      // virtual address may map to somewhere else, and writing it won't
+      // flush this chunk.
+      uint32_t const inst_paddr = m_start_paddr + (arm_idx << 2);
+      uint32_t const offset = inst & 0xFFF;
+      uint32_t const literal_paddr = ((inst & (1 << 23))
+                                      ? (inst_paddr + 8 + offset)
+                                      : (inst_paddr + 8 - offset));
+      
+#if ASSUME_NOT_USE_TINY_PAGE
+      uint32_t const page_mask = ~(SIZE_4K - 1);
+#else
+      uint32_t const page_mask = ~(SIZE_1K - 1);
+#endif
+      
+      if ((literal_paddr & page_mask) != (m_start_paddr & page_mask))
+      {
+        return false;
+      }
+      
+      value = gp_core->peek_dram_word(literal_paddr);
+      
+      return true;
+    }
+    
+    return false;
+  }
+  
+  void
+  GuestRegTracker::transfer(State &state, uint32_t const inst, uint32_t const arm_idx) const
+  {
+    CoreRegNum rd;
+    uint32_t value;
+    
+    if (true == fold_constant(state, inst, arm_idx, rd, value))
+    {
+      state.m_known |= (1 << rd);
+      state.m_value[rd] = value;
+    }
+    else
+    {
+      state.m_known &= ~written_regs(inst);
+    }
+  }
+  
+  // @true: the state before 'arm_idx' is changed.
+  bool
+  GuestRegTracker::merge(uint32_t const arm_idx, State const &state)
+  {
+    State &target = m_state[arm_idx];
+    
+    if (false == target.m_reached)
+    {
+      target = state;
+      
+      return true;
+    }
+    
+    uint32_t known = target.m_known & state.m_known;
+    
+    for (uint32_t reg = 0; reg < CR_PC; ++reg)
+    {
+      if ((known & (1 << reg)) && (target.m_value[reg] != state.m_value[reg]))
+      {
+        known &= ~(1 << reg);
+      }
+    }
+    
+    if (known != target.m_known)
+    {
+      target.m_known = known;
+      
+      return true;
+    }
+    
+    return false;
+  }
+  
+  ///////////////////////////////// Public ////////////////////////////////////
+  //============================== Life cycle =================================
+  
+  GuestRegTracker::GuestRegTracker()
+    : mp_first_arm_inst_info(0),
+      m_length(0),
+      m_start_paddr(0)
+  { }
+  
+  //============================== Operation ==================================
+  
+  void
+  GuestRegTracker::analyze(ARMInstInfo const * const first_arm_inst_info,
+                           uint32_t const length,
+                           uint32_t const start_paddr)
+  {
+    mp_first_arm_inst_info = first_arm_inst_info;
+    m_length = length;
+    m_start_paddr = start_paddr;
+    
+    m_state.resize(length);
+    
+    for (uint32_t i = 0; i < length; ++i)
+    {
+      m_state[i].m_reached = false;
+      m_state[i].m_known = 0;
+    }
+    
+    // Nothing is known when entering the chunk.
+    m_state[0].m_reached = true;
+    
+    // A register only goes from known to unknown, thus this converges
+    // after a few passes even if the chunk contains loops.
+    bool changed;
+    
+    do
+    {
+      changed = false;
+      
+      for (uint32_t i = 0; i < length; ++i)
+      {
+        if (false == m_state[i].m_reached)
+        {
+          continue;
+        }
+        
+        uint32_t const inst = mp_first_arm_inst_info[i].inst().mRawData;
+        
+        State state = m_state[i];
+        
+        transfer(state, inst, i);
+        
+        if (true == is_branch(inst))
+        {
+          int32_t const target = branch_target(inst, i);
+          
+          if ((target >= 0) && (target < static_cast<int32_t>(length)))
+          {
+            if (true == merge(target, state))
+            {
+              changed = true;
+            }
+          }
+          
+          if (static_cast<uint32_t>(AL) == (inst & 0xF0000000))
+          {
+            continue;
+          }
+        }
+        
+        if ((i + 1) < length)
+        {
+          if (true == merge(i + 1, state))
+          {
+            changed = true;
+          }
+        }
+      }
+    }
+    while (true == changed);
+  }
+}
+
+#endif // #if ENABLE_DYNAMIC_TRANSLATOR
@@ -0,0 +1,130 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+
+#ifndef GuestRegTracker_hpp
+#define GuestRegTracker_hpp
+
+#if ENABLE_DYNAMIC_TRANSLATOR
+
+#include <cassert>
+#include <vector>
+
+#include "../ARMware.hpp"
+
+namespace ARMware
+{
+  class ARMInstInfo;
+  
+  // Finds out which guest registers (r0 ~ r14) hold a known constant before
+  // each ARM instruction of a chunk, by a forward data flow analysis over
+  // the ARM instructions themselves (including the branches back into the
+  // same chunk).
+  //
+  // The address of a load or store is computed inside its threaded code
+  // routine, which never appears in MIR, thus SCCVN can't see it. This
+  // analysis is what tells the dynamic translator that a guest register is
+  // a constant there.
+  //
+  // The constants come from:
+  //
+  // * MOV, MVN with an immediate.
+  // * AND, EOR, SUB, RSB, ADD, ORR, BIC with an immediate and a known Rn.
+  // * LDR from a literal pool in the same page as the chunk, which is
+  //   protected by the self-modifying code detection together with the
+  //   chunk.
+  //
+  // Any other instruction, and any conditional one, makes the registers it
+  // writes unknown.
+  typedef class GuestRegTracker GuestRegTracker;
+  class GuestRegTracker
+  {
+  private:
+    
+    struct State
+    {
+      bool m_reached;
+      
+      // Bit n is set if register n is known.
+      uint32_t m_known;
+      uint32_t m_value[CR_PC];
+    };
+    typedef struct State State;
+    
+    static uint32_t const ALL_REGS = 0xFFFF;
+    
+    // Attribute
+    
+    ARMInstInfo const *mp_first_arm_inst_info;
+    uint32_t m_length;
+    uint32_t m_start_paddr;
+    
+    // The state before each ARM instruction.
+    std::vector<State> m_state;
+    
+    // Operation
+    
+    static uint32_t written_regs(uint32_t const inst);
+    
+    bool fold_constant(State const &state,
+                       uint32_t const inst,
+                       uint32_t const arm_idx,
+                       CoreRegNum &rd,
+                       uint32_t &value) const;
+    
+    void transfer(State &state, uint32_t const inst, uint32_t const arm_idx) const;
+    
+    bool merge(uint32_t const arm_idx, State const &state);
+    
+  public:
+    
+    // Life cycle
+    
+    GuestRegTracker();
+    
+    // Operation
+    
+    void analyze(ARMInstInfo const * const first_arm_inst_info,
+                 uint32_t const length,
+                 uint32_t const start_paddr);
+    
+    // Inquery
+    
+    // @true: register 'reg' holds 'value' before the ARM instruction
+    // 'arm_idx' of the chunk analyzed last time.
+    inline bool
+    find_value(uint32_t const arm_idx, CoreRegNum const reg, uint32_t &value) const
+    {
+      assert(arm_idx < m_length);
+      
+      if ((CR_PC == reg) || (0 == (m_state[arm_idx].m_known & (1 << reg))))
+      {
+        return false;
+      }
+      
+      value = m_state[arm_idx].m_value[reg];
+      
+      return true;
+    }
+  };
+  
+  extern GuestRegTracker g_guest_reg_tracker;
+}
+
+#endif // #if ENABLE_DYNAMIC_TRANSLATOR
+
+#endif
@@ -0,0 +1,349 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+#if ENABLE_DYNAMIC_TRANSLATOR
+
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+
+#if LINUX
+#include <elf.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+#include "JitSymbolExport.hpp"
+
+#include "../Chunk.hpp"
+#include "../Log.hpp"
+
+namespace ARMware
+{
+  JitSymbolExport g_jit_symbol_export;
+  
+  namespace
+  {
+#if LINUX
+    // The layout of the jitdump file is described in
+    // tools/perf/Documentation/jitdump-specification.txt of the Linux kernel.
+    uint32_t const JITDUMP_MAGIC = 0x4A695444;
+    uint32_t const JITDUMP_VERSION = 1;
+    
+    uint32_t const JIT_CODE_LOAD = 0;
+    uint32_t const JIT_CODE_CLOSE = 3;
+    
+    struct JitdumpHeader
+    {
+      uint32_t m_magic;
+      uint32_t m_version;
+      uint32_t m_total_size;
+      uint32_t m_elf_mach;
+      uint32_t m_pad1;
+      uint32_t m_pid;
+      uint64_t m_timestamp;
+      uint64_t m_flags;
+    };
+    typedef struct JitdumpHeader JitdumpHeader;
+    
+    struct JitdumpRecordHeader
+    {
+      uint32_t m_id;
+      uint32_t m_total_size;
+      uint64_t m_timestamp;
+    };
+    typedef struct JitdumpRecordHeader JitdumpRecordHeader;
+    
+    struct JitdumpCodeLoad
+    {
+      JitdumpRecordHeader m_header;
+      uint32_t m_pid;
+      uint32_t m_tid;
+      uint64_t m_vma;
+      uint64_t m_code_addr;
+      uint64_t m_code_size;
+      uint64_t m_code_index;
+    };
+    typedef struct JitdumpCodeLoad JitdumpCodeLoad;
+    
+    // 'perf record -k mono' is needed to match this clock.
+    inline uint64_t
+    monotonic_timestamp()
+    {
+      struct timespec ts;
+      
+      clock_gettime(CLOCK_MONOTONIC, &ts);
+      
+      return (static_cast<uint64_t>(ts.tv_sec) * 1000000000ULL) + ts.tv_nsec;
+    }
+    
+    inline bool
+    write_all(int const fd, void const * const data, size_t const size)
+    {
+      char const *curr = static_cast<char const *>(data);
+      size_t remain = size;
+      
+      while (remain != 0)
+      {
+        ssize_t const written = write(fd, curr, remain);
+        
+        if (written <= 0)
+        {
+          return false;
+        }
+        
+        curr += written;
+        remain -= written;
+      }
+      
+      return true;
+    }
+#endif
+    
+    inline std::string
+    chunk_name(Chunk const * const chunk)
+    {
+      std::ostringstream name;
+      
+      name << "ARM_p" << std::hex << chunk->start_paddr()
+           << "_l" << std::dec << chunk->length();
+      
+      return name.str();
+    }
+  }
+  
+  ///////////////////////////////// Private ///////////////////////////////////
+  
+  void
+  JitSymbolExport::open_jitdump(char const * const directory)
+  {
+#if LINUX
+    std::ostringstream path;
+    
+    path << directory << "/jit-" << getpid() << ".dump";
+    
+    int const fd = open(path.str().c_str(), O_CREAT | O_TRUNC | O_RDWR, 0666);
+    
+    if (-1 == fd)
+    {
+      g_log_file << "JIT symbol export: can not open " << path.str() << std::endl;
+      return;
+    }
+    
+    // perf finds the jitdump file by this executable mapping of it,
+    // it has to stay mapped until the end.
+    void * const marker = mmap(0, sysconf(_SC_PAGESIZE), PROT_READ | PROT_EXEC, MAP_PRIVATE, fd, 0);
+    
+    if (MAP_FAILED == marker)
+    {
+      g_log_file << "JIT symbol export: can not mmap " << path.str() << std::endl;
+      
+      close(fd);
+      return;
+    }
+    
+    JitdumpHeader header;
+    
+    memset(&header, 0, sizeof(header));
+    
+    header.m_magic = JITDUMP_MAGIC;
+    header.m_version = JITDUMP_VERSION;
+    header.m_total_size = sizeof(header);
+    header.m_elf_mach = EM_386;
+    header.m_pid = getpid();
+    header.m_timestamp = monotonic_timestamp();
+    
+    if (false == write_all(fd, &header, sizeof(header)))
+    {
+      munmap(marker, sysconf(_SC_PAGESIZE));
+      close(fd);
+      return;
+    }
+    
+    m_jitdump_fd = fd;
+    mp_jitdump_marker = marker;
+#else
+    (void)directory;
+#endif
+  }
+  
+  void
+  JitSymbolExport::write_jitdump_load(uintptr_t const addr,
+                                      uint8_t const * const code,
+                                      uint32_t const size,
+                                      std::string const &name)
+  {
+#if LINUX
+    JitdumpCodeLoad record;
+    
+    record.m_header.m_id = JIT_CODE_LOAD;
+    record.m_header.m_total_size = sizeof(record) + name.size() + 1 + size;
+    record.m_header.m_timestamp = monotonic_timestamp();
+    record.m_pid = getpid();
+    record.m_tid = syscall(SYS_gettid);
+    record.m_vma = addr;
+    record.m_code_addr = addr;
+    record.m_code_size = size;
+    record.m_code_index = m_code_index++;
+    
+    write_all(m_jitdump_fd, &record, sizeof(record));
+    write_all(m_jitdump_fd, name.c_str(), name.size() + 1);
+    write_all(m_jitdump_fd, code, size);
+#else
+    (void)addr;
+    (void)code;
+    (void)size;
+    (void)name;
+#endif
+  }
+  
+  void
+  JitSymbolExport::rewrite_perf_map()
+  {
+    m_perf_map_file.close();
+    m_perf_map_file.open(m_perf_map_path.c_str(), std::ios_base::out | std::ios_base::trunc);
+    
+    m_perf_map_file << std::hex;
+    
+    for (std::map<uintptr_t, Entry>::const_iterator iter = m_living_entries.begin();
+         iter != m_living_entries.end();
+         ++iter)
+    {
+      m_perf_map_file << (*iter).first << ' ' << (*iter).second.m_size << ' ' << (*iter).second.m_name << '\n';
+    }
+    
+    m_perf_map_file.flush();
+    
+    m_retired_number = 0;
+  }
+  
+  ///////////////////////////////// Public ////////////////////////////////////
+  //============================== Life cycle =================================
+  
+  JitSymbolExport::JitSymbolExport()
+    : m_enable(false),
+      m_perf_map_enable(false),
+      m_retired_number(0),
+      m_jitdump_fd(-1),
+      mp_jitdump_marker(0),
+      m_code_index(0)
+  { }
+  
+  JitSymbolExport::~JitSymbolExport()
+  {
+#if LINUX
+    if (m_jitdump_fd != -1)
+    {
+      JitdumpRecordHeader record;
+      
+      record.m_id = JIT_CODE_CLOSE;
+      record.m_total_size = sizeof(record);
+      record.m_timestamp = monotonic_timestamp();
+      
+      write_all(m_jitdump_fd, &record, sizeof(record));
+      
+      munmap(mp_jitdump_marker, sysconf(_SC_PAGESIZE));
+      close(m_jitdump_fd);
+    }
+#endif
+  }
+  
+  //============================== Operation ==================================
+  
+  void
+  JitSymbolExport::init()
+  {
+#if LINUX
+    if (getenv("ARMWARE_PERF_MAP") != 0)
+    {
+      std::ostringstream path;
+      
+      path << "/tmp/perf-" << getpid() << ".map";
+      
+      m_perf_map_path = path.str();
+      m_perf_map_file.open(m_perf_map_path.c_str(), std::ios_base::out | std::ios_base::trunc);
+      
+      m_perf_map_enable = m_perf_map_file.is_open();
+    }
+    
+    char const * const jitdump_directory = getenv("ARMWARE_PERF_JITDUMP");
+    
+    if (jitdump_directory != 0)
+    {
+      open_jitdump(jitdump_directory);
+    }
+#endif
+    
+    m_enable = ((true == m_perf_map_enable) || (m_jitdump_fd != -1));
+  }
+  
+  // Called after Chunk::link_labels(), at that point the native codes of
+  // this chunk are final.
+  void
+  JitSymbolExport::publish(Chunk const * const chunk)
+  {
+    uintptr_t const addr = reinterpret_cast<uintptr_t>(chunk->native_code_begin());
+    std::string const name = chunk_name(chunk);
+    
+    if (true == m_perf_map_enable)
+    {
+      Entry &entry = m_living_entries[addr];
+      
+      entry.m_size = chunk->native_code_size();
+      entry.m_name = name;
+      
+      m_perf_map_file << std::hex << addr << ' ' << entry.m_size << ' ' << name << '\n';
+      m_perf_map_file.flush();
+    }
+    
+    if (m_jitdump_fd != -1)
+    {
+      write_jitdump_load(addr, chunk->native_code_begin(), chunk->native_code_size(), name);
+    }
+  }
+  
+  void
+  JitSymbolExport::retire(Chunk const * const chunk)
+  {
+    if (false == m_perf_map_enable)
+    {
+      return;
+    }
+    
+    std::map<uintptr_t, Entry>::iterator const iter =
+      m_living_entries.find(reinterpret_cast<uintptr_t>(chunk->native_code_begin()));
+    
+    if (iter == m_living_entries.end())
+    {
+      return;
+    }
+    
+    m_living_entries.erase(iter);
+    
+    ++m_retired_number;
+    
+    if (m_retired_number > m_living_entries.size())
+    {
+      rewrite_perf_map();
+    }
+  }
+}
+
+#endif // #if ENABLE_DYNAMIC_TRANSLATOR
@@ -0,0 +1,110 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+#ifndef JitSymbolExport_hpp
+#define JitSymbolExport_hpp
+
+#if ENABLE_DYNAMIC_TRANSLATOR
+
+#include <fstream>
+#include <map>
+#include <string>
+
+#include "../Type.hpp"
+
+namespace ARMware
+{
+  class Chunk;
+  
+  // Tells the Linux 'perf' tool what each dynamic translated chunk is,
+  // so that the time spent in the native codes of a chunk is reported
+  // under its name (ARM_p<guest physical address>_l<ARM instruction number>)
+  // rather than an anonymous address.
+  //
+  // ARMWARE_PERF_MAP=1: write /tmp/perf-<pid>.map.
+  // This format has no way to remove an entry, so I keep all living
+  // chunks in memory, and rewrite the whole file when the number of the
+  // flushed chunks exceeds the number of the living ones.
+  //
+  // ARMWARE_PERF_JITDUMP=<directory>: write <directory>/jit-<pid>.dump
+  // in the jitdump format, which also carries the native codes, thus
+  // 'perf inject --jit' can annotate them. The flushed chunks don't need
+  // any record here, a later JIT_CODE_LOAD record at the same address
+  // overrides the previous one by its timestamp.
+  typedef class JitSymbolExport JitSymbolExport;
+  class JitSymbolExport
+  {
+  private:
+    
+    struct Entry
+    {
+      uint32_t m_size;
+      std::string m_name;
+    };
+    typedef struct Entry Entry;
+    
+    // Attribute
+    
+    bool m_enable;
+    
+    bool m_perf_map_enable;
+    std::string m_perf_map_path;
+    std::ofstream m_perf_map_file;
+    std::map<uintptr_t, Entry> m_living_entries;
+    uint32_t m_retired_number;
+    
+    int m_jitdump_fd;
+    void *mp_jitdump_marker;
+    uint64_t m_code_index;
+    
+    // Operation
+    
+    void open_jitdump(char const * const directory);
+    void write_jitdump_load(uintptr_t const addr,
+                            uint8_t const * const code,
+                            uint32_t const size,
+                            std::string const &name);
+    
+    void rewrite_perf_map();
+  
+  public:
+    
+    // Life cycle
+    
+    JitSymbolExport();
+    ~JitSymbolExport();
+    
+    // Operation
+    
+    void init();
+    
+    void publish(Chunk const * const chunk);
+    void retire(Chunk const * const chunk);
+    
+    // Inquery
+    
+    inline bool
+    is_enabled() const
+    { return m_enable; }
+  };
+  
+  extern JitSymbolExport g_jit_symbol_export;
+}
+
+#endif // #if ENABLE_DYNAMIC_TRANSLATOR
+
+#endif
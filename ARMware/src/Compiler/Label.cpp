@@ -20,9 +20,7 @@
 #include "Label.hpp"
 #include "MIR.hpp"
 
-#if PRINT_CHUNK_CODE
 #include "../Log.hpp"
-#endif
 
 #include "../ARMInstInfo.hpp"
 
@@ -95,7 +93,6 @@ namespace ARMware
     u.m_BB.mp_bb = u.m_MIR_INST.mp_mir->bb();
   }
   
-#if PRINT_CHUNK_CODE
   void
   Label::dump_info() const
   {
@@ -111,15 +108,14 @@ namespace ARMware
     // could be 0.
     if (u.m_MIR_INST.mp_mir != 0)
     {
-      g_log_file << std::dec
-                << u.m_MIR_INST.mp_mir->idx();
+      g_chunk_code_log << std::dec
+                      << u.m_MIR_INST.mp_mir->idx();
     }
     else
     {
-      g_log_file << "0";
+      g_chunk_code_log << "0";
     }
   }
-#endif
 }
 
 #endif
@@ -305,9 +305,7 @@ namespace ARMware
       m_back_patch_info.push_back(PatchInfo(type, offset));
     }
     
-#if PRINT_CHUNK_CODE
     void dump_info() const;
-#endif
     
     // Access
     
@@ -19,9 +19,7 @@
 
 #include <algorithm>
 
-#if PRINT_CHUNK_CODE
 #include "../Log.hpp"
-#endif
 
 #include "LiveInterval.hpp"
 #include "BitPosition.hpp"
@@ -199,25 +197,23 @@ namespace ARMware
     return false;
   }
   
-#if PRINT_CHUNK_CODE
   void
   LiveInterval::dump_info() const
   {
     mp_attached_var->dump_info<true>();
     
-    g_log_file << " "
-               << start_point_idx()
-               << "-"
-               << end_point_idx();
+    g_chunk_code_log << " "
+                     << start_point_idx()
+                     << "-"
+                     << end_point_idx();
     
     if (mp_preallocated_reg != 0)
     {
-      g_log_file << " (";
+      g_chunk_code_log << " (";
       mp_preallocated_reg->dump_info();
-      g_log_file << ")";
+      g_chunk_code_log << ")";
     }
   }
-#endif
 }
 
 #endif
@@ -204,9 +204,7 @@ namespace ARMware
       m_merged_range_bitset_without_lastuse.clear();
     }
     
-#if PRINT_CHUNK_CODE
     void dump_info() const;
-#endif
   };
 }
 
@@ -17,9 +17,7 @@
 
 #if ENABLE_DYNAMIC_TRANSLATOR
 
-#if PRINT_CHUNK_CODE
 #include <iostream>
-#endif
 
 #include "MIR.hpp"
 
@@ -92,7 +90,6 @@ namespace ARMware
     }
   }
   
-#if PRINT_CHUNK_CODE
   std::string const MIR::KIND_NAME[] =
   {
     "CALL_0",
@@ -163,26 +160,26 @@ namespace ARMware
       // :NOTE: Wei 2004-Nov-6:
       //
       // The first MIR always is a leader.
-      g_log_file << "> ";
+      g_chunk_code_log << "> ";
     }
     else
     {
-      g_log_file << ((mp_prev_mir->bb() != mp_bb) ? "> " : "  ");
+      g_chunk_code_log << ((mp_prev_mir->bb() != mp_bb) ? "> " : "  ");
     }
     
-    g_log_file << "["
-               << ((m_in_flags & SIGN_FLAG) ? "N" : "-")
-               << ((m_in_flags & ZERO_FLAG) ? "Z" : "-")
-               << ((m_in_flags & CARRY_FLAG) ? "C" : "-")
-               << ((m_in_flags & OVERFLOW_FLAG) ? "V" : "-")
-               << "] ["
-               << ((m_out_flags & SIGN_FLAG) ? "N" : "-")
-               << ((m_out_flags & ZERO_FLAG) ? "Z" : "-")
-               << ((m_out_flags & CARRY_FLAG) ? "C" : "-")
-               << ((m_out_flags & OVERFLOW_FLAG) ? "V" : "-")
-               << "] ";
+    g_chunk_code_log << "["
+                     << ((m_in_flags & SIGN_FLAG) ? "N" : "-")
+                     << ((m_in_flags & ZERO_FLAG) ? "Z" : "-")
+                     << ((m_in_flags & CARRY_FLAG) ? "C" : "-")
+                     << ((m_in_flags & OVERFLOW_FLAG) ? "V" : "-")
+                     << "] ["
+                     << ((m_out_flags & SIGN_FLAG) ? "N" : "-")
+                     << ((m_out_flags & ZERO_FLAG) ? "Z" : "-")
+                     << ((m_out_flags & CARRY_FLAG) ? "C" : "-")
+                     << ((m_out_flags & OVERFLOW_FLAG) ? "V" : "-")
+                     << "] ";
     
-    g_log_file << KIND_NAME[m_kind];
+    g_chunk_code_log << KIND_NAME[m_kind];
     
     switch (m_kind)
     {
@@ -190,28 +187,28 @@ namespace ARMware
       assert(0 == m_operand_var.size());
       assert(0 == m_dest_var.size());
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case MIR_CALL_1:
       assert(1 == m_operand_var.size());
       assert(0 == m_dest_var.size());
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       
       m_operand_var.front()->dump_info<false>();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case MIR_RETURN:
       assert(1 == m_operand_var.size());
       assert(0 == m_dest_var.size());
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var.front()->dump_info<false>();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case MIR_RETRIEVE:
@@ -220,350 +217,350 @@ namespace ARMware
       
       if (m_dest_var.size() != 0)
       {
-        g_log_file << " ";
+        g_chunk_code_log << " ";
         m_dest_var.front()->dump_info<false>();
       }
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case MIR_ADD:
       assert(2 == m_operand_var.size());
       assert(1 == m_dest_var.size());
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var.front()->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var.back()->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_dest_var.front()->dump_info<false>();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case MIR_ADD64:
       assert(4 == m_operand_var.size());
       assert(2 == m_dest_var.size());
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var[0]->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var[1]->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var[2]->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var[3]->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_dest_var.front()->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_dest_var.back()->dump_info<false>();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case MIR_ADC:
       assert(2 == m_operand_var.size());
       assert(1 == m_dest_var.size());
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var.front()->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var.back()->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_dest_var.front()->dump_info<false>();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case MIR_MOV:
       assert(1 == m_operand_var.size());
       assert(1 == m_dest_var.size());
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var.front()->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_dest_var.front()->dump_info<false>();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case MIR_AND:
       assert(2 == m_operand_var.size());
       assert(1 == m_dest_var.size());
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var.front()->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var.back()->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_dest_var.front()->dump_info<false>();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case MIR_OR:
       assert(2 == m_operand_var.size());
       assert(1 == m_dest_var.size());
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var.front()->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var.back()->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_dest_var.front()->dump_info<false>();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case MIR_EOR:
       assert(2 == m_operand_var.size());
       assert(1 == m_dest_var.size());
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var.front()->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var.back()->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_dest_var.front()->dump_info<false>();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case MIR_SUB:
       assert(2 == m_operand_var.size());
       assert(1 == m_dest_var.size());
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var.front()->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var.back()->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_dest_var.front()->dump_info<false>();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case MIR_SBC:
       assert(2 == m_operand_var.size());
       assert(1 == m_dest_var.size());
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var.front()->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var.back()->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_dest_var.front()->dump_info<false>();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case MIR_TST:
       assert(2 == m_operand_var.size());
       assert(0 == m_dest_var.size());
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var.front()->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var.back()->dump_info<false>();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case MIR_CMP:
       assert(2 == m_operand_var.size());
       assert(0 == m_dest_var.size());
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var.front()->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var.back()->dump_info<false>();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case MIR_CMP_EQ:
       assert(2 == m_operand_var.size());
       assert(0 == m_dest_var.size());
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var.front()->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var.back()->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       u.m_CMP_EQ.mp_label->dump_info();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case MIR_NOT:
       assert(1 == m_operand_var.size());
       assert(1 == m_dest_var.size());
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var.front()->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_dest_var.front()->dump_info<false>();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case MIR_MUL32:
       assert(2 == m_operand_var.size());
       assert(1 == m_dest_var.size());
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var.front()->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var.back()->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_dest_var.front()->dump_info<false>();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case MIR_UMUL64:
       assert(2 == m_operand_var.size());
       assert(2 == m_dest_var.size());
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var.front()->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var.back()->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_dest_var.front()->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_dest_var.back()->dump_info<false>();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case MIR_SMUL64:
       assert(2 == m_operand_var.size());
       assert(2 == m_dest_var.size());
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var.front()->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var.back()->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_dest_var.front()->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_dest_var.back()->dump_info<false>();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case MIR_LSFT_LEFT:
       assert(2 == m_operand_var.size());
       assert(1 == m_dest_var.size());
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var.front()->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var.back()->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_dest_var.front()->dump_info<false>();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case MIR_LSFT_RIGHT:
       assert(2 == m_operand_var.size());
       assert(1 == m_dest_var.size());
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var.front()->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var.back()->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_dest_var.front()->dump_info<false>();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case MIR_ASFT_RIGHT:
       assert(2 == m_operand_var.size());
       assert(1 == m_dest_var.size());
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var.front()->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var.back()->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_dest_var.front()->dump_info<false>();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case MIR_RRX:
       assert(2 == m_operand_var.size());
       assert(1 == m_dest_var.size());
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var.front()->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var.back()->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_dest_var.front()->dump_info<false>();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case MIR_ROR:
       assert(2 == m_operand_var.size());
       assert(1 == m_dest_var.size());
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var.front()->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var.back()->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_dest_var.front()->dump_info<false>();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case MIR_GOTO:
@@ -584,76 +581,76 @@ namespace ARMware
       assert(0 == m_operand_var.size());
       assert(0 == m_dest_var.size());
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       u.m_GOTO.mp_label->dump_info();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case MIR_JUMP:
       assert(1 == m_operand_var.size());
       assert(0 == m_dest_var.size());
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var.front()->dump_info<false>();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case MIR_PRODUCE_CBIT:
       assert(2 == m_operand_var.size());
       assert(0 == m_dest_var.size());
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var.front()->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var.back()->dump_info<false>();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case MIR_CLEAR_CBIT:
       assert(0 == m_operand_var.size());
       assert(0 == m_dest_var.size());
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case MIR_DATA32:
       assert(0 == m_operand_var.size());
       assert(0 == m_dest_var.size());
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       u.m_DATA32.mp_label->dump_info();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case MIR_LOAD_LABEL:
       assert(0 == m_operand_var.size());
       assert(1 == m_dest_var.size());
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       u.m_LOAD_LABEL.mp_label->dump_info();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_dest_var.front()->dump_info<false>();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case MIR_LOAD:
       assert(1 == m_operand_var.size());
       assert(1 == m_dest_var.size());
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand_var.front()->dump_info<false>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_dest_var.front()->dump_info<false>();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     default:
@@ -662,7 +659,6 @@ namespace ARMware
     }
   }
 #endif
-#endif
 }
 
 #endif
@@ -27,9 +27,7 @@
 #include "../MemoryPool.hpp"
 #include "../Chunk.hpp"
 
-#if PRINT_CHUNK_CODE
 #include "../Log.hpp"
-#endif
 
 namespace ARMware
 {
@@ -46,11 +44,9 @@ namespace ARMware
   {
   private:
     
-#if PRINT_CHUNK_CODE
     static std::string const KIND_NAME[MIR_KIND_TOTAL];
     
     uint32_t m_idx;
-#endif
     
     friend class MemoryPool<MIR, 256>;
     
@@ -729,9 +725,7 @@ namespace ARMware
     
     void emit_native_code(std::vector<uint8_t> &native_code_buffer);
     
-#if PRINT_CHUNK_CODE
     void dump_info() const;
-#endif
     
     // Access
     
@@ -775,19 +769,17 @@ namespace ARMware
     
     void set_in_out_flags(uint32_t const in_flags, uint32_t const out_flags);
     
-#if PRINT_CHUNK_CODE
     inline void
     set_idx(uint32_t const idx)
     { m_idx = idx; }
-#endif
     
     inline void
     clear_n_bit()
     {
 #if PRINT_CHUNK_CODE
-      g_log_file << "<opt> clear N bit for "
-                 << m_idx
-                 << std::endl;
+      g_chunk_code_log << "<opt> clear N bit for "
+                       << m_idx
+                       << std::endl;
 #endif
       
       m_out_flags &= ~SIGN_FLAG;
@@ -797,9 +789,9 @@ namespace ARMware
     clear_z_bit()
     {
 #if PRINT_CHUNK_CODE
-      g_log_file << "<opt> clear Z bit for "
-                 << m_idx
-                 << std::endl;
+      g_chunk_code_log << "<opt> clear Z bit for "
+                       << m_idx
+                       << std::endl;
 #endif
       
       m_out_flags &= ~ZERO_FLAG;
@@ -809,9 +801,9 @@ namespace ARMware
     clear_c_bit()
     {
 #if PRINT_CHUNK_CODE
-      g_log_file << "<opt> clear C bit for "
-                 << m_idx
-                 << std::endl;
+      g_chunk_code_log << "<opt> clear C bit for "
+                       << m_idx
+                       << std::endl;
 #endif
       
       m_out_flags &= ~CARRY_FLAG;
@@ -821,9 +813,9 @@ namespace ARMware
     clear_v_bit()
     {
 #if PRINT_CHUNK_CODE
-      g_log_file << "<opt> clear V bit for "
-                 << m_idx
-                 << std::endl;
+      g_chunk_code_log << "<opt> clear V bit for "
+                       << m_idx
+                       << std::endl;
 #endif
       
       m_out_flags &= ~OVERFLOW_FLAG;
@@ -980,11 +972,9 @@ namespace ARMware
     cond_block() const
     { return mp_cond_block; }
     
-#if PRINT_CHUNK_CODE
     inline uint32_t
     idx() const
     { return m_idx; }
-#endif
   };
 }
 
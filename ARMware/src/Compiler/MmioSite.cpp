@@ -0,0 +1,155 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+
+#if ENABLE_DYNAMIC_TRANSLATOR
+
+#include <cstdlib>
+#include <cstring>
+
+#include "MmioSite.hpp"
+
+#include "../Core.hpp"
+#include "../RegisterBank.hpp"
+#include "../MmioProfiler.hpp"
+#include "../Utils/Number.hpp"
+
+#include "../AddressSpace.tcc"
+#include "../Mmu.tcc"
+#include "../Core.tcc"
+
+namespace ARMware
+{
+  bool MmioSite::ms_enable = false;
+  
+  ///////////////////////////////// Private ///////////////////////////////////
+  //============================== Operation ==================================
+  
+  void
+  MmioSite::resolve()
+  {
+    bool exception_occur = false;
+    uint32_t vaddr = m_vaddr;
+    
+    m_generation = gp_core->translation_generation();
+    m_mode = gp_core->CurrentMode();
+    
+    m_paddr = ((true == m_is_load)
+               ? gp_core->virtual_to_physical<TRANSLATION_ANY, DATA, READ>(vaddr, m_mode, exception_occur)
+               : gp_core->virtual_to_physical<TRANSLATION_ANY, DATA, WRITE>(vaddr, m_mode, exception_occur));
+    
+    // If the translation faults, the threaded code routine will fault in
+    // the same way, and raise the data abort.
+    if (true == exception_occur)
+    {
+      mp_bank = 0;
+    }
+    else
+    {
+      mp_bank = RegisterBankBase::find_bank(m_paddr,
+                                            ((true == m_is_load)
+                                             ? RegisterBankBase::REG_READ
+                                             : RegisterBankBase::REG_WRITE));
+    }
+  }
+  
+  ///////////////////////////////// Public ////////////////////////////////////
+  //============================== Life cycle =================================
+  
+  MmioSite::MmioSite(Inst const inst,
+                     GenericFunc const generic,
+                     uint32_t const base)
+    : m_inst(inst),
+      mp_generic(generic),
+      m_is_load(inst.mImmLSW.mLbit != 0),
+      m_rd(static_cast<CoreRegNum>(inst.mImmLSW.mRd)),
+      m_rn(static_cast<CoreRegNum>(inst.mImmLSW.mRn)),
+      m_base(base),
+      m_vaddr((inst.mImmLSW.mUbit != 0)
+              ? (base + inst.mImmLSW.mOff)
+              : (base - inst.mImmLSW.mOff)),
+      // Mmu::generation() starts from 1, thus the first run resolves it.
+      m_generation(0),
+      m_mode(MODE_USR),
+      m_paddr(0),
+      mp_bank(0)
+  {
+    assert(0 == (m_vaddr & 3));
+    assert(m_rd != CR_PC);
+    assert(m_rn != CR_PC);
+  }
+  
+  //============================== Operation ==================================
+  
+  void
+  MmioSite::init()
+  {
+#if ENABLE_INST_RECALL
+    // The instruction recall buffer is filled by the threaded code routines.
+    ms_enable = false;
+#else
+    char const * const enable = getenv("ARMWARE_DT_MMIO_SITES");
+    
+    // The MMIO profiler has to see every access in AddressSpace.
+    ms_enable = (((0 == enable) || (strcmp(enable, "0") != 0)) &&
+                 (false == g_mmio_profiler.is_enabled()));
+#endif
+  }
+  
+  /////////////////////////////////////////////////////////////////////////////
+  // dynamic translator version
+  
+  ExecResultEnum
+  exec_mmio_site_DT(MmioSite * const site)
+  {
+    if (gp_core->CurReg(site->m_rn) != site->m_base)
+    {
+      return (site->mp_generic)(site->m_inst);
+    }
+    
+    if ((site->m_generation != gp_core->translation_generation()) ||
+        (site->m_mode != gp_core->CurrentMode()))
+    {
+      site->resolve();
+    }
+    
+    if (0 == site->mp_bank)
+    {
+      return (site->mp_generic)(site->m_inst);
+    }
+    
+    if (true == site->m_is_load)
+    {
+      gp_core->rCurReg(site->m_rd) = site->mp_bank->read_register(site->m_paddr);
+      
+      gp_core->IncrePC();
+      
+      return ER_NORMAL;
+    }
+    else
+    {
+      site->mp_bank->write_register(site->m_paddr, gp_core->CurReg(site->m_rd));
+      
+      gp_core->IncrePC();
+      
+      // The same as the threaded code routine of STR.
+      return (0 == gp_core->curr_chunk()) ? ER_CHUNK_DISAPPEAR : ER_NORMAL;
+    }
+  }
+}
+
+#endif // #if ENABLE_DYNAMIC_TRANSLATOR
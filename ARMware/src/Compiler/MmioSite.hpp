@@ -0,0 +1,104 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+
+#ifndef MmioSite_hpp
+#define MmioSite_hpp
+
+#if ENABLE_DYNAMIC_TRANSLATOR
+
+#include "../ARMware.hpp"
+#include "../Inst/Inst.hpp"
+
+namespace ARMware
+{
+  class RegisterBankBase;
+  
+  // A word load or store (LDR/STR <Rd>, [<Rn>, #+/-<offset_12>]) in a
+  // dynamic translated chunk, whose base register is known to be a
+  // constant by GuestRegTracker.
+  //
+  // Instead of the threaded code routine of the instruction, the native
+  // codes call exec_mmio_site_DT() with this record. The first time it runs
+  // (and whenever Mmu::generation() or the processor mode changes), it
+  // translates the address once, and if it hits a register declared in a
+  // RegisterBank, the later runs read or write that register directly,
+  // skipping the MMU and the AddressSpace decoding. Otherwise, or if the
+  // base register doesn't hold the expected value, it falls back to the
+  // threaded code routine.
+  //
+  // ARMWARE_DT_MMIO_SITES=0 turns it off.
+  typedef class MmioSite MmioSite;
+  class MmioSite
+  {
+  public:
+    
+    typedef ExecResultEnum (*GenericFunc)(Inst const);
+    
+  private:
+    
+    // Attribute
+    
+    Inst const m_inst;
+    GenericFunc const mp_generic;
+    
+    bool const m_is_load;
+    CoreRegNum const m_rd;
+    CoreRegNum const m_rn;
+    uint32_t const m_base;
+    uint32_t const m_vaddr;
+    
+    // The translation is valid if both of them are still the same.
+    uint32_t m_generation;
+    CoreMode m_mode;
+    
+    uint32_t m_paddr;
+    RegisterBankBase const *mp_bank;
+    
+    static bool ms_enable;
+    
+    // Operation
+    
+    void resolve();
+    
+    friend ExecResultEnum exec_mmio_site_DT(MmioSite * const site);
+    
+  public:
+    
+    // Life cycle
+    
+    MmioSite(Inst const inst,
+             GenericFunc const generic,
+             uint32_t const base);
+    
+    // Operation
+    
+    static void init();
+    
+    // Inquery
+    
+    static inline bool
+    is_enabled()
+    { return ms_enable; }
+  };
+  
+  extern ExecResultEnum exec_mmio_site_DT(MmioSite * const site);
+}
+
+#endif // #if ENABLE_DYNAMIC_TRANSLATOR
+
+#endif
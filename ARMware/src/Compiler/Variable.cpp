@@ -22,12 +22,10 @@
 
 #include <algorithm>
 
-#if PRINT_CHUNK_CODE
 #include <cassert>
 
 #include <iostream>
 #include "../Log.hpp"
-#endif
 
 #endif
 
@@ -41,7 +39,6 @@ namespace ARMware
   /////////////////////////////////////////////////////////////////////////////
   // Public == Operation ======================================================
   
-#if PRINT_CHUNK_CODE
   std::string const Variable::GLOBAL_VAR_NAME[] =
   {
     "CR_0",
@@ -67,7 +64,6 @@ namespace ARMware
     "EXCEPTION_TYPE",
     "DEVICE_TIMER_INCREMENT"
   };
-#endif
   
 #if ENABLE_DYNAMIC_TRANSLATOR
   Variable::~Variable()
@@ -100,9 +100,7 @@ namespace ARMware
     };
     typedef enum GlobalVarEnum GlobalVarEnum;
     
-#if PRINT_CHUNK_CODE
     static std::string const GLOBAL_VAR_NAME[GLOBAL_VAR_TOTAL];
-#endif
     
     friend class MemoryPool<Variable, 256>;
     
@@ -133,9 +131,7 @@ namespace ARMware
       } m_TEMP;
     } u;
     
-#if PRINT_CHUNK_CODE
     uint32_t m_sequence_idx;
-#endif
     
     uint32_t m_idx;
     
@@ -174,10 +170,8 @@ namespace ARMware
     bool m_ssa_already_def;
 #endif
     
-#if PRINT_CHUNK_CODE
     uint32_t m_ssa_number;
     uint32_t m_ssa_number_stack;
-#endif
     
     Variable *mp_original_ssa_var;
     Variable *mp_join_var;
@@ -222,10 +216,8 @@ namespace ARMware
       m_ssa_already_def = false;
 #endif
       
-#if PRINT_CHUNK_CODE
       m_ssa_number = 0;
       m_ssa_number_stack = 0;
-#endif
     }
     
     inline
@@ -300,11 +292,9 @@ namespace ARMware
       mp_next_attached_var = var;
     }
     
-#if PRINT_CHUNK_CODE
     inline void
     set_sequence_idx(uint32_t const idx)
     { m_sequence_idx = idx; }
-#endif
     
     inline void
     set_idx(uint32_t const idx)
@@ -357,9 +347,7 @@ namespace ARMware
       
       mp_original_ssa_var = var;
       
-#if PRINT_CHUNK_CODE
       m_ssa_number = var->get_next_ssa_number();
-#endif
     }
     
     inline void
@@ -425,11 +413,11 @@ namespace ARMware
         
         dump_info<true>();
         
-        g_log_file << " reset Value to ";
+        g_chunk_code_log << " reset Value to ";
         
         var->dump_info<true>();
         
-        g_log_file << std::endl;
+        g_chunk_code_log << std::endl;
       }
       
     skip:
@@ -719,14 +707,12 @@ namespace ARMware
     scc_value_number() const
     { return mp_scc_value_number; }
     
-#if PRINT_CHUNK_CODE
     template<bool T_ssa_enabled>
     void dump_info() const;
     
     inline uint32_t
     get_next_ssa_number()
     { return ++m_ssa_number_stack; }
-#endif
     
 #if CHECK_CHUNK_CODE
     template<DefUseEnum T_type>
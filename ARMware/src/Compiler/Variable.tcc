@@ -139,7 +139,6 @@ namespace ARMware
   }
 #endif
   
-#if PRINT_CHUNK_CODE
   template<bool T_ssa_enabled>
   void
   Variable::dump_info() const
@@ -147,37 +146,37 @@ namespace ARMware
     switch (m_kind)
     {
     case Variable::MEMORY:
-      g_log_file << "MEMORY:";
+      g_chunk_code_log << "MEMORY:";
       
       goto print;
       
     case Variable::GLOBAL:
-      g_log_file << "GLOBAL:";
+      g_chunk_code_log << "GLOBAL:";
       
     print:
       
       switch (u.m_GLOBAL.m_global_var)
       {
-      case CR_0: g_log_file << "CR_0"; break;
-      case CR_1: g_log_file << "CR_1"; break;
-      case CR_2: g_log_file << "CR_2"; break;
-      case CR_3: g_log_file << "CR_3"; break;
-      case CR_4: g_log_file << "CR_4"; break;
-      case CR_5: g_log_file << "CR_5"; break;
-      case CR_6: g_log_file << "CR_6"; break;
-      case CR_7: g_log_file << "CR_7"; break;
-      case CR_8: g_log_file << "CR_8"; break;
-      case CR_9: g_log_file << "CR_9"; break;
-      case CR_10: g_log_file << "CR_10"; break;
-      case CR_11: g_log_file << "CR_11"; break;
-      case CR_12: g_log_file << "CR_12"; break;
-      case CR_13: g_log_file << "CR_13"; break;
-      case CR_14: g_log_file << "CR_14"; break;
-      case CR_15: g_log_file << "CR_15"; break;
-      case CPSR: g_log_file << "CPSR"; break;
-      case SPSR: g_log_file << "SPSR"; break;
-      case EXCEPTION_TYPE: g_log_file << "EXCEPT_TYPE"; break;
-      case DEVICE_TIMER_INCREMENT: g_log_file << "DEV_TIMER_INC"; break;
+      case CR_0: g_chunk_code_log << "CR_0"; break;
+      case CR_1: g_chunk_code_log << "CR_1"; break;
+      case CR_2: g_chunk_code_log << "CR_2"; break;
+      case CR_3: g_chunk_code_log << "CR_3"; break;
+      case CR_4: g_chunk_code_log << "CR_4"; break;
+      case CR_5: g_chunk_code_log << "CR_5"; break;
+      case CR_6: g_chunk_code_log << "CR_6"; break;
+      case CR_7: g_chunk_code_log << "CR_7"; break;
+      case CR_8: g_chunk_code_log << "CR_8"; break;
+      case CR_9: g_chunk_code_log << "CR_9"; break;
+      case CR_10: g_chunk_code_log << "CR_10"; break;
+      case CR_11: g_chunk_code_log << "CR_11"; break;
+      case CR_12: g_chunk_code_log << "CR_12"; break;
+      case CR_13: g_chunk_code_log << "CR_13"; break;
+      case CR_14: g_chunk_code_log << "CR_14"; break;
+      case CR_15: g_chunk_code_log << "CR_15"; break;
+      case CPSR: g_chunk_code_log << "CPSR"; break;
+      case SPSR: g_chunk_code_log << "SPSR"; break;
+      case EXCEPTION_TYPE: g_chunk_code_log << "EXCEPT_TYPE"; break;
+      case DEVICE_TIMER_INCREMENT: g_chunk_code_log << "DEV_TIMER_INC"; break;
         
       case GLOBAL_VAR_TOTAL:
         assert(!"I should not use GLOBAL_VAR_TOTAL as a real global variable.");
@@ -190,15 +189,15 @@ namespace ARMware
       break;
       
     case Variable::TEMP:
-      g_log_file << "TEMP:"
-                 << std::dec
-                 << m_sequence_idx;
+      g_chunk_code_log << "TEMP:"
+                       << std::dec
+                       << m_sequence_idx;
       break;
       
     case Variable::CONST:
-      g_log_file << "CONST:0x"
-                 << std::hex
-                 << u.m_CONST.m_value;
+      g_chunk_code_log << "CONST:0x"
+                       << std::hex
+                       << u.m_CONST.m_value;
       break;
       
     default:
@@ -208,9 +207,9 @@ namespace ARMware
     
     if (true == T_ssa_enabled)
     {
-      g_log_file << "-"
-                 << std::dec
-                 << m_ssa_number;
+      g_chunk_code_log << "-"
+                       << std::dec
+                       << m_ssa_number;
     }
     
     Register *reg;
@@ -226,11 +225,10 @@ namespace ARMware
     
     if (reg != 0)
     {
-      g_log_file << "(";
+      g_chunk_code_log << "(";
       reg->dump_info();
-      g_log_file << ")";
+      g_chunk_code_log << ")";
     }
   }
-#endif
 #endif // ENABLE_DYNAMIC_TRANSLATOR
 }
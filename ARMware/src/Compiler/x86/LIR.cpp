@@ -17,11 +17,9 @@
 
 #if ENABLE_DYNAMIC_TRANSLATOR
 
-#if PRINT_CHUNK_CODE
 #include <iostream>
 #include "../../Log.hpp"
 #include "../Variable.hpp"
-#endif
 
 #include "LIR.hpp"
 #include "Register.hpp"
@@ -58,7 +56,6 @@ namespace ARMware
   
   //========================== Operation ======================================
   
-#if PRINT_CHUNK_CODE
   std::string const LIR::KIND_NAME[] = 
   {
     "PHI",
@@ -158,7 +155,6 @@ namespace ARMware
     "BT",
     "CMC"
   };
-#endif
   
 #if CHECK_CHUNK_CODE
   void
@@ -227,9 +227,7 @@ namespace ARMware
     
   private:
     
-#if PRINT_CHUNK_CODE
     static std::string const KIND_NAME[KIND_TOTAL];
-#endif
     
     KindEnum m_kind;
     uint32_t m_idx;
@@ -1348,10 +1346,8 @@ namespace ARMware
     void check_live_interval_preallocated_reg();
 #endif
     
-#if PRINT_CHUNK_CODE
     template<bool T_ssa_enabled, bool T_print_memory_operation_idx>
     void dump_info() const;
-#endif
     
     // Access
     
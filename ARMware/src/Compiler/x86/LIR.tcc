@@ -19,12 +19,11 @@
 
 namespace ARMware
 {
-#if PRINT_CHUNK_CODE
   template<bool T_ssa_enabled, bool T_print_memory_operation_idx>
   void
   LIR::dump_info() const
   {
-    g_log_file << KIND_NAME[m_kind];
+    g_chunk_code_log << KIND_NAME[m_kind];
     
     switch (m_kind)
     {
@@ -35,200 +34,200 @@ namespace ARMware
       // thus I shouldn't face a condition of dumpping the info of Phi nodes.
       assert(true == T_ssa_enabled);
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       
       m_dest.front()->variable()->dump_info<T_ssa_enabled>();
-      g_log_file << ": ";
+      g_chunk_code_log << ": ";
       
       for (std::vector<OperandKind *>::const_iterator iter = m_operand.begin();
            iter != m_operand.end();
            ++iter)
       {
         (*iter)->variable()->dump_info<T_ssa_enabled>();
-        g_log_file << " ";
+        g_chunk_code_log << " ";
       }
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case FRAME:
       if (true == T_print_memory_operation_idx)
       {
-        g_log_file << " ("
-                   << m_memory_operation_idx
-                   << ")";
+        g_chunk_code_log << " ("
+                         << m_memory_operation_idx
+                         << ")";
       }
       
-      g_log_file << " [";
+      g_chunk_code_log << " [";
       
       for (std::vector<OperandKind *>::const_iterator iter = m_memory_def_list.begin();
            iter != m_memory_def_list.end();
            ++iter)
       {
         (*iter)->variable()->dump_info<T_ssa_enabled>();
-        g_log_file << " ";
+        g_chunk_code_log << " ";
       }
       
-      g_log_file << "]"
-                 << std::endl;
+      g_chunk_code_log << "]"
+                       << std::endl;
       break;
       
     case CALL:
       if (true == T_print_memory_operation_idx)
       {
-        g_log_file << " ("
-                   << m_memory_operation_idx
-                   << ")";
+        g_chunk_code_log << " ("
+                         << m_memory_operation_idx
+                         << ")";
       }
       
-      g_log_file << " [";
+      g_chunk_code_log << " [";
       
       for (std::vector<OperandKind *>::const_iterator iter = m_memory_use_list.begin();
            iter != m_memory_use_list.end();
            ++iter)
       {
         (*iter)->variable()->dump_info<T_ssa_enabled>();
-        g_log_file << " ";
+        g_chunk_code_log << " ";
       }
       
-      g_log_file << "] [";
+      g_chunk_code_log << "] [";
       
       for (std::vector<OperandKind *>::const_iterator iter = m_memory_def_list.begin();
            iter != m_memory_def_list.end();
            ++iter)
       {
         (*iter)->variable()->dump_info<T_ssa_enabled>();
-        g_log_file << " ";
+        g_chunk_code_log << " ";
       }
       
-      g_log_file << "]"
-                 << std::endl;
+      g_chunk_code_log << "]"
+                       << std::endl;
       break;
       
     case PUSH_R:
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand.front()->variable()->dump_info<T_ssa_enabled>();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case PUSH_I:
-      g_log_file << " "
-                 << m_operand.front()->imm()
-                 << std::endl;
+      g_chunk_code_log << " "
+                       << m_operand.front()->imm()
+                       << std::endl;
       break;
       
     case RETURN:
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case MOV_R_2_R:
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand.front()->variable()->dump_info<T_ssa_enabled>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_dest.front()->variable()->dump_info<T_ssa_enabled>();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case MOV_I_2_R:
-      g_log_file << " 0x"
-                 << std::hex
-                 << m_operand.front()->imm();
+      g_chunk_code_log << " 0x"
+                       << std::hex
+                       << m_operand.front()->imm();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_dest.front()->variable()->dump_info<T_ssa_enabled>();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case MOV_FROM_M:
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand.front()->variable()->dump_info<T_ssa_enabled>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_dest.front()->variable()->dump_info<T_ssa_enabled>();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case MOV_FROM_A:
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_dest.front()->variable()->dump_info<T_ssa_enabled>();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case MOV_LABEL_2_R:
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_dest.front()->variable()->dump_info<T_ssa_enabled>();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case LOAD_GLOBAL:
       if (true == T_print_memory_operation_idx)
       {
-        g_log_file << " ("
-                   << m_memory_operation_idx
-                   << ")";
+        g_chunk_code_log << " ("
+                         << m_memory_operation_idx
+                         << ")";
       }
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       
       m_dest.front()->variable()->dump_info<T_ssa_enabled>();
       
-      g_log_file << " [";
+      g_chunk_code_log << " [";
       
       for (std::vector<OperandKind *>::const_iterator iter = m_memory_use_list.begin();
            iter != m_memory_use_list.end();
            ++iter)
       {
         (*iter)->variable()->dump_info<T_ssa_enabled>();
-        g_log_file << " ";
+        g_chunk_code_log << " ";
       }
       
-      g_log_file << "]"
-                 << std::endl;
+      g_chunk_code_log << "]"
+                       << std::endl;
       break;
       
     case STORE_GLOBAL:
       if (true == T_print_memory_operation_idx)
       {
-        g_log_file << " ("
-                   << m_memory_operation_idx
-                   << ")";
+        g_chunk_code_log << " ("
+                         << m_memory_operation_idx
+                         << ")";
       }
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       
       m_operand.front()->variable()->dump_info<T_ssa_enabled>();
       
-      g_log_file << " [";
+      g_chunk_code_log << " [";
       
       for (std::vector<OperandKind *>::const_iterator iter = m_memory_use_list.begin();
            iter != m_memory_use_list.end();
            ++iter)
       {
         (*iter)->variable()->dump_info<T_ssa_enabled>();
-        g_log_file << " ";
+        g_chunk_code_log << " ";
       }
       
-      g_log_file << "] [";
+      g_chunk_code_log << "] [";
       
       for (std::vector<OperandKind *>::const_iterator iter = m_memory_def_list.begin();
            iter != m_memory_def_list.end();
            ++iter)
       {
         (*iter)->variable()->dump_info<T_ssa_enabled>();
-        g_log_file << " ";
+        g_chunk_code_log << " ";
       }
       
-      g_log_file << "]"
-                 << std::endl;
+      g_chunk_code_log << "]"
+                       << std::endl;
       break;
       
     case ADD_RR:
@@ -242,16 +241,16 @@ namespace ARMware
     case LSFT_RIGHT_RR:
     case ASFT_RIGHT_RR:
     case ROR_RR:
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand.front()->variable()->dump_info<T_ssa_enabled>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand.back()->variable()->dump_info<T_ssa_enabled>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_dest.front()->variable()->dump_info<T_ssa_enabled>();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case ADD_RI:
@@ -265,113 +264,113 @@ namespace ARMware
     case LSFT_RIGHT_RI:
     case ASFT_RIGHT_RI:
     case ROR_RI:
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand.front()->variable()->dump_info<T_ssa_enabled>();
       
-      g_log_file << " 0x"
-                 << std::hex
-                 << m_operand.back()->imm();
+      g_chunk_code_log << " 0x"
+                       << std::hex
+                       << m_operand.back()->imm();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_dest.front()->variable()->dump_info<T_ssa_enabled>();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case MUL32:
     case IMUL32:
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand.front()->variable()->dump_info<T_ssa_enabled>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand.back()->variable()->dump_info<T_ssa_enabled>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_dest.front()->variable()->dump_info<T_ssa_enabled>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_dest.back()->variable()->dump_info<T_ssa_enabled>();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case CMP_RR:
     case TST_RR:
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand.front()->variable()->dump_info<T_ssa_enabled>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand.back()->variable()->dump_info<T_ssa_enabled>();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case CMP_RI:
     case TST_RI:
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand.front()->variable()->dump_info<T_ssa_enabled>();
       
-      g_log_file << " 0x"
-                 << std::hex
-                 << m_operand.back()->imm()
-                 << std::endl;
+      g_chunk_code_log << " 0x"
+                       << std::hex
+                       << m_operand.back()->imm()
+                       << std::endl;
       break;
       
     case SET_S:
     case SET_Z:
     case SET_C:
     case SET_O:
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_dest.front()->variable()->dump_info<T_ssa_enabled>();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case LOAD_SP:
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_dest.front()->variable()->dump_info<T_ssa_enabled>();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case STORE_SP:
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand.front()->variable()->dump_info<T_ssa_enabled>();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case ADD_SP:
-      g_log_file << " "
-                 << m_operand.front()->imm()
-                 << std::endl;
+      g_chunk_code_log << " "
+                       << m_operand.front()->imm()
+                       << std::endl;
       break;
       
     case BT:
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand.front()->variable()->dump_info<T_ssa_enabled>();
       
-      g_log_file << " "
-                 << m_operand.back()->imm();
+      g_chunk_code_log << " "
+                       << m_operand.back()->imm();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case JMP_R:
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand.front()->variable()->dump_info<T_ssa_enabled>();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case NOT:
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_operand.front()->variable()->dump_info<T_ssa_enabled>();
       
-      g_log_file << " ";
+      g_chunk_code_log << " ";
       m_dest.front()->variable()->dump_info<T_ssa_enabled>();
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case JMP_I:
@@ -390,21 +389,21 @@ namespace ARMware
       switch (m_operand.front()->label()->kind())
       {
       case Label::BASIC_BLOCK:
-        g_log_file << " (BB)"
-                   << m_operand.front()->label()->bb()->sequence_idx();
+        g_chunk_code_log << " (BB)"
+                         << m_operand.front()->label()->bb()->sequence_idx();
         break;
         
       default:
         break;
       }
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     case PUSHF:
     case POPF:
     case CMC:
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
       break;
       
     default:
@@ -415,7 +414,6 @@ namespace ARMware
       break;
     }
   }
-#endif
   
   template<bool T_need_load_store>
   void
@@ -25,18 +25,17 @@ namespace ARMware
 {
   std::vector<Register::RegisterWeight> Register::REG_WEIGHT;
   
-#if PRINT_CHUNK_CODE
   void
   Register::dump_info() const
   {
     switch (m_kind)
     {
-    case EAX: g_log_file << "EAX"; break;
-    case EBX: g_log_file << "EBX"; break;
-    case ECX: g_log_file << "ECX"; break;
-    case EDX: g_log_file << "EDX"; break;
-    case ESI: g_log_file << "ESI"; break;
-    case EDI: g_log_file << "EDI"; break;
+    case EAX: g_chunk_code_log << "EAX"; break;
+    case EBX: g_chunk_code_log << "EBX"; break;
+    case ECX: g_chunk_code_log << "ECX"; break;
+    case EDX: g_chunk_code_log << "EDX"; break;
+    case ESI: g_chunk_code_log << "ESI"; break;
+    case EDI: g_chunk_code_log << "EDI"; break;
       
     default:
       assert(!"Should not reach here.");
@@ -49,23 +48,22 @@ namespace ARMware
   {
     switch (m_kind)
     {
-    case EAX: g_log_file << "EAX"; break;
-    case EBX: g_log_file << "EBX"; break;
-    case ECX: g_log_file << "ECX"; break;
-    case EDX: g_log_file << "EDX"; break;
-    case ESI: g_log_file << "ESI"; break;
-    case EDI: g_log_file << "EDI"; break;
+    case EAX: g_chunk_code_log << "EAX"; break;
+    case EBX: g_chunk_code_log << "EBX"; break;
+    case ECX: g_chunk_code_log << "ECX"; break;
+    case EDX: g_chunk_code_log << "EDX"; break;
+    case ESI: g_chunk_code_log << "ESI"; break;
+    case EDI: g_chunk_code_log << "EDI"; break;
       
     default:
       assert(!"Should not reach here.");
       break;
     }
     
-    g_log_file << "= "
-               << std::dec
-               << m_weight;
+    g_chunk_code_log << "= "
+                     << std::dec
+                     << m_weight;
   }
-#endif
 }
 
 #endif
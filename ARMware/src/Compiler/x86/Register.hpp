@@ -81,9 +81,7 @@ namespace ARMware
         return (m_weight < weight.m_weight) ? true : false;
       }
       
-#if PRINT_CHUNK_CODE
       void dump_info() const;
-#endif
     };
     typedef struct RegisterWeight RegisterWeight;
     
@@ -331,9 +329,7 @@ namespace ARMware
       }
     }
     
-#if PRINT_CHUNK_CODE
     void dump_info() const;
-#endif
   };
 }
 
@@ -20,6 +20,13 @@
 #include <iostream>
 #include <cassert>
 
+#if ENABLE_DYNAMIC_TRANSLATOR && PROFILE_DT_COMPILE
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#endif
+
 #include "Core.hpp"
 #include "ARMware.hpp"
 #include "SysCoProc.hpp"
@@ -41,6 +48,10 @@
 #include "ChunkChain.hpp"
 #endif
 
+#if ENABLE_DYNAMIC_TRANSLATOR && PROFILE_DT_COMPILE
+#include "Compiler/CompileProfiler.hpp"
+#endif
+
 #include "Database/MachineImpl.hpp"
 
 #include "Gtk/MachineScreen.hpp"
@@ -64,7 +75,7 @@ namespace ARMware
   Core::Core(MachineImpl const &machineImpl,
              MachineScreen * const machine_screen,
              SoftKeyboard * const soft_keyboard,
-             SerialConsole &serial_console)
+             SerialConsole * const serial_console)
     : mpSysCoProc(new SysCoProc(this)),
       mpEgpio(new Egpio(this)),
       mp_memory(new Memory(32 * 1024 * 1024, machine_screen)),
@@ -94,8 +105,10 @@ namespace ARMware
       mpResetController(new ResetController()),
       mpRomFile(new RomFile(this, mpEgpio.get(), machineImpl.get_rom_file())),
       mpAddressSpace(new AddressSpace(this, mpOsTimer.get())),
-      mpMmu(new Mmu(this, mpSysCoProc.get(), mpAddressSpace.get())),
+      mpMmu(new Mmu(mpSysCoProc.get(), mpAddressSpace.get())),
+      mp_fast_mem(new FastMem()),
       m_idle_mode(false),
+      m_stop_requested(false),
 #if USE_SHIFTER_CARRY
       mShifterCarry(0),
 #endif
@@ -104,13 +117,25 @@ namespace ARMware
       m_chunk_length(0),
       m_chunk_disappear(false),
       m_device_timer_increment(1),
+      m_exec_tier(RuntimeStats::INST_INTERPRETER),
+      m_chunk_vaddr(0),
+      m_back_branch_idx(0),
+      m_access_idx(0),
       mp_curr_chunk(0),
 #if CHECK_CHUNK_CODE
       mp_delay_clean_chunk(0),
 #endif
       mp_chunk_chain(new ChunkChain(this)),
 #endif
-      m_UART_clocks(0),
+      m_virtual_clocks(0),
+      m_serial_1_deadline(0),
+      m_serial_3_deadline(0),
+      m_translation_mode(TRANSLATION_MMU_OFF),
+      m_fetch_vpage(0),
+      m_fetch_ppage(0),
+      mp_fetch_host(0),
+      m_fetch_mode(MODE_SVC),
+      m_fetch_generation(0),
       m_3_6864_mhz_clocks(0),
       m_get_event_clocks(0),
       mp_machine_screen(machine_screen)
@@ -149,10 +174,21 @@ namespace ARMware
     
 #endif // ENABLE_THREADED_CODE
     
-    mp_machine_screen->register_memory(mp_memory->get_memory_buffer());
-    mp_machine_screen->register_LCD_controller(mp_LCD_controller.get());
+    mp_memory->register_walk_cache(mpMmu->walk_cache());
+    mpMmu->shadow_tlb()->register_memory(mp_memory->get_memory_buffer());
+    
+    g_frame_capture.register_memory(mp_memory->get_memory_buffer());
+    
+    if (mp_machine_screen != 0)
+    {
+      mp_machine_screen->register_memory(mp_memory->get_memory_buffer());
+      mp_machine_screen->register_LCD_controller(mp_LCD_controller.get());
+    }
     
-    soft_keyboard->register_GPIO_control_block(mp_GPIO_control_block.get());
+    if (soft_keyboard != 0)
+    {
+      soft_keyboard->register_GPIO_control_block(mp_GPIO_control_block.get());
+    }
     
     mpAddressSpace->RegisterIntController(mpIntController.get());
     mpAddressSpace->RegisterGPIOControlBlock(mp_GPIO_control_block.get());
@@ -228,6 +264,11 @@ namespace ARMware
   // This is not what I want.
   Core::~Core()
   {
+    // Stop the render thread of the machine screen before the memory is released.
+    if (mp_machine_screen != 0)
+    {
+      mp_machine_screen->register_memory(0);
+    }
   }
   
   //================================ Operation ================================
@@ -266,11 +307,160 @@ namespace ARMware
     }
   }
 #endif
+  
+#if ENABLE_DYNAMIC_TRANSLATOR && PROFILE_DT_COMPILE
+  // Feed the chunks captured by CompileProfiler (one chunk per line)
+  // through the threaded code generator and the dynamic compiler again,
+  // without executing them, and then dump the compile profile.
+  //
+  // Because the generated native codes are never executed, the chunks
+  // don't have to reside in the emulated memory, nor do I need to
+  // protect the physical memory pages of them.
+  //
+  // Run by 'armware --replay-chunk-corpus' (see ChunkCorpusReplay).
+  //
+  // @false: the corpus can not be opened.
+  bool
+  Core::replay_chunk_corpus(char const * const corpus_file)
+  {
+    std::ifstream corpus(corpus_file);
+    
+    if (false == corpus.is_open())
+    {
+      g_log_file << "Can not open the chunk corpus: " << corpus_file << std::endl;
+      return false;
+    }
+    
+    std::string line;
+    
+    while (std::getline(corpus, line))
+    {
+      std::istringstream record(line);
+      uint32_t paddr;
+      uint32_t length;
+      
+      record >> std::hex >> paddr >> std::dec >> length >> std::hex;
+      
+#if ASSUME_NOT_USE_TINY_PAGE
+      if (!record || (0 == length) || (length >= SIZE_4K))
+#else
+      if (!record || (0 == length) || (length >= SIZE_1K))
+#endif
+      {
+        continue;
+      }
+      
+      std::vector<uint32_t> raw_insts(length);
+      
+      for (uint32_t i = 0; i < length; ++i)
+      {
+        record >> raw_insts[i];
+      }
+      
+      if (!record)
+      {
+        continue;
+      }
+      
+      Chunk * const chunk = new Chunk(paddr);
+      
+      chunk->set_scratch();
+      chunk->set_length(length);
+      
+      mp_curr_chunk = chunk;
+      
+      chunk->alloc_tc_buffer();
+      
+      for (std::vector<uint32_t>::const_iterator iter = raw_insts.begin();
+           iter != raw_insts.end();
+           ++iter)
+      {
+        (void)decode<USAGE_THREADED_CODE, TRANSLATION_ANY>(Inst(*iter));
+      }
+      
+      chunk->set_status(Chunk::ST_THREADED_CODE);
+      
+      chunk->gen_dt_code();
+      
+      mp_curr_chunk = 0;
+      
+      delete chunk;
+    }
+    
+    g_compile_profiler.dump(g_log_file);
     
+    return true;
+  }
+#endif
+  
+#if ENABLE_DYNAMIC_TRANSLATOR
   void
-  Core::run()
+  Core::inspect_hot_chunks()
   {
-    while (1)
+    assert(0 == mp_curr_chunk);
+    
+    std::vector<Chunk *> chunks;
+    
+    mp_chunk_chain->collect_dynamic_chunks(chunks);
+    
+    g_chunk_inspector.select_hot_chunks(chunks);
+    
+    if (false == g_chunk_inspector.begin_report())
+    {
+      return;
+    }
+    
+    Chunk * const saved_chunk = gp_chunk;
+    
+    for (std::vector<Chunk *>::const_iterator iter = chunks.begin();
+         iter != chunks.end();
+         ++iter)
+    {
+      g_chunk_inspector.begin_chunk(*iter);
+      
+      // The intermediate products of a chunk are deleted after it is compiled,
+      // thus I compile a copy of it again to print them out.
+      // The same as replay_chunk_corpus(), the copy is never executed.
+      Chunk * const chunk = new Chunk((*iter)->start_paddr());
+      
+      chunk->set_scratch();
+      chunk->set_print_code();
+      chunk->set_length((*iter)->length());
+      
+      mp_curr_chunk = chunk;
+      
+      chunk->alloc_tc_buffer();
+      
+      for (uint32_t i = 0; i < (*iter)->length(); ++i)
+      {
+        (void)decode<USAGE_THREADED_CODE, TRANSLATION_ANY>((*iter)->peek_arm_inst_info(i)->inst());
+      }
+      
+      chunk->set_status(Chunk::ST_THREADED_CODE);
+      
+      chunk->gen_dt_code();
+      
+      mp_curr_chunk = 0;
+      
+      delete chunk;
+      
+      g_chunk_inspector.end_chunk(*iter);
+    }
+    
+    // Don't leave gp_chunk pointing to a deleted copy.
+    gp_chunk = saved_chunk;
+    
+    g_chunk_inspector.end_report();
+  }
+#endif
+    
+  // Runs the interpreter with the variant of the memory instructions for
+  // T_mode, until the machine is stopped or CP15 changes the translation mode.
+  template<TranslationModeEnum T_mode>
+  void
+  Core::run_in_mode()
+  {
+    while ((false == m_stop_requested) && (T_mode == m_translation_mode))
     {
       // :SA-1110 Developer's Manual: p.45: Wei 2004-Jan-09:
       //
@@ -304,7 +494,7 @@ namespace ARMware
         m_exception_type = EXCEPTION_NONE;
 #endif
         
-        ExecResultEnum const result = exec();
+        ExecResultEnum const result = exec<T_mode>();
         
         switch (result)
         {
@@ -376,6 +566,32 @@ namespace ARMware
     }
   }
   
+  void
+  Core::run()
+  {
+    while (false == m_stop_requested)
+    {
+      switch (m_translation_mode)
+      {
+      case TRANSLATION_MMU_OFF:
+        run_in_mode<TRANSLATION_MMU_OFF>();
+        break;
+        
+      case TRANSLATION_MMU_ON:
+        run_in_mode<TRANSLATION_MMU_ON>();
+        break;
+        
+      case TRANSLATION_MMU_ON_FCSE:
+        run_in_mode<TRANSLATION_MMU_ON_FCSE>();
+        break;
+        
+      default:
+        assert(!"Should not reach here.");
+        break;
+      }
+    }
+  }
+  
   void
   Core::reset()
   {
@@ -395,6 +611,8 @@ namespace ARMware
     m_CPSR |= IBIT_MASK;
     
     mpSysCoProc->reset();
+    invalidate_translation();
+    flush_walk_cache();
     
 #if CONFIG_CPU_SA1110
     // :SA-1110 Developer's Manual: Wei 2004-Jan-08:
@@ -434,6 +652,8 @@ namespace ARMware
   void
   Core::raise_UND_exception()
   {
+    g_runtime_stats.increase(RuntimeStats::EXCEPTION_UND_RAISED);
+    
     // :ARM-DDI-0100E: p.A2-15: Wei 2004-Apr-26:
     //
     // R14_und = address of next instruction after the undefined instruction
@@ -478,6 +698,8 @@ namespace ARMware
   void
   Core::raise_SWI_exception()
   {
+    g_runtime_stats.increase(RuntimeStats::EXCEPTION_SWI_RAISED);
+    
     // :ARM-DDI-0100E: p.A2-16: Wei 2004-Apr-26:
     //
     // R14_svc = address of next instruction after the SWI instruction
@@ -516,6 +738,8 @@ namespace ARMware
   void
   Core::raise_IRQ_exception()
   {
+    g_runtime_stats.increase(RuntimeStats::IRQ_DELIVERED);
+    
     // :ARM-DDI-0100E: p.A2-19: Wei 2004-Apr-26:
     //
     // R14_irq = address of next instruction to be executed + 4
@@ -554,6 +778,8 @@ namespace ARMware
   void
   Core::raise_FIQ_exception()
   {
+    g_runtime_stats.increase(RuntimeStats::FIQ_DELIVERED);
+    
     // :ARM-DDI-0100E: p.A2-20: Wei 2004-Apr-26:
     //
     // R14_fiq = address of next instruction to be executed + 4
@@ -604,6 +830,8 @@ namespace ARMware
   void
   Core::raise_prefetch_abort()
   {
+    g_runtime_stats.increase(RuntimeStats::EXCEPTION_PREFETCH_RAISED);
+    
     // :ARM-DDI-0100E: p.A2-16: Wei 2004-Apr-26:
     //
     // R14_abt = address of the aborted instruction + 4
@@ -642,6 +870,8 @@ namespace ARMware
   void
   Core::raise_data_abort()
   {
+    g_runtime_stats.increase(RuntimeStats::EXCEPTION_DATA_RAISED);
+    
     // :ARM-DDI-0100E: p.A2-17: Wei 2004-Apr-26:
     //
     // R14_abt = address of the aborted instruction + 8
@@ -937,13 +1167,18 @@ namespace ARMware
     uint32_t chunk_length = mp_curr_chunk->length();
     uint32_t paddr = mp_curr_chunk->start_paddr();
     
+    uint64_t const start_tsc = read_time_stamp_counter();
+    
     mp_curr_chunk->alloc_tc_buffer();
     
     do
     {
       Inst inst(mp_memory->get_data<DataWidthTraits<WORD>::UnsignedType>(paddr));
       
-      (void)decode<USAGE_THREADED_CODE>(inst);
+      // The ArgList keeps the variants of all the translation modes, and
+      // exec_threaded_code() selects one of them, thus the translation mode
+      // doesn't matter here.
+      (void)decode<USAGE_THREADED_CODE, TRANSLATION_ANY>(inst);
       
       paddr += 4;
     }
@@ -986,6 +1221,9 @@ namespace ARMware
 #endif
     
     mp_curr_chunk->set_status(Chunk::ST_THREADED_CODE);
+    
+    g_runtime_stats.increase(RuntimeStats::CHUNK_GEN_THREADED_CODE);
+    g_runtime_stats.increase(RuntimeStats::CYCLES_GEN_THREADED_CODE, read_time_stamp_counter() - start_tsc);
   }
   
   inline ExecResultEnum
@@ -1004,6 +1242,8 @@ namespace ARMware
     
     mp_curr_chunk->reset_arm_idx();
     
+    m_exec_tier = RuntimeStats::INST_THREADED_CODE;
+    
 #if CHECK_THREADED_CODE_PC
     uint32_t prev_pc = m_curr_reg_bank[CR_PC];
     
@@ -1032,7 +1272,7 @@ namespace ARMware
       // :NOTE: Wei 2004-Aug-18:
       //
       // I only cache the instructions located in DRAM.
-      uint32_t const paddr = virtual_to_physical<INST, READ>(m_curr_reg_bank[CR_PC], m_curr_mode, exception_occur);
+      uint32_t const paddr = virtual_to_physical<TRANSLATION_ANY, INST, READ>(m_curr_reg_bank[CR_PC], m_curr_mode, exception_occur);
       
       assert(false == exception_occur);
       
@@ -1074,8 +1314,11 @@ namespace ARMware
         {
           ++m_device_timer_increment;
           
-          // Execute the instruction.
-          ExecResultEnum const result = (arm_inst_info->func_TC())(arm_inst_info->inst());
+          // Execute the variant of the instruction for the current
+          // translation mode, which is read again for every instruction,
+          // because a CP15 write in this chunk may change it.
+          ExecResultEnum const result =
+            (arm_inst_info->func_TC(m_translation_mode))(arm_inst_info->inst());
           
           switch (result)
           {
@@ -1301,9 +1544,9 @@ namespace ARMware
     bool exception_occur = false;
     uint32_t addr = m_curr_reg_bank[CR_PC];
     
-    uint32_t const paddr = virtual_to_physical<INST, READ>(addr,
-                                                           m_curr_mode,
-                                                           exception_occur);
+    uint32_t const paddr = virtual_to_physical<TRANSLATION_ANY, INST, READ>(addr,
+                                                                            m_curr_mode,
+                                                                            exception_occur);
     
     assert(false == exception_occur);
     
@@ -1370,6 +1613,8 @@ namespace ARMware
     
     m_device_timer_increment = 0;
     
+    m_exec_tier = RuntimeStats::INST_DYNAMIC;
+    
     void const * const addr = mp_curr_chunk->native_code_begin();
     
 #if PRINT_CHUNK_CODE
@@ -1399,6 +1644,8 @@ namespace ARMware
     m_exec_in_chunk = false;
 #endif
     
+    mp_curr_chunk->increase_exec_inst_number(m_device_timer_increment);
+    
     reset_chunk_after_tc_or_dt();
     
 #if CHECK_PC_MODIFY
@@ -1493,16 +1740,177 @@ namespace ARMware
       return 0;
     }
   }
+  
+  uint32_t
+  Core::peek_dram_word(uint32_t const paddr) const
+  {
+    assert(0 == (paddr & 3));
+    
+    return mp_memory->get_data<uint32_t>(paddr);
+  }
+#endif
+  
+#if ENABLE_THREADED_CODE
+  void
+  Core::track_chunk(uint32_t const paddr)
+  {
+    // :NOTE: Wei 2004-Aug-02:
+    //
+    // Because of simplifying the detection of self-modified codes,
+    // I only generate threaded codes for the codes reside in the emulated dynamic memory.
+    // 
+    // That is to say, if the codes reside in other places, like emulated ROM,
+    // I just left them untranslated, and executes them originally no matter how many times
+    // they executed.
+    //
+    // (In H3600, the emulated dynamic memory resides in 0xC0000000 ~ 0xC1FFFFFF)
+    if (0xC0000000 == (paddr & 0xCE000000))
+    {
+      if (0 == mp_curr_chunk)
+      {
+        // :NOTE: Wei 2004-Aug-14:
+        //
+        // There is no current basic block for now,
+        // thus we should find a new one or an old one.
+        
+        // :NOTE: Wei 2004-Aug-16:
+        //
+        // reset the basic block length to 1.
+        m_chunk_length = 1;
+        
+        m_chunk_start = true;
+        
+        mp_curr_chunk = mp_chunk_chain->find_chunk(paddr - MachineType::DRAM_BASE);
+      }
+      else
+      {
+        // :NOTE: Wei 2004-Aug-13:
+        //
+        // We have a basic block now.
+        
+        assert(m_chunk_length != 0);
+      }
+      
+      // :NOTE: Wei 2004-Aug-02:
+      //
+      // The minimal page size of ARM is 1 Kb,
+      // thus I enforce every basic block totally resides in one 1 kb page
+      // to ensure that when each basic block is executed,
+      // I won't get a prefetch abort exception in the middle of it.
+#if ASSUME_NOT_USE_TINY_PAGE
+      if ((SIZE_4K - 4) == (paddr & (SIZE_4K - 1)))
+#else
+      if ((SIZE_1K - 4) == (paddr & (SIZE_1K - 1)))
+#endif
+      {
+        finalize_chunk_no_check();
+      }
+    }
+    else
+    {
+      // :NOTE: Wei 2004-Aug-18:
+      //
+      // We have a basic block, however, we try to execute an instruction not located in RAM.
+      // Thus I should finish the current basic block.
+      if (mp_curr_chunk != 0)
+      {
+        finalize_chunk_no_check(--m_chunk_length);
+      }
+    }
+  }
 #endif
   
+  // The same as get_data<WORD, INST>() at the PC, but the host address of
+  // the code page is kept while the fetches stay in that page, so that a
+  // sequential fetch needs neither the translation nor the AddressSpace
+  // decoding.
+  //
+  // The page is dropped when the mode changes, or when the generation of
+  // Mmu changes (a TLB is flushed, the control, translation table base,
+  // domain access control or PID register is written, or the flash ROM
+  // leaves the read array mode).
+  template<TranslationModeEnum T_mode>
+  inline uint32_t
+  Core::fetch_inst(bool &exception_occur)
+  {
+#if ENABLE_THREADED_CODE
+    // See the notes about m_chunk_length in get_data().
+    ++m_chunk_length;
+#endif
+    
+    uint32_t vaddr = m_curr_reg_bank[CR_PC];
+    uint32_t const vpage = (vaddr & ~(FETCH_PAGE_SIZE - 1));
+    uint32_t const offset = (vaddr & (FETCH_PAGE_SIZE - 1));
+    uint32_t paddr;
+    uint32_t inst;
+    
+    if ((vpage == m_fetch_vpage) &&
+        (m_curr_mode == m_fetch_mode) &&
+        (mpMmu->generation() == m_fetch_generation))
+    {
+      paddr = (m_fetch_ppage | offset);
+      
+#if ENABLE_INST_RECALL
+      RecordPaddr<INST>(this, paddr);
+#endif
+      
+      inst = *(reinterpret_cast<uint32_t const *>(&(mp_fetch_host[offset])));
+    }
+    else
+    {
+      paddr = virtual_to_physical<T_mode, INST, READ>(vaddr, m_curr_mode, exception_occur);
+      
+      if (true == exception_occur)
+      {
+        return 0;
+      }
+      
+#if ENABLE_INST_RECALL
+      RecordPaddr<INST>(this, paddr);
+#endif
+      
+      inst = mpAddressSpace->get_data<uint32_t>(paddr, exception_occur);
+      
+      // :NOTE: Wei 2004-Jul-30:
+      //
+      // AddressSpace::get_data() might throw an exception of accessing reserved memory area.
+      if (true == exception_occur)
+      {
+        return 0;
+      }
+      
+      uint8_t const * const host = mpAddressSpace->host_addr(paddr);
+      
+      if (host != 0)
+      {
+        m_fetch_vpage = vpage;
+        m_fetch_ppage = (paddr & ~(FETCH_PAGE_SIZE - 1));
+        mp_fetch_host = (host - offset);
+        m_fetch_mode = m_curr_mode;
+        m_fetch_generation = mpMmu->generation();
+      }
+    }
+    
+#if ENABLE_THREADED_CODE
+    track_chunk(paddr);
+#endif
+    
+    return inst;
+  }
+  
   // :NOTE: Wei 2004-Jul-27:
   //
   // @false: an exception has occur.
+  template<TranslationModeEnum T_mode>
   ExecResultEnum
   Core::exec()
   {
     bool exception_occur = false;
     
+#if ENABLE_THREADED_CODE
+    m_exec_tier = RuntimeStats::INST_INTERPRETER;
+#endif
+    
 #if ENABLE_INST_RECALL
     NewInstRecallEntry().mIpVaddr = m_curr_reg_bank[CR_PC];
 #endif
@@ -1522,7 +1930,7 @@ namespace ARMware
     //
     // However, because of 'inst' is a local variable,
     // thus I choose overwrite its value whether an exception occurs or not.
-    Inst inst(get_data<WORD, INST>(m_curr_reg_bank[CR_PC], m_curr_mode, exception_occur));
+    Inst inst(fetch_inst<T_mode>(exception_occur));
     
     if (true == exception_occur)
     {
@@ -1550,6 +1958,8 @@ namespace ARMware
       
       assert(mp_curr_chunk != 0);
       
+      m_chunk_vaddr = m_curr_reg_bank[CR_PC];
+      
       switch (mp_curr_chunk->status())
       {
       case Chunk::ST_NONE:
@@ -1578,8 +1988,18 @@ namespace ARMware
 #if ENABLE_DYNAMIC_TRANSLATOR
         if (mp_curr_chunk->hit_count() >= GENERATE_DT_BUFFER_THRESHOLD)
         {
+          uint64_t const start_tsc = read_time_stamp_counter();
+          
           mp_curr_chunk->gen_dt_code();
           
+          g_runtime_stats.increase(RuntimeStats::CHUNK_GEN_DYNAMIC);
+          g_runtime_stats.increase(RuntimeStats::CYCLES_GEN_DYNAMIC, read_time_stamp_counter() - start_tsc);
+          
+          if (true == mp_chunk_chain->is_page_flushed(mp_curr_chunk->start_paddr()))
+          {
+            g_runtime_stats.increase(RuntimeStats::CHUNK_RECOMPILE);
+          }
+          
           return exec_dt_buffer();
         }
         else
@@ -1656,9 +2076,9 @@ namespace ARMware
     }
     
 #if ENABLE_THREADED_CODE
-    ExecResultEnum const result = decode<USAGE_NORMAL>(inst);
+    ExecResultEnum const result = decode<USAGE_NORMAL, T_mode>(inst);
 #else
-    ExecResultEnum const result = decode(inst);
+    ExecResultEnum const result = decode<T_mode>(inst);
 #endif
     
 #if ENABLE_THREADED_CODE
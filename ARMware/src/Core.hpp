@@ -36,10 +36,18 @@
 //
 
 #include "Mmu.hpp"
+#include "FastMem.hpp"
 #include "SysCoProc.hpp"
 #include "Exception.hpp"
 #include "Chunk.hpp"
 #include "Global.hpp"
+#include "RuntimeStats.hpp"
+#include "GuestProfiler.hpp"
+#include "FrameCapture.hpp"
+
+#if ENABLE_DYNAMIC_TRANSLATOR
+#include "ChunkInspector.hpp"
+#endif
 
 #include "Inst/Inst.hpp"
 
@@ -92,8 +100,12 @@ namespace ARMware
     // The return value of the following 4 functions means:
     // @true : no exception occurs, run sequentially.
     // @false: an exception occurs, need to handle it.
+    template<TranslationModeEnum T_mode>
     ExecResultEnum exec();
     
+    template<TranslationModeEnum T_mode>
+    void run_in_mode();
+    
     inline void
     ModifyFCSEVaddr(uint32_t &vaddr) const
     {
@@ -152,6 +164,7 @@ namespace ARMware
     std::auto_ptr<RomFile>           mpRomFile;
     std::auto_ptr<AddressSpace>      mpAddressSpace;
     std::auto_ptr<Mmu>               mpMmu;
+    std::auto_ptr<FastMem>           mp_fast_mem;
     
     // :NOTE: Wei 2004-Jan-11:
     //
@@ -161,6 +174,9 @@ namespace ARMware
     CoreMode  m_curr_mode;
     bool      m_idle_mode;
     
+    // run() returns once this is set, see request_stop().
+    bool      m_stop_requested;
+    
     ExceptionType m_exception_type;
     
 #if USE_SHIFTER_CARRY
@@ -199,6 +215,20 @@ namespace ARMware
     
     uint32_t m_device_timer_increment;
     
+    // Which one of the RuntimeStats::INST_* counters the instructions
+    // executed since the last check_periphery() belong to.
+    RuntimeStats::CounterEnum m_exec_tier;
+    
+    // For the guest profiler: the virtual address the current chunk was
+    // entered at, and the index of the branch back which called
+    // check_periphery() from inside it.
+    uint32_t m_chunk_vaddr;
+    uint32_t m_back_branch_idx;
+    
+    // For the MMIO profiler: the index of the instruction which does the
+    // current memory access in a dynamic translated chunk.
+    uint32_t m_access_idx;
+    
     Chunk *mp_curr_chunk;
     Chunk *mp_delay_clean_chunk;
     
@@ -242,15 +272,31 @@ namespace ARMware
     typedef enum ExecInst ExecInst;
 #endif
     
-    // :NOTE: Wei 2004-Jun-09:
-    //
-    // The bps (bits per second) for serial port 3 is 115200
-    // (i.e. 14400 bytes per second)
-    //
-    // However, 115200 seems too slow for ARMware,
-    // Thus I increment this frequency.
-    static uint32_t const UART_FREQ = (206000000 / 14400) / 100;
-    uint32_t m_UART_clocks;
+    // The virtual time in the core clocks, on which the serial ports are
+    // scheduled: each Uart::run() returns the clocks until it needs the next
+    // service, which depends on its timing model and baud rate.
+    uint64_t m_virtual_clocks;
+    uint64_t m_serial_1_deadline;
+    uint64_t m_serial_3_deadline;
+    
+    // How a virtual address is translated now, which is decided whenever
+    // CP15 is written (see invalidate_translation()) rather than on every
+    // access. run() & exec_threaded_code() use it to select the variant of
+    // the memory instructions which has the MMU and FCSE checks compiled out.
+    TranslationModeEnum m_translation_mode;
+    
+    // The code page of the last instruction fetched by exec(),
+    // see fetch_inst().
+#if ASSUME_NOT_USE_TINY_PAGE
+    static uint32_t const FETCH_PAGE_SIZE = SIZE_4K;
+#else
+    static uint32_t const FETCH_PAGE_SIZE = SIZE_1K;
+#endif
+    uint32_t m_fetch_vpage;
+    uint32_t m_fetch_ppage;
+    uint8_t const *mp_fetch_host;
+    CoreMode m_fetch_mode;
+    uint32_t m_fetch_generation;
     
     static uint32_t const _3_6864_MHZ_FREQ = (206000000 / 3686400);
     uint32_t m_3_6864_mhz_clocks;
@@ -325,7 +371,9 @@ namespace ARMware
     void gen_threaded_code();
     ExecResultEnum exec_threaded_code();
     
-    template<UsageEnum T_usage>
+    template<UsageEnum T_usage, TranslationModeEnum T_mode>
+#else
+    template<TranslationModeEnum T_mode>
 #endif
     ExecResultEnum decode(Inst const inst);
     
@@ -342,6 +390,8 @@ namespace ARMware
     
     void gen_dt_buffer();
     ExecResultEnum exec_dt_buffer();
+    
+    void inspect_hot_chunks();
 #endif
     
 #if PRINT_CHUNK_CODE
@@ -367,10 +417,12 @@ namespace ARMware
     
     // Life cycle
     
+    // The widgets can be 0, then the machine runs without the GUI
+    // (Ex: the headless frame capture & the chunk corpus replay).
     Core(MachineImpl const &machineImpl,
          MachineScreen * const machine_screen,
          SoftKeyboard * const soft_keyboard,
-         SerialConsole &serial_console);
+         SerialConsole * const serial_console);
     
     ~Core();
     
@@ -378,208 +430,208 @@ namespace ARMware
     
     // STM
     
-    inline ExecResultEnum exec_STM_1_DA(Inst const inst)   { return g_STM_1_DA.Process(inst); }
-    inline ExecResultEnum exec_STM_1_DA_w(Inst const inst) { return g_STM_1_DA_w.Process(inst); }
-    inline ExecResultEnum exec_STM_2_DA(Inst const inst)   { return g_STM_2_DA.Process(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STM_1_DA(Inst const inst)   { return g_STM_1_DA.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STM_1_DA_w(Inst const inst) { return g_STM_1_DA_w.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STM_2_DA(Inst const inst)   { return g_STM_2_DA.template Process<T_mode>(inst); }
   
-    inline ExecResultEnum exec_STM_1_DB(Inst const inst)   { return g_STM_1_DB.Process(inst); }
-    inline ExecResultEnum exec_STM_1_DB_w(Inst const inst) { return g_STM_1_DB_w.Process(inst); }
-    inline ExecResultEnum exec_STM_2_DB(Inst const inst)   { return g_STM_2_DB.Process(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STM_1_DB(Inst const inst)   { return g_STM_1_DB.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STM_1_DB_w(Inst const inst) { return g_STM_1_DB_w.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STM_2_DB(Inst const inst)   { return g_STM_2_DB.template Process<T_mode>(inst); }
   
-    inline ExecResultEnum exec_STM_1_IA(Inst const inst)   { return g_STM_1_IA.Process(inst); }
-    inline ExecResultEnum exec_STM_1_IA_w(Inst const inst) { return g_STM_1_IA_w.Process(inst); }
-    inline ExecResultEnum exec_STM_2_IA(Inst const inst)   { return g_STM_2_IA.Process(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STM_1_IA(Inst const inst)   { return g_STM_1_IA.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STM_1_IA_w(Inst const inst) { return g_STM_1_IA_w.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STM_2_IA(Inst const inst)   { return g_STM_2_IA.template Process<T_mode>(inst); }
   
-    inline ExecResultEnum exec_STM_1_IB(Inst const inst)   { return g_STM_1_IB.Process(inst); }
-    inline ExecResultEnum exec_STM_1_IB_w(Inst const inst) { return g_STM_1_IB_w.Process(inst); }
-    inline ExecResultEnum exec_STM_2_IB(Inst const inst)   { return g_STM_2_IB.Process(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STM_1_IB(Inst const inst)   { return g_STM_1_IB.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STM_1_IB_w(Inst const inst) { return g_STM_1_IB_w.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STM_2_IB(Inst const inst)   { return g_STM_2_IB.template Process<T_mode>(inst); }
       
     // LDM
   
-    inline ExecResultEnum exec_LDM_1_DA(Inst const inst)    { return g_LDM_1_DA.Process(inst); }
-    inline ExecResultEnum exec_LDM_1_DA_w(Inst const inst)  { return g_LDM_1_DA_w.Process(inst); }
-    inline ExecResultEnum exec_LDM_23_DA(Inst const inst)   { return g_LDM_23_DA.Process(inst); }
-    inline ExecResultEnum exec_LDM_23_DA_w(Inst const inst) { return g_LDM_23_DA_w.Process(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDM_1_DA(Inst const inst)    { return g_LDM_1_DA.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDM_1_DA_w(Inst const inst)  { return g_LDM_1_DA_w.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDM_23_DA(Inst const inst)   { return g_LDM_23_DA.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDM_23_DA_w(Inst const inst) { return g_LDM_23_DA_w.template Process<T_mode>(inst); }
   
-    inline ExecResultEnum exec_LDM_1_DB(Inst const inst)    { return g_LDM_1_DB.Process(inst); }
-    inline ExecResultEnum exec_LDM_1_DB_w(Inst const inst)  { return g_LDM_1_DB_w.Process(inst); }
-    inline ExecResultEnum exec_LDM_23_DB(Inst const inst)   { return g_LDM_23_DB.Process(inst); }
-    inline ExecResultEnum exec_LDM_23_DB_w(Inst const inst) { return g_LDM_23_DB_w.Process(inst); }
-    
-    inline ExecResultEnum exec_LDM_1_IA(Inst const inst)    { return g_LDM_1_IA.Process(inst); }
-    inline ExecResultEnum exec_LDM_1_IA_w(Inst const inst)  { return g_LDM_1_IA_w.Process(inst); }
-    inline ExecResultEnum exec_LDM_23_IA(Inst const inst)   { return g_LDM_23_IA.Process(inst); }
-    inline ExecResultEnum exec_LDM_23_IA_w(Inst const inst) { return g_LDM_23_IA_w.Process(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDM_1_DB(Inst const inst)    { return g_LDM_1_DB.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDM_1_DB_w(Inst const inst)  { return g_LDM_1_DB_w.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDM_23_DB(Inst const inst)   { return g_LDM_23_DB.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDM_23_DB_w(Inst const inst) { return g_LDM_23_DB_w.template Process<T_mode>(inst); }
+    
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDM_1_IA(Inst const inst)    { return g_LDM_1_IA.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDM_1_IA_w(Inst const inst)  { return g_LDM_1_IA_w.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDM_23_IA(Inst const inst)   { return g_LDM_23_IA.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDM_23_IA_w(Inst const inst) { return g_LDM_23_IA_w.template Process<T_mode>(inst); }
   
-    inline ExecResultEnum exec_LDM_1_IB(Inst const inst)    { return g_LDM_1_IB.Process(inst); }
-    inline ExecResultEnum exec_LDM_1_IB_w(Inst const inst)  { return g_LDM_1_IB_w.Process(inst); }
-    inline ExecResultEnum exec_LDM_23_IB(Inst const inst)   { return g_LDM_23_IB.Process(inst); }
-    inline ExecResultEnum exec_LDM_23_IB_w(Inst const inst) { return g_LDM_23_IB_w.Process(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDM_1_IB(Inst const inst)    { return g_LDM_1_IB.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDM_1_IB_w(Inst const inst)  { return g_LDM_1_IB_w.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDM_23_IB(Inst const inst)   { return g_LDM_23_IB.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDM_23_IB_w(Inst const inst) { return g_LDM_23_IB_w.template Process<T_mode>(inst); }
       
     // SWP
   
-    inline ExecResultEnum exec_SWP(Inst const inst)  { return g_SWP.Process(inst); }
-    inline ExecResultEnum exec_SWPB(Inst const inst) { return g_SWPB.Process(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_SWP(Inst const inst)  { return g_SWP.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_SWPB(Inst const inst) { return g_SWPB.template Process<T_mode>(inst); }
     
     // STR
   
-    inline ExecResultEnum exec_STR_imm_post_down(Inst const inst)   { return g_STR_imm_post_down.Process(inst); }
-    inline ExecResultEnum exec_STR_imm_post_up(Inst const inst)     { return g_STR_imm_post_up.Process(inst); }
-    inline ExecResultEnum exec_STR_imm_offset_down(Inst const inst) { return g_STR_imm_offset_down.Process(inst); }
-    inline ExecResultEnum exec_STR_imm_offset_up(Inst const inst)   { return g_STR_imm_offset_up.Process(inst); }
-    inline ExecResultEnum exec_STR_imm_pre_down(Inst const inst)    { return g_STR_imm_pre_down.Process(inst); }
-    inline ExecResultEnum exec_STR_imm_pre_up(Inst const inst)      { return g_STR_imm_pre_up.Process(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STR_imm_post_down(Inst const inst)   { return g_STR_imm_post_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STR_imm_post_up(Inst const inst)     { return g_STR_imm_post_up.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STR_imm_offset_down(Inst const inst) { return g_STR_imm_offset_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STR_imm_offset_up(Inst const inst)   { return g_STR_imm_offset_up.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STR_imm_pre_down(Inst const inst)    { return g_STR_imm_pre_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STR_imm_pre_up(Inst const inst)      { return g_STR_imm_pre_up.template Process<T_mode>(inst); }
   
-    inline ExecResultEnum exec_STR_reg_post_down(Inst const inst)   { return g_STR_reg_post_down.Process(inst); }
-    inline ExecResultEnum exec_STR_reg_post_up(Inst const inst)     { return g_STR_reg_post_up.Process(inst); }
-    inline ExecResultEnum exec_STR_reg_offset_down(Inst const inst) { return g_STR_reg_offset_down.Process(inst); }
-    inline ExecResultEnum exec_STR_reg_offset_up(Inst const inst)   { return g_STR_reg_offset_up.Process(inst); }
-    inline ExecResultEnum exec_STR_reg_pre_down(Inst const inst)    { return g_STR_reg_pre_down.Process(inst); }
-    inline ExecResultEnum exec_STR_reg_pre_up(Inst const inst)      { return g_STR_reg_pre_up.Process(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STR_reg_post_down(Inst const inst)   { return g_STR_reg_post_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STR_reg_post_up(Inst const inst)     { return g_STR_reg_post_up.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STR_reg_offset_down(Inst const inst) { return g_STR_reg_offset_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STR_reg_offset_up(Inst const inst)   { return g_STR_reg_offset_up.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STR_reg_pre_down(Inst const inst)    { return g_STR_reg_pre_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STR_reg_pre_up(Inst const inst)      { return g_STR_reg_pre_up.template Process<T_mode>(inst); }
       
     // STRT
   
-    inline ExecResultEnum exec_STRT_imm_post_down(Inst const inst) { return g_STRT_imm_post_down.Process(inst); }
-    inline ExecResultEnum exec_STRT_imm_post_up(Inst const inst)   { return g_STRT_imm_post_up.Process(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STRT_imm_post_down(Inst const inst) { return g_STRT_imm_post_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STRT_imm_post_up(Inst const inst)   { return g_STRT_imm_post_up.template Process<T_mode>(inst); }
   
-    inline ExecResultEnum exec_STRT_reg_post_down(Inst const inst) { return g_STRT_reg_post_down.Process(inst); }
-    inline ExecResultEnum exec_STRT_reg_post_up(Inst const inst)   { return g_STRT_reg_post_up.Process(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STRT_reg_post_down(Inst const inst) { return g_STRT_reg_post_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STRT_reg_post_up(Inst const inst)   { return g_STRT_reg_post_up.template Process<T_mode>(inst); }
     
     // STRB
   
-    inline ExecResultEnum exec_STRB_imm_post_down(Inst const inst)   { return g_STRB_imm_post_down.Process(inst); }
-    inline ExecResultEnum exec_STRB_imm_post_up(Inst const inst)     { return g_STRB_imm_post_up.Process(inst); }
-    inline ExecResultEnum exec_STRB_imm_offset_down(Inst const inst) { return g_STRB_imm_offset_down.Process(inst); }
-    inline ExecResultEnum exec_STRB_imm_offset_up(Inst const inst)   { return g_STRB_imm_offset_up.Process(inst); }
-    inline ExecResultEnum exec_STRB_imm_pre_down(Inst const inst)    { return g_STRB_imm_pre_down.Process(inst); }
-    inline ExecResultEnum exec_STRB_imm_pre_up(Inst const inst)      { return g_STRB_imm_pre_up.Process(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STRB_imm_post_down(Inst const inst)   { return g_STRB_imm_post_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STRB_imm_post_up(Inst const inst)     { return g_STRB_imm_post_up.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STRB_imm_offset_down(Inst const inst) { return g_STRB_imm_offset_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STRB_imm_offset_up(Inst const inst)   { return g_STRB_imm_offset_up.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STRB_imm_pre_down(Inst const inst)    { return g_STRB_imm_pre_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STRB_imm_pre_up(Inst const inst)      { return g_STRB_imm_pre_up.template Process<T_mode>(inst); }
   
-    inline ExecResultEnum exec_STRB_reg_post_down(Inst const inst)   { return g_STRB_reg_post_down.Process(inst); }
-    inline ExecResultEnum exec_STRB_reg_post_up(Inst const inst)     { return g_STRB_reg_post_up.Process(inst); }
-    inline ExecResultEnum exec_STRB_reg_offset_down(Inst const inst) { return g_STRB_reg_offset_down.Process(inst); }
-    inline ExecResultEnum exec_STRB_reg_offset_up(Inst const inst)   { return g_STRB_reg_offset_up.Process(inst); }
-    inline ExecResultEnum exec_STRB_reg_pre_down(Inst const inst)    { return g_STRB_reg_pre_down.Process(inst); }
-    inline ExecResultEnum exec_STRB_reg_pre_up(Inst const inst)      { return g_STRB_reg_pre_up.Process(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STRB_reg_post_down(Inst const inst)   { return g_STRB_reg_post_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STRB_reg_post_up(Inst const inst)     { return g_STRB_reg_post_up.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STRB_reg_offset_down(Inst const inst) { return g_STRB_reg_offset_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STRB_reg_offset_up(Inst const inst)   { return g_STRB_reg_offset_up.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STRB_reg_pre_down(Inst const inst)    { return g_STRB_reg_pre_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STRB_reg_pre_up(Inst const inst)      { return g_STRB_reg_pre_up.template Process<T_mode>(inst); }
     
     // STRBT
   
-    inline ExecResultEnum exec_STRBT_imm_post_down(Inst const inst) { return g_STRBT_imm_post_down.Process(inst); }
-    inline ExecResultEnum exec_STRBT_imm_post_up(Inst const inst)   { return g_STRBT_imm_post_up.Process(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STRBT_imm_post_down(Inst const inst) { return g_STRBT_imm_post_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STRBT_imm_post_up(Inst const inst)   { return g_STRBT_imm_post_up.template Process<T_mode>(inst); }
   
-    inline ExecResultEnum exec_STRBT_reg_post_down(Inst const inst) { return g_STRBT_reg_post_down.Process(inst); }
-    inline ExecResultEnum exec_STRBT_reg_post_up(Inst const inst)   { return g_STRBT_reg_post_up.Process(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STRBT_reg_post_down(Inst const inst) { return g_STRBT_reg_post_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STRBT_reg_post_up(Inst const inst)   { return g_STRBT_reg_post_up.template Process<T_mode>(inst); }
     
     // LDR
   
-    inline ExecResultEnum exec_LDR_imm_post_down(Inst const inst)   { return g_LDR_imm_post_down.Process(inst); }
-    inline ExecResultEnum exec_LDR_imm_post_up(Inst const inst)     { return g_LDR_imm_post_up.Process(inst); }
-    inline ExecResultEnum exec_LDR_imm_offset_down(Inst const inst) { return g_LDR_imm_offset_down.Process(inst); }
-    inline ExecResultEnum exec_LDR_imm_offset_up(Inst const inst)   { return g_LDR_imm_offset_up.Process(inst); }
-    inline ExecResultEnum exec_LDR_imm_pre_down(Inst const inst)    { return g_LDR_imm_pre_down.Process(inst); }
-    inline ExecResultEnum exec_LDR_imm_pre_up(Inst const inst)      { return g_LDR_imm_pre_up.Process(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDR_imm_post_down(Inst const inst)   { return g_LDR_imm_post_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDR_imm_post_up(Inst const inst)     { return g_LDR_imm_post_up.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDR_imm_offset_down(Inst const inst) { return g_LDR_imm_offset_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDR_imm_offset_up(Inst const inst)   { return g_LDR_imm_offset_up.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDR_imm_pre_down(Inst const inst)    { return g_LDR_imm_pre_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDR_imm_pre_up(Inst const inst)      { return g_LDR_imm_pre_up.template Process<T_mode>(inst); }
   
-    inline ExecResultEnum exec_LDR_reg_post_down(Inst const inst)   { return g_LDR_reg_post_down.Process(inst); }
-    inline ExecResultEnum exec_LDR_reg_post_up(Inst const inst)     { return g_LDR_reg_post_up.Process(inst); }
-    inline ExecResultEnum exec_LDR_reg_offset_down(Inst const inst) { return g_LDR_reg_offset_down.Process(inst); }
-    inline ExecResultEnum exec_LDR_reg_offset_up(Inst const inst)   { return g_LDR_reg_offset_up.Process(inst); }
-    inline ExecResultEnum exec_LDR_reg_pre_down(Inst const inst)    { return g_LDR_reg_pre_down.Process(inst); }
-    inline ExecResultEnum exec_LDR_reg_pre_up(Inst const inst)      { return g_LDR_reg_pre_up.Process(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDR_reg_post_down(Inst const inst)   { return g_LDR_reg_post_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDR_reg_post_up(Inst const inst)     { return g_LDR_reg_post_up.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDR_reg_offset_down(Inst const inst) { return g_LDR_reg_offset_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDR_reg_offset_up(Inst const inst)   { return g_LDR_reg_offset_up.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDR_reg_pre_down(Inst const inst)    { return g_LDR_reg_pre_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDR_reg_pre_up(Inst const inst)      { return g_LDR_reg_pre_up.template Process<T_mode>(inst); }
   
     // LDRT
   
-    inline ExecResultEnum exec_LDRT_imm_post_down(Inst const inst) { return g_LDRT_imm_post_down.Process(inst); }
-    inline ExecResultEnum exec_LDRT_imm_post_up(Inst const inst)   { return g_LDRT_imm_post_up.Process(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRT_imm_post_down(Inst const inst) { return g_LDRT_imm_post_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRT_imm_post_up(Inst const inst)   { return g_LDRT_imm_post_up.template Process<T_mode>(inst); }
   
-    inline ExecResultEnum exec_LDRT_reg_post_down(Inst const inst) { return g_LDRT_reg_post_down.Process(inst); }
-    inline ExecResultEnum exec_LDRT_reg_post_up(Inst const inst)   { return g_LDRT_reg_post_up.Process(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRT_reg_post_down(Inst const inst) { return g_LDRT_reg_post_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRT_reg_post_up(Inst const inst)   { return g_LDRT_reg_post_up.template Process<T_mode>(inst); }
     
     // LDRB
   
-    inline ExecResultEnum exec_LDRB_imm_post_down(Inst const inst)   { return g_LDRB_imm_post_down.Process(inst); }
-    inline ExecResultEnum exec_LDRB_imm_post_up(Inst const inst)     { return g_LDRB_imm_post_up.Process(inst); }
-    inline ExecResultEnum exec_LDRB_imm_offset_down(Inst const inst) { return g_LDRB_imm_offset_down.Process(inst); }
-    inline ExecResultEnum exec_LDRB_imm_offset_up(Inst const inst)   { return g_LDRB_imm_offset_up.Process(inst); }
-    inline ExecResultEnum exec_LDRB_imm_pre_down(Inst const inst)    { return g_LDRB_imm_pre_down.Process(inst); }
-    inline ExecResultEnum exec_LDRB_imm_pre_up(Inst const inst)      { return g_LDRB_imm_pre_up.Process(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRB_imm_post_down(Inst const inst)   { return g_LDRB_imm_post_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRB_imm_post_up(Inst const inst)     { return g_LDRB_imm_post_up.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRB_imm_offset_down(Inst const inst) { return g_LDRB_imm_offset_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRB_imm_offset_up(Inst const inst)   { return g_LDRB_imm_offset_up.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRB_imm_pre_down(Inst const inst)    { return g_LDRB_imm_pre_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRB_imm_pre_up(Inst const inst)      { return g_LDRB_imm_pre_up.template Process<T_mode>(inst); }
   
-    inline ExecResultEnum exec_LDRB_reg_post_down(Inst const inst)   { return g_LDRB_reg_post_down.Process(inst); }
-    inline ExecResultEnum exec_LDRB_reg_post_up(Inst const inst)     { return g_LDRB_reg_post_up.Process(inst); }
-    inline ExecResultEnum exec_LDRB_reg_offset_down(Inst const inst) { return g_LDRB_reg_offset_down.Process(inst); }
-    inline ExecResultEnum exec_LDRB_reg_offset_up(Inst const inst)   { return g_LDRB_reg_offset_up.Process(inst); }
-    inline ExecResultEnum exec_LDRB_reg_pre_down(Inst const inst)    { return g_LDRB_reg_pre_down.Process(inst); }
-    inline ExecResultEnum exec_LDRB_reg_pre_up(Inst const inst)      { return g_LDRB_reg_pre_up.Process(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRB_reg_post_down(Inst const inst)   { return g_LDRB_reg_post_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRB_reg_post_up(Inst const inst)     { return g_LDRB_reg_post_up.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRB_reg_offset_down(Inst const inst) { return g_LDRB_reg_offset_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRB_reg_offset_up(Inst const inst)   { return g_LDRB_reg_offset_up.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRB_reg_pre_down(Inst const inst)    { return g_LDRB_reg_pre_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRB_reg_pre_up(Inst const inst)      { return g_LDRB_reg_pre_up.template Process<T_mode>(inst); }
       
     // LDRBT
   
-    inline ExecResultEnum exec_LDRBT_imm_post_down(Inst const inst) { return g_LDRBT_imm_post_down.Process(inst); }
-    inline ExecResultEnum exec_LDRBT_imm_post_up(Inst const inst)   { return g_LDRBT_imm_post_up.Process(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRBT_imm_post_down(Inst const inst) { return g_LDRBT_imm_post_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRBT_imm_post_up(Inst const inst)   { return g_LDRBT_imm_post_up.template Process<T_mode>(inst); }
   
-    inline ExecResultEnum exec_LDRBT_reg_post_down(Inst const inst) { return g_LDRBT_reg_post_down.Process(inst); }
-    inline ExecResultEnum exec_LDRBT_reg_post_up(Inst const inst)   { return g_LDRBT_reg_post_up.Process(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRBT_reg_post_down(Inst const inst) { return g_LDRBT_reg_post_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRBT_reg_post_up(Inst const inst)   { return g_LDRBT_reg_post_up.template Process<T_mode>(inst); }
       
     // STRH
   
-    inline ExecResultEnum exec_STRH_imm_post_down(Inst const inst)   { return g_STRH_imm_post_down.Process(inst); }
-    inline ExecResultEnum exec_STRH_imm_post_up(Inst const inst)     { return g_STRH_imm_post_up.Process(inst); }
-    inline ExecResultEnum exec_STRH_imm_offset_down(Inst const inst) { return g_STRH_imm_offset_down.Process(inst); }
-    inline ExecResultEnum exec_STRH_imm_offset_up(Inst const inst)   { return g_STRH_imm_offset_up.Process(inst); }
-    inline ExecResultEnum exec_STRH_imm_pre_down(Inst const inst)    { return g_STRH_imm_pre_down.Process(inst); }
-    inline ExecResultEnum exec_STRH_imm_pre_up(Inst const inst)      { return g_STRH_imm_pre_up.Process(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STRH_imm_post_down(Inst const inst)   { return g_STRH_imm_post_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STRH_imm_post_up(Inst const inst)     { return g_STRH_imm_post_up.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STRH_imm_offset_down(Inst const inst) { return g_STRH_imm_offset_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STRH_imm_offset_up(Inst const inst)   { return g_STRH_imm_offset_up.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STRH_imm_pre_down(Inst const inst)    { return g_STRH_imm_pre_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STRH_imm_pre_up(Inst const inst)      { return g_STRH_imm_pre_up.template Process<T_mode>(inst); }
   
-    inline ExecResultEnum exec_STRH_reg_post_down(Inst const inst)   { return g_STRH_reg_post_down.Process(inst); }
-    inline ExecResultEnum exec_STRH_reg_post_up(Inst const inst)     { return g_STRH_reg_post_up.Process(inst); }
-    inline ExecResultEnum exec_STRH_reg_offset_down(Inst const inst) { return g_STRH_reg_offset_down.Process(inst); }
-    inline ExecResultEnum exec_STRH_reg_offset_up(Inst const inst)   { return g_STRH_reg_offset_up.Process(inst); }
-    inline ExecResultEnum exec_STRH_reg_pre_down(Inst const inst)    { return g_STRH_reg_pre_down.Process(inst); }
-    inline ExecResultEnum exec_STRH_reg_pre_up(Inst const inst)      { return g_STRH_reg_pre_up.Process(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STRH_reg_post_down(Inst const inst)   { return g_STRH_reg_post_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STRH_reg_post_up(Inst const inst)     { return g_STRH_reg_post_up.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STRH_reg_offset_down(Inst const inst) { return g_STRH_reg_offset_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STRH_reg_offset_up(Inst const inst)   { return g_STRH_reg_offset_up.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STRH_reg_pre_down(Inst const inst)    { return g_STRH_reg_pre_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_STRH_reg_pre_up(Inst const inst)      { return g_STRH_reg_pre_up.template Process<T_mode>(inst); }
       
     // LDRH
   
-    inline ExecResultEnum exec_LDRH_imm_post_down(Inst const inst)   { return g_LDRH_imm_post_down.Process(inst); }
-    inline ExecResultEnum exec_LDRH_imm_post_up(Inst const inst)     { return g_LDRH_imm_post_up.Process(inst); }
-    inline ExecResultEnum exec_LDRH_imm_offset_down(Inst const inst) { return g_LDRH_imm_offset_down.Process(inst); }
-    inline ExecResultEnum exec_LDRH_imm_offset_up(Inst const inst)   { return g_LDRH_imm_offset_up.Process(inst); }
-    inline ExecResultEnum exec_LDRH_imm_pre_down(Inst const inst)    { return g_LDRH_imm_pre_down.Process(inst); }
-    inline ExecResultEnum exec_LDRH_imm_pre_up(Inst const inst)      { return g_LDRH_imm_pre_up.Process(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRH_imm_post_down(Inst const inst)   { return g_LDRH_imm_post_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRH_imm_post_up(Inst const inst)     { return g_LDRH_imm_post_up.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRH_imm_offset_down(Inst const inst) { return g_LDRH_imm_offset_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRH_imm_offset_up(Inst const inst)   { return g_LDRH_imm_offset_up.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRH_imm_pre_down(Inst const inst)    { return g_LDRH_imm_pre_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRH_imm_pre_up(Inst const inst)      { return g_LDRH_imm_pre_up.template Process<T_mode>(inst); }
   
-    inline ExecResultEnum exec_LDRH_reg_post_down(Inst const inst)   { return g_LDRH_reg_post_down.Process(inst); }
-    inline ExecResultEnum exec_LDRH_reg_post_up(Inst const inst)     { return g_LDRH_reg_post_up.Process(inst); }
-    inline ExecResultEnum exec_LDRH_reg_offset_down(Inst const inst) { return g_LDRH_reg_offset_down.Process(inst); }
-    inline ExecResultEnum exec_LDRH_reg_offset_up(Inst const inst)   { return g_LDRH_reg_offset_up.Process(inst); }
-    inline ExecResultEnum exec_LDRH_reg_pre_down(Inst const inst)    { return g_LDRH_reg_pre_down.Process(inst); }
-    inline ExecResultEnum exec_LDRH_reg_pre_up(Inst const inst)      { return g_LDRH_reg_pre_up.Process(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRH_reg_post_down(Inst const inst)   { return g_LDRH_reg_post_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRH_reg_post_up(Inst const inst)     { return g_LDRH_reg_post_up.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRH_reg_offset_down(Inst const inst) { return g_LDRH_reg_offset_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRH_reg_offset_up(Inst const inst)   { return g_LDRH_reg_offset_up.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRH_reg_pre_down(Inst const inst)    { return g_LDRH_reg_pre_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRH_reg_pre_up(Inst const inst)      { return g_LDRH_reg_pre_up.template Process<T_mode>(inst); }
       
     // LDRSB
   
-    inline ExecResultEnum exec_LDRSB_imm_post_down(Inst const inst)   { return g_LDRSB_imm_post_down.Process(inst); }
-    inline ExecResultEnum exec_LDRSB_imm_post_up(Inst const inst)     { return g_LDRSB_imm_post_up.Process(inst); }
-    inline ExecResultEnum exec_LDRSB_imm_offset_down(Inst const inst) { return g_LDRSB_imm_offset_down.Process(inst); }
-    inline ExecResultEnum exec_LDRSB_imm_offset_up(Inst const inst)   { return g_LDRSB_imm_offset_up.Process(inst); }
-    inline ExecResultEnum exec_LDRSB_imm_pre_down(Inst const inst)    { return g_LDRSB_imm_pre_down.Process(inst); }
-    inline ExecResultEnum exec_LDRSB_imm_pre_up(Inst const inst)      { return g_LDRSB_imm_pre_up.Process(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRSB_imm_post_down(Inst const inst)   { return g_LDRSB_imm_post_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRSB_imm_post_up(Inst const inst)     { return g_LDRSB_imm_post_up.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRSB_imm_offset_down(Inst const inst) { return g_LDRSB_imm_offset_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRSB_imm_offset_up(Inst const inst)   { return g_LDRSB_imm_offset_up.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRSB_imm_pre_down(Inst const inst)    { return g_LDRSB_imm_pre_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRSB_imm_pre_up(Inst const inst)      { return g_LDRSB_imm_pre_up.template Process<T_mode>(inst); }
   
-    inline ExecResultEnum exec_LDRSB_reg_post_down(Inst const inst)   { return g_LDRSB_reg_post_down.Process(inst); }
-    inline ExecResultEnum exec_LDRSB_reg_post_up(Inst const inst)     { return g_LDRSB_reg_post_up.Process(inst); }
-    inline ExecResultEnum exec_LDRSB_reg_offset_down(Inst const inst) { return g_LDRSB_reg_offset_down.Process(inst); }
-    inline ExecResultEnum exec_LDRSB_reg_offset_up(Inst const inst)   { return g_LDRSB_reg_offset_up.Process(inst); }
-    inline ExecResultEnum exec_LDRSB_reg_pre_down(Inst const inst)    { return g_LDRSB_reg_pre_down.Process(inst); }
-    inline ExecResultEnum exec_LDRSB_reg_pre_up(Inst const inst)      { return g_LDRSB_reg_pre_up.Process(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRSB_reg_post_down(Inst const inst)   { return g_LDRSB_reg_post_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRSB_reg_post_up(Inst const inst)     { return g_LDRSB_reg_post_up.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRSB_reg_offset_down(Inst const inst) { return g_LDRSB_reg_offset_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRSB_reg_offset_up(Inst const inst)   { return g_LDRSB_reg_offset_up.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRSB_reg_pre_down(Inst const inst)    { return g_LDRSB_reg_pre_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRSB_reg_pre_up(Inst const inst)      { return g_LDRSB_reg_pre_up.template Process<T_mode>(inst); }
       
     // LDRSH
   
-    inline ExecResultEnum exec_LDRSH_imm_post_down(Inst const inst)   { return g_LDRSH_imm_post_down.Process(inst); }
-    inline ExecResultEnum exec_LDRSH_imm_post_up(Inst const inst)     { return g_LDRSH_imm_post_up.Process(inst); }
-    inline ExecResultEnum exec_LDRSH_imm_offset_down(Inst const inst) { return g_LDRSH_imm_offset_down.Process(inst); }
-    inline ExecResultEnum exec_LDRSH_imm_offset_up(Inst const inst)   { return g_LDRSH_imm_offset_up.Process(inst); }
-    inline ExecResultEnum exec_LDRSH_imm_pre_down(Inst const inst)    { return g_LDRSH_imm_pre_down.Process(inst); }
-    inline ExecResultEnum exec_LDRSH_imm_pre_up(Inst const inst)      { return g_LDRSH_imm_pre_up.Process(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRSH_imm_post_down(Inst const inst)   { return g_LDRSH_imm_post_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRSH_imm_post_up(Inst const inst)     { return g_LDRSH_imm_post_up.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRSH_imm_offset_down(Inst const inst) { return g_LDRSH_imm_offset_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRSH_imm_offset_up(Inst const inst)   { return g_LDRSH_imm_offset_up.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRSH_imm_pre_down(Inst const inst)    { return g_LDRSH_imm_pre_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRSH_imm_pre_up(Inst const inst)      { return g_LDRSH_imm_pre_up.template Process<T_mode>(inst); }
   
-    inline ExecResultEnum exec_LDRSH_reg_post_down(Inst const inst)   { return g_LDRSH_reg_post_down.Process(inst); }
-    inline ExecResultEnum exec_LDRSH_reg_post_up(Inst const inst)     { return g_LDRSH_reg_post_up.Process(inst); }
-    inline ExecResultEnum exec_LDRSH_reg_offset_down(Inst const inst) { return g_LDRSH_reg_offset_down.Process(inst); }
-    inline ExecResultEnum exec_LDRSH_reg_offset_up(Inst const inst)   { return g_LDRSH_reg_offset_up.Process(inst); }
-    inline ExecResultEnum exec_LDRSH_reg_pre_down(Inst const inst)    { return g_LDRSH_reg_pre_down.Process(inst); }
-    inline ExecResultEnum exec_LDRSH_reg_pre_up(Inst const inst)      { return g_LDRSH_reg_pre_up.Process(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRSH_reg_post_down(Inst const inst)   { return g_LDRSH_reg_post_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRSH_reg_post_up(Inst const inst)     { return g_LDRSH_reg_post_up.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRSH_reg_offset_down(Inst const inst) { return g_LDRSH_reg_offset_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRSH_reg_offset_up(Inst const inst)   { return g_LDRSH_reg_offset_up.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRSH_reg_pre_down(Inst const inst)    { return g_LDRSH_reg_pre_down.template Process<T_mode>(inst); }
+    template<TranslationModeEnum T_mode> inline ExecResultEnum exec_LDRSH_reg_pre_up(Inst const inst)      { return g_LDRSH_reg_pre_up.template Process<T_mode>(inst); }
       
     // DPI
   
@@ -969,11 +1021,23 @@ namespace ARMware
     {
       mp_curr_chunk->set_curr_arm_inst(inst_idx);
     }
+    
+    inline void
+    set_back_branch_idx(uint32_t const inst_idx)
+    { m_back_branch_idx = inst_idx; }
 #endif // #if ENABLE_THREADED_CODE
     
 #if ENABLE_DYNAMIC_TRANSLATOR
+    inline void
+    set_access_idx(uint32_t const inst_idx)
+    { m_access_idx = inst_idx; }
+    
     void *get_global_var_mem_addr(Variable::GlobalVarEnum const kind);
     
+    // Reads the word at 'paddr' (from the beginning of the emulated dynamic
+    // memory, like Chunk::start_paddr()) for the dynamic translator.
+    uint32_t peek_dram_word(uint32_t const paddr) const;
+    
     inline void
     calculate_average_native_code_buffer_size(uint32_t const native_size, uint32_t const arm_size)
     {
@@ -1005,6 +1069,10 @@ namespace ARMware
     void run();
     void reset();
     
+#if ENABLE_DYNAMIC_TRANSLATOR && PROFILE_DT_COMPILE
+    bool replay_chunk_corpus(char const * const corpus_file);
+#endif
+    
     inline void
     set_data_abort()
     { m_exception_type = EXCEPTION_DATA; }
@@ -1446,12 +1514,21 @@ namespace ARMware
     exit_idle_mode()
     { m_idle_mode = false; }
     
-    template<AccessTypeEnum accessTypeEnum, RWType rw_type>
+    // Stops the machine at the next instruction boundary of Core::run()
+    // (i.e. outside of any chunk), then run() returns to start_machine(),
+    // which shuts the machine down.
+    inline void
+    request_stop()
+    { m_stop_requested = true; }
+    
+    // @T_mode: the translation mode the caller runs in, TRANSLATION_ANY
+    // looks at m_translation_mode.
+    template<TranslationModeEnum T_mode, AccessTypeEnum accessTypeEnum, RWType rw_type>
     uint32_t FASTCALL virtual_to_physical(uint32_t &vaddr,
                                           CoreMode const currentMode,
                                           bool &exception_occur) const;
     
-    template<DataWidthEnum dataWidthEnum, AccessTypeEnum accessTypeEnum>
+    template<TranslationModeEnum T_mode, DataWidthEnum dataWidthEnum, AccessTypeEnum accessTypeEnum>
     typename DataWidthTraits<dataWidthEnum>::UnsignedType FASTCALL get_data(uint32_t vaddr,
                                                                             CoreMode const currentMode,
                                                                             bool &exception_occur)
@@ -1465,11 +1542,18 @@ namespace ARMware
 #endif
       ;
     
+    template<TranslationModeEnum T_mode>
+    inline uint32_t fetch_inst(bool &exception_occur);
+    
+#if ENABLE_THREADED_CODE
+    void track_chunk(uint32_t const paddr);
+#endif
+    
 #if CHECK_CHUNK_CODE
     uint32_t get_curr_inst() const;
 #endif
     
-    template<DataWidthEnum dataWidthEnum>
+    template<TranslationModeEnum T_mode, DataWidthEnum dataWidthEnum>
     void FASTCALL put_data(uint32_t vaddr,
                            typename DataWidthTraits<dataWidthEnum>::UnsignedType const value,
                            CoreMode const currentMode,
@@ -1853,6 +1937,25 @@ namespace ARMware
     read_raw_pc() const
     { return m_curr_reg_bank[CR_PC]; }
     
+    // The address of the instruction which does the current memory access.
+    //
+    // The interpreter & the threaded code keep the PC of the executing
+    // instruction, but the dynamic translated codes don't keep the PC up to
+    // date in the middle of a chunk, they store the index of the instruction
+    // in the chunk instead (see Chunk::record_access_idx_DT()).
+    inline uint32_t
+    access_pc() const
+    {
+#if ENABLE_DYNAMIC_TRANSLATOR
+      if ((RuntimeStats::INST_DYNAMIC == m_exec_tier) && (mp_curr_chunk != 0))
+      {
+        return m_chunk_vaddr + (m_access_idx << 2);
+      }
+#endif
+      
+      return m_curr_reg_bank[CR_PC];
+    }
+    
     inline uint32_t
     Cpsr() const
     { return m_CPSR; }
@@ -1875,6 +1978,35 @@ namespace ARMware
     flush_data_tlb_single_entry(uint32_t const address) const
     { mpMmu->flush_data_tlb_single_entry(address); }
     
+    // Called whenever the control, translation table base, domain access
+    // control or PID register of CP15 is written.
+    inline void
+    invalidate_translation()
+    {
+      mpMmu->bump_generation();
+      
+      if (false == mpSysCoProc->MMU_is_enabled())
+      {
+        m_translation_mode = TRANSLATION_MMU_OFF;
+      }
+      else if (0 == mpSysCoProc->get_reg_value(CPR_13))
+      {
+        m_translation_mode = TRANSLATION_MMU_ON;
+      }
+      else
+      {
+        m_translation_mode = TRANSLATION_MMU_ON_FCSE;
+      }
+    }
+    
+    inline uint32_t
+    translation_generation() const
+    { return mpMmu->generation(); }
+    
+    inline void
+    flush_walk_cache() const
+    { mpMmu->flush_walk_cache(); }
+    
     // Fault Status & Fault address
     
     inline void
@@ -116,11 +116,78 @@ namespace ARMware
       // Thus I think the cursor movement is depent on the OS timer interrupt.
       mpOsTimer->run();
       
-      mp_serial_1->run();
-      mp_serial_3->run();
+      if (true == g_frame_capture.is_enabled())
+      {
+        g_frame_capture.tick();
+      }
+      
+      // Each check in the idle mode stands for an OS timer tick.
+      m_virtual_clocks += _3_6864_MHZ_FREQ;
+      
+      if (m_virtual_clocks >= m_serial_1_deadline)
+      {
+        m_serial_1_deadline = m_virtual_clocks + mp_serial_1->run();
+      }
+      
+      if (m_virtual_clocks >= m_serial_3_deadline)
+      {
+        m_serial_3_deadline = m_virtual_clocks + mp_serial_3->run();
+      }
     }
     else
     {
+#if ENABLE_THREADED_CODE
+      g_runtime_stats.increase(m_exec_tier, m_device_timer_increment);
+#else
+      g_runtime_stats.increase(RuntimeStats::INST_INTERPRETER);
+#endif
+      
+#if ENABLE_DYNAMIC_TRANSLATOR
+      // Called from a loop inside a dynamic translated chunk,
+      // the rest is counted in exec_dt_buffer().
+      if ((RuntimeStats::INST_DYNAMIC == m_exec_tier) && (mp_curr_chunk != 0))
+      {
+        mp_curr_chunk->increase_exec_inst_number(m_device_timer_increment);
+      }
+#endif
+      
+      if (true == g_guest_profiler.is_enabled())
+      {
+        uint32_t overshoot;
+        
+#if ENABLE_THREADED_CODE
+        if (true == g_guest_profiler.advance(m_device_timer_increment, overshoot))
+#else
+        if (true == g_guest_profiler.advance(1, overshoot))
+#endif
+        {
+          uint32_t pc = m_curr_reg_bank[CR_PC];
+          uint32_t chunk_vaddr = GuestProfiler::NO_CHUNK;
+          
+#if ENABLE_THREADED_CODE
+          // Called from a branch back inside a chunk, the PC is not the
+          // sampled instruction. The instructions since the last check ran
+          // straight up to that branch, and the interval ran out
+          // 'overshoot' instructions before it.
+          if ((false == T_update_core) && (mp_curr_chunk != 0))
+          {
+            uint32_t const idx = ((m_back_branch_idx > overshoot)
+                                  ? (m_back_branch_idx - overshoot)
+                                  : 0);
+            
+            chunk_vaddr = m_chunk_vaddr;
+            pc = (m_chunk_vaddr + (idx << 2));
+          }
+#endif
+          
+          g_guest_profiler.record(pc,
+                                  chunk_vaddr,
+                                  m_curr_mode,
+                                  mpSysCoProc->get_reg_value(CPR_13),
+                                  mpSysCoProc->get_TTB_reg());
+        }
+      }
+      
       // :NOTE: Wei 2004-Jul-8:
       //
       // Normal OS timer.
@@ -140,6 +207,11 @@ namespace ARMware
       {
         mpOsTimer->run();
         
+        if (true == g_frame_capture.is_enabled())
+        {
+          g_frame_capture.tick();
+        }
+        
         m_3_6864_mhz_clocks = 0;
       }
       
@@ -147,27 +219,19 @@ namespace ARMware
       //
       // UART
 #if ENABLE_THREADED_CODE
-      m_UART_clocks += m_device_timer_increment;
+      m_virtual_clocks += m_device_timer_increment;
 #else
-      ++m_UART_clocks;
+      ++m_virtual_clocks;
 #endif
       
-      if (UART_FREQ
-#if ENABLE_THREADED_CODE
-          <=
-#else
-          ==
-#endif
-          m_UART_clocks)
+      if (m_virtual_clocks >= m_serial_1_deadline)
       {
-        mp_serial_1->run();
-        
-        if (true == m_RS232_is_enabled)
-        {
-          mp_serial_3->run();
-        }
-        
-        m_UART_clocks = 0;
+        m_serial_1_deadline = m_virtual_clocks + mp_serial_1->run();
+      }
+      
+      if ((true == m_RS232_is_enabled) && (m_virtual_clocks >= m_serial_3_deadline))
+      {
+        m_serial_3_deadline = m_virtual_clocks + mp_serial_3->run();
       }
     }
     
@@ -182,7 +246,27 @@ namespace ARMware
     ++m_get_event_clocks;
     if (GET_EVENT_FREQ == m_get_event_clocks)
     {
-      mp_machine_screen->get_and_store_next_armware_event();
+      if (mp_machine_screen != 0)
+      {
+        mp_machine_screen->get_and_store_next_armware_event();
+      }
+      
+      g_runtime_stats.poll();
+      
+      if (true == g_frame_capture.is_finished())
+      {
+        request_stop();
+      }
+      
+#if ENABLE_DYNAMIC_TRANSLATOR
+      // mp_curr_chunk is 0 only when I am called from Core::run() right after
+      // a threaded code or a dynamic translated chunk returned, only there
+      // I can compile another chunk safely.
+      if ((true == g_chunk_inspector.is_requested()) && (0 == mp_curr_chunk))
+      {
+        inspect_hot_chunks();
+      }
+#endif
       
       m_get_event_clocks = 0;
     }
@@ -270,36 +354,57 @@ namespace ARMware
     }
   }
   
-  template<AccessTypeEnum accessTypeEnum, RWType rw_type>
+  template<TranslationModeEnum T_mode, AccessTypeEnum accessTypeEnum, RWType rw_type>
   inline uint32_t
   Core::virtual_to_physical(uint32_t &vaddr, CoreMode const currentMode, bool &exception_occur) const
   {
-    if (true == mpSysCoProc->MMU_is_enabled())
+    switch (T_mode)
     {
-      ModifyFCSEVaddr(vaddr);
+    case TRANSLATION_MMU_OFF:
+      return vaddr;
       
-      // :NOTE: Wei 2004-Jul-30:
-      //
-      // In the original throw exception version, if translate_access() throws an exception,
-      // paddr will not be modified.
-      //
-      // However, because of paddr is a local variable,
-      // thus I choose overwrite its value whether an exception occurs or not.
-      uint32_t const paddr =
-        mpMmu->template translate_access<accessTypeEnum, rw_type>(vaddr, currentMode, exception_occur);
+    case TRANSLATION_MMU_ON:
+      break;
+      
+    case TRANSLATION_MMU_ON_FCSE:
+      ModifyFCSEVaddr(vaddr);
+      break;
       
-      if (true == exception_occur)
+    case TRANSLATION_ANY:
+      switch (m_translation_mode)
       {
+      case TRANSLATION_MMU_OFF:
+        return virtual_to_physical<TRANSLATION_MMU_OFF, accessTypeEnum, rw_type>(vaddr, currentMode, exception_occur);
+        
+      case TRANSLATION_MMU_ON:
+        return virtual_to_physical<TRANSLATION_MMU_ON, accessTypeEnum, rw_type>(vaddr, currentMode, exception_occur);
+        
+      case TRANSLATION_MMU_ON_FCSE:
+        return virtual_to_physical<TRANSLATION_MMU_ON_FCSE, accessTypeEnum, rw_type>(vaddr, currentMode, exception_occur);
+        
+      default:
+        assert(!"Should not reach here.");
         return 0;
       }
-      else
-      {
-        return paddr;
-      }
+    }
+    
+    // :NOTE: Wei 2004-Jul-30:
+    //
+    // In the original throw exception version, if translate_access() throws an exception,
+    // paddr will not be modified.
+    //
+    // However, because of paddr is a local variable,
+    // thus I choose overwrite its value whether an exception occurs or not.
+    uint32_t const paddr =
+      mpMmu->template translate_access<accessTypeEnum, rw_type>(vaddr, currentMode, exception_occur);
+    
+    if (true == exception_occur)
+    {
+      return 0;
     }
     else
     {
-      return vaddr;
+      return paddr;
     }
   }
   
@@ -319,7 +424,7 @@ namespace ARMware
   // The argument 'vaddr' may be affected by the FCSE,
   // and the argument 'value' won't be affected by the FCSE.
   
-  template<DataWidthEnum dataWidthEnum, AccessTypeEnum accessTypeEnum>
+  template<TranslationModeEnum T_mode, DataWidthEnum dataWidthEnum, AccessTypeEnum accessTypeEnum>
   inline typename DataWidthTraits<dataWidthEnum>::UnsignedType
   Core::get_data(uint32_t vaddr,
                  CoreMode const currentMode,
@@ -350,7 +455,20 @@ namespace ARMware
     }
 #endif
     
-    uint32_t const paddr = virtual_to_physical<accessTypeEnum, READ>(vaddr, currentMode, exception_occur);
+    bool const use_fast_mem = ((DATA == accessTypeEnum) && (true == mp_fast_mem->is_enabled()));
+    
+    if (true == use_fast_mem)
+    {
+      typename DataWidthTraits<dataWidthEnum>::UnsignedType value;
+      
+      if (true == mp_fast_mem->load(vaddr, currentMode, mpMmu->generation(), value))
+      {
+        return value;
+      }
+    }
+    
+    uint32_t const unmodified_vaddr = vaddr;
+    uint32_t const paddr = virtual_to_physical<T_mode, accessTypeEnum, READ>(vaddr, currentMode, exception_occur);
     
     if (true == exception_occur)
     {
@@ -372,72 +490,20 @@ namespace ARMware
       return 0;
     }
     
+    if (true == use_fast_mem)
+    {
+      mp_fast_mem->fill(unmodified_vaddr,
+                        currentMode,
+                        mpMmu->generation(),
+                        paddr,
+                        mpAddressSpace->host_addr(paddr),
+                        false);
+    }
+    
 #if ENABLE_THREADED_CODE
     if (INST == accessTypeEnum)
     {
-      // :NOTE: Wei 2004-Aug-02:
-      //
-      // Because of simplifying the detection of self-modified codes,
-      // I only generate threaded codes for the codes reside in the emulated dynamic memory.
-      // 
-      // That is to say, if the codes reside in other places, like emulated ROM,
-      // I just left them untranslated, and executes them originally no matter how many times
-      // they executed.
-      //
-      // (In H3600, the emulated dynamic memory resides in 0xC0000000 ~ 0xC1FFFFFF)
-      if (0xC0000000 == (paddr & 0xCE000000))
-      {
-        if (0 == mp_curr_chunk)
-        {
-          // :NOTE: Wei 2004-Aug-14:
-          //
-          // There is no current basic block for now,
-          // thus we should find a new one or an old one.
-          
-          // :NOTE: Wei 2004-Aug-16:
-          //
-          // reset the basic block length to 1.
-          m_chunk_length = 1;
-          
-          m_chunk_start = true;
-          
-          mp_curr_chunk = mp_chunk_chain->find_chunk(paddr - MachineType::DRAM_BASE);
-        }
-        else
-        {
-          // :NOTE: Wei 2004-Aug-13:
-          //
-          // We have a basic block now.
-          
-          assert(m_chunk_length != 0);
-        }
-        
-        // :NOTE: Wei 2004-Aug-02:
-        //
-        // The minimal page size of ARM is 1 Kb,
-        // thus I enforce every basic block totally resides in one 1 kb page
-        // to ensure that when each basic block is executed,
-        // I won't get a prefetch abort exception in the middle of it.
-#if ASSUME_NOT_USE_TINY_PAGE
-        if ((SIZE_4K - 4) == (paddr & (SIZE_4K - 1)))
-#else
-        if ((SIZE_1K - 4) == (paddr & (SIZE_1K - 1)))
-#endif
-        {
-          finalize_chunk_no_check();
-        }
-      }
-      else
-      {
-        // :NOTE: Wei 2004-Aug-18:
-        //
-        // We have a basic block, however, we try to execute an instruction not located in RAM.
-        // Thus I should finish the current basic block.
-        if (mp_curr_chunk != 0)
-        {
-          finalize_chunk_no_check(--m_chunk_length);
-        }
-      }
+      track_chunk(paddr);
     }
 #endif
     
@@ -447,14 +513,26 @@ namespace ARMware
   /////////////////////////////////////////////////////////////////////////////
   // Put data
   
-  template<DataWidthEnum dataWidthEnum>
+  template<TranslationModeEnum T_mode, DataWidthEnum dataWidthEnum>
   inline void
   Core::put_data(uint32_t vaddr,
                  typename DataWidthTraits<dataWidthEnum>::UnsignedType const value,
                  CoreMode const currentMode,
                  bool &exception_occur)
   {
-    uint32_t const paddr = virtual_to_physical<DATA, WRITE>(vaddr, currentMode, exception_occur);
+    bool const use_fast_mem = mp_fast_mem->is_enabled();
+    uint32_t dram_offset;
+    
+    if ((true == use_fast_mem) &&
+        (true == mp_fast_mem->store(vaddr, currentMode, mpMmu->generation(), dram_offset)))
+    {
+      mpAddressSpace->put_dram_data<typename DataWidthTraits<dataWidthEnum>::UnsignedType>(dram_offset, value);
+      
+      return;
+    }
+    
+    uint32_t const unmodified_vaddr = vaddr;
+    uint32_t const paddr = virtual_to_physical<T_mode, DATA, WRITE>(vaddr, currentMode, exception_occur);
     
     if (true == exception_occur)
     {
@@ -466,6 +544,18 @@ namespace ARMware
 #endif
     
     mpAddressSpace->put_data<typename DataWidthTraits<dataWidthEnum>::UnsignedType>(paddr, value);
+    
+    // If the store has changed the mode of the flash ROM, the generation
+    // of Mmu has been changed, and FastMem ignores this fill.
+    if (true == use_fast_mem)
+    {
+      mp_fast_mem->fill(unmodified_vaddr,
+                        currentMode,
+                        mpMmu->generation(),
+                        paddr,
+                        mpAddressSpace->host_addr(paddr),
+                        true);
+    }
   }
   
   /////////////////////////////////////////////////////////////////////////////
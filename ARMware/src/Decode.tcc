@@ -18,7 +18,9 @@
 namespace ARMware
 {
 #if ENABLE_THREADED_CODE
-  template<UsageEnum T_usage>
+  template<UsageEnum T_usage, TranslationModeEnum T_mode>
+#else
+  template<TranslationModeEnum T_mode>
 #endif
   inline ExecResultEnum
   Core::decode(Inst const inst)
@@ -117,7 +119,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_STRH_reg_post_down(inst);
+          return exec_STRH_reg_post_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -231,7 +233,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRH_reg_post_down(inst);
+          return exec_LDRH_reg_post_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -252,7 +254,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRSB_reg_post_down(inst);
+          return exec_LDRSB_reg_post_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -273,7 +275,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRSH_reg_post_down(inst);
+          return exec_LDRSH_reg_post_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -513,7 +515,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_STRH_imm_post_down(inst);
+          return exec_STRH_imm_post_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -631,7 +633,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRH_imm_post_down(inst);
+          return exec_LDRH_imm_post_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -652,7 +654,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRSB_imm_post_down(inst);
+          return exec_LDRSB_imm_post_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -673,7 +675,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRSH_imm_post_down(inst);
+          return exec_LDRSH_imm_post_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -903,7 +905,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_STRH_reg_post_up(inst);
+          return exec_STRH_reg_post_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -1017,7 +1019,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRH_reg_post_up(inst);
+          return exec_LDRH_reg_post_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -1038,7 +1040,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRSB_reg_post_up(inst);
+          return exec_LDRSB_reg_post_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -1059,7 +1061,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRSH_reg_post_up(inst);
+          return exec_LDRSH_reg_post_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -1325,7 +1327,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_STRH_imm_post_up(inst);
+          return exec_STRH_imm_post_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -1439,7 +1441,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRH_imm_post_up(inst);
+          return exec_LDRH_imm_post_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -1460,7 +1462,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRSB_imm_post_up(inst);
+          return exec_LDRSB_imm_post_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -1481,7 +1483,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRSH_imm_post_up(inst);
+          return exec_LDRSH_imm_post_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -1717,7 +1719,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_SWP(inst);
+          return exec_SWP<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -1745,7 +1747,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_STRH_reg_offset_down(inst);
+          return exec_STRH_reg_offset_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -1863,7 +1865,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRH_reg_offset_down(inst);
+          return exec_LDRH_reg_offset_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -1884,7 +1886,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRSB_reg_offset_down(inst);
+          return exec_LDRSB_reg_offset_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -1905,7 +1907,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRSH_reg_offset_down(inst);
+          return exec_LDRSH_reg_offset_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -2022,7 +2024,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_STRH_reg_pre_down(inst);
+          return exec_STRH_reg_pre_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -2140,7 +2142,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRH_reg_pre_down(inst);
+          return exec_LDRH_reg_pre_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -2161,7 +2163,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRSB_reg_pre_down(inst);
+          return exec_LDRSB_reg_pre_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -2182,7 +2184,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRSH_reg_pre_down(inst);
+          return exec_LDRSH_reg_pre_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -2254,7 +2256,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_SWPB(inst);
+          return exec_SWPB<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -2282,7 +2284,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_STRH_imm_offset_down(inst);
+          return exec_STRH_imm_offset_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -2400,7 +2402,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRH_imm_offset_down(inst);
+          return exec_LDRH_imm_offset_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -2421,7 +2423,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRSB_imm_offset_down(inst);
+          return exec_LDRSB_imm_offset_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -2442,7 +2444,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRSH_imm_offset_down(inst);
+          return exec_LDRSH_imm_offset_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -2534,7 +2536,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_STRH_imm_pre_down(inst);
+          return exec_STRH_imm_pre_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -2652,7 +2654,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRH_imm_pre_down(inst);
+          return exec_LDRH_imm_pre_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -2673,7 +2675,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRSB_imm_pre_down(inst);
+          return exec_LDRSB_imm_pre_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -2694,7 +2696,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRSH_imm_pre_down(inst);
+          return exec_LDRSH_imm_pre_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -2811,7 +2813,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_STRH_reg_offset_up(inst);
+          return exec_STRH_reg_offset_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -2952,7 +2954,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRH_reg_offset_up(inst);
+          return exec_LDRH_reg_offset_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -2973,7 +2975,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRSB_reg_offset_up(inst);
+          return exec_LDRSB_reg_offset_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -2994,7 +2996,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRSH_reg_offset_up(inst);
+          return exec_LDRSH_reg_offset_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -3111,7 +3113,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_STRH_reg_pre_up(inst);
+          return exec_STRH_reg_pre_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -3252,7 +3254,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRH_reg_pre_up(inst);
+          return exec_LDRH_reg_pre_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -3273,7 +3275,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRSB_reg_pre_up(inst);
+          return exec_LDRSB_reg_pre_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -3294,7 +3296,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRSH_reg_pre_up(inst);
+          return exec_LDRSH_reg_pre_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -3411,7 +3413,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_STRH_imm_offset_up(inst);
+          return exec_STRH_imm_offset_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -3552,7 +3554,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRH_imm_offset_up(inst);
+          return exec_LDRH_imm_offset_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -3573,7 +3575,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRSB_imm_offset_up(inst);
+          return exec_LDRSB_imm_offset_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -3594,7 +3596,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRSH_imm_offset_up(inst);
+          return exec_LDRSH_imm_offset_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -3711,7 +3713,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_STRH_imm_pre_up(inst);
+          return exec_STRH_imm_pre_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -3852,7 +3854,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRH_imm_pre_up(inst);
+          return exec_LDRH_imm_pre_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -3873,7 +3875,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRSB_imm_pre_up(inst);
+          return exec_LDRSB_imm_pre_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -3894,7 +3896,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRSH_imm_pre_up(inst);
+          return exec_LDRSH_imm_pre_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -4579,7 +4581,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_STR_imm_post_down(inst);
+        return exec_STR_imm_post_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -4601,7 +4603,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_LDR_imm_post_down(inst);
+        return exec_LDR_imm_post_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -4629,7 +4631,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_STRT_imm_post_down(inst);
+        return exec_STRT_imm_post_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -4659,7 +4661,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_LDRT_imm_post_down(inst);
+        return exec_LDRT_imm_post_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -4683,7 +4685,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_STRB_imm_post_down(inst);
+        return exec_STRB_imm_post_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -4707,7 +4709,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_LDRB_imm_post_down(inst);
+        return exec_LDRB_imm_post_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -4737,7 +4739,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_STRBT_imm_post_down(inst);
+        return exec_STRBT_imm_post_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -4767,7 +4769,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_LDRBT_imm_post_down(inst);
+        return exec_LDRBT_imm_post_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -4791,7 +4793,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_STR_imm_post_up(inst);
+        return exec_STR_imm_post_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -4813,7 +4815,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_LDR_imm_post_up(inst);
+        return exec_LDR_imm_post_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -4841,7 +4843,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_STRT_imm_post_up(inst);
+        return exec_STRT_imm_post_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -4869,7 +4871,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_LDRT_imm_post_up(inst);
+        return exec_LDRT_imm_post_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -4891,7 +4893,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_STRB_imm_post_up(inst);
+        return exec_STRB_imm_post_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -4913,7 +4915,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_LDRB_imm_post_up(inst);
+        return exec_LDRB_imm_post_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -4941,7 +4943,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_STRBT_imm_post_up(inst);
+        return exec_STRBT_imm_post_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -4969,7 +4971,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_LDRBT_imm_post_up(inst);
+        return exec_LDRBT_imm_post_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -4991,7 +4993,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_STR_imm_offset_down(inst);
+        return exec_STR_imm_offset_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -5013,7 +5015,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_LDR_imm_offset_down(inst);
+        return exec_LDR_imm_offset_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -5035,7 +5037,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_STR_imm_pre_down(inst);
+        return exec_STR_imm_pre_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -5057,7 +5059,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_LDR_imm_pre_down(inst);
+        return exec_LDR_imm_pre_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -5079,7 +5081,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_STRB_imm_offset_down(inst);
+        return exec_STRB_imm_offset_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -5101,7 +5103,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_LDRB_imm_offset_down(inst);
+        return exec_LDRB_imm_offset_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -5123,7 +5125,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_STRB_imm_pre_down(inst);
+        return exec_STRB_imm_pre_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -5145,7 +5147,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_LDRB_imm_pre_down(inst);
+        return exec_LDRB_imm_pre_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -5167,7 +5169,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_STR_imm_offset_up(inst);
+        return exec_STR_imm_offset_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -5189,7 +5191,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_LDR_imm_offset_up(inst);
+        return exec_LDR_imm_offset_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -5211,7 +5213,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_STR_imm_pre_up(inst);
+        return exec_STR_imm_pre_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -5233,7 +5235,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_LDR_imm_pre_up(inst);
+        return exec_LDR_imm_pre_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -5255,7 +5257,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_STRB_imm_offset_up(inst);
+        return exec_STRB_imm_offset_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -5277,7 +5279,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_LDRB_imm_offset_up(inst);
+        return exec_LDRB_imm_offset_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -5299,7 +5301,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_STRB_imm_pre_up(inst);
+        return exec_STRB_imm_pre_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -5321,7 +5323,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_LDRB_imm_pre_up(inst);
+        return exec_LDRB_imm_pre_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -5346,7 +5348,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_STR_reg_post_down(inst);
+          return exec_STR_reg_post_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -5394,7 +5396,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDR_reg_post_down(inst);
+          return exec_LDR_reg_post_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -5448,7 +5450,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_STRT_reg_post_down(inst);
+          return exec_STRT_reg_post_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -5502,7 +5504,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRT_reg_post_down(inst);
+          return exec_LDRT_reg_post_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -5550,7 +5552,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_STRB_reg_post_down(inst);
+          return exec_STRB_reg_post_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -5598,7 +5600,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRB_reg_post_down(inst);
+          return exec_LDRB_reg_post_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -5652,7 +5654,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_STRBT_reg_post_down(inst);
+          return exec_STRBT_reg_post_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -5706,7 +5708,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRBT_reg_post_down(inst);
+          return exec_LDRBT_reg_post_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -5754,7 +5756,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_STR_reg_post_up(inst);
+          return exec_STR_reg_post_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -5802,7 +5804,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDR_reg_post_up(inst);
+          return exec_LDR_reg_post_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -5856,7 +5858,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_STRT_reg_post_up(inst);
+          return exec_STRT_reg_post_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -5910,7 +5912,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRT_reg_post_up(inst);
+          return exec_LDRT_reg_post_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -5958,7 +5960,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_STRB_reg_post_up(inst);
+          return exec_STRB_reg_post_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -6006,7 +6008,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRB_reg_post_up(inst);
+          return exec_LDRB_reg_post_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -6060,7 +6062,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_STRBT_reg_post_up(inst);
+          return exec_STRBT_reg_post_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -6114,7 +6116,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRBT_reg_post_up(inst);
+          return exec_LDRBT_reg_post_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -6162,7 +6164,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_STR_reg_offset_down(inst);
+          return exec_STR_reg_offset_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -6210,7 +6212,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDR_reg_offset_down(inst);
+          return exec_LDR_reg_offset_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -6258,7 +6260,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_STR_reg_pre_down(inst);
+          return exec_STR_reg_pre_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -6306,7 +6308,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDR_reg_pre_down(inst);
+          return exec_LDR_reg_pre_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -6354,7 +6356,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_STRB_reg_offset_down(inst);
+          return exec_STRB_reg_offset_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -6402,7 +6404,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRB_reg_offset_down(inst);
+          return exec_LDRB_reg_offset_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -6450,7 +6452,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_STRB_reg_pre_down(inst);
+          return exec_STRB_reg_pre_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -6498,7 +6500,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRB_reg_pre_down(inst);
+          return exec_LDRB_reg_pre_down<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -6546,7 +6548,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_STR_reg_offset_up(inst);
+          return exec_STR_reg_offset_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -6594,7 +6596,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDR_reg_offset_up(inst);
+          return exec_LDR_reg_offset_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -6642,7 +6644,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_STR_reg_pre_up(inst);
+          return exec_STR_reg_pre_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -6690,7 +6692,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDR_reg_pre_up(inst);
+          return exec_LDR_reg_pre_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -6738,7 +6740,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_STRB_reg_offset_up(inst);
+          return exec_STRB_reg_offset_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -6786,7 +6788,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRB_reg_offset_up(inst);
+          return exec_LDRB_reg_offset_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -6834,7 +6836,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_STRB_reg_pre_up(inst);
+          return exec_STRB_reg_pre_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -6882,7 +6884,7 @@ namespace ARMware
         {
         case USAGE_NORMAL:
 #endif
-          return exec_LDRB_reg_pre_up(inst);
+          return exec_LDRB_reg_pre_up<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
         case USAGE_THREADED_CODE:
@@ -6927,7 +6929,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_STM_1_DA(inst);
+        return exec_STM_1_DA<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -6949,7 +6951,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_LDM_1_DA(inst);
+        return exec_LDM_1_DA<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -6971,7 +6973,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_STM_1_DA_w(inst);
+        return exec_STM_1_DA_w<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -6993,7 +6995,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_LDM_1_DA_w(inst);
+        return exec_LDM_1_DA_w<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -7015,7 +7017,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_STM_2_DA(inst);
+        return exec_STM_2_DA<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -7037,7 +7039,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_LDM_23_DA(inst);
+        return exec_LDM_23_DA<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -7073,7 +7075,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_LDM_23_DA_w(inst);
+        return exec_LDM_23_DA_w<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -7095,7 +7097,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_STM_1_IA(inst);
+        return exec_STM_1_IA<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -7117,7 +7119,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_LDM_1_IA(inst);
+        return exec_LDM_1_IA<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -7139,7 +7141,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_STM_1_IA_w(inst);
+        return exec_STM_1_IA_w<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -7161,7 +7163,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_LDM_1_IA_w(inst);
+        return exec_LDM_1_IA_w<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -7183,7 +7185,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_STM_2_IA(inst);
+        return exec_STM_2_IA<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -7205,7 +7207,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_LDM_23_IA(inst);
+        return exec_LDM_23_IA<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -7241,7 +7243,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_LDM_23_IA_w(inst);
+        return exec_LDM_23_IA_w<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -7263,7 +7265,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_STM_1_DB(inst);
+        return exec_STM_1_DB<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -7285,7 +7287,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_LDM_1_DB(inst);
+        return exec_LDM_1_DB<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -7307,7 +7309,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_STM_1_DB_w(inst);
+        return exec_STM_1_DB_w<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -7329,7 +7331,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_LDM_1_DB_w(inst);
+        return exec_LDM_1_DB_w<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -7351,7 +7353,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_STM_2_DB(inst);
+        return exec_STM_2_DB<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -7373,7 +7375,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_LDM_23_DB(inst);
+        return exec_LDM_23_DB<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -7409,7 +7411,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_LDM_23_DB_w(inst);
+        return exec_LDM_23_DB_w<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -7431,7 +7433,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_STM_1_IB(inst);
+        return exec_STM_1_IB<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -7453,7 +7455,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_LDM_1_IB(inst);
+        return exec_LDM_1_IB<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -7475,7 +7477,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_STM_1_IB_w(inst);
+        return exec_STM_1_IB_w<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -7497,7 +7499,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_LDM_1_IB_w(inst);
+        return exec_LDM_1_IB_w<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -7519,7 +7521,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_STM_2_IB(inst);
+        return exec_STM_2_IB<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -7541,7 +7543,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_LDM_23_IB(inst);
+        return exec_LDM_23_IB<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
@@ -7577,7 +7579,7 @@ namespace ARMware
       {
       case USAGE_NORMAL:
 #endif
-        return exec_LDM_23_IB_w(inst);
+        return exec_LDM_23_IB_w<T_mode>(inst);
 #if ENABLE_THREADED_CODE
           
       case USAGE_THREADED_CODE:
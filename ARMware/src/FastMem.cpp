@@ -0,0 +1,64 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+#include <cstdlib>
+#include <cstring>
+
+#include "FastMem.hpp"
+
+namespace ARMware
+{
+  ///////////////////////////////// Private ///////////////////////////////////
+  //============================== Operation ==================================
+  
+  void
+  FastMem::flush_all(uint32_t const generation)
+  {
+    for (uint32_t i = 0; i < ENTRY_NUMBER; ++i)
+    {
+      m_entries[i].m_tag = INVALID_TAG;
+    }
+    
+    m_generation = generation;
+  }
+  
+  ///////////////////////////////// Public ////////////////////////////////////
+  //============================== Life cycle =================================
+  
+  FastMem::FastMem()
+    : m_generation(0)
+  {
+#if ENABLE_INST_RECALL
+    // The instruction recall has to see the physical address of every
+    // access.
+    m_enable = false;
+#else
+    char const * const enable = getenv("ARMWARE_FASTMEM");
+    
+    m_enable = ((enable != 0) && (0 == strcmp(enable, "1")));
+#endif
+    
+    flush_all(0);
+  }
+  
+  FastMem::FastMem(bool const enable)
+    : m_enable(enable),
+      m_generation(0)
+  {
+    flush_all(0);
+  }
+}
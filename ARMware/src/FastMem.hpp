@@ -0,0 +1,214 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+#ifndef FastMem_hpp
+#define FastMem_hpp
+
+#include <cassert>
+
+#include "ARMware.hpp"
+#include "MachineType.hpp"
+#include "RuntimeStats.hpp"
+
+namespace ARMware
+{
+  // A direct mapped table from the guest virtual pages to the host
+  // addresses of their physical pages, for the data accesses of Core.
+  //
+  // A page gets an entry after an access to it has been translated by Mmu
+  // and it is in DRAM or in the flash ROM in the read array mode (i.e.
+  // AddressSpace::host_addr() gives its host address). Then a load hit is
+  // a load from the host address, and a store hit goes to
+  // Memory::put_data() with the DRAM offset (so the frame buffer, the walk
+  // cache and the code pages still see the store), both without Mmu and
+  // AddressSpace.
+  //
+  // Everything else (unmapped pages, MMIO, and accesses which are not
+  // allowed) misses, and takes the original path, which raises the
+  // exceptions. An entry can only be stored into when a store to the page
+  // has been allowed once, and the permission is kept separately for the
+  // user mode and the privileged modes.
+  //
+  // The table is flushed lazily whenever the generation of Mmu changes (a
+  // TLB is flushed, CP15 is written, or the flash ROM changes its mode).
+  //
+  // It is off unless ARMWARE_FASTMEM=1, until the hit rate
+  // (mmu.fastmem_hit & mmu.fastmem_miss) and the cost of a miss have been
+  // measured on real workloads. Core doesn't look it up at all then.
+  // 'armware --fastmem-benchmark' compares it with the TLB path (see
+  // Utils/FastMemBenchmark.hpp).
+  typedef class FastMem FastMem;
+  class FastMem
+  {
+  private:
+    
+    struct Entry
+    {
+      uint32_t m_tag;
+      uint8_t const *mp_host;
+      uint32_t m_dram_offset;
+      bool m_writable;
+    };
+    typedef struct Entry Entry;
+    
+#if ASSUME_NOT_USE_TINY_PAGE
+    static uint32_t const PAGE_SIZE = SIZE_4K;
+#else
+    static uint32_t const PAGE_SIZE = SIZE_1K;
+#endif
+    static uint32_t const ENTRY_NUMBER = 256;
+    static uint32_t const PRIVILEGED_TAG = 1;
+    static uint32_t const INVALID_TAG = 0xFFFFFFFF;
+    static uint32_t const NOT_IN_DRAM = 0xFFFFFFFF;
+    
+    // Attribute
+    
+    bool m_enable;
+    uint32_t m_generation;
+    
+    Entry m_entries[ENTRY_NUMBER];
+    
+    // Operation
+    
+    void flush_all(uint32_t const generation);
+    
+    // Inquery
+    
+    static inline uint32_t
+    tag_of(uint32_t const vaddr, CoreMode const mode)
+    { return ((vaddr & ~(PAGE_SIZE - 1)) | ((MODE_USR == mode) ? 0 : PRIVILEGED_TAG)); }
+    
+    inline Entry *
+    find(uint32_t const vaddr, CoreMode const mode, uint32_t const generation)
+    {
+      if (generation != m_generation)
+      {
+        flush_all(generation);
+        
+        return 0;
+      }
+      
+      Entry * const entry = &(m_entries[(vaddr / PAGE_SIZE) & (ENTRY_NUMBER - 1)]);
+      
+      return ((tag_of(vaddr, mode) == entry->m_tag) ? entry : 0);
+    }
+    
+  public:
+    
+    // Life cycle
+    
+    FastMem();
+    
+    // Turned on or off regardless of ARMWARE_FASTMEM, for FastMemBenchmark.
+    explicit FastMem(bool const enable);
+    
+    // Inquery
+    
+    inline bool
+    is_enabled() const
+    { return m_enable; }
+    
+    // Operation
+    
+    template<typename T_return>
+    inline bool
+    load(uint32_t const vaddr, CoreMode const mode, uint32_t const generation, T_return &value)
+    {
+      Entry const * const entry = find(vaddr, mode, generation);
+      
+      if (0 == entry)
+      {
+        g_runtime_stats.increase(RuntimeStats::FASTMEM_MISS);
+        
+        return false;
+      }
+      
+      g_runtime_stats.increase(RuntimeStats::FASTMEM_HIT);
+      
+      value = *(reinterpret_cast<T_return const *>(&(entry->mp_host[vaddr & (PAGE_SIZE - 1)])));
+      
+      return true;
+    }
+    
+    // @true: 'dram_offset' is where to store.
+    inline bool
+    store(uint32_t const vaddr, CoreMode const mode, uint32_t const generation, uint32_t &dram_offset)
+    {
+      Entry const * const entry = find(vaddr, mode, generation);
+      
+      if ((0 == entry) || (false == entry->m_writable))
+      {
+        g_runtime_stats.increase(RuntimeStats::FASTMEM_MISS);
+        
+        return false;
+      }
+      
+      g_runtime_stats.increase(RuntimeStats::FASTMEM_HIT);
+      
+      dram_offset = (entry->m_dram_offset | (vaddr & (PAGE_SIZE - 1)));
+      
+      return true;
+    }
+    
+    // Called after an access to 'vaddr' (before the FCSE remapping) in
+    // 'mode' is translated to 'paddr' without any exception, and 'host' is
+    // the host address of 'paddr'. 'is_store' tells whether the access is a
+    // store.
+    inline void
+    fill(uint32_t const vaddr,
+         CoreMode const mode,
+         uint32_t const generation,
+         uint32_t const paddr,
+         uint8_t const * const host,
+         bool const is_store)
+    {
+      assert(true == m_enable);
+      
+      if ((0 == host) || (generation != m_generation))
+      {
+        return;
+      }
+      
+      uint32_t const tag = tag_of(vaddr, mode);
+      Entry &entry = m_entries[(vaddr / PAGE_SIZE) & (ENTRY_NUMBER - 1)];
+      
+      // A store is allowed implies a load is allowed, but not the reverse,
+      // thus a load doesn't drop what a store has found out.
+      if ((tag == entry.m_tag) && (false == is_store))
+      {
+        return;
+      }
+      
+      entry.m_tag = tag;
+      entry.mp_host = (host - (vaddr & (PAGE_SIZE - 1)));
+      
+      // DRAM is mirrored in 0xC0000000 - 0xC7FFFFFF.
+      if (MachineType::DRAM_BASE == (paddr & 0xF8000000))
+      {
+        entry.m_dram_offset = ((paddr & ~(PAGE_SIZE - 1)) & MachineType::DRAM_SIZE);
+        entry.m_writable = is_store;
+      }
+      else
+      {
+        entry.m_dram_offset = NOT_IN_DRAM;
+        entry.m_writable = false;
+      }
+    }
+  };
+}
+
+#endif
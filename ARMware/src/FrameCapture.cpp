@@ -0,0 +1,576 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+#include "FrameCapture.hpp"
+#include "PixelConvert.hpp"
+#include "Log.hpp"
+
+namespace ARMware
+{
+  FrameCapture g_frame_capture;
+  
+  namespace
+  {
+    uint32_t g_crc_table[256];
+    bool g_crc_table_ready = false;
+    
+    uint32_t
+    crc32(uint8_t const * const data, uint32_t const size, uint32_t crc)
+    {
+      if (false == g_crc_table_ready)
+      {
+        for (uint32_t i = 0; i < 256; ++i)
+        {
+          uint32_t c = i;
+          
+          for (uint32_t j = 0; j < 8; ++j)
+          {
+            c = ((c & 1) ? (0xEDB88320 ^ (c >> 1)) : (c >> 1));
+          }
+          
+          g_crc_table[i] = c;
+        }
+        
+        g_crc_table_ready = true;
+      }
+      
+      crc = ~crc;
+      
+      for (uint32_t i = 0; i < size; ++i)
+      {
+        crc = g_crc_table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+      }
+      
+      return ~crc;
+    }
+    
+    uint32_t
+    adler32(uint8_t const * const data, uint32_t const size)
+    {
+      uint32_t a = 1;
+      uint32_t b = 0;
+      
+      for (uint32_t i = 0; i < size; ++i)
+      {
+        a = (a + data[i]) % 65521;
+        b = (b + a) % 65521;
+      }
+      
+      return (b << 16) | a;
+    }
+    
+    inline void
+    put_be32(std::vector<uint8_t> &buf, uint32_t const value)
+    {
+      buf.push_back(static_cast<uint8_t>(value >> 24));
+      buf.push_back(static_cast<uint8_t>(value >> 16));
+      buf.push_back(static_cast<uint8_t>(value >> 8));
+      buf.push_back(static_cast<uint8_t>(value));
+    }
+    
+    inline void
+    put_le16(std::ostream &os, uint32_t const value)
+    {
+      char const bytes[2] = { static_cast<char>(value),
+                              static_cast<char>(value >> 8) };
+      
+      os.write(bytes, sizeof(bytes));
+    }
+    
+    inline void
+    put_le32(std::ostream &os, uint32_t const value)
+    {
+      put_le16(os, value & 0xFFFF);
+      put_le16(os, value >> 16);
+    }
+    
+    inline void
+    put_le64(std::ostream &os, uint64_t const value)
+    {
+      put_le32(os, static_cast<uint32_t>(value));
+      put_le32(os, static_cast<uint32_t>(value >> 32));
+    }
+    
+    void
+    write_png_chunk(std::ostream &os, char const * const type, std::vector<uint8_t> const &data)
+    {
+      std::vector<uint8_t> chunk;
+      
+      put_be32(chunk, static_cast<uint32_t>(data.size()));
+      chunk.insert(chunk.end(), type, type + 4);
+      chunk.insert(chunk.end(), data.begin(), data.end());
+      
+      put_be32(chunk, crc32(&(chunk[4]), static_cast<uint32_t>(chunk.size() - 4), 0));
+      
+      os.write(reinterpret_cast<char const *>(&(chunk[0])), chunk.size());
+    }
+  }
+  
+  ///////////////////////////////// Private ///////////////////////////////////
+  
+  // The same rule as MachineScreen::update_color_depth(): Memory::mark_dirty()
+  // only knows the 16-bit layout, thus in the palettized modes the whole
+  // screen is taken when anything is marked or the palette is changed.
+  void
+  FrameCapture::update_color_depth()
+  {
+    uint16_t const * const palette = reinterpret_cast<uint16_t const *>(&(mp_memory[m_frame_buffer_addr_1]));
+    
+    uint32_t color_depth;
+    
+    switch ((palette[0] >> 12) & 0x3)
+    {
+    case 0: color_depth = 4; break;
+    case 1: color_depth = 8; break;
+    default: color_depth = 16; break;
+    }
+    
+    if (color_depth != m_color_depth)
+    {
+      m_color_depth = color_depth;
+      
+      update_whole_screen();
+    }
+    
+    if (color_depth != 16)
+    {
+      uint32_t const entry_number = ((8 == color_depth) ? 256 : 16);
+      uint32_t lut[256];
+      
+      PixelConvert::build_lut(palette, entry_number, lut);
+      
+      bool marked = false;
+      
+      for (uint32_t i = 0; i < ((MachineScreen::DIRTY_UNIT_NUMBER + 31) >> 5); ++i)
+      {
+        if (m_dirty_bitmap[i] != 0)
+        {
+          marked = true;
+          break;
+        }
+      }
+      
+      if ((true == marked) ||
+          (memcmp(lut, m_color_lut, entry_number * sizeof(uint32_t)) != 0))
+      {
+        memcpy(m_color_lut, lut, entry_number * sizeof(uint32_t));
+        
+        update_whole_screen();
+      }
+    }
+  }
+  
+  // The frame buffer of H3600 is rotated, one frame buffer line is one
+  // column of the screen, and its first pixel is at the bottom.
+  void
+  FrameCapture::convert_column(uint32_t const x)
+  {
+    uint32_t const panel_left = (((DUAL_PANEL == (m_lcd_status & DUAL_PANEL)) && (x >= (DISPLAY_WIDTH >> 1)))
+                                 ? (DISPLAY_WIDTH >> 1)
+                                 : 0);
+    
+    uint32_t const palette_size = ((8 == m_color_depth) ? (256 * 2) : MachineScreen::PALETTE_OFFSET);
+    
+    uint32_t const panel_start = ((0 == panel_left)
+                                  ? (m_frame_buffer_addr_1 + palette_size)
+                                  : m_frame_buffer_addr_2);
+    
+    uint32_t const machine_bpl = ((DISPLAY_HEIGHT * m_color_depth) >> 3); // bytes per line
+    uint32_t const line_addr = panel_start + ((x - panel_left) * machine_bpl);
+    
+    if ((line_addr + machine_bpl) > MachineType::DRAM_SIZE)
+    {
+      memset(m_converted_line, 0, sizeof(m_converted_line));
+    }
+    else
+    {
+      uint8_t const * const line = &(mp_memory[line_addr]);
+      
+      switch (m_color_depth)
+      {
+      case 16:
+        g_pixel_convert.convert_16bpp(reinterpret_cast<uint16_t const *>(line), m_converted_line, DISPLAY_HEIGHT);
+        break;
+      
+      case 8:
+        g_pixel_convert.convert_8bpp(line, m_converted_line, DISPLAY_HEIGHT, m_color_lut);
+        break;
+      
+      case 4:
+        g_pixel_convert.convert_4bpp(line, 0, m_converted_line, DISPLAY_HEIGHT, m_color_lut);
+        break;
+      
+      default:
+        assert(!"Should not reach here.");
+        break;
+      }
+    }
+    
+    // The converted pixels are in the RGBA byte order.
+    uint8_t const *src = reinterpret_cast<uint8_t const *>(m_converted_line);
+    uint8_t *dest = &(m_image[(((DISPLAY_HEIGHT - 1) * DISPLAY_WIDTH) + x) * 3]);
+    
+    for (uint32_t i = 0; i < DISPLAY_HEIGHT; ++i)
+    {
+      dest[0] = src[0];
+      dest[1] = src[1];
+      dest[2] = src[2];
+      
+      src += 4;
+      dest -= (DISPLAY_WIDTH * 3);
+    }
+  }
+  
+  void
+  FrameCapture::convert_frame()
+  {
+    if (0 == (m_lcd_status & ENABLE_DRAWING))
+    {
+      if (true == m_whole_screen)
+      {
+        std::fill(m_image.begin(), m_image.end(), 0);
+      }
+      
+      return;
+    }
+    
+    for (uint32_t x = 0; x < DISPLAY_WIDTH; ++x)
+    {
+      bool dirty = m_whole_screen;
+      
+      for (uint32_t idx = (x * MachineScreen::DIRTY_UNITS_PER_LINE);
+           (false == dirty) && (idx < ((x + 1) * MachineScreen::DIRTY_UNITS_PER_LINE));
+           ++idx)
+      {
+        dirty = ((m_dirty_bitmap[idx >> 5] & (1 << (idx & 31))) != 0);
+      }
+      
+      if (true == dirty)
+      {
+        convert_column(x);
+      }
+    }
+  }
+  
+  // Each row of dirty units (DIRTY_UNIT_PIXELS pixels high) is split into
+  // runs of dirty columns, and each run becomes one rectangle.
+  void
+  FrameCapture::collect_rects()
+  {
+    m_rects.clear();
+    
+    if (true == m_whole_screen)
+    {
+      Rect const rect = { 0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT };
+      
+      m_rects.push_back(rect);
+      
+      return;
+    }
+    
+    for (uint32_t unit = 0; unit < MachineScreen::DIRTY_UNITS_PER_LINE; ++unit)
+    {
+      uint32_t const bottom = DISPLAY_HEIGHT - (unit * MachineScreen::DIRTY_UNIT_PIXELS);
+      uint32_t const top = bottom - MachineScreen::DIRTY_UNIT_PIXELS;
+      
+      uint32_t x = 0;
+      
+      while (x < DISPLAY_WIDTH)
+      {
+        uint32_t const idx = (x * MachineScreen::DIRTY_UNITS_PER_LINE) + unit;
+        
+        if (0 == (m_dirty_bitmap[idx >> 5] & (1 << (idx & 31))))
+        {
+          ++x;
+          
+          continue;
+        }
+        
+        uint32_t const left = x;
+        
+        do
+        {
+          ++x;
+        }
+        while ((x < DISPLAY_WIDTH) &&
+               ((m_dirty_bitmap[((x * MachineScreen::DIRTY_UNITS_PER_LINE) + unit) >> 5] &
+                 (1 << (((x * MachineScreen::DIRTY_UNITS_PER_LINE) + unit) & 31))) != 0));
+        
+        Rect const rect = { left, top, x, bottom };
+        
+        m_rects.push_back(rect);
+      }
+    }
+  }
+  
+  void
+  FrameCapture::write_ppm(std::string const &path) const
+  {
+    std::ofstream file(path.c_str(), std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+    
+    file << "P6\n" << DISPLAY_WIDTH << " " << DISPLAY_HEIGHT << "\n255\n";
+    file.write(reinterpret_cast<char const *>(&(m_image[0])), m_image.size());
+  }
+  
+  // The IDAT is a zlib stream of stored (uncompressed) deflate blocks, thus
+  // no compression library is needed. A frame is about 225 KBytes.
+  void
+  FrameCapture::write_png(std::string const &path) const
+  {
+    uint32_t const row_size = (DISPLAY_WIDTH * 3) + 1; // filter type + RGB
+    
+    std::vector<uint8_t> raw;
+    
+    raw.reserve(row_size * DISPLAY_HEIGHT);
+    
+    for (uint32_t y = 0; y < DISPLAY_HEIGHT; ++y)
+    {
+      raw.push_back(0); // filter type: none
+      raw.insert(raw.end(),
+                 m_image.begin() + (y * DISPLAY_WIDTH * 3),
+                 m_image.begin() + ((y + 1) * DISPLAY_WIDTH * 3));
+    }
+    
+    std::vector<uint8_t> header;
+    
+    put_be32(header, DISPLAY_WIDTH);
+    put_be32(header, DISPLAY_HEIGHT);
+    header.push_back(8); // bit depth
+    header.push_back(2); // color type: RGB
+    header.push_back(0); // compression method
+    header.push_back(0); // filter method
+    header.push_back(0); // interlace method
+    
+    std::vector<uint8_t> idat;
+    
+    idat.push_back(0x78); // CM = 8, CINFO = 7
+    idat.push_back(0x01); // FCHECK, no dictionary
+    
+    for (uint32_t offset = 0; offset < raw.size(); )
+    {
+      uint32_t const size = std::min<uint32_t>(static_cast<uint32_t>(raw.size()) - offset, 0xFFFF);
+      
+      idat.push_back(((offset + size) == raw.size()) ? 1 : 0); // BFINAL, BTYPE = 00
+      idat.push_back(static_cast<uint8_t>(size));
+      idat.push_back(static_cast<uint8_t>(size >> 8));
+      idat.push_back(static_cast<uint8_t>(~size));
+      idat.push_back(static_cast<uint8_t>(~size >> 8));
+      
+      idat.insert(idat.end(), raw.begin() + offset, raw.begin() + offset + size);
+      
+      offset += size;
+    }
+    
+    put_be32(idat, adler32(&(raw[0]), static_cast<uint32_t>(raw.size())));
+    
+    std::ofstream file(path.c_str(), std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+    
+    file.write("\x89PNG\r\n\x1A\n", 8);
+    
+    write_png_chunk(file, "IHDR", header);
+    write_png_chunk(file, "IDAT", idat);
+    write_png_chunk(file, "IEND", std::vector<uint8_t>());
+  }
+  
+  void
+  FrameCapture::write_delta(TriggerEnum const trigger)
+  {
+    put_le64(m_delta_file, m_virtual_time);
+    put_le32(m_delta_file, trigger);
+    put_le32(m_delta_file, static_cast<uint32_t>(m_rects.size()));
+    
+    for (std::vector<Rect>::const_iterator iter = m_rects.begin();
+         iter != m_rects.end();
+         ++iter)
+    {
+      put_le16(m_delta_file, iter->m_left);
+      put_le16(m_delta_file, iter->m_top);
+      put_le16(m_delta_file, iter->m_right - iter->m_left);
+      put_le16(m_delta_file, iter->m_bottom - iter->m_top);
+      
+      for (uint32_t y = iter->m_top; y < iter->m_bottom; ++y)
+      {
+        m_delta_file.write(reinterpret_cast<char const *>(&(m_image[((y * DISPLAY_WIDTH) + iter->m_left) * 3])),
+                           (iter->m_right - iter->m_left) * 3);
+      }
+    }
+    
+    m_delta_file.flush();
+  }
+  
+  void
+  FrameCapture::capture(TriggerEnum const trigger)
+  {
+    assert(mp_memory != 0);
+    
+    if (ENABLE_DRAWING == (m_lcd_status & ENABLE_DRAWING))
+    {
+      update_color_depth();
+    }
+    
+    collect_rects();
+    convert_frame();
+    
+    memset(m_dirty_bitmap, 0, sizeof(m_dirty_bitmap));
+    m_whole_screen = false;
+    
+    switch (m_format)
+    {
+    case FORMAT_DELTA:
+      write_delta(trigger);
+      break;
+    
+    case FORMAT_PNG:
+    case FORMAT_PPM:
+      {
+        std::ostringstream path;
+        
+        path << m_output_dir << "/frame-" << std::setw(6) << std::setfill('0') << m_frame_number
+             << ((FORMAT_PNG == m_format) ? ".png" : ".ppm");
+        
+        if (FORMAT_PNG == m_format)
+        {
+          write_png(path.str());
+        }
+        else
+        {
+          write_ppm(path.str());
+        }
+      }
+      break;
+    
+    default:
+      assert(!"Should not reach here.");
+      break;
+    }
+    
+    ++m_frame_number;
+    
+    if ((m_max_frame_number != 0) && (m_frame_number >= m_max_frame_number))
+    {
+      m_delta_file.close();
+      
+      g_log_file << "CAPTURE: " << std::dec << m_frame_number << " frames are taken, stop the machine." << std::endl;
+      
+      // Core::check_periphery() sees this and stops the machine through
+      // Core::run(), so that the other threads and the profilers are shut
+      // down as usual.
+      m_enable = false;
+      m_finished = true;
+    }
+  }
+  
+  ///////////////////////////////// Public ////////////////////////////////////
+  //============================== Life cycle =================================
+  
+  FrameCapture::FrameCapture()
+    : m_enable(false),
+      m_finished(false),
+      m_on_flip(false),
+      m_format(FORMAT_PNG),
+      m_virtual_time(0),
+      m_period(0),
+      m_countdown(0),
+      m_frame_number(0),
+      m_max_frame_number(0),
+      mp_memory(0),
+      m_lcd_status(0),
+      m_frame_buffer_addr_1(0),
+      m_frame_buffer_addr_2(0),
+      m_whole_screen(true),
+      m_color_depth(16),
+      m_image(DISPLAY_WIDTH * DISPLAY_HEIGHT * 3, 0)
+  {
+    memset(m_dirty_bitmap, 0, sizeof(m_dirty_bitmap));
+    memset(m_color_lut, 0, sizeof(m_color_lut));
+  }
+  
+  //============================== Operation ==================================
+  
+  void
+  FrameCapture::init()
+  {
+    char const * const output_dir = getenv("ARMWARE_CAPTURE");
+    
+    if (0 == output_dir)
+    {
+      return;
+    }
+    
+    m_output_dir = output_dir;
+    
+    char const * const format = getenv("ARMWARE_CAPTURE_FORMAT");
+    
+    if (format != 0)
+    {
+      std::string const name(format);
+      
+      if ("ppm" == name)
+      {
+        m_format = FORMAT_PPM;
+      }
+      else if ("delta" == name)
+      {
+        m_format = FORMAT_DELTA;
+      }
+    }
+    
+    char const * const period = getenv("ARMWARE_CAPTURE_PERIOD");
+    uint32_t const period_ms = ((period != 0) ? strtoul(period, 0, 10) : DEFAULT_PERIOD);
+    
+    m_period = static_cast<uint32_t>((static_cast<uint64_t>(period_ms) * TICKS_PER_SECOND) / 1000);
+    m_countdown = m_period;
+    
+    char const * const on_flip = getenv("ARMWARE_CAPTURE_ON_FLIP");
+    
+    m_on_flip = ((on_flip != 0) && (strcmp(on_flip, "0") != 0));
+    
+    char const * const max_frame_number = getenv("ARMWARE_CAPTURE_FRAMES");
+    
+    if (max_frame_number != 0)
+    {
+      m_max_frame_number = strtoul(max_frame_number, 0, 10);
+    }
+    
+    if (FORMAT_DELTA == m_format)
+    {
+      std::string const path = m_output_dir + "/capture.armfb";
+      
+      m_delta_file.open(path.c_str(), std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+      
+      if (false == m_delta_file.is_open())
+      {
+        g_log_file << "CAPTURE: can not create " << path << std::endl;
+        
+        return;
+      }
+      
+      m_delta_file.write("ARMWFB01", 8);
+      put_le32(m_delta_file, DISPLAY_WIDTH);
+      put_le32(m_delta_file, DISPLAY_HEIGHT);
+      put_le32(m_delta_file, TICKS_PER_SECOND);
+    }
+    
+    m_enable = true;
+  }
+}
@@ -0,0 +1,273 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+#ifndef FrameCapture_hpp
+#define FrameCapture_hpp
+
+#include <cassert>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "Type.hpp"
+#include "MachineType.hpp"
+#include "Gtk/MachineScreen.hpp"
+
+namespace ARMware
+{
+  // Headless capture of the LCD frames for the automated visual tests.
+  //
+  // It doesn't read anything from MachineScreen, the frames are converted
+  // from the guest DRAM on the emulation thread, and they are taken on the
+  // virtual time, which is counted in the OS timer ticks (3.6864 MHz).
+  // Thus the same ROM image with the same inputs gives the same sequence of
+  // frames, no matter how fast the host or the render thread is.
+  //
+  // ARMWARE_CAPTURE=<directory> turns it on.
+  //
+  // ARMWARE_CAPTURE_FORMAT:
+  //
+  // * png (default): <directory>/frame-<N>.png for each frame.
+  // * ppm: <directory>/frame-<N>.ppm for each frame.
+  // * delta: all frames go into <directory>/capture.armfb, and each frame
+  //   contains only the rectangles marked in the dirty bitmap since the
+  //   previous frame. All values are little endian:
+  //
+  //   header: "ARMWFB01", u32 width, u32 height, u32 ticks per second
+  //   frame:  u64 virtual time (in ticks), u32 trigger (0: period, 1: guest),
+  //           u32 number of rectangles, and then for each rectangle:
+  //           u16 left, u16 top, u16 width, u16 height,
+  //           width * height RGB pixels, row by row.
+  //
+  // ARMWARE_CAPTURE_PERIOD=<ms> takes a frame every <ms> milliseconds of the
+  // virtual time (100 by default, 0 turns it off).
+  //
+  // ARMWARE_CAPTURE_ON_FLIP=1 takes a frame whenever the guest changes DBAR1,
+  // i.e. flips its frame buffer.
+  //
+  // ARMWARE_CAPTURE_FRAMES=<n> stops the machine after <n> frames, and
+  // then ARMware quits.
+  //
+  // ARMWARE_CAPTURE_MACHINE=<machine name> powers that machine of the
+  // machine database on without MainWindow & MachineScreen (see
+  // HeadlessCapture), thus no GTK main loop and no display are needed.
+  // Without it, the machine is powered on from MainWindow as usual.
+  typedef class FrameCapture FrameCapture;
+  class FrameCapture
+  {
+  public:
+    
+    enum TriggerEnum
+    {
+      TRIGGER_PERIOD,
+      TRIGGER_GUEST
+    };
+    typedef enum TriggerEnum TriggerEnum;
+  
+  private:
+    
+    enum FormatEnum
+    {
+      FORMAT_PNG,
+      FORMAT_PPM,
+      FORMAT_DELTA
+    };
+    typedef enum FormatEnum FormatEnum;
+    
+    enum LcdStatusEnum
+    {
+      ENABLE_DRAWING = 0x1,
+      DUAL_PANEL = 0x2
+    };
+    typedef enum LcdStatusEnum LcdStatusEnum;
+    
+    struct Rect
+    {
+      uint32_t m_left;
+      uint32_t m_top;
+      uint32_t m_right;
+      uint32_t m_bottom;
+    };
+    typedef struct Rect Rect;
+    
+    static uint32_t const TICKS_PER_SECOND = 3686400;
+    static uint32_t const DEFAULT_PERIOD = 100; // ms
+    
+    static uint32_t const DISPLAY_WIDTH = MachineScreen::DISPLAY_WIDTH;
+    static uint32_t const DISPLAY_HEIGHT = MachineScreen::DISPLAY_HEIGHT;
+    
+    // Attribute
+    
+    bool m_enable;
+    bool m_finished;
+    bool m_on_flip;
+    FormatEnum m_format;
+    
+    std::string m_output_dir;
+    
+    uint64_t m_virtual_time;
+    uint32_t m_period;
+    uint32_t m_countdown;
+    uint32_t m_frame_number;
+    uint32_t m_max_frame_number;
+    
+    uint8_t const *mp_memory;
+    
+    uint32_t m_lcd_status;
+    uint32_t m_frame_buffer_addr_1;
+    uint32_t m_frame_buffer_addr_2;
+    
+    // The same geometry as the dirty bitmap of MachineScreen, but it is
+    // consumed by capture() instead of the render thread.
+    uint32_t m_dirty_bitmap[(MachineScreen::DIRTY_UNIT_NUMBER + 31) >> 5];
+    bool m_whole_screen;
+    
+    uint32_t m_color_depth;
+    uint32_t m_color_lut[256];
+    uint32_t m_converted_line[DISPLAY_HEIGHT];
+    
+    std::vector<uint8_t> m_image; // RGB
+    std::vector<Rect> m_rects;
+    
+    std::ofstream m_delta_file;
+    
+    // Operation
+    
+    void update_color_depth();
+    void convert_column(uint32_t const x);
+    void convert_frame();
+    void collect_rects();
+    
+    void write_ppm(std::string const &path) const;
+    void write_png(std::string const &path) const;
+    void write_delta(TriggerEnum const trigger);
+    
+    void capture(TriggerEnum const trigger);
+    
+    inline void
+    update_whole_screen()
+    { m_whole_screen = true; }
+  
+  public:
+    
+    // Life cycle
+    
+    FrameCapture();
+    
+    // Operation
+    
+    void init();
+    
+    inline void
+    register_memory(uint8_t const * const memory)
+    { mp_memory = memory; }
+    
+    inline void
+    set_frame_buffer_addr_1(uint32_t const address)
+    {
+      m_frame_buffer_addr_1 = (address - MachineType::DRAM_BASE);
+      
+      update_whole_screen();
+    }
+    
+    inline void
+    set_frame_buffer_addr_2(uint32_t const address)
+    {
+      m_frame_buffer_addr_2 = (address - MachineType::DRAM_BASE);
+      
+      update_whole_screen();
+    }
+    
+    inline void
+    enable_drawing()
+    {
+      m_lcd_status |= ENABLE_DRAWING;
+      
+      update_whole_screen();
+    }
+    
+    inline void
+    disable_drawing()
+    {
+      m_lcd_status &= ~ENABLE_DRAWING;
+      
+      update_whole_screen();
+    }
+    
+    inline void
+    enable_dual_panel()
+    {
+      m_lcd_status |= DUAL_PANEL;
+      
+      update_whole_screen();
+    }
+    
+    inline void
+    disable_dual_panel()
+    {
+      m_lcd_status &= ~DUAL_PANEL;
+      
+      update_whole_screen();
+    }
+    
+    inline void
+    mark_dirty_unit(uint32_t const idx)
+    {
+      assert(idx < MachineScreen::DIRTY_UNIT_NUMBER);
+      
+      m_dirty_bitmap[idx >> 5] |= (1 << (idx & 31));
+    }
+    
+    // Called once per OS timer tick.
+    inline void
+    tick()
+    {
+      ++m_virtual_time;
+      
+      if ((m_period != 0) && (0 == --m_countdown))
+      {
+        m_countdown = m_period;
+        
+        capture(TRIGGER_PERIOD);
+      }
+    }
+    
+    inline void
+    frame_flipped()
+    {
+      if ((true == m_enable) && (true == m_on_flip))
+      {
+        capture(TRIGGER_GUEST);
+      }
+    }
+    
+    // Inquery
+    
+    inline bool
+    is_enabled() const
+    { return m_enable; }
+    
+    // ARMWARE_CAPTURE_FRAMES frames have been taken.
+    inline bool
+    is_finished() const
+    { return m_finished; }
+  };
+  
+  extern FrameCapture g_frame_capture;
+}
+
+#endif
@@ -30,218 +30,203 @@
 
 namespace ARMware
 {
-  //////////////////////////////// Public /////////////////////////////////////
+  //////////////////////////////// Private ////////////////////////////////////
   //============================== Operation ==================================
   
   void
-  GPIOControlBlock::reset()
+  GPIOControlBlock::write_GPDR(uint32_t const /* address */, uint32_t const value)
   {
-    m_GPLR &= 0xFFFFFFF;
-    m_GEDR &= 0xFFFFFFF;
-    m_GPDR = 0;
-    m_GAFR = 0;
+    // :SA-1110 Developer's Manual: p.233: Wei 2004-Jun-06:
+    //
+    // In active mode, GPIO pins 2..9 are also used.
+    // Note that the user must configure GPIO pins 2..9 as outputs (for 16-bit/pixel mode)
+    // by setting the appropriate bits within the GPIO pin direction register (GPDR)
+    // and GPIO alternate function register (GAFR).
+    //
+    // :NOTE: Wei 2004-Jun-06:
+    //
+    // ARMware supports only TFT (active) mode now.
+    assert(LDD_BITS == (value & LDD_BITS));
     
-    release_action_button();
+    // :SA-1110 Developer's Manual: p.76: Wei 2004-Jun-05:
+    //
+    // The upper 4 bits are always 0.
+    m_GPDR = (value & 0xFFFFFFF);
     
-    m_GPLR_backup = m_GPLR;
+#if TRACE_GPIO
+    g_log_file << "-GPIO: put GPDR: " << std::hex << m_GPDR << std::endl;
+#endif
   }
   
-  template<>
-  uint32_t
-  GPIOControlBlock::get_data(uint32_t const address) const
+  void
+  GPIOControlBlock::write_GPSR(uint32_t const /* address */, uint32_t const value)
   {
-    switch (address)
-    {
-    case GPLR:
-#if TRACE_GPIO
-      g_log_file << "-GPIO: get GPLR: " << m_GPLR << std::endl;
-#endif
-      return m_GPLR;
-      
-    case GPDR:
-#if TRACE_GPIO
-      g_log_file << "-GPIO: get GPDR: " << m_GPDR << std::endl;
-#endif
-      return m_GPDR;
-      
-    case GPSR:
-    case GPCR:
-      // :SA-1110 Developer's Manual: p.77: Wei 2004-Jun-05:
-      //
-      // GPSR & GPCR are write-only registers.
-      assert(!"Should not reach here.");
-      return 0;
-      
-    case GRER:
 #if TRACE_GPIO
-      g_log_file << "-GPIO: get GRER: " << m_GRER << std::endl;
+    g_log_file << "-GPIO: put GPSR: " << std::hex << value << std::endl;
 #endif
-      return m_GRER;
-      
-    case GFER:
-#if TRACE_GPIO
-      g_log_file << "-GPIO: get GFER: " << m_GFER << std::endl;
-#endif
-      return m_GFER;
-      
-    case GEDR:
-#if TRACE_GPIO
-      g_log_file << "-GPIO: get GEDR: " << m_GEDR << std::endl;
-#endif
-      return m_GEDR;
-      
-    case GAFR:
+    
+    // Determine what pins are configured as output and we want to set it value now.
+    uint32_t const temp = (m_GPDR & (value & 0xFFFFFFF));
+    uint32_t const new_GPLR = m_GPLR | temp;
+    uint32_t const diff = m_GPLR ^ new_GPLR;
+    
+    // Update GEDR
+    m_GEDR |= (m_GRER & (new_GPLR & diff));
+    
+    // Update GPLR
+    m_GPLR = new_GPLR;
+    
 #if TRACE_GPIO
-      g_log_file << "-GPIO: get GAFR: " << m_GAFR << std::endl;
+    g_log_file << "-GPIO: new GPLR: " << std::hex << m_GPLR << std::endl;
 #endif
-      return m_GAFR;
-      
-    default:
-      assert(!"Should not reach here.");
-      return 0;
-    }
   }
   
-  template<>
   void
-  GPIOControlBlock::put_data(uint32_t const address, uint32_t const value)
+  GPIOControlBlock::write_GPCR(uint32_t const /* address */, uint32_t const value)
   {
-    switch (address)
-    {
-    case GPLR:
-      // :SA-1110 Developer's Manual: p.75: Wei 2004-Jun-05:
-      //
-      // GPLR is a read-only register.
-      assert(!"Should not reach here.");
-      break;
-      
-    case GPDR:
-      // :SA-1110 Developer's Manual: p.233: Wei 2004-Jun-06:
-      //
-      // In active mode, GPIO pins 2..9 are also used.
-      // Note that the user must configure GPIO pins 2..9 as outputs (for 16-bit/pixel mode)
-      // by setting the appropriate bits within the GPIO pin direction register (GPDR)
-      // and GPIO alternate function register (GAFR).
-      //
-      // :NOTE: Wei 2004-Jun-06:
-      //
-      // ARMware supports only TFT (active) mode now.
-      assert(LDD_BITS == (value & LDD_BITS));
-      
-      // :SA-1110 Developer's Manual: p.76: Wei 2004-Jun-05:
-      //
-      // The upper 4 bits are always 0.
-      m_GPDR = (value & 0xFFFFFFF);
-      
-#if TRACE_GPIO
-      g_log_file << "-GPIO: put GPDR: " << std::hex << m_GPDR << std::endl;
-#endif
-      break;
-      
-    case GPSR:
-      {
 #if TRACE_GPIO
-        g_log_file << "-GPIO: put GPSR: " << std::hex << value << std::endl;
+    g_log_file << "-GPIO: put GPCR: " << std::hex << value << std::endl;
 #endif
-        
-        // Determine what pins are configured as output and we want to set it value now.
-        uint32_t const temp = (m_GPDR & (value & 0xFFFFFFF));
-        uint32_t const new_GPLR = m_GPLR | temp;
-        uint32_t const diff = m_GPLR ^ new_GPLR;
-        
-        // Update GEDR
-        m_GEDR |= (m_GRER & (new_GPLR & diff));
-        
-        // Update GPLR
-        m_GPLR = new_GPLR;
-        
-#if TRACE_GPIO
-        g_log_file << "-GPIO: new GPLR: " << std::hex << m_GPLR << std::endl;
-#endif
-      }
-      break;
-      
-    case GPCR:
-      {
+    
+    // Determine what pins are configured as output and we want to clear it value now.
+    uint32_t const temp = (m_GPDR & (value & 0xFFFFFFF));
+    
+    // Update GEDR
+    m_GEDR |= (m_GFER & (m_GPLR & temp));
+    
+    // Update GPLR
+    
+    // :SA-1110 Developer's Manual: p.77: Wei 2004-Jul-1:
+    //
+    // To clear an output pin, a one is written to the corresponding bit within the GPCR.
+    m_GPLR &= ~temp;
+    
 #if TRACE_GPIO
-        g_log_file << "-GPIO: put GPCR: " << std::hex << value << std::endl;
+    g_log_file << "-GPIO: new GPLR: " << std::hex << m_GPLR << std::endl;
 #endif
-        
-        // Determine what pins are configured as output and we want to clear it value now.
-        uint32_t const temp = (m_GPDR & (value & 0xFFFFFFF));
-        
-        // Update GEDR
-        m_GEDR |= (m_GFER & (m_GPLR & temp));
-        
-        // Update GPLR
-        
-        // :SA-1110 Developer's Manual: p.77: Wei 2004-Jul-1:
-        //
-        // To clear an output pin, a one is written to the corresponding bit within the GPCR.
-        m_GPLR &= ~temp;
-        
+  }
+  
+  void
+  GPIOControlBlock::write_GRER(uint32_t const /* address */, uint32_t const value)
+  {
+    m_GRER = (value & 0xFFFFFFF);
+    
 #if TRACE_GPIO
-        g_log_file << "-GPIO: new GPLR: " << std::hex << m_GPLR << std::endl;
+    g_log_file << "-GPIO: put GRER: " << std::hex << m_GRER << std::endl;
 #endif
-      }
-      break;
-      
-    case GRER:
-      m_GRER = (value & 0xFFFFFFF);
-      
+  }
+  
+  void
+  GPIOControlBlock::write_GFER(uint32_t const /* address */, uint32_t const value)
+  {
+    m_GFER = (value & 0xFFFFFFF);
+    
 #if TRACE_GPIO
-      g_log_file << "-GPIO: put GRER: " << std::hex << m_GRER << std::endl;
+    g_log_file << "-GPIO: put GFER: " << std::hex << m_GFER << std::endl;
 #endif
-      break;
-      
-    case GFER:
-      m_GFER = (value & 0xFFFFFFF);
-      
+  }
+  
+  void
+  GPIOControlBlock::write_GEDR(uint32_t const /* address */, uint32_t const value)
+  {
+    // :SA-1110 Developer's Manual: p.79: Wei 2004-Jun-05:
+    //
+    // GEDR status bits are cleared by writing a one to them.
+    // Writing a zero to a GEDR status bit has no effect.
+    m_GEDR &= ~(value & 0xFFFFFFF);
+    
 #if TRACE_GPIO
-      g_log_file << "-GPIO: put GFER: " << std::hex << m_GFER << std::endl;
+    g_log_file << "-GPIO: put GEDR: " << std::hex << m_GEDR << std::endl;
 #endif
-      break;
-      
-    case GEDR:
-      // :SA-1110 Developer's Manual: p.79: Wei 2004-Jun-05:
-      //
-      // GEDR status bits are cleared by writing a one to them.
-      // Writing a zero to a GEDR status bit has no effect.
-      m_GEDR &= ~(value & 0xFFFFFFF);
-      
+  }
+  
+  void
+  GPIOControlBlock::write_GAFR(uint32_t const /* address */, uint32_t const value)
+  {
+    // :SA-1110 Developer's Manual: p.80: Wei 2004-Jun-06:
+    //
+    // A bit set in this register indicates that the corresponding GPIO pin
+    // is to be used for its alternate function.
+    //
+    // :NOTE: Wei 2004-Jun-06:
+    //
+    // ARMware supports only TFT (active) mode now, thus GPIO pins 2..9 have
+    // to be used for their alternate function (see write_GPDR()).
+    assert(LDD_BITS == (value & LDD_BITS));
+    
+    m_GAFR = (value & 0xFFFFFFF);
+    
 #if TRACE_GPIO
-      g_log_file << "-GPIO: put GEDR: " << std::hex << m_GEDR << std::endl;
+    g_log_file << "-GPIO: put GAFR: " << std::hex << m_GAFR << std::endl;
 #endif
-      break;
-      
-    case GAFR:
-      // :SA-1110 Developer's Manual: p.233: Wei 2004-Jun-06:
-      //
-      // In active mode, GPIO pins 2..9 are also used.
-      // Note that the user must configure GPIO pins 2..9 as outputs (for 16-bit/pixel mode)
-      // by setting the appropriate bits within the GPIO pin direction register (GPDR)
-      // and GPIO alternate function register (GAFR).
-      //
-      // :NOTE: Wei 2004-Jun-06:
-      //
-      // ARMware supports only TFT (active) mode now.
-      
-      // :SA-1110 Developer's Manual: p.80: Wei 2004-Jun-06:
-      //
-      // A bit set in this register indicates that the corresponding GPIO pin
-      // is to be used for its alternate function.
-      assert(LDD_BITS == (value & LDD_BITS));
-      
-      m_GAFR = (value & 0xFFFFFFF);
-      
+  }
+  
+  //////////////////////////////// Public /////////////////////////////////////
+  //============================== Life cycle =================================
+  
+  GPIOControlBlock::GPIOControlBlock()
+    : m_register_bank(this, "gpio", GPLR, (GAFR + 4) - GPLR)
+  {
+    init_register();
+    
+    uint32_t const write_flags = (RegisterBankBase::REG_READ_WRITE | RegisterBankBase::REG_WRITE_SIDE_EFFECT);
+    
+    // :SA-1110 Developer's Manual: p.75: Wei 2004-Jun-05:
+    //
+    // GPLR is a read-only register.
+    m_register_bank.add_plain(GPLR, "GPLR", &m_GPLR,
+                              RegisterBankBase::REG_READ | RegisterBankBase::REG_VOLATILE);
+    m_register_bank.add(GPDR, "GPDR", write_flags, &m_GPDR, 0, &GPIOControlBlock::write_GPDR);
+    
+    // :SA-1110 Developer's Manual: p.77: Wei 2004-Jun-05:
+    //
+    // GPSR & GPCR are write-only registers.
+    m_register_bank.add(GPSR, "GPSR",
+                        RegisterBankBase::REG_WRITE | RegisterBankBase::REG_WRITE_SIDE_EFFECT,
+                        0, 0, &GPIOControlBlock::write_GPSR);
+    m_register_bank.add(GPCR, "GPCR",
+                        RegisterBankBase::REG_WRITE | RegisterBankBase::REG_WRITE_SIDE_EFFECT,
+                        0, 0, &GPIOControlBlock::write_GPCR);
+    
+    m_register_bank.add(GRER, "GRER", write_flags, &m_GRER, 0, &GPIOControlBlock::write_GRER);
+    m_register_bank.add(GFER, "GFER", write_flags, &m_GFER, 0, &GPIOControlBlock::write_GFER);
+    m_register_bank.add(GEDR, "GEDR", write_flags | RegisterBankBase::REG_VOLATILE,
+                        &m_GEDR, 0, &GPIOControlBlock::write_GEDR);
+    m_register_bank.add(GAFR, "GAFR", write_flags, &m_GAFR, 0, &GPIOControlBlock::write_GAFR);
+  }
+  
+  //============================== Operation ==================================
+  
+  void
+  GPIOControlBlock::reset()
+  {
+    m_GPLR &= 0xFFFFFFF;
+    m_GEDR &= 0xFFFFFFF;
+    m_GPDR = 0;
+    m_GAFR = 0;
+    
+    release_action_button();
+    
+    m_GPLR_backup = m_GPLR;
+  }
+  
+  template<>
+  uint32_t
+  GPIOControlBlock::get_data(uint32_t const address) const
+  {
+    uint32_t const value = m_register_bank.read(address);
+    
 #if TRACE_GPIO
-      g_log_file << "-GPIO: put GAFR: " << std::hex << m_GAFR << std::endl;
+    g_log_file << "-GPIO: get " << std::hex << address << ": " << value << std::endl;
 #endif
-      break;
-      
-    default:
-      assert(!"Should not reach here.");
-      break;
-    }
+    
+    return value;
+  }
+  
+  template<>
+  void
+  GPIOControlBlock::put_data(uint32_t const address, uint32_t const value)
+  {
+    m_register_bank.write(address, value);
   }
 }
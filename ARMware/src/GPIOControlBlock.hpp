@@ -26,6 +26,7 @@
 //
 
 #include "ARMware.hpp"
+#include "RegisterBank.hpp"
 
 namespace ARMware
 {
@@ -89,6 +90,8 @@ namespace ARMware
     
     uint32_t m_GPLR_backup;
     
+    RegisterBank<GPIOControlBlock> m_register_bank;
+    
     // Operation
     
     void
@@ -104,14 +107,19 @@ namespace ARMware
       m_GAFR = 0;
     }
     
+    void write_GPDR(uint32_t const address, uint32_t const value);
+    void write_GPSR(uint32_t const address, uint32_t const value);
+    void write_GPCR(uint32_t const address, uint32_t const value);
+    void write_GRER(uint32_t const address, uint32_t const value);
+    void write_GFER(uint32_t const address, uint32_t const value);
+    void write_GEDR(uint32_t const address, uint32_t const value);
+    void write_GAFR(uint32_t const address, uint32_t const value);
+    
   public:
     
     // Life cycle
     
-    GPIOControlBlock()
-    {
-      init_register();
-    }
+    GPIOControlBlock();
     
     // Operation
     
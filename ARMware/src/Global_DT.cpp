@@ -30,6 +30,7 @@
 #include "Utils/Number.hpp"
 #include "Gtk/MachineScreen.hpp"
 #include "Compiler/MIR.hpp"
+#include "Compiler/MmioSite.hpp"
 
 #include "Core.tcc"
 #include "AddressSpace.tcc"
@@ -64,7 +65,19 @@ namespace ARMware
   // dynamic translator version
   
 #if ENABLE_DYNAMIC_TRANSLATOR
-  ExecResultEnum check_periphery_DT() { return gp_core->check_periphery<false, false>(); }
+  ExecResultEnum
+  check_periphery_DT(uint32_t const inst_idx)
+  {
+    gp_core->set_back_branch_idx(inst_idx);
+    
+    return gp_core->check_periphery<false, false>();
+  }
+  
+  void
+  set_access_idx_DT(uint32_t const inst_idx)
+  {
+    gp_core->set_access_idx(inst_idx);
+  }
   
   // STM - dynamic translator version
   
@@ -40,7 +40,8 @@ namespace ARMware
   // dynamic translator version
   
 #if ENABLE_DYNAMIC_TRANSLATOR
-  extern ExecResultEnum check_periphery_DT();
+  extern ExecResultEnum check_periphery_DT(uint32_t const inst_idx);
+  extern void set_access_idx_DT(uint32_t const inst_idx);
   
   // STM - dynamic translator version
   
@@ -54,7 +54,7 @@
 
 namespace ARMware
 {
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
   // STM
   
   void exec_STM_1_DA_PRINT(Inst const inst)   { g_STM_1_DA.print_code(inst); }
@@ -402,7 +402,7 @@ namespace ARMware
   void
   exec_UND_PRINT(Inst const /* inst */)
   {
-    g_log_file << "UND" << std::endl;
+    g_chunk_code_log << "UND" << std::endl;
   }
   
   // CDP
@@ -410,9 +410,9 @@ namespace ARMware
   void
   exec_CDP_PRINT(Inst const inst)
   {
-    g_log_file << "CDP"
-              << CondName(inst)
-              << std::endl;
+    g_chunk_code_log << "CDP"
+                    << CondName(inst)
+                    << std::endl;
   }
   
   // CDT
@@ -420,9 +420,9 @@ namespace ARMware
   void
   exec_CDT_PRINT(Inst const inst)
   {
-    g_log_file << "CDT"
-              << CondName(inst)
-              << std::endl;
+    g_chunk_code_log << "CDT"
+                    << CondName(inst)
+                    << std::endl;
   }
   
   // SWI
@@ -430,9 +430,9 @@ namespace ARMware
   void
   exec_SWI_PRINT(Inst const inst)
   {
-    g_log_file << "SWI"
-              << CondName(inst)
-              << std::endl;
+    g_chunk_code_log << "SWI"
+                    << CondName(inst)
+                    << std::endl;
   }
 #endif
 }
@@ -36,7 +36,7 @@
 
 namespace ARMware
 {
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
   // STM
   
   extern void exec_STM_1_DA_PRINT(Inst const inst);
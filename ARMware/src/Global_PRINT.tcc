@@ -19,14 +19,14 @@
 
 namespace ARMware
 {  
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
   template<IsLoad isLoad>
   void
   exec_CRT_PRINT(Inst const inst)
   {
-    g_log_file << "CRT"
-              << CondName(inst)
-              << std::endl;
+    g_chunk_code_log << "CRT"
+                    << CondName(inst)
+                    << std::endl;
   }
 #endif
 }
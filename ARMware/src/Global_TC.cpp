@@ -396,208 +396,534 @@ namespace ARMware
   
   // STM - threaded code version
   
-  ExecResultEnum exec_STM_1_DA_TC(Inst const inst)   { return g_STM_1_DA_TC.Process(inst); }
-  ExecResultEnum exec_STM_1_DA_w_TC(Inst const inst) { return g_STM_1_DA_w_TC.Process(inst); }
-  ExecResultEnum exec_STM_2_DA_TC(Inst const inst)   { return g_STM_2_DA_TC.Process(inst); }
+  ExecResultEnum exec_STM_1_DA_TC(Inst const inst)   { return g_STM_1_DA_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_STM_1_DA_w_TC(Inst const inst) { return g_STM_1_DA_w_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_STM_2_DA_TC(Inst const inst)   { return g_STM_2_DA_TC.Process<TRANSLATION_ANY>(inst); }
   
-  ExecResultEnum exec_STM_1_DB_TC(Inst const inst)   { return g_STM_1_DB_TC.Process(inst); }
-  ExecResultEnum exec_STM_1_DB_w_TC(Inst const inst) { return g_STM_1_DB_w_TC.Process(inst); }
-  ExecResultEnum exec_STM_2_DB_TC(Inst const inst)   { return g_STM_2_DB_TC.Process(inst); }
+  ExecResultEnum exec_STM_1_DB_TC(Inst const inst)   { return g_STM_1_DB_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_STM_1_DB_w_TC(Inst const inst) { return g_STM_1_DB_w_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_STM_2_DB_TC(Inst const inst)   { return g_STM_2_DB_TC.Process<TRANSLATION_ANY>(inst); }
   
-  ExecResultEnum exec_STM_1_IA_TC(Inst const inst)   { return g_STM_1_IA_TC.Process(inst); }
-  ExecResultEnum exec_STM_1_IA_w_TC(Inst const inst) { return g_STM_1_IA_w_TC.Process(inst); }
-  ExecResultEnum exec_STM_2_IA_TC(Inst const inst)   { return g_STM_2_IA_TC.Process(inst); }
+  ExecResultEnum exec_STM_1_IA_TC(Inst const inst)   { return g_STM_1_IA_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_STM_1_IA_w_TC(Inst const inst) { return g_STM_1_IA_w_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_STM_2_IA_TC(Inst const inst)   { return g_STM_2_IA_TC.Process<TRANSLATION_ANY>(inst); }
   
-  ExecResultEnum exec_STM_1_IB_TC(Inst const inst)   { return g_STM_1_IB_TC.Process(inst); }
-  ExecResultEnum exec_STM_1_IB_w_TC(Inst const inst) { return g_STM_1_IB_w_TC.Process(inst); }
-  ExecResultEnum exec_STM_2_IB_TC(Inst const inst)   { return g_STM_2_IB_TC.Process(inst); }
+  ExecResultEnum exec_STM_1_IB_TC(Inst const inst)   { return g_STM_1_IB_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_STM_1_IB_w_TC(Inst const inst) { return g_STM_1_IB_w_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_STM_2_IB_TC(Inst const inst)   { return g_STM_2_IB_TC.Process<TRANSLATION_ANY>(inst); }
   
   // LDM - threaded code version
   
-  ExecResultEnum exec_LDM_1_DA_TC(Inst const inst)    { return g_LDM_1_DA_TC.Process(inst); }
-  ExecResultEnum exec_LDM_1_DA_w_TC(Inst const inst)  { return g_LDM_1_DA_w_TC.Process(inst); }
-  ExecResultEnum exec_LDM_23_DA_TC(Inst const inst)   { return g_LDM_23_DA_TC.Process(inst); }
-  ExecResultEnum exec_LDM_23_DA_w_TC(Inst const inst) { return g_LDM_23_DA_w_TC.Process(inst); }
+  ExecResultEnum exec_LDM_1_DA_TC(Inst const inst)    { return g_LDM_1_DA_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDM_1_DA_w_TC(Inst const inst)  { return g_LDM_1_DA_w_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDM_23_DA_TC(Inst const inst)   { return g_LDM_23_DA_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDM_23_DA_w_TC(Inst const inst) { return g_LDM_23_DA_w_TC.Process<TRANSLATION_ANY>(inst); }
   
-  ExecResultEnum exec_LDM_1_DB_TC(Inst const inst)    { return g_LDM_1_DB_TC.Process(inst); }
-  ExecResultEnum exec_LDM_1_DB_w_TC(Inst const inst)  { return g_LDM_1_DB_w_TC.Process(inst); }
-  ExecResultEnum exec_LDM_23_DB_TC(Inst const inst)   { return g_LDM_23_DB_TC.Process(inst); }
-  ExecResultEnum exec_LDM_23_DB_w_TC(Inst const inst) { return g_LDM_23_DB_w_TC.Process(inst); }
+  ExecResultEnum exec_LDM_1_DB_TC(Inst const inst)    { return g_LDM_1_DB_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDM_1_DB_w_TC(Inst const inst)  { return g_LDM_1_DB_w_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDM_23_DB_TC(Inst const inst)   { return g_LDM_23_DB_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDM_23_DB_w_TC(Inst const inst) { return g_LDM_23_DB_w_TC.Process<TRANSLATION_ANY>(inst); }
     
-  ExecResultEnum exec_LDM_1_IA_TC(Inst const inst)    { return g_LDM_1_IA_TC.Process(inst); }
-  ExecResultEnum exec_LDM_1_IA_w_TC(Inst const inst)  { return g_LDM_1_IA_w_TC.Process(inst); }
-  ExecResultEnum exec_LDM_23_IA_TC(Inst const inst)   { return g_LDM_23_IA_TC.Process(inst); }
-  ExecResultEnum exec_LDM_23_IA_w_TC(Inst const inst) { return g_LDM_23_IA_w_TC.Process(inst); }
+  ExecResultEnum exec_LDM_1_IA_TC(Inst const inst)    { return g_LDM_1_IA_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDM_1_IA_w_TC(Inst const inst)  { return g_LDM_1_IA_w_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDM_23_IA_TC(Inst const inst)   { return g_LDM_23_IA_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDM_23_IA_w_TC(Inst const inst) { return g_LDM_23_IA_w_TC.Process<TRANSLATION_ANY>(inst); }
   
-  ExecResultEnum exec_LDM_1_IB_TC(Inst const inst)    { return g_LDM_1_IB_TC.Process(inst); }
-  ExecResultEnum exec_LDM_1_IB_w_TC(Inst const inst)  { return g_LDM_1_IB_w_TC.Process(inst); }
-  ExecResultEnum exec_LDM_23_IB_TC(Inst const inst)   { return g_LDM_23_IB_TC.Process(inst); }
-  ExecResultEnum exec_LDM_23_IB_w_TC(Inst const inst) { return g_LDM_23_IB_w_TC.Process(inst); }
+  ExecResultEnum exec_LDM_1_IB_TC(Inst const inst)    { return g_LDM_1_IB_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDM_1_IB_w_TC(Inst const inst)  { return g_LDM_1_IB_w_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDM_23_IB_TC(Inst const inst)   { return g_LDM_23_IB_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDM_23_IB_w_TC(Inst const inst) { return g_LDM_23_IB_w_TC.Process<TRANSLATION_ANY>(inst); }
   
   // SWP - threaded code version
   
-  ExecResultEnum exec_SWP_TC(Inst const inst)  { return g_SWP_TC.Process(inst); }
-  ExecResultEnum exec_SWPB_TC(Inst const inst) { return g_SWPB_TC.Process(inst); }
+  ExecResultEnum exec_SWP_TC(Inst const inst)  { return g_SWP_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_SWPB_TC(Inst const inst) { return g_SWPB_TC.Process<TRANSLATION_ANY>(inst); }
   
   // STR - threaded code version
   
-  ExecResultEnum exec_STR_imm_post_down_TC(Inst const inst)   { return g_STR_imm_post_down_TC.Process(inst); }
-  ExecResultEnum exec_STR_imm_post_up_TC(Inst const inst)     { return g_STR_imm_post_up_TC.Process(inst); }
-  ExecResultEnum exec_STR_imm_offset_down_TC(Inst const inst) { return g_STR_imm_offset_down_TC.Process(inst); }
-  ExecResultEnum exec_STR_imm_offset_up_TC(Inst const inst)   { return g_STR_imm_offset_up_TC.Process(inst); }
-  ExecResultEnum exec_STR_imm_pre_down_TC(Inst const inst)    { return g_STR_imm_pre_down_TC.Process(inst); }
-  ExecResultEnum exec_STR_imm_pre_up_TC(Inst const inst)      { return g_STR_imm_pre_up_TC.Process(inst); }
+  ExecResultEnum exec_STR_imm_post_down_TC(Inst const inst)   { return g_STR_imm_post_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_STR_imm_post_up_TC(Inst const inst)     { return g_STR_imm_post_up_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_STR_imm_offset_down_TC(Inst const inst) { return g_STR_imm_offset_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_STR_imm_offset_up_TC(Inst const inst)   { return g_STR_imm_offset_up_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_STR_imm_pre_down_TC(Inst const inst)    { return g_STR_imm_pre_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_STR_imm_pre_up_TC(Inst const inst)      { return g_STR_imm_pre_up_TC.Process<TRANSLATION_ANY>(inst); }
   
-  ExecResultEnum exec_STR_reg_post_down_TC(Inst const inst)   { return g_STR_reg_post_down_TC.Process(inst); }
-  ExecResultEnum exec_STR_reg_post_up_TC(Inst const inst)     { return g_STR_reg_post_up_TC.Process(inst); }
-  ExecResultEnum exec_STR_reg_offset_down_TC(Inst const inst) { return g_STR_reg_offset_down_TC.Process(inst); }
-  ExecResultEnum exec_STR_reg_offset_up_TC(Inst const inst)   { return g_STR_reg_offset_up_TC.Process(inst); }
-  ExecResultEnum exec_STR_reg_pre_down_TC(Inst const inst)    { return g_STR_reg_pre_down_TC.Process(inst); }
-  ExecResultEnum exec_STR_reg_pre_up_TC(Inst const inst)      { return g_STR_reg_pre_up_TC.Process(inst); }
+  ExecResultEnum exec_STR_reg_post_down_TC(Inst const inst)   { return g_STR_reg_post_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_STR_reg_post_up_TC(Inst const inst)     { return g_STR_reg_post_up_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_STR_reg_offset_down_TC(Inst const inst) { return g_STR_reg_offset_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_STR_reg_offset_up_TC(Inst const inst)   { return g_STR_reg_offset_up_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_STR_reg_pre_down_TC(Inst const inst)    { return g_STR_reg_pre_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_STR_reg_pre_up_TC(Inst const inst)      { return g_STR_reg_pre_up_TC.Process<TRANSLATION_ANY>(inst); }
   
   // STRT - threaded code version
   
-  ExecResultEnum exec_STRT_imm_post_down_TC(Inst const inst) { return g_STRT_imm_post_down_TC.Process(inst); }
-  ExecResultEnum exec_STRT_imm_post_up_TC(Inst const inst)   { return g_STRT_imm_post_up_TC.Process(inst); }
+  ExecResultEnum exec_STRT_imm_post_down_TC(Inst const inst) { return g_STRT_imm_post_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_STRT_imm_post_up_TC(Inst const inst)   { return g_STRT_imm_post_up_TC.Process<TRANSLATION_ANY>(inst); }
   
-  ExecResultEnum exec_STRT_reg_post_down_TC(Inst const inst) { return g_STRT_reg_post_down_TC.Process(inst); }
-  ExecResultEnum exec_STRT_reg_post_up_TC(Inst const inst)   { return g_STRT_reg_post_up_TC.Process(inst); }
+  ExecResultEnum exec_STRT_reg_post_down_TC(Inst const inst) { return g_STRT_reg_post_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_STRT_reg_post_up_TC(Inst const inst)   { return g_STRT_reg_post_up_TC.Process<TRANSLATION_ANY>(inst); }
   
   // STRB - threaded code version
   
-  ExecResultEnum exec_STRB_imm_post_down_TC(Inst const inst)   { return g_STRB_imm_post_down_TC.Process(inst); }
-  ExecResultEnum exec_STRB_imm_post_up_TC(Inst const inst)     { return g_STRB_imm_post_up_TC.Process(inst); }
-  ExecResultEnum exec_STRB_imm_offset_down_TC(Inst const inst) { return g_STRB_imm_offset_down_TC.Process(inst); }
-  ExecResultEnum exec_STRB_imm_offset_up_TC(Inst const inst)   { return g_STRB_imm_offset_up_TC.Process(inst); }
-  ExecResultEnum exec_STRB_imm_pre_down_TC(Inst const inst)    { return g_STRB_imm_pre_down_TC.Process(inst); }
-  ExecResultEnum exec_STRB_imm_pre_up_TC(Inst const inst)      { return g_STRB_imm_pre_up_TC.Process(inst); }
+  ExecResultEnum exec_STRB_imm_post_down_TC(Inst const inst)   { return g_STRB_imm_post_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_STRB_imm_post_up_TC(Inst const inst)     { return g_STRB_imm_post_up_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_STRB_imm_offset_down_TC(Inst const inst) { return g_STRB_imm_offset_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_STRB_imm_offset_up_TC(Inst const inst)   { return g_STRB_imm_offset_up_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_STRB_imm_pre_down_TC(Inst const inst)    { return g_STRB_imm_pre_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_STRB_imm_pre_up_TC(Inst const inst)      { return g_STRB_imm_pre_up_TC.Process<TRANSLATION_ANY>(inst); }
   
-  ExecResultEnum exec_STRB_reg_post_down_TC(Inst const inst)   { return g_STRB_reg_post_down_TC.Process(inst); }
-  ExecResultEnum exec_STRB_reg_post_up_TC(Inst const inst)     { return g_STRB_reg_post_up_TC.Process(inst); }
-  ExecResultEnum exec_STRB_reg_offset_down_TC(Inst const inst) { return g_STRB_reg_offset_down_TC.Process(inst); }
-  ExecResultEnum exec_STRB_reg_offset_up_TC(Inst const inst)   { return g_STRB_reg_offset_up_TC.Process(inst); }
-  ExecResultEnum exec_STRB_reg_pre_down_TC(Inst const inst)    { return g_STRB_reg_pre_down_TC.Process(inst); }
-  ExecResultEnum exec_STRB_reg_pre_up_TC(Inst const inst)      { return g_STRB_reg_pre_up_TC.Process(inst); }
+  ExecResultEnum exec_STRB_reg_post_down_TC(Inst const inst)   { return g_STRB_reg_post_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_STRB_reg_post_up_TC(Inst const inst)     { return g_STRB_reg_post_up_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_STRB_reg_offset_down_TC(Inst const inst) { return g_STRB_reg_offset_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_STRB_reg_offset_up_TC(Inst const inst)   { return g_STRB_reg_offset_up_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_STRB_reg_pre_down_TC(Inst const inst)    { return g_STRB_reg_pre_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_STRB_reg_pre_up_TC(Inst const inst)      { return g_STRB_reg_pre_up_TC.Process<TRANSLATION_ANY>(inst); }
   
   // STRBT - threaded code version
   
-  ExecResultEnum exec_STRBT_imm_post_down_TC(Inst const inst) { return g_STRBT_imm_post_down_TC.Process(inst); }
-  ExecResultEnum exec_STRBT_imm_post_up_TC(Inst const inst)   { return g_STRBT_imm_post_up_TC.Process(inst); }
+  ExecResultEnum exec_STRBT_imm_post_down_TC(Inst const inst) { return g_STRBT_imm_post_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_STRBT_imm_post_up_TC(Inst const inst)   { return g_STRBT_imm_post_up_TC.Process<TRANSLATION_ANY>(inst); }
   
-  ExecResultEnum exec_STRBT_reg_post_down_TC(Inst const inst) { return g_STRBT_reg_post_down_TC.Process(inst); }
-  ExecResultEnum exec_STRBT_reg_post_up_TC(Inst const inst)   { return g_STRBT_reg_post_up_TC.Process(inst); }
+  ExecResultEnum exec_STRBT_reg_post_down_TC(Inst const inst) { return g_STRBT_reg_post_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_STRBT_reg_post_up_TC(Inst const inst)   { return g_STRBT_reg_post_up_TC.Process<TRANSLATION_ANY>(inst); }
   
   // LDR - threaded code version
   
-  ExecResultEnum exec_LDR_imm_post_down_TC(Inst const inst)   { return g_LDR_imm_post_down_TC.Process(inst); }
-  ExecResultEnum exec_LDR_imm_post_up_TC(Inst const inst)     { return g_LDR_imm_post_up_TC.Process(inst); }
-  ExecResultEnum exec_LDR_imm_offset_down_TC(Inst const inst) { return g_LDR_imm_offset_down_TC.Process(inst); }
-  ExecResultEnum exec_LDR_imm_offset_up_TC(Inst const inst)   { return g_LDR_imm_offset_up_TC.Process(inst); }
-  ExecResultEnum exec_LDR_imm_pre_down_TC(Inst const inst)    { return g_LDR_imm_pre_down_TC.Process(inst); }
-  ExecResultEnum exec_LDR_imm_pre_up_TC(Inst const inst)      { return g_LDR_imm_pre_up_TC.Process(inst); }
+  ExecResultEnum exec_LDR_imm_post_down_TC(Inst const inst)   { return g_LDR_imm_post_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDR_imm_post_up_TC(Inst const inst)     { return g_LDR_imm_post_up_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDR_imm_offset_down_TC(Inst const inst) { return g_LDR_imm_offset_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDR_imm_offset_up_TC(Inst const inst)   { return g_LDR_imm_offset_up_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDR_imm_pre_down_TC(Inst const inst)    { return g_LDR_imm_pre_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDR_imm_pre_up_TC(Inst const inst)      { return g_LDR_imm_pre_up_TC.Process<TRANSLATION_ANY>(inst); }
   
-  ExecResultEnum exec_LDR_reg_post_down_TC(Inst const inst)   { return g_LDR_reg_post_down_TC.Process(inst); }
-  ExecResultEnum exec_LDR_reg_post_up_TC(Inst const inst)     { return g_LDR_reg_post_up_TC.Process(inst); }
-  ExecResultEnum exec_LDR_reg_offset_down_TC(Inst const inst) { return g_LDR_reg_offset_down_TC.Process(inst); }
-  ExecResultEnum exec_LDR_reg_offset_up_TC(Inst const inst)   { return g_LDR_reg_offset_up_TC.Process(inst); }
-  ExecResultEnum exec_LDR_reg_pre_down_TC(Inst const inst)    { return g_LDR_reg_pre_down_TC.Process(inst); }
-  ExecResultEnum exec_LDR_reg_pre_up_TC(Inst const inst)      { return g_LDR_reg_pre_up_TC.Process(inst); }
+  ExecResultEnum exec_LDR_reg_post_down_TC(Inst const inst)   { return g_LDR_reg_post_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDR_reg_post_up_TC(Inst const inst)     { return g_LDR_reg_post_up_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDR_reg_offset_down_TC(Inst const inst) { return g_LDR_reg_offset_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDR_reg_offset_up_TC(Inst const inst)   { return g_LDR_reg_offset_up_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDR_reg_pre_down_TC(Inst const inst)    { return g_LDR_reg_pre_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDR_reg_pre_up_TC(Inst const inst)      { return g_LDR_reg_pre_up_TC.Process<TRANSLATION_ANY>(inst); }
   
   // LDRT - threaded code version
   
-  ExecResultEnum exec_LDRT_imm_post_down_TC(Inst const inst) { return g_LDRT_imm_post_down_TC.Process(inst); }
-  ExecResultEnum exec_LDRT_imm_post_up_TC(Inst const inst)   { return g_LDRT_imm_post_up_TC.Process(inst); }
+  ExecResultEnum exec_LDRT_imm_post_down_TC(Inst const inst) { return g_LDRT_imm_post_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRT_imm_post_up_TC(Inst const inst)   { return g_LDRT_imm_post_up_TC.Process<TRANSLATION_ANY>(inst); }
   
-  ExecResultEnum exec_LDRT_reg_post_down_TC(Inst const inst) { return g_LDRT_reg_post_down_TC.Process(inst); }
-  ExecResultEnum exec_LDRT_reg_post_up_TC(Inst const inst)   { return g_LDRT_reg_post_up_TC.Process(inst); }
+  ExecResultEnum exec_LDRT_reg_post_down_TC(Inst const inst) { return g_LDRT_reg_post_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRT_reg_post_up_TC(Inst const inst)   { return g_LDRT_reg_post_up_TC.Process<TRANSLATION_ANY>(inst); }
   
   // LDRB - threaded code version
   
-  ExecResultEnum exec_LDRB_imm_post_down_TC(Inst const inst)   { return g_LDRB_imm_post_down_TC.Process(inst); }
-  ExecResultEnum exec_LDRB_imm_post_up_TC(Inst const inst)     { return g_LDRB_imm_post_up_TC.Process(inst); }
-  ExecResultEnum exec_LDRB_imm_offset_down_TC(Inst const inst) { return g_LDRB_imm_offset_down_TC.Process(inst); }
-  ExecResultEnum exec_LDRB_imm_offset_up_TC(Inst const inst)   { return g_LDRB_imm_offset_up_TC.Process(inst); }
-  ExecResultEnum exec_LDRB_imm_pre_down_TC(Inst const inst)    { return g_LDRB_imm_pre_down_TC.Process(inst); }
-  ExecResultEnum exec_LDRB_imm_pre_up_TC(Inst const inst)      { return g_LDRB_imm_pre_up_TC.Process(inst); }
+  ExecResultEnum exec_LDRB_imm_post_down_TC(Inst const inst)   { return g_LDRB_imm_post_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRB_imm_post_up_TC(Inst const inst)     { return g_LDRB_imm_post_up_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRB_imm_offset_down_TC(Inst const inst) { return g_LDRB_imm_offset_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRB_imm_offset_up_TC(Inst const inst)   { return g_LDRB_imm_offset_up_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRB_imm_pre_down_TC(Inst const inst)    { return g_LDRB_imm_pre_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRB_imm_pre_up_TC(Inst const inst)      { return g_LDRB_imm_pre_up_TC.Process<TRANSLATION_ANY>(inst); }
   
-  ExecResultEnum exec_LDRB_reg_post_down_TC(Inst const inst)   { return g_LDRB_reg_post_down_TC.Process(inst); }
-  ExecResultEnum exec_LDRB_reg_post_up_TC(Inst const inst)     { return g_LDRB_reg_post_up_TC.Process(inst); }
-  ExecResultEnum exec_LDRB_reg_offset_down_TC(Inst const inst) { return g_LDRB_reg_offset_down_TC.Process(inst); }
-  ExecResultEnum exec_LDRB_reg_offset_up_TC(Inst const inst)   { return g_LDRB_reg_offset_up_TC.Process(inst); }
-  ExecResultEnum exec_LDRB_reg_pre_down_TC(Inst const inst)    { return g_LDRB_reg_pre_down_TC.Process(inst); }
-  ExecResultEnum exec_LDRB_reg_pre_up_TC(Inst const inst)      { return g_LDRB_reg_pre_up_TC.Process(inst); }
+  ExecResultEnum exec_LDRB_reg_post_down_TC(Inst const inst)   { return g_LDRB_reg_post_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRB_reg_post_up_TC(Inst const inst)     { return g_LDRB_reg_post_up_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRB_reg_offset_down_TC(Inst const inst) { return g_LDRB_reg_offset_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRB_reg_offset_up_TC(Inst const inst)   { return g_LDRB_reg_offset_up_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRB_reg_pre_down_TC(Inst const inst)    { return g_LDRB_reg_pre_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRB_reg_pre_up_TC(Inst const inst)      { return g_LDRB_reg_pre_up_TC.Process<TRANSLATION_ANY>(inst); }
   
   // LDRBT - threaded code version
   
-  ExecResultEnum exec_LDRBT_imm_post_down_TC(Inst const inst) { return g_LDRBT_imm_post_down_TC.Process(inst); }
-  ExecResultEnum exec_LDRBT_imm_post_up_TC(Inst const inst)   { return g_LDRBT_imm_post_up_TC.Process(inst); }
+  ExecResultEnum exec_LDRBT_imm_post_down_TC(Inst const inst) { return g_LDRBT_imm_post_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRBT_imm_post_up_TC(Inst const inst)   { return g_LDRBT_imm_post_up_TC.Process<TRANSLATION_ANY>(inst); }
   
-  ExecResultEnum exec_LDRBT_reg_post_down_TC(Inst const inst) { return g_LDRBT_reg_post_down_TC.Process(inst); }
-  ExecResultEnum exec_LDRBT_reg_post_up_TC(Inst const inst)   { return g_LDRBT_reg_post_up_TC.Process(inst); }
+  ExecResultEnum exec_LDRBT_reg_post_down_TC(Inst const inst) { return g_LDRBT_reg_post_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRBT_reg_post_up_TC(Inst const inst)   { return g_LDRBT_reg_post_up_TC.Process<TRANSLATION_ANY>(inst); }
   
   // STRH - threaded code version
   
-  ExecResultEnum exec_STRH_imm_post_down_TC(Inst const inst)   { return g_STRH_imm_post_down_TC.Process(inst); }
-  ExecResultEnum exec_STRH_imm_post_up_TC(Inst const inst)     { return g_STRH_imm_post_up_TC.Process(inst); }
-  ExecResultEnum exec_STRH_imm_offset_down_TC(Inst const inst) { return g_STRH_imm_offset_down_TC.Process(inst); }
-  ExecResultEnum exec_STRH_imm_offset_up_TC(Inst const inst)   { return g_STRH_imm_offset_up_TC.Process(inst); }
-  ExecResultEnum exec_STRH_imm_pre_down_TC(Inst const inst)    { return g_STRH_imm_pre_down_TC.Process(inst); }
-  ExecResultEnum exec_STRH_imm_pre_up_TC(Inst const inst)      { return g_STRH_imm_pre_up_TC.Process(inst); }
+  ExecResultEnum exec_STRH_imm_post_down_TC(Inst const inst)   { return g_STRH_imm_post_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_STRH_imm_post_up_TC(Inst const inst)     { return g_STRH_imm_post_up_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_STRH_imm_offset_down_TC(Inst const inst) { return g_STRH_imm_offset_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_STRH_imm_offset_up_TC(Inst const inst)   { return g_STRH_imm_offset_up_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_STRH_imm_pre_down_TC(Inst const inst)    { return g_STRH_imm_pre_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_STRH_imm_pre_up_TC(Inst const inst)      { return g_STRH_imm_pre_up_TC.Process<TRANSLATION_ANY>(inst); }
   
-  ExecResultEnum exec_STRH_reg_post_down_TC(Inst const inst)   { return g_STRH_reg_post_down_TC.Process(inst); }
-  ExecResultEnum exec_STRH_reg_post_up_TC(Inst const inst)     { return g_STRH_reg_post_up_TC.Process(inst); }
-  ExecResultEnum exec_STRH_reg_offset_down_TC(Inst const inst) { return g_STRH_reg_offset_down_TC.Process(inst); }
-  ExecResultEnum exec_STRH_reg_offset_up_TC(Inst const inst)   { return g_STRH_reg_offset_up_TC.Process(inst); }
-  ExecResultEnum exec_STRH_reg_pre_down_TC(Inst const inst)    { return g_STRH_reg_pre_down_TC.Process(inst); }
-  ExecResultEnum exec_STRH_reg_pre_up_TC(Inst const inst)      { return g_STRH_reg_pre_up_TC.Process(inst); }
+  ExecResultEnum exec_STRH_reg_post_down_TC(Inst const inst)   { return g_STRH_reg_post_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_STRH_reg_post_up_TC(Inst const inst)     { return g_STRH_reg_post_up_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_STRH_reg_offset_down_TC(Inst const inst) { return g_STRH_reg_offset_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_STRH_reg_offset_up_TC(Inst const inst)   { return g_STRH_reg_offset_up_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_STRH_reg_pre_down_TC(Inst const inst)    { return g_STRH_reg_pre_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_STRH_reg_pre_up_TC(Inst const inst)      { return g_STRH_reg_pre_up_TC.Process<TRANSLATION_ANY>(inst); }
   
   // LDRH - threaded code version
   
-  ExecResultEnum exec_LDRH_imm_post_down_TC(Inst const inst)   { return g_LDRH_imm_post_down_TC.Process(inst); }
-  ExecResultEnum exec_LDRH_imm_post_up_TC(Inst const inst)     { return g_LDRH_imm_post_up_TC.Process(inst); }
-  ExecResultEnum exec_LDRH_imm_offset_down_TC(Inst const inst) { return g_LDRH_imm_offset_down_TC.Process(inst); }
-  ExecResultEnum exec_LDRH_imm_offset_up_TC(Inst const inst)   { return g_LDRH_imm_offset_up_TC.Process(inst); }
-  ExecResultEnum exec_LDRH_imm_pre_down_TC(Inst const inst)    { return g_LDRH_imm_pre_down_TC.Process(inst); }
-  ExecResultEnum exec_LDRH_imm_pre_up_TC(Inst const inst)      { return g_LDRH_imm_pre_up_TC.Process(inst); }
+  ExecResultEnum exec_LDRH_imm_post_down_TC(Inst const inst)   { return g_LDRH_imm_post_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRH_imm_post_up_TC(Inst const inst)     { return g_LDRH_imm_post_up_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRH_imm_offset_down_TC(Inst const inst) { return g_LDRH_imm_offset_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRH_imm_offset_up_TC(Inst const inst)   { return g_LDRH_imm_offset_up_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRH_imm_pre_down_TC(Inst const inst)    { return g_LDRH_imm_pre_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRH_imm_pre_up_TC(Inst const inst)      { return g_LDRH_imm_pre_up_TC.Process<TRANSLATION_ANY>(inst); }
   
-  ExecResultEnum exec_LDRH_reg_post_down_TC(Inst const inst)   { return g_LDRH_reg_post_down_TC.Process(inst); }
-  ExecResultEnum exec_LDRH_reg_post_up_TC(Inst const inst)     { return g_LDRH_reg_post_up_TC.Process(inst); }
-  ExecResultEnum exec_LDRH_reg_offset_down_TC(Inst const inst) { return g_LDRH_reg_offset_down_TC.Process(inst); }
-  ExecResultEnum exec_LDRH_reg_offset_up_TC(Inst const inst)   { return g_LDRH_reg_offset_up_TC.Process(inst); }
-  ExecResultEnum exec_LDRH_reg_pre_down_TC(Inst const inst)    { return g_LDRH_reg_pre_down_TC.Process(inst); }
-  ExecResultEnum exec_LDRH_reg_pre_up_TC(Inst const inst)      { return g_LDRH_reg_pre_up_TC.Process(inst); }
+  ExecResultEnum exec_LDRH_reg_post_down_TC(Inst const inst)   { return g_LDRH_reg_post_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRH_reg_post_up_TC(Inst const inst)     { return g_LDRH_reg_post_up_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRH_reg_offset_down_TC(Inst const inst) { return g_LDRH_reg_offset_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRH_reg_offset_up_TC(Inst const inst)   { return g_LDRH_reg_offset_up_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRH_reg_pre_down_TC(Inst const inst)    { return g_LDRH_reg_pre_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRH_reg_pre_up_TC(Inst const inst)      { return g_LDRH_reg_pre_up_TC.Process<TRANSLATION_ANY>(inst); }
   
   // LDRSB - threaded code version
   
-  ExecResultEnum exec_LDRSB_imm_post_down_TC(Inst const inst)   { return g_LDRSB_imm_post_down_TC.Process(inst); }
-  ExecResultEnum exec_LDRSB_imm_post_up_TC(Inst const inst)     { return g_LDRSB_imm_post_up_TC.Process(inst); }
-  ExecResultEnum exec_LDRSB_imm_offset_down_TC(Inst const inst) { return g_LDRSB_imm_offset_down_TC.Process(inst); }
-  ExecResultEnum exec_LDRSB_imm_offset_up_TC(Inst const inst)   { return g_LDRSB_imm_offset_up_TC.Process(inst); }
-  ExecResultEnum exec_LDRSB_imm_pre_down_TC(Inst const inst)    { return g_LDRSB_imm_pre_down_TC.Process(inst); }
-  ExecResultEnum exec_LDRSB_imm_pre_up_TC(Inst const inst)      { return g_LDRSB_imm_pre_up_TC.Process(inst); }
+  ExecResultEnum exec_LDRSB_imm_post_down_TC(Inst const inst)   { return g_LDRSB_imm_post_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRSB_imm_post_up_TC(Inst const inst)     { return g_LDRSB_imm_post_up_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRSB_imm_offset_down_TC(Inst const inst) { return g_LDRSB_imm_offset_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRSB_imm_offset_up_TC(Inst const inst)   { return g_LDRSB_imm_offset_up_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRSB_imm_pre_down_TC(Inst const inst)    { return g_LDRSB_imm_pre_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRSB_imm_pre_up_TC(Inst const inst)      { return g_LDRSB_imm_pre_up_TC.Process<TRANSLATION_ANY>(inst); }
   
-  ExecResultEnum exec_LDRSB_reg_post_down_TC(Inst const inst)   { return g_LDRSB_reg_post_down_TC.Process(inst); }
-  ExecResultEnum exec_LDRSB_reg_post_up_TC(Inst const inst)     { return g_LDRSB_reg_post_up_TC.Process(inst); }
-  ExecResultEnum exec_LDRSB_reg_offset_down_TC(Inst const inst) { return g_LDRSB_reg_offset_down_TC.Process(inst); }
-  ExecResultEnum exec_LDRSB_reg_offset_up_TC(Inst const inst)   { return g_LDRSB_reg_offset_up_TC.Process(inst); }
-  ExecResultEnum exec_LDRSB_reg_pre_down_TC(Inst const inst)    { return g_LDRSB_reg_pre_down_TC.Process(inst); }
-  ExecResultEnum exec_LDRSB_reg_pre_up_TC(Inst const inst)      { return g_LDRSB_reg_pre_up_TC.Process(inst); }
+  ExecResultEnum exec_LDRSB_reg_post_down_TC(Inst const inst)   { return g_LDRSB_reg_post_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRSB_reg_post_up_TC(Inst const inst)     { return g_LDRSB_reg_post_up_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRSB_reg_offset_down_TC(Inst const inst) { return g_LDRSB_reg_offset_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRSB_reg_offset_up_TC(Inst const inst)   { return g_LDRSB_reg_offset_up_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRSB_reg_pre_down_TC(Inst const inst)    { return g_LDRSB_reg_pre_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRSB_reg_pre_up_TC(Inst const inst)      { return g_LDRSB_reg_pre_up_TC.Process<TRANSLATION_ANY>(inst); }
   
   // LDRSH - threaded code version
   
-  ExecResultEnum exec_LDRSH_imm_post_down_TC(Inst const inst)   { return g_LDRSH_imm_post_down_TC.Process(inst); }
-  ExecResultEnum exec_LDRSH_imm_post_up_TC(Inst const inst)     { return g_LDRSH_imm_post_up_TC.Process(inst); }
-  ExecResultEnum exec_LDRSH_imm_offset_down_TC(Inst const inst) { return g_LDRSH_imm_offset_down_TC.Process(inst); }
-  ExecResultEnum exec_LDRSH_imm_offset_up_TC(Inst const inst)   { return g_LDRSH_imm_offset_up_TC.Process(inst); }
-  ExecResultEnum exec_LDRSH_imm_pre_down_TC(Inst const inst)    { return g_LDRSH_imm_pre_down_TC.Process(inst); }
-  ExecResultEnum exec_LDRSH_imm_pre_up_TC(Inst const inst)      { return g_LDRSH_imm_pre_up_TC.Process(inst); }
-  
-  ExecResultEnum exec_LDRSH_reg_post_down_TC(Inst const inst)   { return g_LDRSH_reg_post_down_TC.Process(inst); }
-  ExecResultEnum exec_LDRSH_reg_post_up_TC(Inst const inst)     { return g_LDRSH_reg_post_up_TC.Process(inst); }
-  ExecResultEnum exec_LDRSH_reg_offset_down_TC(Inst const inst) { return g_LDRSH_reg_offset_down_TC.Process(inst); }
-  ExecResultEnum exec_LDRSH_reg_offset_up_TC(Inst const inst)   { return g_LDRSH_reg_offset_up_TC.Process(inst); }
-  ExecResultEnum exec_LDRSH_reg_pre_down_TC(Inst const inst)    { return g_LDRSH_reg_pre_down_TC.Process(inst); }
-  ExecResultEnum exec_LDRSH_reg_pre_up_TC(Inst const inst)      { return g_LDRSH_reg_pre_up_TC.Process(inst); }
+  ExecResultEnum exec_LDRSH_imm_post_down_TC(Inst const inst)   { return g_LDRSH_imm_post_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRSH_imm_post_up_TC(Inst const inst)     { return g_LDRSH_imm_post_up_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRSH_imm_offset_down_TC(Inst const inst) { return g_LDRSH_imm_offset_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRSH_imm_offset_up_TC(Inst const inst)   { return g_LDRSH_imm_offset_up_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRSH_imm_pre_down_TC(Inst const inst)    { return g_LDRSH_imm_pre_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRSH_imm_pre_up_TC(Inst const inst)      { return g_LDRSH_imm_pre_up_TC.Process<TRANSLATION_ANY>(inst); }
+  
+  ExecResultEnum exec_LDRSH_reg_post_down_TC(Inst const inst)   { return g_LDRSH_reg_post_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRSH_reg_post_up_TC(Inst const inst)     { return g_LDRSH_reg_post_up_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRSH_reg_offset_down_TC(Inst const inst) { return g_LDRSH_reg_offset_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRSH_reg_offset_up_TC(Inst const inst)   { return g_LDRSH_reg_offset_up_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRSH_reg_pre_down_TC(Inst const inst)    { return g_LDRSH_reg_pre_down_TC.Process<TRANSLATION_ANY>(inst); }
+  ExecResultEnum exec_LDRSH_reg_pre_up_TC(Inst const inst)      { return g_LDRSH_reg_pre_up_TC.Process<TRANSLATION_ANY>(inst); }
+  
+  // Memory instructions - threaded code version, one variant per translation mode.
+  //
+  // The exec_XXX_TC() above are the TRANSLATION_ANY variants, the dynamic translator
+  // calls them. The threaded code picks one of these from the ArgList instead.
+  
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STM_1_DA(Inst const inst) { return g_STM_1_DA_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STM_1_DA_w(Inst const inst) { return g_STM_1_DA_w_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STM_2_DA(Inst const inst) { return g_STM_2_DA_TC.Process<T_mode>(inst); }
+  
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STM_1_DB(Inst const inst) { return g_STM_1_DB_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STM_1_DB_w(Inst const inst) { return g_STM_1_DB_w_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STM_2_DB(Inst const inst) { return g_STM_2_DB_TC.Process<T_mode>(inst); }
+  
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STM_1_IA(Inst const inst) { return g_STM_1_IA_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STM_1_IA_w(Inst const inst) { return g_STM_1_IA_w_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STM_2_IA(Inst const inst) { return g_STM_2_IA_TC.Process<T_mode>(inst); }
+  
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STM_1_IB(Inst const inst) { return g_STM_1_IB_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STM_1_IB_w(Inst const inst) { return g_STM_1_IB_w_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STM_2_IB(Inst const inst) { return g_STM_2_IB_TC.Process<T_mode>(inst); }
+  
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDM_1_DA(Inst const inst) { return g_LDM_1_DA_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDM_1_DA_w(Inst const inst) { return g_LDM_1_DA_w_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDM_23_DA(Inst const inst) { return g_LDM_23_DA_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDM_23_DA_w(Inst const inst) { return g_LDM_23_DA_w_TC.Process<T_mode>(inst); }
+  
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDM_1_DB(Inst const inst) { return g_LDM_1_DB_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDM_1_DB_w(Inst const inst) { return g_LDM_1_DB_w_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDM_23_DB(Inst const inst) { return g_LDM_23_DB_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDM_23_DB_w(Inst const inst) { return g_LDM_23_DB_w_TC.Process<T_mode>(inst); }
+  
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDM_1_IA(Inst const inst) { return g_LDM_1_IA_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDM_1_IA_w(Inst const inst) { return g_LDM_1_IA_w_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDM_23_IA(Inst const inst) { return g_LDM_23_IA_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDM_23_IA_w(Inst const inst) { return g_LDM_23_IA_w_TC.Process<T_mode>(inst); }
+  
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDM_1_IB(Inst const inst) { return g_LDM_1_IB_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDM_1_IB_w(Inst const inst) { return g_LDM_1_IB_w_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDM_23_IB(Inst const inst) { return g_LDM_23_IB_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDM_23_IB_w(Inst const inst) { return g_LDM_23_IB_w_TC.Process<T_mode>(inst); }
+  
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_SWP(Inst const inst) { return g_SWP_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_SWPB(Inst const inst) { return g_SWPB_TC.Process<T_mode>(inst); }
+  
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STR_imm_post_down(Inst const inst) { return g_STR_imm_post_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STR_imm_post_up(Inst const inst) { return g_STR_imm_post_up_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STR_imm_offset_down(Inst const inst) { return g_STR_imm_offset_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STR_imm_offset_up(Inst const inst) { return g_STR_imm_offset_up_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STR_imm_pre_down(Inst const inst) { return g_STR_imm_pre_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STR_imm_pre_up(Inst const inst) { return g_STR_imm_pre_up_TC.Process<T_mode>(inst); }
+  
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STR_reg_post_down(Inst const inst) { return g_STR_reg_post_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STR_reg_post_up(Inst const inst) { return g_STR_reg_post_up_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STR_reg_offset_down(Inst const inst) { return g_STR_reg_offset_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STR_reg_offset_up(Inst const inst) { return g_STR_reg_offset_up_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STR_reg_pre_down(Inst const inst) { return g_STR_reg_pre_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STR_reg_pre_up(Inst const inst) { return g_STR_reg_pre_up_TC.Process<T_mode>(inst); }
+  
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STRT_imm_post_down(Inst const inst) { return g_STRT_imm_post_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STRT_imm_post_up(Inst const inst) { return g_STRT_imm_post_up_TC.Process<T_mode>(inst); }
+  
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STRT_reg_post_down(Inst const inst) { return g_STRT_reg_post_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STRT_reg_post_up(Inst const inst) { return g_STRT_reg_post_up_TC.Process<T_mode>(inst); }
+  
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STRB_imm_post_down(Inst const inst) { return g_STRB_imm_post_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STRB_imm_post_up(Inst const inst) { return g_STRB_imm_post_up_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STRB_imm_offset_down(Inst const inst) { return g_STRB_imm_offset_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STRB_imm_offset_up(Inst const inst) { return g_STRB_imm_offset_up_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STRB_imm_pre_down(Inst const inst) { return g_STRB_imm_pre_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STRB_imm_pre_up(Inst const inst) { return g_STRB_imm_pre_up_TC.Process<T_mode>(inst); }
+  
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STRB_reg_post_down(Inst const inst) { return g_STRB_reg_post_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STRB_reg_post_up(Inst const inst) { return g_STRB_reg_post_up_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STRB_reg_offset_down(Inst const inst) { return g_STRB_reg_offset_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STRB_reg_offset_up(Inst const inst) { return g_STRB_reg_offset_up_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STRB_reg_pre_down(Inst const inst) { return g_STRB_reg_pre_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STRB_reg_pre_up(Inst const inst) { return g_STRB_reg_pre_up_TC.Process<T_mode>(inst); }
+  
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STRBT_imm_post_down(Inst const inst) { return g_STRBT_imm_post_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STRBT_imm_post_up(Inst const inst) { return g_STRBT_imm_post_up_TC.Process<T_mode>(inst); }
+  
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STRBT_reg_post_down(Inst const inst) { return g_STRBT_reg_post_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STRBT_reg_post_up(Inst const inst) { return g_STRBT_reg_post_up_TC.Process<T_mode>(inst); }
+  
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDR_imm_post_down(Inst const inst) { return g_LDR_imm_post_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDR_imm_post_up(Inst const inst) { return g_LDR_imm_post_up_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDR_imm_offset_down(Inst const inst) { return g_LDR_imm_offset_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDR_imm_offset_up(Inst const inst) { return g_LDR_imm_offset_up_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDR_imm_pre_down(Inst const inst) { return g_LDR_imm_pre_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDR_imm_pre_up(Inst const inst) { return g_LDR_imm_pre_up_TC.Process<T_mode>(inst); }
+  
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDR_reg_post_down(Inst const inst) { return g_LDR_reg_post_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDR_reg_post_up(Inst const inst) { return g_LDR_reg_post_up_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDR_reg_offset_down(Inst const inst) { return g_LDR_reg_offset_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDR_reg_offset_up(Inst const inst) { return g_LDR_reg_offset_up_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDR_reg_pre_down(Inst const inst) { return g_LDR_reg_pre_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDR_reg_pre_up(Inst const inst) { return g_LDR_reg_pre_up_TC.Process<T_mode>(inst); }
+  
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRT_imm_post_down(Inst const inst) { return g_LDRT_imm_post_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRT_imm_post_up(Inst const inst) { return g_LDRT_imm_post_up_TC.Process<T_mode>(inst); }
+  
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRT_reg_post_down(Inst const inst) { return g_LDRT_reg_post_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRT_reg_post_up(Inst const inst) { return g_LDRT_reg_post_up_TC.Process<T_mode>(inst); }
+  
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRB_imm_post_down(Inst const inst) { return g_LDRB_imm_post_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRB_imm_post_up(Inst const inst) { return g_LDRB_imm_post_up_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRB_imm_offset_down(Inst const inst) { return g_LDRB_imm_offset_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRB_imm_offset_up(Inst const inst) { return g_LDRB_imm_offset_up_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRB_imm_pre_down(Inst const inst) { return g_LDRB_imm_pre_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRB_imm_pre_up(Inst const inst) { return g_LDRB_imm_pre_up_TC.Process<T_mode>(inst); }
+  
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRB_reg_post_down(Inst const inst) { return g_LDRB_reg_post_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRB_reg_post_up(Inst const inst) { return g_LDRB_reg_post_up_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRB_reg_offset_down(Inst const inst) { return g_LDRB_reg_offset_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRB_reg_offset_up(Inst const inst) { return g_LDRB_reg_offset_up_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRB_reg_pre_down(Inst const inst) { return g_LDRB_reg_pre_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRB_reg_pre_up(Inst const inst) { return g_LDRB_reg_pre_up_TC.Process<T_mode>(inst); }
+  
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRBT_imm_post_down(Inst const inst) { return g_LDRBT_imm_post_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRBT_imm_post_up(Inst const inst) { return g_LDRBT_imm_post_up_TC.Process<T_mode>(inst); }
+  
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRBT_reg_post_down(Inst const inst) { return g_LDRBT_reg_post_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRBT_reg_post_up(Inst const inst) { return g_LDRBT_reg_post_up_TC.Process<T_mode>(inst); }
+  
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STRH_imm_post_down(Inst const inst) { return g_STRH_imm_post_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STRH_imm_post_up(Inst const inst) { return g_STRH_imm_post_up_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STRH_imm_offset_down(Inst const inst) { return g_STRH_imm_offset_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STRH_imm_offset_up(Inst const inst) { return g_STRH_imm_offset_up_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STRH_imm_pre_down(Inst const inst) { return g_STRH_imm_pre_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STRH_imm_pre_up(Inst const inst) { return g_STRH_imm_pre_up_TC.Process<T_mode>(inst); }
+  
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STRH_reg_post_down(Inst const inst) { return g_STRH_reg_post_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STRH_reg_post_up(Inst const inst) { return g_STRH_reg_post_up_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STRH_reg_offset_down(Inst const inst) { return g_STRH_reg_offset_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STRH_reg_offset_up(Inst const inst) { return g_STRH_reg_offset_up_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STRH_reg_pre_down(Inst const inst) { return g_STRH_reg_pre_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_STRH_reg_pre_up(Inst const inst) { return g_STRH_reg_pre_up_TC.Process<T_mode>(inst); }
+  
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRH_imm_post_down(Inst const inst) { return g_LDRH_imm_post_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRH_imm_post_up(Inst const inst) { return g_LDRH_imm_post_up_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRH_imm_offset_down(Inst const inst) { return g_LDRH_imm_offset_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRH_imm_offset_up(Inst const inst) { return g_LDRH_imm_offset_up_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRH_imm_pre_down(Inst const inst) { return g_LDRH_imm_pre_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRH_imm_pre_up(Inst const inst) { return g_LDRH_imm_pre_up_TC.Process<T_mode>(inst); }
+  
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRH_reg_post_down(Inst const inst) { return g_LDRH_reg_post_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRH_reg_post_up(Inst const inst) { return g_LDRH_reg_post_up_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRH_reg_offset_down(Inst const inst) { return g_LDRH_reg_offset_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRH_reg_offset_up(Inst const inst) { return g_LDRH_reg_offset_up_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRH_reg_pre_down(Inst const inst) { return g_LDRH_reg_pre_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRH_reg_pre_up(Inst const inst) { return g_LDRH_reg_pre_up_TC.Process<T_mode>(inst); }
+  
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRSB_imm_post_down(Inst const inst) { return g_LDRSB_imm_post_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRSB_imm_post_up(Inst const inst) { return g_LDRSB_imm_post_up_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRSB_imm_offset_down(Inst const inst) { return g_LDRSB_imm_offset_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRSB_imm_offset_up(Inst const inst) { return g_LDRSB_imm_offset_up_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRSB_imm_pre_down(Inst const inst) { return g_LDRSB_imm_pre_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRSB_imm_pre_up(Inst const inst) { return g_LDRSB_imm_pre_up_TC.Process<T_mode>(inst); }
+  
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRSB_reg_post_down(Inst const inst) { return g_LDRSB_reg_post_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRSB_reg_post_up(Inst const inst) { return g_LDRSB_reg_post_up_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRSB_reg_offset_down(Inst const inst) { return g_LDRSB_reg_offset_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRSB_reg_offset_up(Inst const inst) { return g_LDRSB_reg_offset_up_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRSB_reg_pre_down(Inst const inst) { return g_LDRSB_reg_pre_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRSB_reg_pre_up(Inst const inst) { return g_LDRSB_reg_pre_up_TC.Process<T_mode>(inst); }
+  
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRSH_imm_post_down(Inst const inst) { return g_LDRSH_imm_post_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRSH_imm_post_up(Inst const inst) { return g_LDRSH_imm_post_up_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRSH_imm_offset_down(Inst const inst) { return g_LDRSH_imm_offset_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRSH_imm_offset_up(Inst const inst) { return g_LDRSH_imm_offset_up_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRSH_imm_pre_down(Inst const inst) { return g_LDRSH_imm_pre_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRSH_imm_pre_up(Inst const inst) { return g_LDRSH_imm_pre_up_TC.Process<T_mode>(inst); }
+  
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRSH_reg_post_down(Inst const inst) { return g_LDRSH_reg_post_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRSH_reg_post_up(Inst const inst) { return g_LDRSH_reg_post_up_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRSH_reg_offset_down(Inst const inst) { return g_LDRSH_reg_offset_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRSH_reg_offset_up(Inst const inst) { return g_LDRSH_reg_offset_up_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRSH_reg_pre_down(Inst const inst) { return g_LDRSH_reg_pre_down_TC.Process<T_mode>(inst); }
+  template<TranslationModeEnum T_mode>
+  ExecResultEnum MemoryInst_TC<T_mode>::exec_LDRSH_reg_pre_up(Inst const inst) { return g_LDRSH_reg_pre_up_TC.Process<T_mode>(inst); }
+  
+  template struct MemoryInst_TC<TRANSLATION_MMU_OFF>;
+  template struct MemoryInst_TC<TRANSLATION_MMU_ON>;
+  template struct MemoryInst_TC<TRANSLATION_MMU_ON_FCSE>;
   
   // DPI - threaded code version
   
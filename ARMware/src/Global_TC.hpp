@@ -557,6 +557,189 @@ namespace ARMware
   extern ExecResultEnum exec_LDRSH_reg_pre_down_TC(Inst const inst);
   extern ExecResultEnum exec_LDRSH_reg_pre_up_TC(Inst const inst);
   
+  // Memory instructions - threaded code version, one variant per translation mode.
+  //
+  // @T_mode: see Core::virtual_to_physical().
+  template<TranslationModeEnum T_mode>
+  struct MemoryInst_TC
+  {
+    
+    static ExecResultEnum exec_STM_1_DA(Inst const inst);
+    static ExecResultEnum exec_STM_1_DA_w(Inst const inst);
+    static ExecResultEnum exec_STM_2_DA(Inst const inst);
+    
+    static ExecResultEnum exec_STM_1_DB(Inst const inst);
+    static ExecResultEnum exec_STM_1_DB_w(Inst const inst);
+    static ExecResultEnum exec_STM_2_DB(Inst const inst);
+    
+    static ExecResultEnum exec_STM_1_IA(Inst const inst);
+    static ExecResultEnum exec_STM_1_IA_w(Inst const inst);
+    static ExecResultEnum exec_STM_2_IA(Inst const inst);
+    
+    static ExecResultEnum exec_STM_1_IB(Inst const inst);
+    static ExecResultEnum exec_STM_1_IB_w(Inst const inst);
+    static ExecResultEnum exec_STM_2_IB(Inst const inst);
+    
+    static ExecResultEnum exec_LDM_1_DA(Inst const inst);
+    static ExecResultEnum exec_LDM_1_DA_w(Inst const inst);
+    static ExecResultEnum exec_LDM_23_DA(Inst const inst);
+    static ExecResultEnum exec_LDM_23_DA_w(Inst const inst);
+    
+    static ExecResultEnum exec_LDM_1_DB(Inst const inst);
+    static ExecResultEnum exec_LDM_1_DB_w(Inst const inst);
+    static ExecResultEnum exec_LDM_23_DB(Inst const inst);
+    static ExecResultEnum exec_LDM_23_DB_w(Inst const inst);
+    
+    static ExecResultEnum exec_LDM_1_IA(Inst const inst);
+    static ExecResultEnum exec_LDM_1_IA_w(Inst const inst);
+    static ExecResultEnum exec_LDM_23_IA(Inst const inst);
+    static ExecResultEnum exec_LDM_23_IA_w(Inst const inst);
+    
+    static ExecResultEnum exec_LDM_1_IB(Inst const inst);
+    static ExecResultEnum exec_LDM_1_IB_w(Inst const inst);
+    static ExecResultEnum exec_LDM_23_IB(Inst const inst);
+    static ExecResultEnum exec_LDM_23_IB_w(Inst const inst);
+    
+    static ExecResultEnum exec_SWP(Inst const inst);
+    static ExecResultEnum exec_SWPB(Inst const inst);
+    
+    static ExecResultEnum exec_STR_imm_post_down(Inst const inst);
+    static ExecResultEnum exec_STR_imm_post_up(Inst const inst);
+    static ExecResultEnum exec_STR_imm_offset_down(Inst const inst);
+    static ExecResultEnum exec_STR_imm_offset_up(Inst const inst);
+    static ExecResultEnum exec_STR_imm_pre_down(Inst const inst);
+    static ExecResultEnum exec_STR_imm_pre_up(Inst const inst);
+    
+    static ExecResultEnum exec_STR_reg_post_down(Inst const inst);
+    static ExecResultEnum exec_STR_reg_post_up(Inst const inst);
+    static ExecResultEnum exec_STR_reg_offset_down(Inst const inst);
+    static ExecResultEnum exec_STR_reg_offset_up(Inst const inst);
+    static ExecResultEnum exec_STR_reg_pre_down(Inst const inst);
+    static ExecResultEnum exec_STR_reg_pre_up(Inst const inst);
+    
+    static ExecResultEnum exec_STRT_imm_post_down(Inst const inst);
+    static ExecResultEnum exec_STRT_imm_post_up(Inst const inst);
+    
+    static ExecResultEnum exec_STRT_reg_post_down(Inst const inst);
+    static ExecResultEnum exec_STRT_reg_post_up(Inst const inst);
+    
+    static ExecResultEnum exec_STRB_imm_post_down(Inst const inst);
+    static ExecResultEnum exec_STRB_imm_post_up(Inst const inst);
+    static ExecResultEnum exec_STRB_imm_offset_down(Inst const inst);
+    static ExecResultEnum exec_STRB_imm_offset_up(Inst const inst);
+    static ExecResultEnum exec_STRB_imm_pre_down(Inst const inst);
+    static ExecResultEnum exec_STRB_imm_pre_up(Inst const inst);
+    
+    static ExecResultEnum exec_STRB_reg_post_down(Inst const inst);
+    static ExecResultEnum exec_STRB_reg_post_up(Inst const inst);
+    static ExecResultEnum exec_STRB_reg_offset_down(Inst const inst);
+    static ExecResultEnum exec_STRB_reg_offset_up(Inst const inst);
+    static ExecResultEnum exec_STRB_reg_pre_down(Inst const inst);
+    static ExecResultEnum exec_STRB_reg_pre_up(Inst const inst);
+    
+    static ExecResultEnum exec_STRBT_imm_post_down(Inst const inst);
+    static ExecResultEnum exec_STRBT_imm_post_up(Inst const inst);
+    
+    static ExecResultEnum exec_STRBT_reg_post_down(Inst const inst);
+    static ExecResultEnum exec_STRBT_reg_post_up(Inst const inst);
+    
+    static ExecResultEnum exec_LDR_imm_post_down(Inst const inst);
+    static ExecResultEnum exec_LDR_imm_post_up(Inst const inst);
+    static ExecResultEnum exec_LDR_imm_offset_down(Inst const inst);
+    static ExecResultEnum exec_LDR_imm_offset_up(Inst const inst);
+    static ExecResultEnum exec_LDR_imm_pre_down(Inst const inst);
+    static ExecResultEnum exec_LDR_imm_pre_up(Inst const inst);
+    
+    static ExecResultEnum exec_LDR_reg_post_down(Inst const inst);
+    static ExecResultEnum exec_LDR_reg_post_up(Inst const inst);
+    static ExecResultEnum exec_LDR_reg_offset_down(Inst const inst);
+    static ExecResultEnum exec_LDR_reg_offset_up(Inst const inst);
+    static ExecResultEnum exec_LDR_reg_pre_down(Inst const inst);
+    static ExecResultEnum exec_LDR_reg_pre_up(Inst const inst);
+    
+    static ExecResultEnum exec_LDRT_imm_post_down(Inst const inst);
+    static ExecResultEnum exec_LDRT_imm_post_up(Inst const inst);
+    
+    static ExecResultEnum exec_LDRT_reg_post_down(Inst const inst);
+    static ExecResultEnum exec_LDRT_reg_post_up(Inst const inst);
+    
+    static ExecResultEnum exec_LDRB_imm_post_down(Inst const inst);
+    static ExecResultEnum exec_LDRB_imm_post_up(Inst const inst);
+    static ExecResultEnum exec_LDRB_imm_offset_down(Inst const inst);
+    static ExecResultEnum exec_LDRB_imm_offset_up(Inst const inst);
+    static ExecResultEnum exec_LDRB_imm_pre_down(Inst const inst);
+    static ExecResultEnum exec_LDRB_imm_pre_up(Inst const inst);
+    
+    static ExecResultEnum exec_LDRB_reg_post_down(Inst const inst);
+    static ExecResultEnum exec_LDRB_reg_post_up(Inst const inst);
+    static ExecResultEnum exec_LDRB_reg_offset_down(Inst const inst);
+    static ExecResultEnum exec_LDRB_reg_offset_up(Inst const inst);
+    static ExecResultEnum exec_LDRB_reg_pre_down(Inst const inst);
+    static ExecResultEnum exec_LDRB_reg_pre_up(Inst const inst);
+    
+    static ExecResultEnum exec_LDRBT_imm_post_down(Inst const inst);
+    static ExecResultEnum exec_LDRBT_imm_post_up(Inst const inst);
+    
+    static ExecResultEnum exec_LDRBT_reg_post_down(Inst const inst);
+    static ExecResultEnum exec_LDRBT_reg_post_up(Inst const inst);
+    
+    static ExecResultEnum exec_STRH_imm_post_down(Inst const inst);
+    static ExecResultEnum exec_STRH_imm_post_up(Inst const inst);
+    static ExecResultEnum exec_STRH_imm_offset_down(Inst const inst);
+    static ExecResultEnum exec_STRH_imm_offset_up(Inst const inst);
+    static ExecResultEnum exec_STRH_imm_pre_down(Inst const inst);
+    static ExecResultEnum exec_STRH_imm_pre_up(Inst const inst);
+    
+    static ExecResultEnum exec_STRH_reg_post_down(Inst const inst);
+    static ExecResultEnum exec_STRH_reg_post_up(Inst const inst);
+    static ExecResultEnum exec_STRH_reg_offset_down(Inst const inst);
+    static ExecResultEnum exec_STRH_reg_offset_up(Inst const inst);
+    static ExecResultEnum exec_STRH_reg_pre_down(Inst const inst);
+    static ExecResultEnum exec_STRH_reg_pre_up(Inst const inst);
+    
+    static ExecResultEnum exec_LDRH_imm_post_down(Inst const inst);
+    static ExecResultEnum exec_LDRH_imm_post_up(Inst const inst);
+    static ExecResultEnum exec_LDRH_imm_offset_down(Inst const inst);
+    static ExecResultEnum exec_LDRH_imm_offset_up(Inst const inst);
+    static ExecResultEnum exec_LDRH_imm_pre_down(Inst const inst);
+    static ExecResultEnum exec_LDRH_imm_pre_up(Inst const inst);
+    
+    static ExecResultEnum exec_LDRH_reg_post_down(Inst const inst);
+    static ExecResultEnum exec_LDRH_reg_post_up(Inst const inst);
+    static ExecResultEnum exec_LDRH_reg_offset_down(Inst const inst);
+    static ExecResultEnum exec_LDRH_reg_offset_up(Inst const inst);
+    static ExecResultEnum exec_LDRH_reg_pre_down(Inst const inst);
+    static ExecResultEnum exec_LDRH_reg_pre_up(Inst const inst);
+    
+    static ExecResultEnum exec_LDRSB_imm_post_down(Inst const inst);
+    static ExecResultEnum exec_LDRSB_imm_post_up(Inst const inst);
+    static ExecResultEnum exec_LDRSB_imm_offset_down(Inst const inst);
+    static ExecResultEnum exec_LDRSB_imm_offset_up(Inst const inst);
+    static ExecResultEnum exec_LDRSB_imm_pre_down(Inst const inst);
+    static ExecResultEnum exec_LDRSB_imm_pre_up(Inst const inst);
+    
+    static ExecResultEnum exec_LDRSB_reg_post_down(Inst const inst);
+    static ExecResultEnum exec_LDRSB_reg_post_up(Inst const inst);
+    static ExecResultEnum exec_LDRSB_reg_offset_down(Inst const inst);
+    static ExecResultEnum exec_LDRSB_reg_offset_up(Inst const inst);
+    static ExecResultEnum exec_LDRSB_reg_pre_down(Inst const inst);
+    static ExecResultEnum exec_LDRSB_reg_pre_up(Inst const inst);
+    
+    static ExecResultEnum exec_LDRSH_imm_post_down(Inst const inst);
+    static ExecResultEnum exec_LDRSH_imm_post_up(Inst const inst);
+    static ExecResultEnum exec_LDRSH_imm_offset_down(Inst const inst);
+    static ExecResultEnum exec_LDRSH_imm_offset_up(Inst const inst);
+    static ExecResultEnum exec_LDRSH_imm_pre_down(Inst const inst);
+    static ExecResultEnum exec_LDRSH_imm_pre_up(Inst const inst);
+    
+    static ExecResultEnum exec_LDRSH_reg_post_down(Inst const inst);
+    static ExecResultEnum exec_LDRSH_reg_post_up(Inst const inst);
+    static ExecResultEnum exec_LDRSH_reg_offset_down(Inst const inst);
+    static ExecResultEnum exec_LDRSH_reg_offset_up(Inst const inst);
+    static ExecResultEnum exec_LDRSH_reg_pre_down(Inst const inst);
+    static ExecResultEnum exec_LDRSH_reg_pre_up(Inst const inst);
+  };
+  
   // DPI - threaded code version
   
   extern ExecResultEnum exec_AND_regimm_TC(Inst const inst);
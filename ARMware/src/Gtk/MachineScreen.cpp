@@ -19,6 +19,7 @@
 //
 
 #include <cassert>
+#include <cstring>
 
 #if TRACE_DRAW_SCREEN
 #include <iostream>
@@ -34,9 +35,10 @@
 //
 
 #include "../Memory.hpp"
-#include "../ColorTableTraits.hpp"
+#include "../PixelConvert.hpp"
 #include "../LCDController.hpp"
 #include "../AtmelMicro.hpp"
+#include "../platform_dep.hpp"
 
 #include "MachineScreen.hpp"
 
@@ -58,21 +60,11 @@ namespace ARMware
     // This size will meet the alignment requirement in most case, and should be
     // faster.
     
-    // :NOTE: Wei 2004-Jul-12:
-    //
-    // The reason why the height of the pixbuf is 'height + 8' when using ENABLE_DRAWING_ASM
-    // is because I will get 8 pixels data at most at once.
-    //
-    // Thus I have to increment the height to avoid the segmentation fault.
     mp_pixbuf = Gdk::Pixbuf::create(Gdk::COLORSPACE_RGB,
                                     true, // has_alpha
                                     8, // bits_per_sample
                                     width,
-#if ENABLE_DRAWING_ASM
-                                    height + 8
-#else
                                     height
-#endif
                                     );
     
     // Clear the pixbuf's buffer to black
@@ -120,10 +112,10 @@ namespace ARMware
     switch (T_panel)
     {
     case PANEL_1:
-      return m_frame_buffer_addr_1;
+      return m_render_frame_buffer_addr_1 + get_palette_size();
       
     case PANEL_2:
-      return m_frame_buffer_addr_2;
+      return m_render_frame_buffer_addr_2;
       
     default:
       assert(!"Should not reach here.");
@@ -131,40 +123,6 @@ namespace ARMware
     }
   } 
   
-  template<MachineScreen::PanelEnum T_panel, MachineScreen::DualPanelEnum T_dual>
-  inline guint8 *
-  MachineScreen::get_pixbuf_start_address() const
-  {
-    switch (T_dual)
-    {
-    case SINGLE:
-      assert(PANEL_1 == T_panel);
-      return mp_pixbuf->get_pixels();
-      
-    case DUAL:
-      switch (T_panel)
-      {
-      case PANEL_1:
-        return mp_pixbuf->get_pixels();
-        
-      case PANEL_2:
-        // :NOTE: Wei 2004-Jun-29:
-        //
-        // The pixel width of Gdk pixbuf is 4-byte.
-        // (Alpha, red, green, blue)
-        return mp_pixbuf->get_pixels() + ((DISPLAY_WIDTH >> 1) << 2);
-        
-      default:
-        assert(!"Should not reach here.");
-        return 0;
-      }
-      
-    default:
-      assert(!"Should not reach here.");
-      return 0;
-    }
-  }
-  
   template<MachineScreen::PanelEnum T_panel, MachineScreen::DualPanelEnum T_dual>
   inline uint32_t
   MachineScreen::get_drawing_left() const
@@ -233,427 +191,357 @@ namespace ARMware
     }
   }
   
-#if ENABLE_DRAWING_ASM
-  
-  // :NOTE: Wei 2004-Jul-12:
-  //
-  // The 'psrlq' for MMX & 'psrldq' for SSE are different.
-  //
-  // 'psrlq' uses bits as element to shift, however,
-  // 'psrldq' uses bytes as element to shift.
-#define MMX_STORE_PIXEL(mmx_r) "subl %6, %%edi \n\t" \
-                               "psrlq $32, %%" #mmx_r "\n\t" \
-                               "maskmovq %%mm2, %%" #mmx_r "\n\t"
-  
-#define SSE2_STORE_PIXEL(sse_r) "subl %6, %%edi \n\t" \
-                                "psrldq $4, %%" #sse_r "\n\t" \
-                                "maskmovdqu %%xmm2, %%" #sse_r "\n\t"
-  
-  // :NOTE: Wei 2004-Jul-12:
-  //
-  // If just drawing 1 or 2 pixels, then we can eliminate some operations, see below.
-#define MMX_DRAW_1_2_PIXELS_PROLOGUE \
-      asm volatile ( \
-      "movq %0, %%mm0 \n\t" /* read 4 pixels */ \
-      "movq %%mm0, %%mm1 \n\t" \
-      "movq %%mm0, %%mm2 \n\t" \
-      \
-      "pand %1, %%mm0 \n\t" /* mm0: red */ \
-      "pand %2, %%mm1 \n\t" /* mm1: green */ \
-      "pand %3, %%mm2 \n\t" /* mm2: blue */ \
-      \
-      "psrlw $8, %%mm0\n\t" /* red shift right 12, multiply 16 */ \
-      "psrlw $3, %%mm1\n\t" /* green shift right 7, multiply 16 */ \
-      "psllw $3, %%mm2\n\t" /* blue shift right 1, multiply 16 */ \
-      \
-      "packuswb %%mm3, %%mm0 \n\t" /* mm0: low 32-bit red */ \
-      "packuswb %%mm3, %%mm1 \n\t" /* mm1: low 32-bit green */ \
-      "packuswb %%mm3, %%mm2 \n\t" /* mm2: low 32-bit blue */ \
-      \
-      "punpcklbw %%mm1, %%mm0 \n\t" /* mm0: 64-bit {green, red} */ \
-      /* "movq %%mm0, %%mm1 \n\t" --> mm1: 64-bit {green, red} */ \
-      "punpcklbw %4, %%mm2 \n\t" /* mm2: 64-bit {alpha, blue} */ \
-      \
-      "punpcklwd %%mm2, %%mm0 \n\t" /* mm0: 64-bit {alpha, blue, green, red} */ \
-      /* "punpckhwd %%mm2, %%mm1 \n\t" --> mm1: 64-bit {alpha, blue, green, red} */ \
-      \
-      "movl %5, %%edi \n\t" /* edi: dest address */ \
-      \
-      "movl $0xFFFFFFFF, %%edx \n\t" \
-      "movd %%edx, %%mm2 \n\t" /* mm2: 0x00000000FFFFFFFF */ \
-      "maskmovq %%mm2, %%mm0 \n\t"
-                     
-#define MMX_DRAW_PIXELS_PROLOGUE \
-      asm volatile ( \
-      "movq %0, %%mm0 \n\t" /* read 4 pixels */ \
-      "movq %%mm0, %%mm1 \n\t" \
-      "movq %%mm0, %%mm2 \n\t" \
-      \
-      "pand %1, %%mm0 \n\t" /* mm0: red */ \
-      "pand %2, %%mm1 \n\t" /* mm1: green */ \
-      "pand %3, %%mm2 \n\t" /* mm2: blue */ \
-      \
-      "psrlw $8, %%mm0\n\t" /* red shift right 12, multiply 16 */ \
-      "psrlw $3, %%mm1\n\t" /* green shift right 7, multiply 16 */ \
-      "psllw $3, %%mm2\n\t" /* blue shift right 1, multiply 16 */ \
-      \
-      "packuswb %%mm3, %%mm0 \n\t" /* mm0: low 32-bit red */ \
-      "packuswb %%mm3, %%mm1 \n\t" /* mm1: low 32-bit green */ \
-      "packuswb %%mm3, %%mm2 \n\t" /* mm2: low 32-bit blue */ \
-      \
-      "punpcklbw %%mm1, %%mm0 \n\t" /* mm0: 64-bit {green, red} */ \
-      "movq %%mm0, %%mm1 \n\t" /* mm1: 64-bit {green, red} */ \
-      "punpcklbw %4, %%mm2 \n\t" /* mm2: 64-bit {alpha, blue} */ \
-      \
-      "punpcklwd %%mm2, %%mm0 \n\t" /* mm0: 64-bit {alpha, blue, green, red} */ \
-      "punpckhwd %%mm2, %%mm1 \n\t" /* mm1: 64-bit {alpha, blue, green, red} */ \
-      \
-      "movl %5, %%edi \n\t" /* edi: dest address */ \
-      \
-      "movl $0xFFFFFFFF, %%edx \n\t" \
-      "movd %%edx, %%mm2 \n\t" /* mm2: 0x00000000FFFFFFFF */ \
-      "maskmovq %%mm2, %%mm0 \n\t"
-                     
-#define SSE2_DRAW_PIXELS_PROLOGUE \
-      asm volatile ( \
-      "movdqu %0, %%xmm0 \n\t" /* read 8 pixels */ \
-      "movdqa %%xmm0, %%xmm1 \n\t" \
-      "movdqa %%xmm0, %%xmm2 \n\t" \
-      \
-      "pand %1, %%xmm0 \n\t" /* xmm0: red */ \
-      "pand %2, %%xmm1 \n\t" /* xmm1: green */ \
-      "pand %3, %%xmm2 \n\t" /* xmm2: blue */ \
-      \
-      "psrlw $8, %%xmm0\n\t" /* red shift right 12, multiply 16 */ \
-      "psrlw $3, %%xmm1\n\t" /* green shift right 7, multiply 16 */ \
-      "psllw $3, %%xmm2\n\t" /* blue shift right 1, multiply 16 */ \
-      \
-      "packuswb %%xmm3, %%xmm0 \n\t" /* xmm0: low 64-bit red */ \
-      "packuswb %%xmm3, %%xmm1 \n\t" /* xmm1: low 64-bit green */ \
-      "packuswb %%xmm3, %%xmm2 \n\t" /* xmm2: low 64-bit blue */ \
-      \
-      "punpcklbw %%xmm1, %%xmm0 \n\t" /* xmm0: 128-bit {green, red} */ \
-      "movdqa %%xmm0, %%xmm1 \n\t" /* xmm1: 128-bit {green, red} */ \
-      "punpcklbw %4, %%xmm2 \n\t" /* xmm2: 128-bit {alpha, blue} */ \
-      \
-      "punpcklwd %%xmm2, %%xmm0 \n\t" /* xmm0: 128-bit {alpha, blue, green, red} */ \
-      "punpckhwd %%xmm2, %%xmm1 \n\t" /* xmm1: 128-bit {alpha, blue, green, red} */ \
-      \
-      "movl %5, %%edi \n\t" /* edi: dest address */ \
-      \
-      "movl $0xFFFFFFFF, %%edx \n\t" \
-      "movd %%edx, %%xmm2 \n\t" /* xmm2: 0x000000000000000000000000FFFFFFFF */ \
-      "maskmovdqu %%xmm2, %%xmm0 \n\t"
-      
-#define MMX_DRAW_PIXELS_EPILOGUE \
-      "subl %6, %%edi \n\t" \
-      "movl %%edi, %5" \
-      : \
-      : "m" (mp_memory[curr_addr]), \
-      "m" (m_red_bitmask.m_low), \
-      "m" (m_green_bitmask.m_low), \
-      "m" (m_blue_bitmask.m_low), \
-      "m" (m_alpha_value.m_low), \
-      "m" (dest), \
-      "r" (row_length) \
-      : "edx", "edi", "memory", "mm0", "mm1", "mm2" \
-      )
-      
-#define SSE2_DRAW_PIXELS_EPILOGUE \
-      "subl %6, %%edi \n\t" \
-      "movl %%edi, %5" \
-      : \
-      : "m" (mp_memory[curr_addr]), \
-      "m" (m_red_bitmask), \
-      "m" (m_green_bitmask), \
-      "m" (m_blue_bitmask), \
-      "m" (m_alpha_value), \
-      "m" (dest), \
-      "r" (row_length) \
-      : "edx", "edi", "memory", "xmm0", "xmm1", "xmm2" \
-      )
-      
-  // :NOTE: Wei 2004-Jul-12:
-  //
-  // The reason why I have the following 1, 2, 3, 4, 5, 6, 7, 8 pixels drawing routines
-  // is because I want to minimize the store operations in the end of each drawing routines.
-  //
-  // Ex: If I just need to drawing 6 pixels, however, I use drawing_8_pixels() to drawing,
-  //     then I drawing 2 unnecessary pixels.
-  //     And because of the load/store to memory is slow, thus I want to minimize its uses.
-#define MMX_DRAW_1_PIXELS \
-      MMX_DRAW_1_2_PIXELS_PROLOGUE \
-      MMX_DRAW_PIXELS_EPILOGUE
-  
-#define MMX_DRAW_2_PIXELS \
-      MMX_DRAW_1_2_PIXELS_PROLOGUE \
-      \
-      MMX_STORE_PIXEL(mm0) \
-      \
-      MMX_DRAW_PIXELS_EPILOGUE
-  
-#define MMX_DRAW_3_PIXELS \
-      MMX_DRAW_PIXELS_PROLOGUE \
-      \
-      MMX_STORE_PIXEL(mm0) \
-      \
-      "subl %6, %%edi \n\t" \
-      "maskmovq %%mm2, %%mm1 \n\t" \
-      \
-      MMX_DRAW_PIXELS_EPILOGUE
-  
-#define MMX_DRAW_4_PIXELS \
-      MMX_DRAW_PIXELS_PROLOGUE \
-      \
-      MMX_STORE_PIXEL(mm0) \
-      \
-      "subl %6, %%edi \n\t" \
-      "maskmovq %%mm2, %%mm1 \n\t" \
-      \
-      MMX_STORE_PIXEL(mm1) \
-      \
-      MMX_DRAW_PIXELS_EPILOGUE
-  
-#define SSE2_DRAW_5_PIXELS \
-      SSE2_DRAW_PIXELS_PROLOGUE \
-      \
-      SSE2_STORE_PIXEL(xmm0) \
-      SSE2_STORE_PIXEL(xmm0) \
-      SSE2_STORE_PIXEL(xmm0) \
-      \
-      "subl %6, %%edi \n\t" \
-      "maskmovdqu %%xmm2, %%xmm1 \n\t" \
-      \
-      SSE2_DRAW_PIXELS_EPILOGUE
-  
-#define SSE2_DRAW_6_PIXELS \
-      SSE2_DRAW_PIXELS_PROLOGUE \
-      \
-      SSE2_STORE_PIXEL(xmm0) \
-      SSE2_STORE_PIXEL(xmm0) \
-      SSE2_STORE_PIXEL(xmm0) \
-      \
-      "subl %6, %%edi \n\t" \
-      "maskmovdqu %%xmm2, %%xmm1 \n\t" \
-      \
-      SSE2_STORE_PIXEL(xmm1) \
-      \
-      SSE2_DRAW_PIXELS_EPILOGUE
-  
-#define SSE2_DRAW_7_PIXELS \
-      SSE2_DRAW_PIXELS_PROLOGUE \
-      \
-      SSE2_STORE_PIXEL(xmm0) \
-      SSE2_STORE_PIXEL(xmm0) \
-      SSE2_STORE_PIXEL(xmm0) \
-      \
-      "subl %6, %%edi \n\t" \
-      "maskmovdqu %%xmm2, %%xmm1 \n\t" \
-      \
-      SSE2_STORE_PIXEL(xmm1) \
-      SSE2_STORE_PIXEL(xmm1) \
-      \
-      SSE2_DRAW_PIXELS_EPILOGUE
-  
-#define SSE2_DRAW_8_PIXELS \
-      SSE2_DRAW_PIXELS_PROLOGUE \
-      \
-      SSE2_STORE_PIXEL(xmm0) \
-      SSE2_STORE_PIXEL(xmm0) \
-      SSE2_STORE_PIXEL(xmm0) \
-      \
-      "subl %6, %%edi \n\t" \
-      "maskmovdqu %%xmm2, %%xmm1 \n\t" \
-      \
-      SSE2_STORE_PIXEL(xmm1) \
-      SSE2_STORE_PIXEL(xmm1) \
-      SSE2_STORE_PIXEL(xmm1) \
-      \
-      SSE2_DRAW_PIXELS_EPILOGUE
-  
+  template<MachineScreen::PanelEnum T_panel, MachineScreen::DualPanelEnum T_dual>
   inline void
-  MachineScreen::drawing_1_pixel(uint32_t &curr_addr, uint8_t *&dest, uint32_t const row_length) const
+  MachineScreen::draw_panel()
   {
-    MMX_DRAW_1_PIXELS;
+#if TRACE_DRAW_SCREEN
+    g_log_file << "SCREEN: drawing: ";
+#endif
     
-    curr_addr += (1 * BYTES_PER_PIXEL);
-  }
-  
-  inline void
-  MachineScreen::drawing_2_pixel(uint32_t &curr_addr, uint8_t *&dest, uint32_t const row_length) const
-  {
-    MMX_DRAW_2_PIXELS;
+    assert(mp_memory != 0);
     
-    curr_addr += (2 * BYTES_PER_PIXEL);
-  }
-  
-  inline void
-  MachineScreen::drawing_3_pixel(uint32_t &curr_addr, uint8_t *&dest, uint32_t const row_length) const
-  {
-    MMX_DRAW_3_PIXELS;
+    if (false == dirty_rect_in_this_panel<T_panel, T_dual>())
+    {
+      return;
+    }
     
-    curr_addr += (3 * BYTES_PER_PIXEL);
-  }
-  
-  inline void
-  MachineScreen::drawing_4_pixel(uint32_t &curr_addr, uint8_t *&dest, uint32_t const row_length) const
-  {
-    MMX_DRAW_4_PIXELS;
+    uint32_t const drawing_left = get_drawing_left<T_panel, T_dual>();
+    uint32_t const drawing_right = get_drawing_right<T_panel, T_dual>();
     
-    curr_addr += (4 * BYTES_PER_PIXEL);
-  }
-  
-  inline void
-  MachineScreen::drawing_5_pixel(uint32_t &curr_addr, uint8_t *&dest, uint32_t const row_length) const
-  {
-    SSE2_DRAW_5_PIXELS;
+    uint32_t const panel_left = (((DUAL == T_dual) && (PANEL_2 == T_panel))
+                                 ? (DISPLAY_WIDTH >> 1)
+                                 : 0);
+    
+    uint32_t const machine_bpl = ((DISPLAY_HEIGHT * m_color_depth) >> 3); // bytes per line
+    
+    // The first pixel of a frame buffer line is at the bottom of the screen,
+    // thus the dirty part of each line is converted as a whole span, and
+    // then stored upwards.
+    uint32_t const first_pixel = (DISPLAY_HEIGHT - m_dirty_bottom);
+    uint32_t const height = (m_dirty_bottom - m_dirty_top);
+    
+    uint32_t const first_byte = ((first_pixel * m_color_depth) >> 3);
+    uint32_t const end_byte = ((((first_pixel + height) * m_color_depth) + 7) >> 3);
     
-    curr_addr += (5 * BYTES_PER_PIXEL);
+    // Copy the whole dirty part out of the guest DRAM first, so that the
+    // emulation thread has less chance to change it during the conversion.
+    uint32_t line_addr = (get_panel_start_address<T_panel>() + ((drawing_left - panel_left) * machine_bpl));
+    
+    for (uint32_t x = drawing_left; x < drawing_right; ++x)
+    {
+      memcpy(&(m_snapshot[(x * machine_bpl) + first_byte]),
+             &(mp_memory[line_addr + first_byte]),
+             end_byte - first_byte);
+      
+      line_addr += machine_bpl;
+    }
+    
+    for (uint32_t x = drawing_left; x < drawing_right; ++x)
+    {
+      uint8_t const * const line = &(m_snapshot[x * machine_bpl]);
+      
+      switch (m_color_depth)
+      {
+      case 16:
+        g_pixel_convert.convert_16bpp(reinterpret_cast<uint16_t const *>(line) + first_pixel,
+                                      m_converted_line,
+                                      height);
+        break;
+        
+      case 8:
+        g_pixel_convert.convert_8bpp(line + first_pixel,
+                                     m_converted_line,
+                                     height,
+                                     m_color_lut);
+        break;
+        
+      case 4:
+        g_pixel_convert.convert_4bpp(line,
+                                     first_pixel,
+                                     m_converted_line,
+                                     height,
+                                     m_color_lut);
+        break;
+        
+      default:
+        assert(!"Should not reach here.");
+        break;
+      }
+      
+      uint32_t *dest = &(m_back_image[((m_dirty_bottom - 1) * DISPLAY_WIDTH) + x]);
+      
+      for (uint32_t i = 0; i < height; ++i)
+      {
+        *dest = m_converted_line[i];
+        
+        dest -= DISPLAY_WIDTH;
+      }
+    }
+    
+#if TRACE_DRAW_SCREEN
+    g_log_file << std::endl;
+#endif
   }
   
-  inline void
-  MachineScreen::drawing_6_pixel(uint32_t &curr_addr, uint8_t *&dest, uint32_t const row_length) const
+  void
+  MachineScreen::start_render_thread()
   {
-    SSE2_DRAW_6_PIXELS;
+    assert(0 == mp_render_thread);
     
-    curr_addr += (6 * BYTES_PER_PIXEL);
+    m_render_running = true;
+    m_render_idle = true;
+    m_render_empty_frames = 0;
+    
+    mp_render_thread = Glib::Thread::create(sigc::mem_fun(*this, &MachineScreen::render_thread),
+                                            true // joinable
+                                            );
   }
   
-  inline void
-  MachineScreen::drawing_7_pixel(uint32_t &curr_addr, uint8_t *&dest, uint32_t const row_length) const
+  void
+  MachineScreen::stop_render_thread()
   {
-    SSE2_DRAW_7_PIXELS;
+    if (0 == mp_render_thread)
+    {
+      return;
+    }
     
-    curr_addr += (7 * BYTES_PER_PIXEL);
+    {
+      Glib::Mutex::Lock lock(m_render_lock);
+      
+      m_render_running = false;
+      m_render_cond.signal();
+    }
+    
+    mp_render_thread->join();
+    mp_render_thread = 0;
   }
   
-  inline void
-  MachineScreen::drawing_8_pixel(uint32_t &curr_addr, uint8_t *&dest, uint32_t const row_length) const
+  void
+  MachineScreen::wake_render_thread()
   {
-    SSE2_DRAW_8_PIXELS;
+    Glib::Mutex::Lock lock(m_render_lock);
     
-    curr_addr += (8 * BYTES_PER_PIXEL);
+    if (true == m_render_idle)
+    {
+      m_render_idle = false;
+      m_render_empty_frames = 0;
+      
+      m_render_cond.signal();
+    }
   }
   
-#else // ENABLE_DRAWING_ASM
-  
-  inline void
-  MachineScreen::drawing_1_pixel(uint32_t &curr_addr, uint8_t *&dest, uint32_t const row_length) const
+  void
+  MachineScreen::render_thread()
   {
-    uint16_t const pixel = *reinterpret_cast<uint16_t *>(&(mp_memory[curr_addr]));
-    
-    curr_addr += BYTES_PER_PIXEL;
+    Glib::Mutex::Lock lock(m_render_lock);
     
-    *reinterpret_cast<uint32_t *>(dest) = (0xFF000000 |
-                                           mRedTable[(pixel >> RED_OFFSET) /* & RED_MAX_VALUE */] |
-                                           mGreenTable[(pixel >> GREEN_OFFSET) & GREEN_MAX_VALUE] |
-                                           mBlueTable[(pixel >> BLUE_OFFSET) & BLUE_MAX_VALUE]
-                                           );
-    
-    dest -= row_length;
+    while (true == m_render_running)
+    {
+      if (true == m_render_idle)
+      {
+        m_render_cond.wait(m_render_lock);
+      }
+      else
+      {
+        Glib::TimeVal deadline;
+        
+        deadline.assign_current_time();
+        deadline.add_milliseconds(RENDER_PERIOD);
+        
+        m_render_cond.timed_wait(m_render_lock, deadline);
+      }
+      
+      if ((false == m_render_running) || (true == m_render_idle))
+      {
+        continue;
+      }
+      
+      m_render_lcd_status = m_lcd_status;
+      m_render_frame_buffer_addr_1 = m_frame_buffer_addr_1;
+      m_render_frame_buffer_addr_2 = m_frame_buffer_addr_2;
+      
+      lock.release();
+      
+      bool const drawn = render_frame();
+      
+      lock.acquire();
+      
+      if (true == drawn)
+      {
+        m_render_empty_frames = 0;
+      }
+      else
+      {
+        ++m_render_empty_frames;
+        
+        if (m_render_empty_frames >= RENDER_IDLE_FRAMES)
+        {
+          m_render_idle = true;
+        }
+      }
+    }
   }
   
-#endif // ENABLE_DRAWING_ASM
-  
-  template<MachineScreen::PanelEnum T_panel, MachineScreen::DualPanelEnum T_dual>
-  inline void
-  MachineScreen::draw_panel()
+  // @true: something is drawn in this frame.
+  bool
+  MachineScreen::render_frame()
   {
-#if TRACE_DRAW_SCREEN
-    g_log_file << "SCREEN: drawing: ";
-#endif
+    if (0 == (m_render_lcd_status & ENABLE_DRAWING))
+    {
+      return false;
+    }
     
-    assert(mp_memory != 0);
+    collect_dirty_bitmap();
+    update_color_depth();
     
-    if (false == dirty_rect_in_this_panel<T_panel, T_dual>())
+    if (false == has_dirty_rect())
     {
-      return;
+      return false;
     }
     
-    uint32_t const machine_bpl = DISPLAY_HEIGHT * BYTES_PER_PIXEL; // bytes per line
+    switch (m_render_lcd_status & DUAL_PANEL)
+    {
+    case 0:
+      // single panel
+      draw_panel<PANEL_1, SINGLE>();
+      break;
+      
+    case DUAL_PANEL:
+      draw_panel<PANEL_1, DUAL>();
+      draw_panel<PANEL_2, DUAL>();
+      break;
+      
+    default:
+      assert(!"Should not reach here.");
+      break;
+    }
     
-    uint32_t const start_addr = (get_panel_start_address<T_panel>() +
-                                 (DISPLAY_HEIGHT * BYTES_PER_PIXEL * get_x_diff<T_panel, T_dual>()) +
-                                 (((DISPLAY_HEIGHT - m_dirty_bottom)) * BYTES_PER_PIXEL));
+    publish_frame();
     
-    uint32_t prev_addr = start_addr;
+    clear_dirty_rect();
     
-    guint8 * const pixbuf_startaddress = get_pixbuf_start_address<T_panel, T_dual>();
-    uint32_t const row_length = mp_pixbuf->get_rowstride();
+    return true;
+  }
+  
+  void
+  MachineScreen::publish_frame()
+  {
+    {
+      Glib::Mutex::Lock lock(m_frame_lock);
+      
+      for (uint32_t y = m_dirty_top; y < m_dirty_bottom; ++y)
+      {
+        memcpy(&(m_front_image[(y * DISPLAY_WIDTH) + m_dirty_left]),
+               &(m_back_image[(y * DISPLAY_WIDTH) + m_dirty_left]),
+               (m_dirty_right - m_dirty_left) * sizeof(uint32_t));
+      }
+      
+      if (m_dirty_left < m_front_left) m_front_left = m_dirty_left;
+      if (m_dirty_top < m_front_top) m_front_top = m_dirty_top;
+      if (m_dirty_right > m_front_right) m_front_right = m_dirty_right;
+      if (m_dirty_bottom > m_front_bottom) m_front_bottom = m_dirty_bottom;
+    }
     
-    uint8_t *dest_base = pixbuf_startaddress + ((m_dirty_bottom - 1) * row_length) + (m_dirty_left << 2);
+    m_frame_ready.emit();
+  }
+  
+  // The pixel size is in the bit 13-12 of the first palette entry:
+  //
+  // 00: 4-bit, 01: 8-bit, 10: 12/16-bit, 11: reserved (treated as 16-bit).
+  //
+  // Memory::mark_dirty() only knows the 16-bit layout, and a store into the
+  // palette doesn't mark anything, thus in the palettized modes, the whole
+  // screen is redrawn when anything is marked or the palette is changed.
+  void
+  MachineScreen::update_color_depth()
+  {
+    uint16_t const * const palette = reinterpret_cast<uint16_t const *>(&(mp_memory[m_render_frame_buffer_addr_1]));
     
-    uint32_t curr_addr;
-    uint8_t *dest;
+    uint32_t color_depth;
     
-#if ENABLE_DRAWING_ASM
-    uint32_t const height = (m_dirty_bottom - m_dirty_top);
+    switch ((palette[0] >> 12) & 0x3)
+    {
+    case 0: color_depth = 4; break;
+    case 1: color_depth = 8; break;
+    default: color_depth = 16; break;
+    }
     
-    uint32_t const p8_count = (height >> 3);
-    uint32_t const p1_count = (height & (8 - 1));
-#endif
+    if (color_depth != m_color_depth)
+    {
+      m_color_depth = color_depth;
+      
+      update_whole_screen();
+    }
     
-    for (uint32_t x = get_drawing_left<T_panel, T_dual>();
-         x < get_drawing_right<T_panel, T_dual>();
-         ++x)
+    if (color_depth != 16)
     {
-      curr_addr = prev_addr;
-      dest = dest_base;
+      uint32_t const entry_number = ((8 == color_depth) ? 256 : 16);
+      uint32_t lut[256];
       
-      prev_addr = curr_addr;
+      PixelConvert::build_lut(palette, entry_number, lut);
       
-#if ENABLE_DRAWING_ASM
-      for (uint32_t c8 = 0; c8 < p8_count; ++c8)
+      if ((true == has_dirty_rect()) ||
+          (memcmp(lut, m_color_lut, entry_number * sizeof(uint32_t)) != 0))
       {
-        drawing_8_pixel(curr_addr, dest, row_length);
+        memcpy(m_color_lut, lut, entry_number * sizeof(uint32_t));
+        
+        update_whole_screen();
       }
+    }
+  }
+  
+  void
+  MachineScreen::collect_dirty_bitmap()
+  {
+    for (uint32_t i = 0; i < ((DIRTY_UNIT_NUMBER + 31) >> 5); ++i)
+    {
+      if (0 == m_dirty_bitmap[i])
+      {
+        continue;
+      }
+      
+      uint32_t bits = atomic_exchange(&(m_dirty_bitmap[i]), 0);
       
-      switch (p1_count)
+      for (uint32_t idx = (i << 5); bits != 0; ++idx, bits >>= 1)
       {
-      case 0: break;
-      case 1: drawing_1_pixel(curr_addr, dest, row_length); break;
-      case 2: drawing_2_pixel(curr_addr, dest, row_length); break;
-      case 3: drawing_3_pixel(curr_addr, dest, row_length); break;
-      case 4: drawing_4_pixel(curr_addr, dest, row_length); break;
-      case 5: drawing_5_pixel(curr_addr, dest, row_length); break;
-      case 6: drawing_6_pixel(curr_addr, dest, row_length); break;
-      case 7: drawing_7_pixel(curr_addr, dest, row_length); break;
-      default: assert(!"Should not reach here."); break;
+        if (0 == (bits & 1))
+        {
+          continue;
+        }
+        
+        // The first pixel of a frame buffer line is at the bottom of the
+        // screen, see Memory::mark_dirty().
+        uint32_t const x = (idx / DIRTY_UNITS_PER_LINE);
+        uint32_t const first_pixel = ((idx % DIRTY_UNITS_PER_LINE) * DIRTY_UNIT_PIXELS);
+        
+        update_dirty_point(x, DISPLAY_HEIGHT - first_pixel - 1);
+        update_dirty_point(x, DISPLAY_HEIGHT - first_pixel - DIRTY_UNIT_PIXELS);
       }
-#else
-      for (uint32_t y = m_dirty_top; y < m_dirty_bottom; ++y)
+    }
+  }
+  
+  bool
+  MachineScreen::has_dirty_unit() const
+  {
+    for (uint32_t i = 0; i < ((DIRTY_UNIT_NUMBER + 31) >> 5); ++i)
+    {
+      if (m_dirty_bitmap[i] != 0)
       {
-        drawing_1_pixel(curr_addr, dest, row_length);
+        return true;
       }
-#endif
-      
-      dest_base += 4;
-      prev_addr += machine_bpl;
     }
     
-#if ENABLE_DRAWING_ASM
-    asm volatile ("emms");
-#endif
-    
-#if TRACE_DRAW_SCREEN
-    g_log_file << std::endl;
-#endif
-    
-    mp_pixmap->draw_pixbuf(mp_empty_gc,
-                           mp_pixbuf,
-                           m_dirty_left, m_dirty_top, // src
-                           m_dirty_left, m_dirty_top, // dest
-                           static_cast<int>(m_dirty_right - m_dirty_left),
-                           static_cast<int>(m_dirty_bottom - m_dirty_top),
-                           Gdk::RGB_DITHER_NONE,
-                           0, 0 // dither offset
-                           );
-    
-    // Force X Window Server to send an expose event to the m_drawing_area.
-    m_drawing_area.get_window()->clear_area_e(m_dirty_left,
-                                              m_dirty_top,
-                                              m_dirty_right - m_dirty_left,
-                                              m_dirty_bottom - m_dirty_top);
+    return false;
+  }
+  
+  void
+  MachineScreen::mark_dirty_units(uint32_t const begin, uint32_t const end)
+  {
+    for (uint32_t idx = begin; idx < end; ++idx)
+    {
+      mark_dirty_unit(idx);
+    }
   }
   
   //============================ Signal handler ================================
@@ -727,15 +615,101 @@ namespace ARMware
     mp_atmel->receive_touch_panel_pen_move_event(event);
   }
   
+  void
+  MachineScreen::on_frame_ready()
+  {
+    uint32_t left;
+    uint32_t top;
+    uint32_t right;
+    uint32_t bottom;
+    
+    {
+      Glib::Mutex::Lock lock(m_frame_lock);
+      
+      if (m_front_left >= m_front_right)
+      {
+        return;
+      }
+      
+      left = m_front_left;
+      top = m_front_top;
+      right = m_front_right;
+      bottom = m_front_bottom;
+      
+      m_front_left = DISPLAY_WIDTH;
+      m_front_top = DISPLAY_HEIGHT;
+      m_front_right = 0;
+      m_front_bottom = 0;
+      
+      // A frame rendered before disable_drawing() is dropped. m_render_lock
+      // is only ever taken inside m_frame_lock, never the reverse.
+      bool drawing;
+      
+      {
+        Glib::Mutex::Lock render_lock(m_render_lock);
+        
+        drawing = (ENABLE_DRAWING == (m_lcd_status & m_render_lcd_status & ENABLE_DRAWING));
+      }
+      
+      if ((false == drawing) || (false == mp_pixbuf))
+      {
+        return;
+      }
+      
+      guint8 * const pixels = mp_pixbuf->get_pixels();
+      uint32_t const row_length = mp_pixbuf->get_rowstride();
+      
+      for (uint32_t y = top; y < bottom; ++y)
+      {
+        memcpy(pixels + (y * row_length) + (left << 2),
+               &(m_front_image[(y * DISPLAY_WIDTH) + left]),
+               (right - left) * sizeof(uint32_t));
+      }
+    }
+    
+    mp_pixmap->draw_pixbuf(mp_empty_gc,
+                           mp_pixbuf,
+                           left, top, // src
+                           left, top, // dest
+                           static_cast<int>(right - left),
+                           static_cast<int>(bottom - top),
+                           Gdk::RGB_DITHER_NONE,
+                           0, 0 // dither offset
+                           );
+    
+    // Force X Window Server to send an expose event to the m_drawing_area.
+    m_drawing_area.get_window()->clear_area_e(left,
+                                              top,
+                                              right - left,
+                                              bottom - top);
+  }
+  
   ///////////////////////////////// Public ////////////////////////////////////
   //============================== Life cycle =================================
   
   MachineScreen::MachineScreen()
     : m_table(1, 1, true),
       m_lcd_status(0),
+      m_frame_buffer_addr_1(0),
+      m_frame_buffer_addr_2(0),
+      mp_render_thread(0),
+      m_render_running(false),
+      m_render_idle(true),
+      m_render_empty_frames(0),
+      m_render_lcd_status(0),
+      m_render_frame_buffer_addr_1(0),
+      m_render_frame_buffer_addr_2(0),
+      m_snapshot(DISPLAY_WIDTH * DISPLAY_HEIGHT * BYTES_PER_PIXEL),
+      m_back_image(DISPLAY_WIDTH * DISPLAY_HEIGHT),
+      m_front_image(DISPLAY_WIDTH * DISPLAY_HEIGHT),
+      m_front_left(DISPLAY_WIDTH),
+      m_front_top(DISPLAY_HEIGHT),
+      m_front_right(0),
+      m_front_bottom(0),
       mp_memory(0),
       mp_LCD_controller(0),
-      mp_atmel(0)
+      mp_atmel(0),
+      m_color_depth(DISPLAY_DEPTH)
   {
     set_policy(Gtk::POLICY_AUTOMATIC, Gtk::POLICY_AUTOMATIC);
     
@@ -750,27 +724,19 @@ namespace ARMware
     m_drawing_area.signal_expose_event().
       connect_notify(sigc::mem_fun(*this, &MachineScreen::on_drawing_area_expose_event));
     
+    m_frame_ready.connect(sigc::mem_fun(*this, &MachineScreen::on_frame_ready));
+    
     show_all_children();
     
     clear_dirty_rect();
     
-#if ENABLE_DRAWING_ASM
-    m_red_bitmask.m_low = 0xF800F800F800F800LL;
-    m_red_bitmask.m_high = m_red_bitmask.m_low;
-    
-    m_green_bitmask.m_low = 0x07E007E007E007E0LL;
-    m_green_bitmask.m_high = m_green_bitmask.m_low;
-    
-    m_blue_bitmask.m_low = 0x001F001F001F001FLL;
-    m_blue_bitmask.m_high = m_blue_bitmask.m_low;
-    
-    m_alpha_value.m_low = 0xFFFFFFFFFFFFFFFFLL;
-    m_alpha_value.m_high = 0;
-#endif
+    memset(m_dirty_bitmap, 0, sizeof(m_dirty_bitmap));
   }
   
   MachineScreen::~MachineScreen()
   {
+    stop_render_thread();
+    
     if (false == mp_pixmap)
     {
       mp_pixmap.clear();
@@ -803,6 +769,21 @@ namespace ARMware
       connect_notify(sigc::mem_fun(*this, &MachineScreen::on_drawing_area_motion_notify_event));
   }
   
+  // The render thread reads the guest DRAM directly, thus it lives as long as
+  // the memory is registered.
+  void
+  MachineScreen::register_memory(uint8_t * const memory)
+  {
+    stop_render_thread();
+    
+    mp_memory = memory;
+    
+    if (memory != 0)
+    {
+      start_render_thread();
+    }
+  }
+  
   void
   MachineScreen::get_and_store_next_armware_event()
   {
@@ -815,43 +796,20 @@ namespace ARMware
     m_drawing_area.set_size_request(width, height);
   }
   
+  // Called from the GTK main loop 10 times per second on the emulation
+  // thread. The screen is drawn by the render thread, here I only complete
+  // one LCD frame and wake the render thread up when the screen is changed.
   bool
-  MachineScreen::draw_screen()
+  MachineScreen::finish_frame()
   {
-    switch (m_lcd_status)
+    if (ENABLE_DRAWING == (m_lcd_status & ENABLE_DRAWING))
     {
-    case 0:
-    case DUAL_PANEL:
-      // disable drawing
-      break;
-      
-    case ENABLE_DRAWING:
-      // single panel
-      if (true == has_dirty_rect())
-      {
-        draw_panel<PANEL_1, SINGLE>();
-        
-        clear_dirty_rect();
-      }
-      
-      mp_LCD_controller->finish_one_frame();
-      break;
-      
-    case (ENABLE_DRAWING | DUAL_PANEL):
-      if (true == has_dirty_rect())
+      if (true == has_dirty_unit())
       {
-        draw_panel<PANEL_1, DUAL>();
-        draw_panel<PANEL_2, DUAL>();
-        
-        clear_dirty_rect();
+        wake_render_thread();
       }
       
       mp_LCD_controller->finish_one_frame();
-      break;
-      
-    default:
-      assert(!"Should not reach here.");
-      break;
     }
     
     // :NOTE: Wei 2004-Jun-29:
@@ -26,6 +26,7 @@
 #endif
 
 #include <cassert>
+#include <vector>
 
 #if WIN32
 #pragma warning(disable: 4250)
@@ -35,6 +36,9 @@
 #include <gtkmm/drawingarea.h>
 #include <gtkmm/table.h>
 
+#include <glibmm/dispatcher.h>
+#include <glibmm/thread.h>
+
 // LOCAL INCLUDE
 //
 
@@ -50,6 +54,17 @@ namespace ARMware
   class LCDController;
   class AtmelMicro;
   
+  // The screen is rendered by a render thread:
+  //
+  // The emulation thread only sets bits in m_dirty_bitmap. The render thread
+  // copies the dirty part of the frame buffer from the guest DRAM into
+  // m_snapshot, converts it into m_back_image, and then copies that part into
+  // m_front_image and notifies the GTK thread through m_frame_ready.
+  // The GTK thread only blits m_front_image into the pixbuf.
+  //
+  // The render thread runs once every RENDER_PERIOD ms (60 Hz) while
+  // the screen is changing, after RENDER_IDLE_FRAMES frames without any
+  // change it sleeps until finish_frame() finds a dirty bit.
   typedef class MachineScreen MachineScreen;
   class MachineScreen : public Gtk::ScrolledWindow
   {
@@ -77,6 +92,9 @@ namespace ARMware
       DUAL_PANEL = 0x2
     };
     
+    static uint32_t const RENDER_PERIOD = (1000 / 60);
+    static uint32_t const RENDER_IDLE_FRAMES = 6;
+    
     // Attribute
     
     Gtk::DrawingArea m_drawing_area;
@@ -86,11 +104,42 @@ namespace ARMware
     Glib::RefPtr<Gdk::Pixmap> mp_pixmap;
     Glib::RefPtr<Gdk::GC> mp_empty_gc;
     
+    // m_lcd_status & m_frame_buffer_addr_* are written by the emulation
+    // thread with m_render_lock held, the render thread copies them into
+    // m_render_* at the beginning of each frame.
     uint32_t m_lcd_status;
     
     uint32_t m_frame_buffer_addr_1;
     uint32_t m_frame_buffer_addr_2;
     
+    Glib::Thread *mp_render_thread;
+    Glib::Mutex m_render_lock;
+    Glib::Cond m_render_cond;
+    bool m_render_running;
+    bool m_render_idle;
+    uint32_t m_render_empty_frames;
+    
+    uint32_t m_render_lcd_status;
+    uint32_t m_render_frame_buffer_addr_1;
+    uint32_t m_render_frame_buffer_addr_2;
+    
+    // m_snapshot has the same layout as the frame buffer,
+    // m_back_image & m_front_image have the same layout as the pixbuf.
+    std::vector<uint8_t> m_snapshot;
+    std::vector<uint32_t> m_back_image;
+    
+    Glib::Mutex m_frame_lock;
+    std::vector<uint32_t> m_front_image;
+    
+    // The part of m_front_image which is not blitted yet.
+    uint32_t m_front_left;
+    uint32_t m_front_top;
+    uint32_t m_front_right;
+    uint32_t m_front_bottom;
+    
+    Glib::Dispatcher m_frame_ready;
+    
+    // The dirty rectangle below is only used by the render thread.
     uint32_t m_dirty_left;
     uint32_t m_dirty_top;
     
@@ -115,60 +164,13 @@ namespace ARMware
     LCDController *mp_LCD_controller;
     AtmelMicro *mp_atmel;
     
-#if ENABLE_DRAWING_ASM
-    struct
-    {
-      uint64_t m_low __attribute__ ((aligned (16)));
-      uint64_t m_high __attribute__ ((packed));
-    } m_red_bitmask;
-    
-    struct
-    {
-      uint64_t m_low __attribute__ ((aligned (16)));
-      uint64_t m_high __attribute__ ((packed));
-    } m_green_bitmask;
-    
-    struct
-    {
-      uint64_t m_low __attribute__ ((aligned (16)));
-      uint64_t m_high __attribute__ ((packed));
-    } m_blue_bitmask;
-    
-    struct
-    {
-      uint64_t m_low __attribute__((aligned (16)));
-      uint64_t m_high __attribute__((packed));
-    } m_alpha_value;
-#endif
-    
 #if CONFIG_MACH_H3600
-    static uint32_t const DISPLAY_DEPTH = 16;
-    
     // :NOTE: Wei 2004-Jan-15:
     //
     // The LCD controller of H3600 is programmed in 16-bit TFT mode.
     //
     // rrrr rggg gggb bbbb
-    //
-    // Thus...
-    //
-    // the red color offset is 12
-    // the green color offset is 7
-    // the blue color offset is 1
-    static uint32_t const RED_OFFSET = 12;
-    static uint32_t const GREEN_OFFSET = 7;
-    static uint32_t const BLUE_OFFSET = 1;
-    
-    // :NOTE: Wei 2004-Jan-15:
-    //
-    // Althought the LCD controller of H3600 is programmed in 16-bit TFT mode,
-    // but the TFT LCD uses the most highest 4 bit for each color(RGB).
-    // That makes a total of 4096 colors.
-    //
-    // Thus the max values of red, green, blue are 15 (=0xF)
-    static uint32_t const RED_MAX_VALUE = 0xF;
-    static uint32_t const GREEN_MAX_VALUE = 0xF;
-    static uint32_t const BLUE_MAX_VALUE = 0xF;
+    static uint32_t const DISPLAY_DEPTH = 16;
 #endif
     
     // Operation
@@ -181,26 +183,29 @@ namespace ARMware
     template<PanelEnum T_panel>
     uint32_t get_panel_start_address() const;
     
-    template<PanelEnum T_panel, DualPanelEnum T_dual>
-    guint8 *get_pixbuf_start_address() const;
-    
     template<PanelEnum T_panel, DualPanelEnum T_dual>
     uint32_t get_drawing_left() const;
     
     template<PanelEnum T_panel, DualPanelEnum T_dual>
     uint32_t get_drawing_right() const;
     
-    void drawing_1_pixel(uint32_t &curr_addr, uint8_t *&dest, uint32_t const row_length) const;
+    void start_render_thread();
+    void stop_render_thread();
+    void wake_render_thread();
     
-#if ENABLE_DRAWING_ASM
-    void drawing_2_pixel(uint32_t &curr_addr, uint8_t *&dest, uint32_t const row_length) const;
-    void drawing_3_pixel(uint32_t &curr_addr, uint8_t *&dest, uint32_t const row_length) const;
-    void drawing_4_pixel(uint32_t &curr_addr, uint8_t *&dest, uint32_t const row_length) const;
-    void drawing_5_pixel(uint32_t &curr_addr, uint8_t *&dest, uint32_t const row_length) const;
-    void drawing_6_pixel(uint32_t &curr_addr, uint8_t *&dest, uint32_t const row_length) const;
-    void drawing_7_pixel(uint32_t &curr_addr, uint8_t *&dest, uint32_t const row_length) const;
-    void drawing_8_pixel(uint32_t &curr_addr, uint8_t *&dest, uint32_t const row_length) const;
-#endif
+    void render_thread();
+    bool render_frame();
+    void publish_frame();
+    
+    void update_color_depth();
+    
+    // SA-1110 Developer's Manual, p.247:
+    //
+    // The palette buffer has 256 entries in 8-bit pixel mode,
+    // and 16 entries in the others.
+    inline uint32_t
+    get_palette_size() const
+    { return ((8 == m_color_depth) ? (256 * 2) : PALETTE_OFFSET); }
     
     inline void
     clear_dirty_rect()
@@ -275,35 +280,6 @@ namespace ARMware
       }
     }
     
-    template<PanelEnum T_panel, DualPanelEnum T_dual>
-    inline uint32_t
-    get_x_diff() const
-    {
-      switch (T_dual)
-      {
-      case SINGLE:
-        return m_dirty_left;
-        
-      case DUAL:
-        switch (T_panel)
-        {
-        case PANEL_1:
-          return m_dirty_left;
-          
-        case PANEL_2:
-          return m_dirty_left - (DISPLAY_WIDTH >> 1);
-          
-        default:
-          assert(!"Should not reach here.");
-          return 0;
-        }
-        
-      default:
-        assert(!"Should not reach here.");
-        return 0;
-      }
-    }
-    
     // Signal handler
     
     void on_drawing_area_size_allocate(Gtk::Allocation &alloc);
@@ -313,6 +289,8 @@ namespace ARMware
     void on_drawing_area_button_release_event(GdkEventButton *event);
     void on_drawing_area_motion_notify_event(GdkEventMotion *event);
     
+    void on_frame_ready();
+    
   public:
     
 #if CONFIG_MACH_H3600
@@ -322,6 +300,42 @@ namespace ARMware
     static uint32_t const PALETTE_OFFSET = 32; // 32 bytes of "dummy" palette
 #endif
     
+    // A store into the frame buffer only sets one bit in m_dirty_bitmap,
+    // each bit covers DIRTY_UNIT_SIZE bytes (the SA-1110 cache line size).
+    //
+    // The frame buffer of H3600 is rotated, one DISPLAY_HEIGHT-pixel line in
+    // the frame buffer is one column (x) on the screen, thus each line
+    // consists of DIRTY_UNITS_PER_LINE units, and each unit covers
+    // DIRTY_UNIT_PIXELS pixels of that column.
+    //
+    // The bitmap is converted into the dirty rectangle once per frame by the
+    // render thread, which takes each word out by an atomic exchange, thus a
+    // bit set by the emulation thread at the same time is never lost.
+    static uint32_t const DIRTY_UNIT_SHIFT = 5;
+    static uint32_t const DIRTY_UNIT_SIZE = (1 << DIRTY_UNIT_SHIFT);
+    static uint32_t const DIRTY_UNIT_PIXELS = (DIRTY_UNIT_SIZE / BYTES_PER_PIXEL);
+    static uint32_t const DIRTY_UNITS_PER_LINE = ((DISPLAY_HEIGHT * BYTES_PER_PIXEL) / DIRTY_UNIT_SIZE);
+    static uint32_t const DIRTY_UNIT_NUMBER = (DISPLAY_WIDTH * DIRTY_UNITS_PER_LINE);
+    
+  private:
+    
+    uint32_t m_dirty_bitmap[(DIRTY_UNIT_NUMBER + 31) >> 5];
+    
+    // The pixel size of the current frame (4, 8 or 16), which is read from
+    // the first palette entry once per frame, and the LUT built from the
+    // palette when it is 4 or 8.
+    uint32_t m_color_depth;
+    uint32_t m_color_lut[256];
+    
+    // One frame buffer line converted by g_pixel_convert.
+    uint32_t m_converted_line[DISPLAY_HEIGHT];
+    
+    void collect_dirty_bitmap();
+    bool has_dirty_unit() const;
+    void mark_dirty_units(uint32_t const begin, uint32_t const end);
+    
+  public:
+    
     enum PenDownTimes
     {
       PEN_DOWN_FIRST,
@@ -339,7 +353,15 @@ namespace ARMware
     void change_screen_size(uint32_t const width, uint32_t const height);
     
     void get_and_store_next_armware_event();
-    bool draw_screen();
+    bool finish_frame();
+    
+    inline void
+    mark_dirty_unit(uint32_t const idx)
+    {
+      assert(idx < DIRTY_UNIT_NUMBER);
+      
+      m_dirty_bitmap[idx >> 5] |= (1 << (idx & 31));
+    }
     
     inline void
     update_dirty_point(uint32_t const x, uint32_t const y)
@@ -382,17 +404,15 @@ namespace ARMware
     {
       if (PANEL_1 == T_panel)
       {
-        m_dirty_left = 0;
-        
         switch (m_lcd_status & DUAL_PANEL)
         {
         case 0:
           // singal panel
-          m_dirty_right = DISPLAY_WIDTH;
+          mark_dirty_units(0, DIRTY_UNIT_NUMBER);
           break;
           
         case DUAL_PANEL:
-          m_dirty_right = (DISPLAY_WIDTH >> 1);
+          mark_dirty_units(0, (DIRTY_UNIT_NUMBER >> 1));
           break;
           
         default:
@@ -402,26 +422,30 @@ namespace ARMware
       }
       else
       {
-        m_dirty_left = (DISPLAY_WIDTH >> 1);
-        m_dirty_right = DISPLAY_WIDTH;
+        mark_dirty_units((DIRTY_UNIT_NUMBER >> 1), DIRTY_UNIT_NUMBER);
       }
-      
-      m_dirty_top = 0;
-      m_dirty_bottom = DISPLAY_HEIGHT;
     }
     
     inline void
     enable_drawing()
     {
-      m_lcd_status |= ENABLE_DRAWING;
+      {
+        Glib::Mutex::Lock lock(m_render_lock);
+        
+        m_lcd_status |= ENABLE_DRAWING;
+      }
       
-      update_whole_screen();
+      mark_dirty_units(0, DIRTY_UNIT_NUMBER);
     }
     
     inline void
     disable_drawing()
     {
-      m_lcd_status &= ~ENABLE_DRAWING;
+      {
+        Glib::Mutex::Lock lock(m_render_lock);
+        
+        m_lcd_status &= ~ENABLE_DRAWING;
+      }
       
       // Clear the pixbuf's buffer to black
       //
@@ -448,15 +472,21 @@ namespace ARMware
     
     inline void
     enable_dual_panel()
-    { m_lcd_status |= DUAL_PANEL; }
+    {
+      Glib::Mutex::Lock lock(m_render_lock);
+      
+      m_lcd_status |= DUAL_PANEL;
+    }
     
     inline void
     disable_dual_panel()
-    { m_lcd_status &= ~DUAL_PANEL; }
+    {
+      Glib::Mutex::Lock lock(m_render_lock);
+      
+      m_lcd_status &= ~DUAL_PANEL;
+    }
     
-    inline void
-    register_memory(uint8_t * const memory)
-    { mp_memory = memory; }
+    void register_memory(uint8_t * const memory);
     
     inline void
     register_LCD_controller(LCDController * const LCD_controller)
@@ -474,7 +504,12 @@ namespace ARMware
       //
       // The palette buffer, which resides within the first 16 or 256 entries of the frame buffer,
       // is utilized only by DMA channel 1.
-      m_frame_buffer_addr_1 = ((address - MachineType::DRAM_BASE) + PALETTE_OFFSET);
+      //
+      // Thus m_frame_buffer_addr_1 points to the palette, and the size of
+      // the palette is skipped in get_panel_start_address().
+      Glib::Mutex::Lock lock(m_render_lock);
+      
+      m_frame_buffer_addr_1 = (address - MachineType::DRAM_BASE);
     }
     
     inline void
@@ -483,6 +518,8 @@ namespace ARMware
       assert((address >= MachineType::DRAM_BASE) &&
              (address <= (MachineType::DRAM_BASE + MachineType::DRAM_SIZE)));
       
+      Glib::Mutex::Lock lock(m_render_lock);
+      
       m_frame_buffer_addr_2 = (address - MachineType::DRAM_BASE);
     }
   };
@@ -16,15 +16,23 @@
 //
 
 #include <cstdlib> // for EXIT_SUCCESS
+#include <cstring>
 
 #if WIN32
 #pragma warning(disable: 4250)
 #endif
 
+#include <glibmm/thread.h>
 #include <gtkmm/main.h>
 #include <gtkmm/window.h>
 
 #include "MainWindow.hpp"
+#include "../Utils/ChunkCorpusReplay.hpp"
+#include "../Utils/FastMemBenchmark.hpp"
+#include "../Utils/HeadlessCapture.hpp"
+#include "../Utils/RomBuilder.hpp"
+#include "../Utils/SerialBenchmark.hpp"
+#include "../Utils/ShadowTlbCheck.hpp"
 
 #if WIN32
 // for gettext
@@ -38,6 +46,50 @@ main(int argc, char *argv[])
   bind_textdomain_codeset("armware", "UTF-8");
   textdomain("armware");
   
+  // Build a flash ROM image without the GUI, for the provisioning scripts.
+  if ((argc >= 2) && (0 == strcmp(argv[1], "--build-rom")))
+  {
+    return ARMware::RomBuilder::command_line(argc - 2, argv + 2);
+  }
+  
+  // Check the shadow TLB against page tables changed behind it, without
+  // the GUI and without a guest.
+  if ((argc >= 2) && (0 == strcmp(argv[1], "--check-shadow-tlb")))
+  {
+    return ARMware::ShadowTlbCheck::command_line(argc - 2, argv + 2);
+  }
+  
+  // Compare FastMem with the TLB path, without the GUI and without a guest.
+  if ((argc >= 2) && (0 == strcmp(argv[1], "--fastmem-benchmark")))
+  {
+    return ARMware::FastMemBenchmark::command_line(argc - 2, argv + 2);
+  }
+  
+  // MachineScreen draws the screen, and SerialHost services the serial
+  // ports attached to the host, in other threads.
+  if (false == Glib::thread_supported())
+  {
+    Glib::thread_init();
+  }
+  
+  if ((argc >= 2) && (0 == strcmp(argv[1], "--serial-benchmark")))
+  {
+    return ARMware::SerialBenchmark::command_line(argc - 2, argv + 2);
+  }
+  
+  // Replay a chunk corpus through the dynamic compiler without a guest and
+  // without the GUI.
+  if ((argc >= 2) && (0 == strcmp(argv[1], "--replay-chunk-corpus")))
+  {
+    return ARMware::ChunkCorpusReplay::command_line(argc - 2, argv + 2);
+  }
+  
+  // Capture the frames of a machine without the GUI and without a display.
+  if ((getenv("ARMWARE_CAPTURE") != 0) && (getenv("ARMWARE_CAPTURE_MACHINE") != 0))
+  {
+    return ARMware::HeadlessCapture::run(getenv("ARMWARE_CAPTURE_MACHINE"));
+  }
+  
   Gtk::Main kit(argc, argv);
   
   ARMware::MainWindow window;
@@ -117,7 +117,11 @@ namespace ARMware
       m_machine_screen.unreference();
       
       start_machine(mCurrMachine, &m_machine_screen,
-                    &m_soft_keyboard, *mp_serial_console);
+                    &m_soft_keyboard, mp_serial_console);
+      
+      // The machine only stops by itself in a batch mode (Ex: the frame
+      // capture), quit ARMware then, the same as File -> Exit.
+      hide();
     }
     else
     {
@@ -744,8 +748,11 @@ namespace ARMware
     // :NOTE: Wei 2004-Jun-29:
     //
     // re-drawing the screen 10 times per second.
+    //
+    // The screen is drawn by the render thread of m_machine_screen now,
+    // this only completes one LCD frame and wakes that thread up.
     Glib::signal_timeout().connect(sigc::mem_fun(&m_machine_screen,
-                                                 &MachineScreen::draw_screen), 1000 / 10);
+                                                 &MachineScreen::finish_frame), 1000 / 10);
   }
   
   MainWindow::~MainWindow()
@@ -15,7 +15,6 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 //
 
-#include <fstream>
 #include <sstream>
 
 #if WIN32
@@ -32,10 +31,51 @@
 
 #include "PartitionView.hpp"
 #include "ProgressDialog.hpp"
+#include "../Utils/RomBuilder.hpp"
 #include "compose/ucompose.hpp"
 
 namespace ARMware
 {
+  namespace
+  {
+    // RomBuilder reports once per copied block, thus the GTK events are
+    // also handled once per block instead of once per byte.
+    typedef class DialogProgress DialogProgress;
+    class DialogProgress : public RomBuilder::Progress
+    {
+    private:
+      
+      ProgressDialog &m_dialog;
+      std::string m_image_file;
+      
+    public:
+      
+      DialogProgress(ProgressDialog &dialog)
+        : m_dialog(dialog)
+      { }
+      
+      virtual bool
+      report(std::string const &image_file, double const fraction)
+      {
+        if (image_file != m_image_file)
+        {
+          m_image_file = image_file;
+          
+          m_dialog.set_text(image_file);
+        }
+        
+        m_dialog.set_fraction(fraction);
+        
+        while (true == Gtk::Main::events_pending())
+        {
+          Gtk::Main::iteration(false);
+        }
+        
+        return (false == m_dialog.is_cancel());
+      }
+    };
+  }
+  
   ///////////////////////////////// Private ///////////////////////////////////
   //======================= Cell renderer data func ===========================
   
@@ -237,84 +277,59 @@ namespace ARMware
   void
   PartitionView::create_rom(Glib::ustring const &rom_file)
   {
-    std::ofstream ofs(rom_file.c_str(), std::ios::binary | std::ios::trunc);
-    int8_t ch;
-    uint32_t input_file_size;
-    uint32_t fraction_base;
-    uint32_t read_count;
+    RomBuilder rom_builder(rom_file);
     uint32_t addr;
     std::stringstream s;
     
-    ProgressDialog progress_dialog(gettext("Burning Flash ROM"), *(dynamic_cast<Gtk::Window *>(get_toplevel())));
-    progress_dialog.show();
-    
     for (Gtk::TreeModel::iterator iter = get_model()->children().begin();
          iter != get_model()->children().end();
          ++iter)
     {
       Gtk::TreeRow row = *iter;
       
-      std::ifstream ifs(static_cast<Glib::ustring>(row[m_model_columns.m_col_file]).c_str(), std::ios::binary);
-      
-      ifs.seekg(0, std::ios::end);
-      input_file_size = std::streamoff(ifs.tellg());
-      ifs.seekg(0, std::ios::beg);
-      
-      fraction_base = input_file_size / 100;
-      
       s << static_cast<Glib::ustring>(row[m_model_columns.m_col_addr]).c_str();
       s >> std::hex >> addr;
       
-      ofs.seekp(static_cast<std::fstream::pos_type>(addr));
-      
       s.clear();
       s.str("");
       
-      ch = ifs.get();
-      
-      read_count = 0;
-      
-      progress_dialog.set_text(static_cast<Glib::ustring>(row[m_model_columns.m_col_file]));
-      progress_dialog.set_fraction(0.0);
-      
-      while (ifs.eof() != true)
+      rom_builder.add_partition(addr, static_cast<Glib::ustring>(row[m_model_columns.m_col_file]));
+    }
+    
+    ProgressDialog progress_dialog(gettext("Burning Flash ROM"), *(dynamic_cast<Gtk::Window *>(get_toplevel())));
+    progress_dialog.show();
+    
+    DialogProgress progress(progress_dialog);
+    
+    switch (rom_builder.build(&progress))
+    {
+    case RomBuilder::RESULT_DONE:
       {
-        Gtk::Main::iteration(false);
+        Gtk::MessageDialog done_dialog(progress_dialog,
+                                       String::ucompose(gettext("Burning %1 done."), rom_file),
+                                       false, Gtk::MESSAGE_INFO, Gtk::BUTTONS_OK);
         
-        ofs << ch;
-        ch = ifs.get();
-        
-        ++read_count;
-        
-        if (0 == (read_count % fraction_base))
-        {
-          // :NOTE: Wei 2004-Jun-02:
-          //
-          // The following statement can be optimized below.
-          //
-          //dialog.set_fraction(0.01 * (read_count / fraction_base));
-          progress_dialog.set_fraction(static_cast<double>(read_count) / static_cast<double>(input_file_size));
-        }
+        done_dialog.run();
+      }
+      break;
+      
+    case RomBuilder::RESULT_INPUT_ERROR:
+    case RomBuilder::RESULT_OUTPUT_ERROR:
+      {
+        Gtk::MessageDialog error_dialog(progress_dialog,
+                                        String::ucompose(gettext("Burning %1 failed: %2 can not be accessed."),
+                                                         rom_file,
+                                                         rom_builder.error_file()),
+                                        false, Gtk::MESSAGE_ERROR, Gtk::BUTTONS_OK);
         
-        if (true == progress_dialog.is_cancel())
-        {
-          progress_dialog.hide();
-          ifs.close();
-          ofs.close();
-          return;
-        }
+        error_dialog.run();
       }
+      break;
       
-      ifs.close();
+    case RomBuilder::RESULT_CANCEL:
+      progress_dialog.hide();
+      break;
     }
-    
-    ofs.close();
-    
-    Gtk::MessageDialog done_dialog(progress_dialog,
-                                   String::ucompose(gettext("Burning %1 done."), rom_file),
-                                   false, Gtk::MESSAGE_INFO, Gtk::BUTTONS_OK);
-    
-    done_dialog.run();
   }
   
   Glib::ustring
@@ -22,6 +22,9 @@
 #pragma warning(disable: 4250)
 #endif
 
+#include <cstdlib>
+
+#include <glibmm/main.h>
 #include <gtkmm/stock.h>
 #include <gtkmm/textview.h>
 #include <gtkmm/entry.h>
@@ -57,6 +60,56 @@ namespace ARMware
     mp_input_entry->set_text(Glib::ustring());
   }
   
+  bool
+  SerialConsole::on_flush_timeout()
+  {
+    uint8_t const *first;
+    uint8_t const *second;
+    uint32_t first_size;
+    uint32_t size = m_output_fifo.read_spans(first, first_size, second);
+    
+    std::string text(reinterpret_cast<char const *>(first), first_size);
+    
+    text.append(reinterpret_cast<char const *>(second), size - first_size);
+    
+    // Gtk::TextBuffer takes "\r\n" as one line break, but a "\r" and a "\n"
+    // inserted separately as two, thus a trailing "\r" waits for the next
+    // flush to see whether a "\n" follows.
+    if ((size > 1) && ('\r' == text[size - 1]))
+    {
+      --size;
+      
+      text.erase(size);
+    }
+    
+    m_output_fifo.consume(size);
+    
+    if (size != 0)
+    {
+      mp_textbuffer->insert(mp_textbuffer->end(), text);
+      
+      if (m_scrollback_lines != 0)
+      {
+        int const line_count = mp_textbuffer->get_line_count();
+        
+        if (line_count > static_cast<int>(m_scrollback_lines))
+        {
+          mp_textbuffer->erase(mp_textbuffer->begin(),
+                               mp_textbuffer->get_iter_at_line(line_count - m_scrollback_lines));
+        }
+      }
+    }
+    
+    if (true == m_tee_file.is_open())
+    {
+      m_tee_file.flush();
+    }
+    
+    // @false: disconnect, put_char_to_serial_console() connects me again
+    // when there is more output.
+    return (false == m_output_fifo.empty());
+  }
+  
   /////////////////////////////////////////////////////////////////////////////
   // Public == Life cycle =====================================================
   
@@ -65,8 +118,31 @@ namespace ARMware
       mp_input_entry(Gtk::manage(new Gtk::Entry())),
       mp_input_label(Gtk::manage(new Gtk::Label(gettext("Input here: ")))),
       mp_input_hbox(Gtk::manage(new Gtk::HBox())),
-      m_need_append_more(false)
+      m_flush_period(1000 / DEFAULT_FLUSH_RATE),
+      m_scrollback_lines(DEFAULT_SCROLLBACK_LINES),
+      mp_rx_fifo(0)
   {
+    char const * const flush_rate = getenv("ARMWARE_CONSOLE_FLUSH_RATE");
+    
+    if ((flush_rate != 0) && (strtoul(flush_rate, 0, 10) != 0))
+    {
+      m_flush_period = 1000 / strtoul(flush_rate, 0, 10);
+    }
+    
+    char const * const scrollback = getenv("ARMWARE_CONSOLE_SCROLLBACK");
+    
+    if (scrollback != 0)
+    {
+      m_scrollback_lines = strtoul(scrollback, 0, 10);
+    }
+    
+    char const * const tee_file = getenv("ARMWARE_CONSOLE_TEE");
+    
+    if (tee_file != 0)
+    {
+      m_tee_file.open(tee_file, std::ios_base::out | std::ios_base::binary | std::ios_base::app);
+    }
+    
     mp_textbuffer = Gtk::TextBuffer::create();
     
     Gtk::TextView * const p_textview = Gtk::manage(new Gtk::TextView());
@@ -93,4 +169,52 @@ namespace ARMware
     
     show_all_children();
   }
+  
+  /////////////////////////////////////////////////////////////////////////////
+  // Public == Operation ======================================================
+  
+  void
+  SerialConsole::put_char_to_serial_console(UartFifo &tx_fifo)
+  {
+    uint8_t const *span;
+    uint32_t size;
+    
+    while ((size = tx_fifo.read_span(span)) != 0)
+    {
+      if (true == m_tee_file.is_open())
+      {
+        m_tee_file.write(reinterpret_cast<char const *>(span), size);
+      }
+      
+      for (uint32_t i = 0; i != size; ++i)
+      {
+        // :NOTE: Wei 2004-Jun-10:
+        //
+        // Because Glib::ustring can only eat UTF-8 string,
+        // and UTF-8 contains pure ASCII codes (i.e. 0~127).
+        //
+        // That is to say, extended ASCII codes are not included in the UTF-8 encoding.
+        // Thus I have to check argument str to convert each non-pure-ASCII
+        // characters to space characters (0x20).
+        // Otherwise, when Glib::ustring outputs data into Gtk::TextBuffer,
+        // a glibmm internal error will terminate ARMware ! (Oops)
+        uint8_t const ch = ((span[i] & 0x80) ? 0x20 : span[i]);
+        
+        if (true == m_output_fifo.full())
+        {
+          m_output_fifo.consume(1);
+        }
+        
+        m_output_fifo.push(ch);
+      }
+      
+      tx_fifo.consume(size);
+    }
+    
+    if (false == m_flush_connection.connected())
+    {
+      m_flush_connection = Glib::signal_timeout().connect(
+        sigc::mem_fun(*this, &SerialConsole::on_flush_timeout), m_flush_period);
+    }
+  }
 }
@@ -25,6 +25,8 @@
 #pragma warning(disable: 4250)
 #endif
 
+#include <fstream>
+
 #include <gtkmm/textbuffer.h>
 #include <gtkmm/dialog.h>
 
@@ -32,6 +34,7 @@
 //
 
 #include "../ARMware.hpp"
+#include "../Uart.hpp"
 
 namespace Gtk
 {
@@ -40,11 +43,29 @@ namespace Gtk
 
 namespace ARMware
 {
+  // The output of the guest is collected into m_output_fifo on the
+  // emulation path, and inserted into the text view by a timeout at most
+  // ARMWARE_CONSOLE_FLUSH_RATE (10 by default) times per second, thus a
+  // verbose guest costs one text view update per flush rather than one per
+  // line.
+  //
+  // ARMWARE_CONSOLE_SCROLLBACK=<lines> caps the lines kept in the text view
+  // (5000 by default, 0 means unlimited).
+  //
+  // ARMWARE_CONSOLE_TEE=<file> writes all the output into <file> as well,
+  // straight from the UART, without going through GTK.
   typedef class SerialConsole SerialConsole;
   class SerialConsole : public Gtk::Dialog
   {
   private:
     
+    static uint32_t const DEFAULT_FLUSH_RATE = 10; // per second
+    static uint32_t const DEFAULT_SCROLLBACK_LINES = 5000;
+    
+    // If the text view falls behind more than this, the oldest output is
+    // dropped from the view (but not from the tee file).
+    typedef SpscRing<uint8_t, 64 * 1024> OutputFifo;
+    
     // Attribute
     
     Glib::RefPtr<Gtk::TextBuffer> mp_textbuffer;
@@ -53,12 +74,18 @@ namespace ARMware
     Gtk::HBox * const mp_input_hbox;
     
     Glib::ustring m_input_buffer;
-    Glib::ustring m_output_buffer;
-    bool m_need_append_more;
     
-    std::deque<uint8_t> *mp_rx_fifo;
+    OutputFifo m_output_fifo;
+    sigc::connection m_flush_connection;
+    uint32_t m_flush_period; // ms
+    uint32_t m_scrollback_lines;
+    
+    std::ofstream m_tee_file;
+    
+    UartFifo *mp_rx_fifo;
     
     void on_input_entry_activate();
+    bool on_flush_timeout();
     
   public:
     
@@ -69,74 +96,28 @@ namespace ARMware
     // Operation
     
     inline void
-    register_rx_fifo(std::deque<uint8_t> *rx_fifo)
+    register_rx_fifo(UartFifo *rx_fifo)
     {
       assert(rx_fifo != 0);
       
       mp_rx_fifo = rx_fifo;
     }
     
-    inline void
-    put_char_to_serial_console(std::vector<uint8_t> &tx_fifo)
-    {
-      // :NOTE: Wei 2004-Jun-10:
-      //
-      // Because Glib::ustring can only eat UTF-8 string,
-      // and UTF-8 contains pure ASCII codes (i.e. 0~127).
-      //
-      // That is to say, extended ASCII codes are not included in the UTF-8 encoding.
-      // Thus I have to check argument str to convert each non-pure-ASCII
-      // characters to space characters (0x20).
-      // Otherwise, when Glib::ustring outputs data into Gtk::TextBuffer,
-      // a glibmm internal error will terminate ARMware ! (Oops)
-      for (std::vector<uint8_t>::iterator iter = tx_fifo.begin();
-           iter != tx_fifo.end();
-           ++iter)
-      {
-        if ((*iter) & 0x80)
-        {
-          (*iter) = 0x20;
-        }
-      }
-      
-      if (0xd == tx_fifo.back())
-      {
-        m_output_buffer.append(reinterpret_cast<char const *>(&(tx_fifo[0])), tx_fifo.size());
-        
-        m_need_append_more = true;
-      }
-      else
-      {
-        if (true == m_need_append_more)
-        {
-          m_output_buffer.append(reinterpret_cast<char const *>(&(tx_fifo[0])), tx_fifo.size());
-          
-          m_need_append_more = false;
-        }
-        else
-        {
-          if (false == m_output_buffer.empty())
-          {
-            mp_textbuffer->insert(mp_textbuffer->end(), m_output_buffer);
-            m_output_buffer.clear();
-          }
-          
-          mp_textbuffer->insert(mp_textbuffer->end(), Glib::ustring(reinterpret_cast<char const *>(&(tx_fifo[0])), tx_fifo.size()));
-        }
-      }
-    }
+    void put_char_to_serial_console(UartFifo &tx_fifo);
     
     inline void
     get_char_from_serial_console()
     {
-      for (Glib::ustring::size_type i = 0;
-           i != m_input_buffer.size();
-           ++i)
+      Glib::ustring::size_type i = 0;
+      
+      while ((i != m_input_buffer.size()) &&
+             (true == mp_rx_fifo->push(static_cast<uint8_t>(m_input_buffer[i]))))
       {
-        mp_rx_fifo->push_back(m_input_buffer[i]);
+        ++i;
       }
       
-      m_input_buffer.clear();
+      // The rest which doesn't fit in the RX FIFO waits for the next time.
+      m_input_buffer.erase(0, i);
     }
   };
 }
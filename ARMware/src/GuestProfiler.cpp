@@ -0,0 +1,459 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+
+#if LINUX
+#include <elf.h>
+#endif
+
+#include "GuestProfiler.hpp"
+#include "Log.hpp"
+
+namespace ARMware
+{
+  GuestProfiler g_guest_profiler;
+  
+  namespace
+  {
+    uint32_t const ELF_MAGIC_LENGTH = 4;
+  }
+  
+  ///////////////////////////////// Private ///////////////////////////////////
+  
+  // Every line of a System.map looks like:
+  //
+  // c0008000 T stext
+  //
+  // It has no sizes, every symbol ends at the next one, and the last one
+  // at _etext.
+  bool
+  GuestProfiler::load_system_map(char const * const filename, std::vector<Symbol> &symbols)
+  {
+    std::ifstream file(filename);
+    
+    if (false == file.is_open())
+    {
+      return false;
+    }
+    
+    std::string line;
+    std::vector<Symbol>::size_type const first = symbols.size();
+    uint32_t text_end = 0;
+    
+    while (std::getline(file, line))
+    {
+      std::istringstream fields(line);
+      Symbol symbol;
+      std::string type;
+      
+      fields >> std::hex >> symbol.m_addr >> type >> symbol.m_name;
+      
+      if (!fields || (type.size() != 1))
+      {
+        continue;
+      }
+      
+      if ("_etext" == symbol.m_name)
+      {
+        text_end = symbol.m_addr;
+        continue;
+      }
+      
+      // Only keep the symbols in the text section.
+      if (('T' == type[0]) || ('t' == type[0]) || ('W' == type[0]) || ('w' == type[0]))
+      {
+        symbol.m_end = 0;
+        symbol.m_exact_end = false;
+        
+        symbols.push_back(symbol);
+      }
+    }
+    
+    for (std::vector<Symbol>::size_type i = first; i < symbols.size(); ++i)
+    {
+      symbols[i].m_end = text_end;
+    }
+    
+    return true;
+  }
+  
+  bool
+  GuestProfiler::load_elf_symbols(char const * const filename, std::vector<Symbol> &symbols)
+  {
+#if LINUX
+    std::ifstream file(filename, std::ios_base::in | std::ios_base::binary);
+    
+    if (false == file.is_open())
+    {
+      return false;
+    }
+    
+    std::vector<char> image((std::istreambuf_iterator<char>(file)),
+                            std::istreambuf_iterator<char>());
+    
+    if ((image.size() < sizeof(Elf32_Ehdr)) ||
+        (memcmp(&image[0], ELFMAG, SELFMAG) != 0) ||
+        (image[EI_CLASS] != ELFCLASS32))
+    {
+      return false;
+    }
+    
+    Elf32_Ehdr const * const ehdr = reinterpret_cast<Elf32_Ehdr const *>(&image[0]);
+    
+    if ((0 == ehdr->e_shoff) ||
+        ((ehdr->e_shoff + (ehdr->e_shnum * sizeof(Elf32_Shdr))) > image.size()))
+    {
+      return false;
+    }
+    
+    Elf32_Shdr const * const shdr = reinterpret_cast<Elf32_Shdr const *>(&image[ehdr->e_shoff]);
+    
+    for (uint32_t i = 0; i < ehdr->e_shnum; ++i)
+    {
+      if ((shdr[i].sh_type != SHT_SYMTAB) ||
+          (shdr[i].sh_link >= ehdr->e_shnum))
+      {
+        continue;
+      }
+      
+      Elf32_Shdr const &strtab = shdr[shdr[i].sh_link];
+      
+      if (((shdr[i].sh_offset + shdr[i].sh_size) > image.size()) ||
+          ((strtab.sh_offset + strtab.sh_size) > image.size()))
+      {
+        continue;
+      }
+      
+      Elf32_Sym const * const sym = reinterpret_cast<Elf32_Sym const *>(&image[shdr[i].sh_offset]);
+      uint32_t const sym_number = shdr[i].sh_size / sizeof(Elf32_Sym);
+      
+      for (uint32_t j = 0; j < sym_number; ++j)
+      {
+        if ((ELF32_ST_TYPE(sym[j].st_info) != STT_FUNC) ||
+            (sym[j].st_name >= strtab.sh_size))
+        {
+          continue;
+        }
+        
+        Symbol symbol;
+        
+        // Clear the Thumb bit.
+        symbol.m_addr = (sym[j].st_value & ~1);
+        
+        if (sym[j].st_size != 0)
+        {
+          symbol.m_end = (symbol.m_addr + sym[j].st_size);
+          symbol.m_exact_end = true;
+        }
+        else
+        {
+          // Up to the next symbol, but never past its own section.
+          symbol.m_end = ((sym[j].st_shndx < ehdr->e_shnum)
+                          ? (shdr[sym[j].st_shndx].sh_addr + shdr[sym[j].st_shndx].sh_size)
+                          : 0);
+          symbol.m_exact_end = false;
+        }
+        symbol.m_name.assign(&image[strtab.sh_offset + sym[j].st_name],
+                             strnlen(&image[strtab.sh_offset + sym[j].st_name],
+                                     strtab.sh_size - sym[j].st_name));
+        
+        symbols.push_back(symbol);
+      }
+    }
+    
+    return true;
+#else
+    (void)filename;
+    (void)symbols;
+    
+    return false;
+#endif
+  }
+  
+  // 'symbols' is sorted. A symbol without a size ends at the next symbol,
+  // if that comes before its limit. A symbol whose end is still not
+  // known covers nothing.
+  void
+  GuestProfiler::bound_symbols(std::vector<Symbol> &symbols)
+  {
+    for (std::vector<Symbol>::size_type i = 0; i < symbols.size(); ++i)
+    {
+      Symbol &symbol = symbols[i];
+      
+      if (true == symbol.m_exact_end)
+      {
+        continue;
+      }
+      
+      std::vector<Symbol>::size_type next = i + 1;
+      
+      // Skip the aliases.
+      while ((next < symbols.size()) && (symbols[next].m_addr == symbol.m_addr))
+      {
+        ++next;
+      }
+      
+      if ((next < symbols.size()) &&
+          ((0 == symbol.m_end) || (symbols[next].m_addr < symbol.m_end)))
+      {
+        symbol.m_end = symbols[next].m_addr;
+      }
+      
+      if (symbol.m_end < symbol.m_addr)
+      {
+        symbol.m_end = symbol.m_addr;
+      }
+    }
+  }
+  
+  void
+  GuestProfiler::load_symbol_file(std::string const &spec)
+  {
+    SymbolTable table;
+    std::string filename = spec;
+    std::string::size_type const at = spec.rfind('@');
+    
+    table.m_pid = ANY_PID;
+    
+    if (at != std::string::npos)
+    {
+      filename = spec.substr(0, at);
+      table.m_pid = strtoul(spec.c_str() + at + 1, 0, 10);
+    }
+    
+    char magic[ELF_MAGIC_LENGTH] = { 0 };
+    
+    {
+      std::ifstream file(filename.c_str(), std::ios_base::in | std::ios_base::binary);
+      
+      file.read(magic, ELF_MAGIC_LENGTH);
+    }
+    
+    bool const loaded = (0 == memcmp(magic, "\177ELF", ELF_MAGIC_LENGTH))
+      ? load_elf_symbols(filename.c_str(), table.m_symbols)
+      : load_system_map(filename.c_str(), table.m_symbols);
+    
+    if (false == loaded)
+    {
+      g_log_file << "Guest profiler: can not load symbols from " << filename << std::endl;
+      return;
+    }
+    
+    std::sort(table.m_symbols.begin(), table.m_symbols.end());
+    
+    bound_symbols(table.m_symbols);
+    
+    m_symbol_tables.push_back(table);
+  }
+  
+  void
+  GuestProfiler::write_output() const
+  {
+    std::map<std::string, uint32_t> stacks;
+    
+    for (std::map<Sample, uint32_t>::const_iterator iter = m_samples.begin();
+         iter != m_samples.end();
+         ++iter)
+    {
+      Sample const &sample = (*iter).first;
+      std::ostringstream stack;
+      
+      stack << "pid" << std::dec << sample.m_pid
+            << "_ttb" << std::hex << sample.m_ttb
+            << ';' << mode_name(sample.m_mode)
+            << ';' << symbolize(sample.m_pc, sample.m_pid);
+      
+      if (sample.m_chunk_vaddr != NO_CHUNK)
+      {
+        stack << ";chunk_" << std::hex << sample.m_chunk_vaddr;
+      }
+      
+      stacks[stack.str()] += (*iter).second;
+    }
+    
+    std::ofstream output(m_output_file.c_str(), std::ios_base::out | std::ios_base::trunc);
+    
+    for (std::map<std::string, uint32_t>::const_iterator iter = stacks.begin();
+         iter != stacks.end();
+         ++iter)
+    {
+      output << (*iter).first << ' ' << std::dec << (*iter).second << std::endl;
+    }
+  }
+  
+  ///////////////////////////////// Public ////////////////////////////////////
+  //============================== Life cycle =================================
+  
+  GuestProfiler::GuestProfiler()
+    : m_enable(false),
+      m_interval(DEFAULT_INTERVAL),
+      m_countdown(DEFAULT_INTERVAL),
+      m_sample_number(0)
+  { }
+  
+  GuestProfiler::~GuestProfiler()
+  {
+    if (true == m_enable)
+    {
+      write_output();
+    }
+  }
+  
+  //============================== Operation ==================================
+  
+  void
+  GuestProfiler::init()
+  {
+    char const * const symbol_files = getenv("ARMWARE_GUEST_SYMBOLS");
+    
+    if (symbol_files != 0)
+    {
+      std::istringstream specs(symbol_files);
+      std::string spec;
+      
+      while (std::getline(specs, spec, ':'))
+      {
+        if (false == spec.empty())
+        {
+          load_symbol_file(spec);
+        }
+      }
+    }
+    
+    char const * const output_file = getenv("ARMWARE_GUEST_PROFILE");
+    
+    if (0 == output_file)
+    {
+      return;
+    }
+    
+    m_output_file = output_file;
+    
+    char const * const interval = getenv("ARMWARE_GUEST_PROFILE_INTERVAL");
+    
+    if (interval != 0)
+    {
+      m_interval = strtoul(interval, 0, 10);
+      
+      if (0 == m_interval)
+      {
+        m_interval = DEFAULT_INTERVAL;
+      }
+    }
+    
+    m_countdown = m_interval;
+    
+    m_enable = true;
+  }
+  
+  void
+  GuestProfiler::record(uint32_t const pc,
+                        uint32_t const chunk_vaddr,
+                        CoreMode const mode,
+                        uint32_t const pid,
+                        uint32_t const ttb)
+  {
+    Sample sample;
+    
+    sample.m_pc = pc;
+    sample.m_chunk_vaddr = chunk_vaddr;
+    
+    // SysCoProc keeps bits 31..25 of the register 13 (with the reserved
+    // bits cleared), thus all of them take part in the PID slot.
+    sample.m_pid = ((pid >> 25) & 0x7F);
+    sample.m_ttb = (ttb & 0xFFFFC000);
+    sample.m_mode = mode;
+    
+    ++m_samples[sample];
+    ++m_sample_number;
+    
+    if (0 == (m_sample_number % WRITE_FREQ))
+    {
+      write_output();
+    }
+  }
+  
+  //============================== Inquery ====================================
+  
+  char const *
+  GuestProfiler::mode_name(CoreMode const mode)
+  {
+    switch (mode)
+    {
+    case MODE_USR: return "usr";
+    case MODE_FIQ: return "fiq";
+    case MODE_IRQ: return "irq";
+    case MODE_SVC: return "svc";
+    case MODE_ABT: return "abt";
+    case MODE_UND: return "und";
+    case MODE_SYS: return "sys";
+      
+    default:
+      assert(!"Should not reach here.");
+      return "unknown";
+    }
+  }
+  
+  std::string
+  GuestProfiler::symbolize(uint32_t const pc, uint32_t const pid) const
+  {
+    // The symbol tables bound to a PID are searched first.
+    for (uint32_t pass = 0; pass < 2; ++pass)
+    {
+      for (std::vector<SymbolTable>::const_iterator iter = m_symbol_tables.begin();
+           iter != m_symbol_tables.end();
+           ++iter)
+      {
+        if ((0 == pass) ? ((*iter).m_pid != pid) : ((*iter).m_pid != ANY_PID))
+        {
+          continue;
+        }
+        
+        Symbol key;
+        
+        key.m_addr = pc;
+        
+        std::vector<Symbol>::const_iterator found =
+          std::upper_bound((*iter).m_symbols.begin(), (*iter).m_symbols.end(), key);
+        
+        if (found != (*iter).m_symbols.begin())
+        {
+          --found;
+          
+          // Past the end of the closest symbol, the PC is not covered by
+          // this table (Ex: a kernel PC and a table bound to a process).
+          if (pc < (*found).m_end)
+          {
+            return (*found).m_name;
+          }
+        }
+      }
+    }
+    
+    std::ostringstream unknown;
+    
+    unknown << "0x" << std::hex << pc;
+    
+    return unknown.str();
+  }
+}
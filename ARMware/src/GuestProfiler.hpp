@@ -0,0 +1,194 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+#ifndef GuestProfiler_hpp
+#define GuestProfiler_hpp
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "ARMware.hpp"
+
+namespace ARMware
+{
+  // Sampling profiler of the emulated program.
+  //
+  // Once every ARMWARE_GUEST_PROFILE_INTERVAL emulated instructions
+  // (10000 by default), Core::check_periphery() records the guest PC,
+  // the core mode, and the CP15 PID & TTB registers.
+  // Inside a threaded code or a dynamic translated chunk,
+  // check_periphery() is only called on a branch back into the same
+  // chunk, which passes its own index in the chunk. The sample is then
+  // located from the address the chunk was entered at plus the index of
+  // the instruction where the interval ran out, counted back from that
+  // branch.
+  //
+  // The samples are symbolized against the files listed in
+  // ARMWARE_GUEST_SYMBOLS (separated by ':'), each one is a System.map
+  // or an ELF file with a symbol table. A file name can be followed by
+  // '@<PID>', then it is only used for the process running in that FCSE
+  // PID slot (the value of the CP15 register 13 shifted right by 25).
+  // A PC only resolves to a symbol if it is inside it: the size of an ELF
+  // symbol, or up to the next symbol (and at most to the end of its
+  // section, or to _etext for a System.map).
+  //
+  // The result is written into the file ARMWARE_GUEST_PROFILE in the
+  // collapsed stack format (process;mode;function count), which can be
+  // fed into flamegraph.pl directly. The samples taken inside a chunk get
+  // one more frame, chunk_<entry address>.
+  typedef class GuestProfiler GuestProfiler;
+  class GuestProfiler
+  {
+  public:
+    
+    // The sample is not taken inside a chunk.
+    static uint32_t const NO_CHUNK = 0xFFFFFFFF;
+    
+  private:
+    
+    static uint32_t const DEFAULT_INTERVAL = 10000;
+    
+    // Rewrite the output file once every WRITE_FREQ samples,
+    // so that the profile is still usable if ARMware is killed.
+    static uint32_t const WRITE_FREQ = 4096;
+    
+    static uint32_t const ANY_PID = 0xFFFFFFFF;
+    
+    struct Symbol
+    {
+      uint32_t m_addr;
+      
+      // The first address after the symbol, 0 if it is not known yet.
+      uint32_t m_end;
+      
+      // m_end is the size of the symbol, not only a limit.
+      bool m_exact_end;
+      
+      std::string m_name;
+      
+      inline bool
+      operator<(Symbol const &other) const
+      { return m_addr < other.m_addr; }
+    };
+    typedef struct Symbol Symbol;
+    
+    struct SymbolTable
+    {
+      uint32_t m_pid;
+      std::vector<Symbol> m_symbols;
+    };
+    typedef struct SymbolTable SymbolTable;
+    
+    struct Sample
+    {
+      uint32_t m_pc;
+      uint32_t m_chunk_vaddr;
+      uint32_t m_pid;
+      uint32_t m_ttb;
+      CoreMode m_mode;
+      
+      inline bool
+      operator<(Sample const &other) const
+      {
+        if (m_pc != other.m_pc) return m_pc < other.m_pc;
+        if (m_chunk_vaddr != other.m_chunk_vaddr) return m_chunk_vaddr < other.m_chunk_vaddr;
+        if (m_pid != other.m_pid) return m_pid < other.m_pid;
+        if (m_ttb != other.m_ttb) return m_ttb < other.m_ttb;
+        return m_mode < other.m_mode;
+      }
+    };
+    typedef struct Sample Sample;
+    
+    // Attribute
+    
+    bool m_enable;
+    
+    uint32_t m_interval;
+    int32_t m_countdown;
+    
+    std::string m_output_file;
+    
+    std::vector<SymbolTable> m_symbol_tables;
+    
+    std::map<Sample, uint32_t> m_samples;
+    uint32_t m_sample_number;
+    
+    // Operation
+    
+    void load_symbol_file(std::string const &spec);
+    bool load_system_map(char const * const filename, std::vector<Symbol> &symbols);
+    bool load_elf_symbols(char const * const filename, std::vector<Symbol> &symbols);
+    void bound_symbols(std::vector<Symbol> &symbols);
+    
+    void write_output() const;
+  
+  public:
+    
+    // Life cycle
+    
+    GuestProfiler();
+    ~GuestProfiler();
+    
+    // Operation
+    
+    void init();
+    
+    // @true: a sample should be taken now, the interval ran out
+    // 'overshoot' instructions before the last one of 'inst_number'.
+    inline bool
+    advance(uint32_t const inst_number, uint32_t &overshoot)
+    {
+      m_countdown -= static_cast<int32_t>(inst_number);
+      
+      if (m_countdown <= 0)
+      {
+        overshoot = static_cast<uint32_t>(-m_countdown);
+        
+        m_countdown += m_interval;
+        
+        return true;
+      }
+      else
+      {
+        return false;
+      }
+    }
+    
+    void record(uint32_t const pc,
+                uint32_t const chunk_vaddr,
+                CoreMode const mode,
+                uint32_t const pid,
+                uint32_t const ttb);
+    
+    // Inquery
+    
+    static char const *mode_name(CoreMode const mode);
+    
+    // The symbols are loaded even if the profiler itself is off, so that
+    // the other profilers (ex: MmioProfiler) can symbolize their reports.
+    std::string symbolize(uint32_t const pc, uint32_t const pid) const;
+    
+    inline bool
+    is_enabled() const
+    { return m_enable; }
+  };
+  
+  extern GuestProfiler g_guest_profiler;
+}
+
+#endif
@@ -110,6 +110,38 @@ namespace ARMware
       return t;
     }
     
+    // Walk through all elements:
+    //
+    // for (T *t = table->walk_first(); t != 0; t = table->walk_next())
+    //
+    // The table must not be modified during the walk.
+    inline T *
+    walk_first()
+    {
+      m_curr_walk_idx = 0;
+      m_curr_walk_item = 0;
+      
+      return walk_next();
+    }
+    
+    inline T *
+    walk_next()
+    {
+      if (m_curr_walk_item != 0)
+      {
+        m_curr_walk_item = m_curr_walk_item->next_used_one();
+      }
+      
+      while ((0 == m_curr_walk_item) && (m_curr_walk_idx < HASH_TABLE_ENTRY_COUNT))
+      {
+        m_curr_walk_item = mp_hash_table[m_curr_walk_idx];
+        
+        ++m_curr_walk_idx;
+      }
+      
+      return m_curr_walk_item;
+    }
+    
     inline void
     add_new_element(T * const t, uint32_t const idx)
     {
@@ -19,7 +19,7 @@
 
 namespace ARMware
 {
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
   std::string const AND::NAME = "AND";
   std::string const EOR::NAME = "EOR";
   std::string const SUB::NAME = "SUB";
@@ -466,7 +466,7 @@ namespace ARMware
     static DPIOpcodeEnum const OPCODE = DPI_OP_AND;
     static bool const SHIFTER_SHELL_PRODUCE_C_BIT = true;
     
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
     static std::string const NAME;
 #endif
   };
@@ -476,7 +476,7 @@ namespace ARMware
     static DPIOpcodeEnum const OPCODE = DPI_OP_EOR;
     static bool const SHIFTER_SHELL_PRODUCE_C_BIT = true;
     
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
     static std::string const NAME;
 #endif
   };
@@ -486,7 +486,7 @@ namespace ARMware
     static DPIOpcodeEnum const OPCODE = DPI_OP_SUB;
     static bool const SHIFTER_SHELL_PRODUCE_C_BIT = false;
     
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
     static std::string const NAME;
 #endif
   };
@@ -496,7 +496,7 @@ namespace ARMware
     static DPIOpcodeEnum const OPCODE = DPI_OP_RSB;
     static bool const SHIFTER_SHELL_PRODUCE_C_BIT = false;
     
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
     static std::string const NAME;
 #endif
   };
@@ -506,7 +506,7 @@ namespace ARMware
     static DPIOpcodeEnum const OPCODE = DPI_OP_ADD;
     static bool const SHIFTER_SHELL_PRODUCE_C_BIT = false;
     
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
     static std::string const NAME;
 #endif
   };
@@ -516,7 +516,7 @@ namespace ARMware
     static DPIOpcodeEnum const OPCODE = DPI_OP_ADC;
     static bool const SHIFTER_SHELL_PRODUCE_C_BIT = false;
     
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
     static std::string const NAME;
 #endif
   };
@@ -526,7 +526,7 @@ namespace ARMware
     static DPIOpcodeEnum const OPCODE = DPI_OP_SBC;
     static bool const SHIFTER_SHELL_PRODUCE_C_BIT = false;
     
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
     static std::string const NAME;
 #endif
   };
@@ -536,7 +536,7 @@ namespace ARMware
     static DPIOpcodeEnum const OPCODE = DPI_OP_RSC;
     static bool const SHIFTER_SHELL_PRODUCE_C_BIT = false;
     
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
     static std::string const NAME;
 #endif
   };
@@ -546,7 +546,7 @@ namespace ARMware
     static DPIOpcodeEnum const OPCODE = DPI_OP_ORR;
     static bool const SHIFTER_SHELL_PRODUCE_C_BIT = true;
     
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
     static std::string const NAME;
 #endif
   };
@@ -556,7 +556,7 @@ namespace ARMware
     static DPIOpcodeEnum const OPCODE = DPI_OP_BIC;
     static bool const SHIFTER_SHELL_PRODUCE_C_BIT = true;
     
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
     static std::string const NAME;
 #endif
   };
@@ -566,7 +566,7 @@ namespace ARMware
     static DPIOpcodeEnum const OPCODE = DPI_OP_MOV;
     static bool const SHIFTER_SHELL_PRODUCE_C_BIT = true;
     
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
     static std::string const NAME;
 #endif
   };
@@ -576,7 +576,7 @@ namespace ARMware
     static DPIOpcodeEnum const OPCODE = DPI_OP_MVN;
     static bool const SHIFTER_SHELL_PRODUCE_C_BIT = true;
     
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
     static std::string const NAME;
 #endif
   };
@@ -586,7 +586,7 @@ namespace ARMware
     static DPIOpcodeEnum const OPCODE = DPI_OP_TST;
     static bool const SHIFTER_SHELL_PRODUCE_C_BIT = true;
     
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
     static std::string const NAME;
 #endif
   };
@@ -596,7 +596,7 @@ namespace ARMware
     static DPIOpcodeEnum const OPCODE = DPI_OP_TEQ;
     static bool const SHIFTER_SHELL_PRODUCE_C_BIT = true;
     
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
     static std::string const NAME;
 #endif
   };
@@ -606,7 +606,7 @@ namespace ARMware
     static DPIOpcodeEnum const OPCODE = DPI_OP_CMP;
     static bool const SHIFTER_SHELL_PRODUCE_C_BIT = false;
     
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
     static std::string const NAME;
 #endif
   };
@@ -616,7 +616,7 @@ namespace ARMware
     static DPIOpcodeEnum const OPCODE = DPI_OP_CMN;
     static bool const SHIFTER_SHELL_PRODUCE_C_BIT = false;
     
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
     static std::string const NAME;
 #endif
   };
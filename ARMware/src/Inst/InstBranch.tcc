@@ -523,6 +523,7 @@ namespace ARMware
       
       if ((inst_idx >= 0) && (inst_idx < static_cast<int32_t>(gp_core->curr_chunk()->length())))
       {
+        gp_core->set_back_branch_idx(gp_core->curr_chunk()->inst_idx());
         gp_core->set_next_tc_inst_idx(inst_idx);
         
         return true;
@@ -185,15 +185,20 @@ namespace ARMware
         // :NOTE: Wei 2004-Oct-03:
         //
         // Jump into the same chunk, need to check periphery.
+        //
+        // The index of this branch goes along, the guest profiler locates
+        // its samples by it.
         Label * const routine_label =
           gp_chunk->add_new_label(new Label(static_cast<LabelRoutine *>(0),
                                             reinterpret_cast<DTFunc_t>(check_periphery_DT)));
         
-        gp_chunk->append_mir<MIR_FOR_NORMAL>(new MIR(static_cast<MIRCall_0 *>(0), routine_label));
+        gp_chunk->append_mir<MIR_FOR_NORMAL>(new MIR(static_cast<MIRCall_1 *>(0),
+                                                     routine_label,
+                                                     gp_chunk->find_const_var(gp_chunk->inst_idx())));
         
         Variable * const tmp1 = gp_chunk->get_new_temp();
         
-        gp_chunk->append_mir<MIR_FOR_NORMAL>(new MIR(static_cast<MIRRetrieve *>(0), 0, tmp1));
+        gp_chunk->append_mir<MIR_FOR_NORMAL>(new MIR(static_cast<MIRRetrieve *>(0), 1, tmp1));
         
         Label * const near_label = gp_chunk->add_new_label(new Label(static_cast<LabelMIRInst *>(0), 0));
         
@@ -17,7 +17,7 @@
 
 namespace ARMware
 {
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
   /////////////////////////////////////////////////////////////////////////////
   // print_code
   
@@ -34,11 +34,11 @@ namespace ARMware
       switch (is_link)
       {
       case LINK:
-        g_log_file << "BLX(2) ";
+        g_chunk_code_log << "BLX(2) ";
         break;
         
       case NO_LINK:
-        g_log_file << "BX ";
+        g_chunk_code_log << "BX ";
         break;
         
       default:
@@ -46,9 +46,9 @@ namespace ARMware
         break;
       }
       
-      g_log_file << CondName(branch->mInst)
-                << " "
-                << CoreRegName(branch->RmNum()) << std::endl;
+      g_chunk_code_log << CondName(branch->mInst)
+                      << " "
+                      << CoreRegName(branch->RmNum()) << std::endl;
     }
     
     template<IsLink is_link, ExchangeToThumb exchange_to_thumb, UsageEnum T_usage>
@@ -63,11 +63,11 @@ namespace ARMware
         switch (exchange_to_thumb)
         {
         case EXCHANGE:
-          g_log_file << "BLX(1)";
+          g_chunk_code_log << "BLX(1)";
           break;
           
         case NO_EXCHANGE:
-          g_log_file << "BL";
+          g_chunk_code_log << "BL";
           break;
           
         default:
@@ -77,7 +77,7 @@ namespace ARMware
         break;
         
       case NO_LINK:
-        g_log_file << "B";
+        g_chunk_code_log << "B";
         break;
         
       default:
@@ -85,10 +85,10 @@ namespace ARMware
         break;
       }
       
-      g_log_file << CondName(branch->mInst)
-                << " "
-                << std::dec << static_cast<int32_t>(branch->Imm())
-                << std::endl;
+      g_chunk_code_log << CondName(branch->mInst)
+                      << " "
+                      << std::dec << static_cast<int32_t>(branch->Imm())
+                      << std::endl;
     }
   }
   
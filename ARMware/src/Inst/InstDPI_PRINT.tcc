@@ -17,7 +17,7 @@
 
 namespace ARMware
 {
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
   namespace
   {
     template<typename opcode,
@@ -33,12 +33,12 @@ namespace ARMware
                       update_status_category_id,
                       operand_number_category_id> const * const dpi)
     {
-      g_log_file << CoreRegName(dpi->RmNum())
-                << ", "
-                << SftTypeName(dpi->WhichSftType())
-                << " "
-                << dpi->SftImm()
-                << std::endl;
+      g_chunk_code_log << CoreRegName(dpi->RmNum())
+                      << ", "
+                      << SftTypeName(dpi->WhichSftType())
+                      << " "
+                      << dpi->SftImm()
+                      << std::endl;
     }
     
     template<typename opcode,
@@ -54,12 +54,12 @@ namespace ARMware
                       update_status_category_id,
                       operand_number_category_id> const * const dpi)
     {
-      g_log_file << CoreRegName(dpi->RmNum())
-                << ", "
-                << SftTypeName(dpi->WhichSftType())
-                << " "
-                << CoreRegName(dpi->RsNum())
-                << std::endl;
+      g_chunk_code_log << CoreRegName(dpi->RmNum())
+                      << ", "
+                      << SftTypeName(dpi->WhichSftType())
+                      << " "
+                      << CoreRegName(dpi->RsNum())
+                      << std::endl;
     }
     
     template<typename opcode,
@@ -75,11 +75,11 @@ namespace ARMware
                       update_status_category_id,
                       operand_number_category_id> const * const dpi)
     {
-      g_log_file << dpi->Imm()
-                << " ROR "
-                << dpi->RotImm()
-                << " "
-                << std::endl;;
+      g_chunk_code_log << dpi->Imm()
+                      << " ROR "
+                      << dpi->RotImm()
+                      << " "
+                      << std::endl;;
     }
   }
   
@@ -100,14 +100,14 @@ namespace ARMware
   {
     m_inst = inst;
     
-    g_log_file << opcode::NAME
-               << CondName(m_inst)
-               << ((UPDATE_STATUS == is_update_status) ? "S" : "")
-               << " "
-               << CoreRegName(RdNum())
-               << ", "
-               << CoreRegName(RnNum())
-               << ", ";
+    g_chunk_code_log << opcode::NAME
+                     << CondName(m_inst)
+                     << ((UPDATE_STATUS == is_update_status) ? "S" : "")
+                     << " "
+                     << CoreRegName(RdNum())
+                     << ", "
+                     << CoreRegName(RnNum())
+                     << ", ";
     
     print_code_helper(this);
   }
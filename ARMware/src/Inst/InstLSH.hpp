@@ -43,8 +43,14 @@ namespace ARMware
     uint32_t Offset() const;
     uint32_t Address() const;
     
+    // @T_mode: see Core::virtual_to_physical().
+    template<TranslationModeEnum T_mode>
     void OperationInternal(bool &exception_occur) const;
+    
+    template<TranslationModeEnum T_mode>
     void OperationInternalByAddressingMode(bool &exception_occur) const;
+    
+    template<TranslationModeEnum T_mode>
     void Operation(bool &exception_occur) const;
     
 #if CHECK_UNPREDICTABLE
@@ -55,6 +61,7 @@ namespace ARMware
     
     // Operation
     
+    template<TranslationModeEnum T_mode>
     ExecResultEnum Process(Inst const inst);
     
 #if ENABLE_DYNAMIC_TRANSLATOR
@@ -65,7 +72,7 @@ namespace ARMware
 #endif
 #endif
     
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
     void print_code(Inst const inst);
 #endif
   };
@@ -663,7 +663,8 @@ namespace ARMware
   namespace
   {
     // LDRH or LDRSH or LDRSB
-    template<typename mode,
+    template<TranslationModeEnum T_mode,
+             typename mode,
              AddressingMode addressing_mode,
              Direction direction,
              IsSigned is_signed,
@@ -719,7 +720,7 @@ namespace ARMware
       // However, because of 'value' is a local variable,
       // thus I choose overwrite its value whether an exception occurs or not.
       typename DataWidthTraits<data_width_enum>::UnsignedType const value =
-        gp_core->template get_data<data_width_enum, DATA>(address, gp_core->CurrentMode(), exception_occur);
+        gp_core->template get_data<T_mode, data_width_enum, DATA>(address, gp_core->CurrentMode(), exception_occur);
       
       if (true == exception_occur)
       {
@@ -742,7 +743,8 @@ namespace ARMware
     }
     
     // STRH
-    template<typename mode,
+    template<TranslationModeEnum T_mode,
+             typename mode,
              AddressingMode addressing_mode,
              Direction direction,
              UsageEnum T_usage>
@@ -799,9 +801,9 @@ namespace ARMware
       gp_core->CurrentInstRecallEntry().mCurrentRegNum = lsh->RdNum();
 #endif
       
-      gp_core->template put_data<HALF_WORD>(address, store_value,
-                                                gp_core->CurrentMode(),
-                                                exception_occur);
+      gp_core->template put_data<T_mode, HALF_WORD>(address, store_value,
+                                                        gp_core->CurrentMode(),
+                                                        exception_occur);
     }
   }
   
@@ -812,11 +814,12 @@ namespace ARMware
            DataWidthEnum data_width_enum,
            IsLoad is_load,
            UsageEnum T_usage>
+  template<TranslationModeEnum T_mode>
   inline void
   InstLSH<mode, addressing_mode, direction, is_signed, data_width_enum, is_load, T_usage>::
   OperationInternal(bool &exception_occur) const
   {
-    OperationInternal_Helper(this, exception_occur);
+    OperationInternal_Helper<T_mode>(this, exception_occur);
   }
   
   /////////////////////////////////////////////////////////////////////////////
@@ -825,7 +828,8 @@ namespace ARMware
   namespace
   {
     // Used for pre-index & post-index addressing mode
-    template<typename mode,
+    template<TranslationModeEnum T_mode,
+             typename mode,
              AddressingMode addressing_mode,
              Direction direction,
              IsSigned is_signed,
@@ -844,7 +848,7 @@ namespace ARMware
     {
       uint32_t const orig_rn_value = lsh->Rn();
       
-      lsh->OperationInternal(exception_occur);
+      lsh->template OperationInternal<T_mode>(exception_occur);
       
       if (true == exception_occur)
       {
@@ -853,7 +857,8 @@ namespace ARMware
     }
     
     // Special case for offset addressing mode
-    template<typename mode,
+    template<TranslationModeEnum T_mode,
+             typename mode,
              Direction direction,
              IsSigned is_signed,
              DataWidthEnum data_width_enum,
@@ -869,7 +874,7 @@ namespace ARMware
                                              T_usage> const * const lsh,
                                              bool &exception_occur)
     {
-      lsh->OperationInternal(exception_occur);
+      lsh->template OperationInternal<T_mode>(exception_occur);
     }
   }
   
@@ -880,11 +885,12 @@ namespace ARMware
            DataWidthEnum data_width_enum,
            IsLoad is_load,
            UsageEnum T_usage>
+  template<TranslationModeEnum T_mode>
   inline void
   InstLSH<mode, addressing_mode, direction, is_signed, data_width_enum, is_load, T_usage>::
   OperationInternalByAddressingMode(bool &exception_occur) const
   {
-    OperationInternalByAddressingMode_Helper(this, exception_occur);
+    OperationInternalByAddressingMode_Helper<T_mode>(this, exception_occur);
   }
   
   /////////////////////////////////////////////////////////////////////////////
@@ -897,6 +903,7 @@ namespace ARMware
            DataWidthEnum data_width_enum,
            IsLoad is_load,
            UsageEnum T_usage>
+  template<TranslationModeEnum T_mode>
   inline void
   InstLSH<mode, addressing_mode, direction, is_signed, data_width_enum, is_load, T_usage>::
   Operation(bool &exception_occur) const
@@ -905,7 +912,7 @@ namespace ARMware
     gp_core->CurrentInstRecallEntry().mRdNum = RdNum();
 #endif
     
-    OperationInternalByAddressingMode(exception_occur);
+    OperationInternalByAddressingMode<T_mode>(exception_occur);
     
     if (true == exception_occur)
     {
@@ -929,6 +936,7 @@ namespace ARMware
            DataWidthEnum data_width_enum,
            IsLoad is_load,
            UsageEnum T_usage>
+  template<TranslationModeEnum T_mode>
   inline ExecResultEnum
   InstLSH<mode, addressing_mode, direction, is_signed, data_width_enum, is_load, T_usage>::
   Process(Inst const inst)
@@ -953,7 +961,7 @@ namespace ARMware
     }
 #endif
     
-    Operation(exception_occur);
+    Operation<T_mode>(exception_occur);
     
     if (true == exception_occur)
     {
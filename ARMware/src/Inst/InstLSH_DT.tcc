@@ -1032,6 +1032,8 @@ namespace ARMware
     
     determine_dt_func_helper(this);
     
+    gp_chunk->record_access_idx_DT();
+    
     Label * const routine_label =
       gp_chunk->add_new_label(new Label(static_cast<LabelRoutine *>(0), dt_func));
     
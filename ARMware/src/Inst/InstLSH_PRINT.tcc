@@ -17,7 +17,7 @@
 
 namespace ARMware
 {
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
   namespace
   {
     template<AddressingMode addressing_mode,
@@ -38,32 +38,32 @@ namespace ARMware
       switch (addressing_mode)
       {
       case OFFSET:
-        g_log_file << "["
-                   << CoreRegName(lsh->RnNum())
-                   << ", #"
-                   << ((UP == direction) ? "+" : "-")
-                   << static_cast<int32_t>(lsh->Offset())
-                   << "]"
-                   << std::endl;
+        g_chunk_code_log << "["
+                         << CoreRegName(lsh->RnNum())
+                         << ", #"
+                         << ((UP == direction) ? "+" : "-")
+                         << static_cast<int32_t>(lsh->Offset())
+                         << "]"
+                         << std::endl;
         break;
         
       case PRE_IDX:
-        g_log_file << "["
-                   << CoreRegName(lsh->RnNum())
-                   << ", #"
-                   << ((UP == direction) ? "+" : "-")
-                   << static_cast<int32_t>(lsh->Offset())
-                   << "]!"
-                   << std::endl;
+        g_chunk_code_log << "["
+                         << CoreRegName(lsh->RnNum())
+                         << ", #"
+                         << ((UP == direction) ? "+" : "-")
+                         << static_cast<int32_t>(lsh->Offset())
+                         << "]!"
+                         << std::endl;
         break;
         
       case POST_IDX:
-        g_log_file << "["
-                   << CoreRegName(lsh->RnNum())
-                   << "], #"
-                   << ((UP == direction) ? "+" : "-")
-                   << static_cast<int32_t>(lsh->Offset())
-                   << std::endl;
+        g_chunk_code_log << "["
+                         << CoreRegName(lsh->RnNum())
+                         << "], #"
+                         << ((UP == direction) ? "+" : "-")
+                         << static_cast<int32_t>(lsh->Offset())
+                         << std::endl;
         break;
         
       default:
@@ -90,32 +90,32 @@ namespace ARMware
       switch (addressing_mode)
       {
       case OFFSET:
-        g_log_file << "["
-                   << CoreRegName(lsh->RnNum())
-                   << ", "
-                   << ((UP == direction) ? "+" : "-")
-                   << CoreRegName(lsh->RmNum())
-                   << "]"
-                   << std::endl;
+        g_chunk_code_log << "["
+                         << CoreRegName(lsh->RnNum())
+                         << ", "
+                         << ((UP == direction) ? "+" : "-")
+                         << CoreRegName(lsh->RmNum())
+                         << "]"
+                         << std::endl;
         break;
         
       case PRE_IDX:
-        g_log_file << "["
-                   << CoreRegName(lsh->RnNum())
-                   << ", "
-                   << ((UP == direction) ? "+" : "-")
-                   << CoreRegName(lsh->RmNum())
-                   << "]!"
-                   << std::endl;
+        g_chunk_code_log << "["
+                         << CoreRegName(lsh->RnNum())
+                         << ", "
+                         << ((UP == direction) ? "+" : "-")
+                         << CoreRegName(lsh->RmNum())
+                         << "]!"
+                         << std::endl;
         break;
         
       case POST_IDX:
-        g_log_file << "["
-                   << CoreRegName(lsh->RnNum())
-                   << "], "
-                   << ((UP == direction) ? "+" : "-")
-                   << CoreRegName(lsh->RmNum())
-                   << std::endl;
+        g_chunk_code_log << "["
+                         << CoreRegName(lsh->RnNum())
+                         << "], "
+                         << ((UP == direction) ? "+" : "-")
+                         << CoreRegName(lsh->RmNum())
+                         << std::endl;
         break;
         
       default:
@@ -140,8 +140,8 @@ namespace ARMware
     
     if (LOAD == is_load)
     {
-      g_log_file << "LDR"
-                 << CondName(mInst);
+      g_chunk_code_log << "LDR"
+                       << CondName(mInst);
       
       if (HALF_WORD == data_width_enum)
       {
@@ -149,13 +149,13 @@ namespace ARMware
         {
           // LDRSH
           
-          g_log_file << "SH ";
+          g_chunk_code_log << "SH ";
         }
         else
         {
           // LDRH
           
-          g_log_file << "H ";
+          g_chunk_code_log << "H ";
         }
       }
       else
@@ -165,7 +165,7 @@ namespace ARMware
         assert(BYTE == data_width_enum);
         assert(SIGNED == is_signed);
         
-        g_log_file << "SB ";
+        g_chunk_code_log << "SB ";
       }
     }
     else
@@ -175,14 +175,14 @@ namespace ARMware
       assert(HALF_WORD == data_width_enum);
       assert(UNSIGNED == is_signed);
       
-      g_log_file << "STR"
-                 << CondName(mInst)
-                 << "H ";
+      g_chunk_code_log << "STR"
+                       << CondName(mInst)
+                       << "H ";
     }
     
-    g_log_file << " "
-               << CoreRegName(RdNum())
-               << ", ";
+    g_chunk_code_log << " "
+                     << CoreRegName(RdNum())
+                     << ", ";
     
     print_code_helper(this);
   }
@@ -51,10 +51,13 @@ namespace ARMware
     
     void     WriteBackBase() const;
     
+    // @T_mode: see Core::virtual_to_physical().
+    template<TranslationModeEnum T_mode>
     void     OperationInternal(uint32_t const orig_rn_value,
                                uint32_t address,
                                bool &exception_occur) const;
     
+    template<TranslationModeEnum T_mode>
     void     Operation(bool &exception_occur) const;
     
 #if CHECK_UNPREDICTABLE
@@ -65,6 +68,7 @@ namespace ARMware
     
     // Operation
     
+    template<TranslationModeEnum T_mode>
     ExecResultEnum Process(Inst const inst);
     
 #if ENABLE_DYNAMIC_TRANSLATOR
@@ -75,7 +79,7 @@ namespace ARMware
 #endif
 #endif
     
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
     void print_code(Inst const inst);
 #endif
   };
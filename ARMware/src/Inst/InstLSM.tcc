@@ -454,7 +454,8 @@ namespace ARMware
   namespace
   {
     // LDM(1)
-    template<Direction direction,
+    template<TranslationModeEnum T_mode,
+             Direction direction,
              StartFrom start_from,
              IsWriteBack is_write_back,
              UsageEnum T_usage>
@@ -492,9 +493,9 @@ namespace ARMware
           //
           // Thus I have to use a temporary variable to store the result.
           uint32_t const temp = 
-            gp_core->template get_data<WORD, DATA>(address,
-                                                       gp_core->CurrentMode(),
-                                                       exception_occur);
+            gp_core->template get_data<T_mode, WORD, DATA>(address,
+                                                               gp_core->CurrentMode(),
+                                                               exception_occur);
           
           if (true == exception_occur)
           {
@@ -529,9 +530,9 @@ namespace ARMware
         // However, because of 'value' is a local variable,
         // thus I choose overwrite its value whether an exception occurs or not.
         uint32_t const value =
-          gp_core->template get_data<WORD, DATA>(address,
-                                                     gp_core->CurrentMode(),
-                                                     exception_occur);
+          gp_core->template get_data<T_mode, WORD, DATA>(address,
+                                                             gp_core->CurrentMode(),
+                                                             exception_occur);
         
         if (true == exception_occur)
         {
@@ -574,7 +575,7 @@ namespace ARMware
 #endif
     }
     
-    template<Direction direction, StartFrom start_from, IsWriteBack is_write_back, UsageEnum T_usage>
+    template<TranslationModeEnum T_mode, Direction direction, StartFrom start_from, IsWriteBack is_write_back, UsageEnum T_usage>
     inline void
     OperationInternal_Helper(InstLSM<direction,
                              start_from,
@@ -611,9 +612,9 @@ namespace ARMware
             
             // Use 'user' register bank
             uint32_t const temp = 
-              gp_core->template get_data<WORD, DATA>(address,
-                                                         gp_core->CurrentMode(),
-                                                         exception_occur);
+              gp_core->template get_data<T_mode, WORD, DATA>(address,
+                                                                 gp_core->CurrentMode(),
+                                                                 exception_occur);
             
             if (true == exception_occur)
             {
@@ -674,9 +675,9 @@ namespace ARMware
             // Thus I have to use a temporary variable to store the result.
             
             uint32_t const temp = 
-              gp_core->template get_data<WORD, DATA>(address,
-                                                         current_mode,
-                                                         exception_occur);
+              gp_core->template get_data<T_mode, WORD, DATA>(address,
+                                                                 current_mode,
+                                                                 exception_occur);
             
             if (true == exception_occur)
             {
@@ -714,9 +715,9 @@ namespace ARMware
         
         // use old cpu mode.
         uint32_t const value =
-          gp_core->template get_data<WORD, DATA>(address,
-                                                     current_mode,
-                                                     exception_occur);
+          gp_core->template get_data<T_mode, WORD, DATA>(address,
+                                                             current_mode,
+                                                             exception_occur);
         
         if (true == exception_occur)
         {
@@ -767,7 +768,7 @@ namespace ARMware
     }
     
     // STM(1)
-    template<Direction direction, StartFrom start_from, IsWriteBack is_write_back, UsageEnum T_usage>
+    template<TranslationModeEnum T_mode, Direction direction, StartFrom start_from, IsWriteBack is_write_back, UsageEnum T_usage>
     inline void
     OperationInternal_Helper(InstLSM<direction,
                              start_from,
@@ -814,10 +815,10 @@ namespace ARMware
             gp_core->CurrentInstRecallEntry().mCurrentRegNum = i;
 #endif
             
-            gp_core->template put_data<WORD>(address,
-                                             orig_rn_value,
-                                             gp_core->CurrentMode(),
-                                             exception_occur);
+            gp_core->template put_data<T_mode, WORD>(address,
+                                                     orig_rn_value,
+                                                     gp_core->CurrentMode(),
+                                                     exception_occur);
             
             if (true == exception_occur)
             {
@@ -860,10 +861,10 @@ namespace ARMware
             gp_core->CurrentInstRecallEntry().mCurrentRegNum = i;
 #endif
             
-            gp_core->template put_data<WORD>(address,
-                                             store_value,
-                                             gp_core->CurrentMode(),
-                                             exception_occur);
+            gp_core->template put_data<T_mode, WORD>(address,
+                                                     store_value,
+                                                     gp_core->CurrentMode(),
+                                                     exception_occur);
             
             if (true == exception_occur)
             {
@@ -887,7 +888,7 @@ namespace ARMware
     }
     
     // STM(2)
-    template<Direction direction, StartFrom start_from, IsWriteBack is_write_back, UsageEnum T_usage>
+    template<TranslationModeEnum T_mode, Direction direction, StartFrom start_from, IsWriteBack is_write_back, UsageEnum T_usage>
     inline void
     OperationInternal_Helper(InstLSM<direction,
                              start_from,
@@ -932,10 +933,10 @@ namespace ARMware
           gp_core->CurrentInstRecallEntry().mCurrentRegNum = i;
 #endif
           
-          gp_core->template put_data<WORD>(address,
-                                               store_value,
-                                               gp_core->CurrentMode(),
-                                               exception_occur);
+          gp_core->template put_data<T_mode, WORD>(address,
+                                                       store_value,
+                                                       gp_core->CurrentMode(),
+                                                       exception_occur);
           
           if (true == exception_occur)
           {
@@ -966,11 +967,12 @@ namespace ARMware
            IsWriteBack is_write_back,
            IsLoad is_load,
            UsageEnum T_usage>
+  template<TranslationModeEnum T_mode>
   inline void
   InstLSM<direction, start_from, desired_bank, is_write_back, is_load, T_usage>::
   OperationInternal(uint32_t const orig_rn_value, uint32_t address, bool &exception_occur) const
   {
-    OperationInternal_Helper(this, orig_rn_value, address, exception_occur);
+    OperationInternal_Helper<T_mode>(this, orig_rn_value, address, exception_occur);
   }
   
   /////////////////////////////////////////////////////////////////////////////
@@ -982,6 +984,7 @@ namespace ARMware
            IsWriteBack is_write_back,
            IsLoad is_load,
            UsageEnum T_usage>
+  template<TranslationModeEnum T_mode>
   inline void
   InstLSM<direction, start_from, desired_bank, is_write_back, is_load, T_usage>::
   Operation(bool &exception_occur) const
@@ -1035,7 +1038,7 @@ namespace ARMware
       return;
     }
     
-    OperationInternal(orig_rn_value, real_address, exception_occur);
+    OperationInternal<T_mode>(orig_rn_value, real_address, exception_occur);
     
     if (true == exception_occur)
     {
@@ -1130,6 +1133,7 @@ namespace ARMware
            IsWriteBack is_write_back,
            IsLoad is_load,
            UsageEnum T_usage>
+  template<TranslationModeEnum T_mode>
   inline ExecResultEnum
   InstLSM<direction, start_from, desired_bank, is_write_back, is_load, T_usage>::
   Process(Inst const inst)
@@ -1161,7 +1165,7 @@ namespace ARMware
     }
 #endif
     
-    Operation(exception_occur);
+    Operation<T_mode>(exception_occur);
     
     if (true == exception_occur)
     {
@@ -381,6 +381,8 @@ namespace ARMware
     default: assert(!"Should not reach here."); break;
     }
     
+    gp_chunk->record_access_idx_DT();
+    
     Label * const routine_label =
       gp_chunk->add_new_label(new Label(static_cast<LabelRoutine *>(0), dt_func));
     
@@ -17,7 +17,7 @@
 
 namespace ARMware
 {
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
   namespace
   {
     template<Direction direction,
@@ -38,22 +38,22 @@ namespace ARMware
       {
         if (AFTER == start_from)
         {
-          g_log_file << "DA ";
+          g_chunk_code_log << "DA ";
         }
         else
         {
-          g_log_file << "DB ";
+          g_chunk_code_log << "DB ";
         }
       }
       else
       {
         if (AFTER == start_from)
         {
-          g_log_file << "IA ";
+          g_chunk_code_log << "IA ";
         }
         else
         {
-          g_log_file << "IB ";
+          g_chunk_code_log << "IB ";
         }
       }
     }
@@ -73,113 +73,113 @@ namespace ARMware
     
     if (LOAD == is_load)
     {
-      g_log_file << "LDM"
-                << CondName(mInst);
+      g_chunk_code_log << "LDM"
+                      << CondName(mInst);
       
       print_code_helper(this);
       
       if (CURRENT_BANK == desired_bank)
       {
         // LDM_1
-        g_log_file << CoreRegName(RnNum())
-                  << ((WRITE_BACK == is_write_back) ? "!" : "")
-                  << ", {";
+        g_chunk_code_log << CoreRegName(RnNum())
+                        << ((WRITE_BACK == is_write_back) ? "!" : "")
+                        << ", {";
         
         for (CoreRegNum i = CR_BEGIN; i != CR_END; ++i)
         {
           if (true == RegEnable(i))
           {
-            g_log_file << CoreRegName(i)
-                      << ", ";
+            g_chunk_code_log << CoreRegName(i)
+                            << ", ";
           }
         }
         
-        g_log_file << "}"
-                  << std::endl;
+        g_chunk_code_log << "}"
+                        << std::endl;
       }
       else
       {
         if (false == RegEnable(CR_PC))
         {
           // LDM_2
-          g_log_file << CoreRegName(RnNum())
-                    << ", {";
+          g_chunk_code_log << CoreRegName(RnNum())
+                          << ", {";
           
           for (CoreRegNum i = CR_BEGIN; i != CR_PC; ++i)
           {
             if (true == RegEnable(i))
             {
-              g_log_file << CoreRegName(i)
-                        << ", ";
+              g_chunk_code_log << CoreRegName(i)
+                              << ", ";
             }
           }
           
-          g_log_file << "}^"
-                    << std::endl;
+          g_chunk_code_log << "}^"
+                          << std::endl;
         }
         else
         {
           // LDM_3
-          g_log_file << CoreRegName(RnNum())
-                    << ((WRITE_BACK == is_write_back) ? "!" : "")
-                    << ", {";
+          g_chunk_code_log << CoreRegName(RnNum())
+                          << ((WRITE_BACK == is_write_back) ? "!" : "")
+                          << ", {";
           
           for (CoreRegNum i = CR_BEGIN; i != CR_END; ++i)
           {
             if (true == RegEnable(i))
             {
-              g_log_file << CoreRegName(i)
-                        << ", ";
+              g_chunk_code_log << CoreRegName(i)
+                              << ", ";
             }
           }
           
-          g_log_file << "}^"
-                    << std::endl;
+          g_chunk_code_log << "}^"
+                          << std::endl;
         }
       }
     }
     else
     {
-      g_log_file << "STM";
+      g_chunk_code_log << "STM";
       
       print_code_helper(this);
       
       if (CURRENT_BANK == desired_bank)
       {
         // STM_1
-        g_log_file << CoreRegName(RnNum())
-                  << ((WRITE_BACK == is_write_back) ? "!" : "")
-                  << ", {";
+        g_chunk_code_log << CoreRegName(RnNum())
+                        << ((WRITE_BACK == is_write_back) ? "!" : "")
+                        << ", {";
         
         for (CoreRegNum i = CR_BEGIN; i != CR_END; ++i)
         {
           if (true == RegEnable(i))
           {
-            g_log_file << CoreRegName(i)
-                      << ", ";
+            g_chunk_code_log << CoreRegName(i)
+                            << ", ";
           }
         }
         
-        g_log_file << "}"
-                  << std::endl;
+        g_chunk_code_log << "}"
+                        << std::endl;
       }
       else
       {
         // STM_2
-        g_log_file << CoreRegName(RnNum())
-                  << ", {";
+        g_chunk_code_log << CoreRegName(RnNum())
+                        << ", {";
         
         for (CoreRegNum i = CR_BEGIN; i != CR_END; ++i)
         {
           if (true == RegEnable(i))
           {
-            g_log_file << CoreRegName(i)
-                      << ", ";
+            g_chunk_code_log << CoreRegName(i)
+                            << ", ";
           }
         }
         
-        g_log_file << "}^"
-                  << std::endl;
+        g_chunk_code_log << "}^"
+                        << std::endl;
       }
     }
   }
@@ -47,7 +47,7 @@ namespace ARMware
     uint32_t rn() const;
     uint32_t offset() const;
     
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
     uint32_t offset_without_check() const;
 #endif
     
@@ -57,7 +57,11 @@ namespace ARMware
     SftType  which_sft_type() const;
     uint32_t sft_imm() const;
     
+    // @T_mode: see Core::virtual_to_physical().
+    template<TranslationModeEnum T_mode>
     void operation_internal(bool &exception_occur) const;
+    
+    template<TranslationModeEnum T_mode>
     void operation(bool &exception_occur) const;
     
 #if CHECK_UNPREDICTABLE
@@ -68,6 +72,7 @@ namespace ARMware
     
     // Operation
     
+    template<TranslationModeEnum T_mode>
     ExecResultEnum Process(Inst const inst);
     
 #if ENABLE_DYNAMIC_TRANSLATOR
@@ -78,7 +83,7 @@ namespace ARMware
 #endif
 #endif
     
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
     void print_sft_field() const;
     void print_code(Inst const inst);
 #endif
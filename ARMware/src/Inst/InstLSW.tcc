@@ -677,7 +677,7 @@ namespace ARMware
     return offset_helper(this);
   }
   
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
   template<typename mode,
            AddressingMode addressing_mode,
            Direction direction,
@@ -852,7 +852,8 @@ namespace ARMware
   namespace
   {
     // LDRBT or LDRB
-    template<typename mode,
+    template<TranslationModeEnum T_mode,
+             typename mode,
              AddressingMode addressing_mode,
              Direction direction,
              DesiredMode desired_mode,
@@ -900,9 +901,9 @@ namespace ARMware
       // Thus I have to use a temporary variable to store the result.
       
       uint32_t const temp = 
-        static_cast<uint32_t>(gp_core->template get_data<BYTE, DATA>(address,
-                                                                     lsw->assume_mode(),
-                                                                     exception_occur));
+        static_cast<uint32_t>(gp_core->template get_data<T_mode, BYTE, DATA>(address,
+                                                                             lsw->assume_mode(),
+                                                                             exception_occur));
       
       if (true == exception_occur)
       {
@@ -924,7 +925,11 @@ namespace ARMware
     }
     
     // LDRT
-    template<typename mode, AddressingMode addressing_mode, Direction direction, UsageEnum T_usage>
+    template<TranslationModeEnum T_mode,
+             typename mode,
+             AddressingMode addressing_mode,
+             Direction direction,
+             UsageEnum T_usage>
     inline void
     operation_internal_helper(InstLSW<mode,
                              addressing_mode,
@@ -981,7 +986,7 @@ namespace ARMware
       // However, because of 'value' is a local variable,
       // thus I choose overwrite its value whether an exception occurs or not.
       DataWidthTraits<WORD>::UnsignedType value =
-        gp_core->template get_data<WORD, DATA>(real_address, lsw->assume_mode(), exception_occur);
+        gp_core->template get_data<T_mode, WORD, DATA>(real_address, lsw->assume_mode(), exception_occur);
       
       if (true == exception_occur)
       {
@@ -1006,7 +1011,11 @@ namespace ARMware
     }
     
     // LDR
-    template<typename mode, AddressingMode addressing_mode, Direction direction, UsageEnum T_usage>
+    template<TranslationModeEnum T_mode,
+             typename mode,
+             AddressingMode addressing_mode,
+             Direction direction,
+             UsageEnum T_usage>
     inline void
     operation_internal_helper(InstLSW<mode,
                               addressing_mode,
@@ -1058,7 +1067,7 @@ namespace ARMware
       // However, because of 'value' is a local variable,
       // thus I choose overwrite its value whether an exception occurs or not.
       DataWidthTraits<WORD>::UnsignedType value =
-        gp_core->template get_data<WORD, DATA>(real_address, lsw->assume_mode(), exception_occur);
+        gp_core->template get_data<T_mode, WORD, DATA>(real_address, lsw->assume_mode(), exception_occur);
       
       if (true == exception_occur)
       {
@@ -1117,7 +1126,8 @@ namespace ARMware
     }
     
     // STRB or STRBT
-    template<typename mode,
+    template<TranslationModeEnum T_mode,
+             typename mode,
              AddressingMode addressing_mode,
              Direction direction,
              DesiredMode desired_mode,
@@ -1158,7 +1168,7 @@ namespace ARMware
       gp_core->CurrentInstRecallEntry().mCurrentRegNum = lsw->rd_num();
 #endif
       
-      gp_core->template put_data<BYTE>(
+      gp_core->template put_data<T_mode, BYTE>(
         address,
         static_cast<DataWidthTraits<BYTE>::UnsignedType>(
           gp_core->CurReg(lsw->rd_num()) & 0xFF
@@ -1175,7 +1185,8 @@ namespace ARMware
     }
     
     // STR or STRT
-    template<typename mode,
+    template<TranslationModeEnum T_mode,
+             typename mode,
              AddressingMode addressing_mode,
              Direction direction,
              DesiredMode desired_mode,
@@ -1240,7 +1251,7 @@ namespace ARMware
       gp_core->CurrentInstRecallEntry().mCurrentRegNum = lsw->rd_num();
 #endif
       
-      gp_core->template put_data<WORD>(
+      gp_core->template put_data<T_mode, WORD>(
         real_address,
         store_value,
         lsw->assume_mode(),
@@ -1262,11 +1273,12 @@ namespace ARMware
            DesiredMode desired_mode,
            IsLoad is_load,
            UsageEnum T_usage>
+  template<TranslationModeEnum T_mode>
   inline void
   InstLSW<mode, addressing_mode, direction, data_width_enum, desired_mode, is_load, T_usage>::
   operation_internal(bool &exception_occur) const
   {
-    operation_internal_helper(this, exception_occur);
+    operation_internal_helper<T_mode>(this, exception_occur);
   }
   
   /////////////////////////////////////////////////////////////////////////////
@@ -1275,7 +1287,8 @@ namespace ARMware
   namespace
   {
     // Used for pre-index & post-index addressing mode
-    template<typename mode,
+    template<TranslationModeEnum T_mode,
+             typename mode,
              AddressingMode addressing_mode,
              Direction direction,
              DataWidthEnum data_width_enum,
@@ -1307,7 +1320,7 @@ namespace ARMware
       
       uint32_t const orig_rn_value = lsw->rn();
       
-      lsw->operation_internal(exception_occur);
+      lsw->template operation_internal<T_mode>(exception_occur);
       
       if (true == exception_occur)
       {
@@ -1316,7 +1329,8 @@ namespace ARMware
     }
     
     // Special case for offset addressing mode
-    template<typename mode,
+    template<TranslationModeEnum T_mode,
+             typename mode,
              Direction direction,
              DataWidthEnum data_width_enum,
              DesiredMode desired_mode,
@@ -1342,7 +1356,7 @@ namespace ARMware
       // Offset addressing mode means no write-back.
       // Thus I don't need to consider the restore of the original base register (Rn).
       
-      lsw->operation_internal(exception_occur);
+      lsw->template operation_internal<T_mode>(exception_occur);
     }
   }
   
@@ -1353,11 +1367,12 @@ namespace ARMware
            DesiredMode desired_mode,
            IsLoad is_load,
            UsageEnum T_usage>
+  template<TranslationModeEnum T_mode>
   inline void
   InstLSW<mode, addressing_mode, direction, data_width_enum, desired_mode, is_load, T_usage>::
   operation(bool &exception_occur) const
   {
-    operation_helper(this, exception_occur);
+    operation_helper<T_mode>(this, exception_occur);
   }
   
   /////////////////////////////////////////////////////////////////////////////
@@ -1467,6 +1482,7 @@ namespace ARMware
            DesiredMode desired_mode,
            IsLoad is_load,
            UsageEnum T_usage>
+  template<TranslationModeEnum T_mode>
   inline ExecResultEnum
   InstLSW<mode, addressing_mode, direction, data_width_enum, desired_mode, is_load, T_usage>::
   Process(Inst const inst)
@@ -1496,7 +1512,7 @@ namespace ARMware
     }
 #endif
     
-    operation(exception_occur);
+    operation<T_mode>(exception_occur);
     
     if (true == exception_occur)
     {
@@ -899,6 +899,40 @@ namespace ARMware
       default: assert(!"Should not reach here."); break;
       }
     }
+    
+    // Only LDR & STR with an immediate offset and no writeback can be a
+    // MmioSite.
+    template<typename mode,
+             AddressingMode addressing_mode,
+             Direction direction,
+             DataWidthEnum data_width_enum,
+             DesiredMode desired_mode,
+             IsLoad is_load,
+             UsageEnum T_usage>
+    inline MmioSite *
+    new_mmio_site_helper(InstLSW<mode,
+                         addressing_mode,
+                         direction,
+                         data_width_enum,
+                         desired_mode,
+                         is_load,
+                         T_usage> const * const /* lsw */)
+    {
+      return 0;
+    }
+    
+    template<Direction direction, IsLoad is_load, UsageEnum T_usage>
+    inline MmioSite *
+    new_mmio_site_helper(InstLSW<ImmLSW,
+                         OFFSET,
+                         direction,
+                         WORD,
+                         CURRENT_MODE,
+                         is_load,
+                         T_usage> const * const lsw)
+    {
+      return gp_chunk->new_mmio_site(lsw->m_inst, lsw->dt_func);
+    }
   }
   
   template<typename mode,
@@ -916,13 +950,33 @@ namespace ARMware
     
     determine_dt_func_helper(this);
     
-    Label * const routine_label =
-      gp_chunk->add_new_label(new Label(static_cast<LabelRoutine *>(0), dt_func));
+    gp_chunk->record_access_idx_DT();
+    
+    MmioSite * const site = new_mmio_site_helper(this);
     
-    gp_chunk->append_mir<MIR_FOR_NORMAL>(
-      new MIR(static_cast<MIRCall_1 *>(0),
-              routine_label,
-              gp_chunk->find_const_var(m_inst.mRawData)));
+    if (site != 0)
+    {
+      // exec_mmio_site_DT() returns the same values as the threaded code
+      // routine, thus the jump table below is the same.
+      Label * const routine_label =
+        gp_chunk->add_new_label(new Label(static_cast<LabelRoutine *>(0),
+                                          reinterpret_cast<DTFunc_t>(exec_mmio_site_DT)));
+      
+      gp_chunk->append_mir<MIR_FOR_NORMAL>(
+        new MIR(static_cast<MIRCall_1 *>(0),
+                routine_label,
+                gp_chunk->find_const_var(reinterpret_cast<uint32_t>(site))));
+    }
+    else
+    {
+      Label * const routine_label =
+        gp_chunk->add_new_label(new Label(static_cast<LabelRoutine *>(0), dt_func));
+      
+      gp_chunk->append_mir<MIR_FOR_NORMAL>(
+        new MIR(static_cast<MIRCall_1 *>(0),
+                routine_label,
+                gp_chunk->find_const_var(m_inst.mRawData)));
+    }
     
     Variable * const tmp1 = gp_chunk->get_new_temp();
     gp_chunk->append_mir<MIR_FOR_NORMAL>(new MIR(static_cast<MIRRetrieve *>(0), 1, tmp1));
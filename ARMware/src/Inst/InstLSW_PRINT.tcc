@@ -17,7 +17,7 @@
 
 namespace ARMware
 {
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
   template<typename mode,
            AddressingMode addressing_mode,
            Direction direction,
@@ -32,29 +32,29 @@ namespace ARMware
     switch (which_sft_type())
     {
     case LSL:
-      g_log_file << ", LSL #"
-                << sft_imm();
+      g_chunk_code_log << ", LSL #"
+                      << sft_imm();
       break;
       
     case LSR:
-      g_log_file << ", LSR #"
-                << sft_imm();
+      g_chunk_code_log << ", LSR #"
+                      << sft_imm();
       break;
       
     case ASR:
-      g_log_file << ", ASR #"
-                << sft_imm();
+      g_chunk_code_log << ", ASR #"
+                      << sft_imm();
       break;
       
     case ROR:
       if (0 == sft_imm())
       {
-        g_log_file << ", RRX";
+        g_chunk_code_log << ", RRX";
       }
       else
       {
-        g_log_file << ", ROR #"
-                  << sft_imm();
+        g_chunk_code_log << ", ROR #"
+                        << sft_imm();
       }
       break;
       
@@ -85,32 +85,32 @@ namespace ARMware
       switch (addressing_mode)
       {
       case OFFSET:
-        g_log_file << "["
-                  << CoreRegName(lsw->rn_num())
-                  << ", #"
-                  << ((UP == direction) ? "+" : "-")
-                  << static_cast<int32_t>(lsw->offset_without_check())
-                  << "]"
-                  << std::endl;
+        g_chunk_code_log << "["
+                        << CoreRegName(lsw->rn_num())
+                        << ", #"
+                        << ((UP == direction) ? "+" : "-")
+                        << static_cast<int32_t>(lsw->offset_without_check())
+                        << "]"
+                        << std::endl;
         break;
         
       case PRE_IDX:
-        g_log_file << "["
-                  << CoreRegName(lsw->rn_num())
-                  << ", #"
-                  << ((UP == direction) ? "+" : "-")
-                  << static_cast<int32_t>(lsw->offset_without_check())
-                  << "]!"
-                  << std::endl;
+        g_chunk_code_log << "["
+                        << CoreRegName(lsw->rn_num())
+                        << ", #"
+                        << ((UP == direction) ? "+" : "-")
+                        << static_cast<int32_t>(lsw->offset_without_check())
+                        << "]!"
+                        << std::endl;
         break;
         
       case POST_IDX:
-        g_log_file << "["
-                  << CoreRegName(lsw->rn_num())
-                  << "], #"
-                  << ((UP == direction) ? "+" : "-")
-                  << static_cast<int32_t>(lsw->offset_without_check())
-                  << std::endl;
+        g_chunk_code_log << "["
+                        << CoreRegName(lsw->rn_num())
+                        << "], #"
+                        << ((UP == direction) ? "+" : "-")
+                        << static_cast<int32_t>(lsw->offset_without_check())
+                        << std::endl;
         break;
         
       default:
@@ -137,40 +137,40 @@ namespace ARMware
       switch (addressing_mode)
       {
       case OFFSET:
-        g_log_file << "["
-                  << CoreRegName(lsw->rn_num())
-                  << ", "
-                  << ((UP == direction) ? "+" : "-")
-                  << CoreRegName(lsw->rm_num());
+        g_chunk_code_log << "["
+                        << CoreRegName(lsw->rn_num())
+                        << ", "
+                        << ((UP == direction) ? "+" : "-")
+                        << CoreRegName(lsw->rm_num());
         
         lsw->print_sft_field();
         
-        g_log_file << "]";
+        g_chunk_code_log << "]";
         break;
         
       case PRE_IDX:
-        g_log_file << "["
-                  << CoreRegName(lsw->rn_num())
-                  << ", "
-                  << ((UP == direction) ? "+" : "-")
-                  << CoreRegName(lsw->rm_num());
+        g_chunk_code_log << "["
+                        << CoreRegName(lsw->rn_num())
+                        << ", "
+                        << ((UP == direction) ? "+" : "-")
+                        << CoreRegName(lsw->rm_num());
         
         lsw->print_sft_field();
         
-        g_log_file << "]!";
+        g_chunk_code_log << "]!";
         break;
         
       case POST_IDX:
-        g_log_file << "["
-                  << CoreRegName(lsw->rn_num())
-                  << "], "
-                  << ((UP == direction) ? "+" : "-")
-                  << CoreRegName(lsw->rm_num())
-                  << ", ";
+        g_chunk_code_log << "["
+                        << CoreRegName(lsw->rn_num())
+                        << "], "
+                        << ((UP == direction) ? "+" : "-")
+                        << CoreRegName(lsw->rm_num())
+                        << ", ";
         
         lsw->print_sft_field();
         
-        g_log_file << std::endl;
+        g_chunk_code_log << std::endl;
         break;
         
       default:
@@ -178,7 +178,7 @@ namespace ARMware
         break;
       }
       
-      g_log_file << std::endl;
+      g_chunk_code_log << std::endl;
     }
   }
   
@@ -197,8 +197,8 @@ namespace ARMware
     
     if (LOAD == is_load)
     {
-      g_log_file << "LDR"
-                << CondName(m_inst);
+      g_chunk_code_log << "LDR"
+                      << CondName(m_inst);
       
       if (BYTE == data_width_enum)
       {
@@ -206,13 +206,13 @@ namespace ARMware
         {
           // LDRBT
           
-          g_log_file << "BT";
+          g_chunk_code_log << "BT";
         }
         else
         {
           // LDRB
           
-          g_log_file << "B";
+          g_chunk_code_log << "B";
         }
       }
       else
@@ -223,7 +223,7 @@ namespace ARMware
         {
           // LDRT
           
-          g_log_file << "T";
+          g_chunk_code_log << "T";
         }
         else
         {
@@ -233,8 +233,8 @@ namespace ARMware
     }
     else
     {
-      g_log_file << "STR"
-                << CondName(m_inst);
+      g_chunk_code_log << "STR"
+                      << CondName(m_inst);
       
       if (BYTE == data_width_enum)
       {
@@ -242,13 +242,13 @@ namespace ARMware
         {
           // STRBT
           
-          g_log_file << "BT";
+          g_chunk_code_log << "BT";
         }
         else
         {
           // STRB
           
-          g_log_file << "B";
+          g_chunk_code_log << "B";
         }
       }
       else
@@ -259,7 +259,7 @@ namespace ARMware
         {
           // STRT
           
-          g_log_file << "T";
+          g_chunk_code_log << "T";
         }
         else
         {
@@ -268,9 +268,9 @@ namespace ARMware
       }
     }
     
-    g_log_file << " "
-               << CoreRegName(rd_num())
-               << ", ";
+    g_chunk_code_log << " "
+                     << CoreRegName(rd_num())
+                     << ", ";
     
     print_code_helper(this);
   }
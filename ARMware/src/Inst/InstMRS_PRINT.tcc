@@ -17,7 +17,7 @@
 
 namespace ARMware
 {
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
   template<UseWhichStatus use_which_status>
   inline void
   InstMRS<use_which_status>::
@@ -25,13 +25,13 @@ namespace ARMware
   {
     m_inst = inst;
     
-    g_log_file << "MRS"
-              << CondName(m_inst)
-              << " "
-              << CoreRegName(rd_num())
-              << ", "
-              << ((USE_CPSR == use_which_status) ? "CPSR" : "SPSR")
-              << std::endl;
+    g_chunk_code_log << "MRS"
+                    << CondName(m_inst)
+                    << " "
+                    << CoreRegName(rd_num())
+                    << ", "
+                    << ((USE_CPSR == use_which_status) ? "CPSR" : "SPSR")
+                    << std::endl;
   }
 #endif
 }
@@ -72,7 +72,7 @@ namespace ARMware
 #endif
 #endif
     
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
     void print_fields() const;
     void print_code(Inst const inst);
 #endif
@@ -17,7 +17,7 @@
 
 namespace ARMware
 {
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
   template<typename mode, UseWhichStatus use_which_status>
   inline void
   InstMSR<mode, use_which_status>::
@@ -29,80 +29,80 @@ namespace ARMware
       break;
       
     case FieldTraits<CONTROL>::INST_BITMASK: // 0001
-      g_log_file << "c";
+      g_chunk_code_log << "c";
       break;
       
     case FieldTraits<EXTENSION>::INST_BITMASK: // 0010
-      g_log_file << "x";
+      g_chunk_code_log << "x";
       break;
       
     case (FieldTraits<EXTENSION>::INST_BITMASK |
           FieldTraits<CONTROL>::INST_BITMASK): // 0011
-      g_log_file << "cx";
+      g_chunk_code_log << "cx";
       break;
       
     case FieldTraits<STATUS>::INST_BITMASK: // 0100
-      g_log_file << "s";
+      g_chunk_code_log << "s";
       break;
       
     case (FieldTraits<STATUS>::INST_BITMASK |
           FieldTraits<CONTROL>::INST_BITMASK): // 0101
-      g_log_file << "cs";
+      g_chunk_code_log << "cs";
       break;
       
     case (FieldTraits<STATUS>::INST_BITMASK |
           FieldTraits<EXTENSION>::INST_BITMASK): // 0110
-      g_log_file << "xs";
+      g_chunk_code_log << "xs";
       break;
       
     case (FieldTraits<STATUS>::INST_BITMASK |
           FieldTraits<EXTENSION>::INST_BITMASK |
           FieldTraits<CONTROL>::INST_BITMASK): // 0111
-      g_log_file << "cxs";
+      g_chunk_code_log << "cxs";
       break;
       
     case FieldTraits<FLAGS>::INST_BITMASK: // 1000
-      g_log_file << "f";
+      g_chunk_code_log << "f";
       break;
       
     case (FieldTraits<FLAGS>::INST_BITMASK |
           FieldTraits<CONTROL>::INST_BITMASK): // 1001
-      g_log_file << "cf";
+      g_chunk_code_log << "cf";
       break;
       
     case (FieldTraits<FLAGS>::INST_BITMASK |
           FieldTraits<EXTENSION>::INST_BITMASK): // 1010
-      g_log_file << "xf";
+      g_chunk_code_log << "xf";
       break;
       
     case (FieldTraits<FLAGS>::INST_BITMASK |
           FieldTraits<EXTENSION>::INST_BITMASK |
           FieldTraits<CONTROL>::INST_BITMASK): // 1011
-      g_log_file << "cxf";
+      g_chunk_code_log << "cxf";
       break;
       
     case (FieldTraits<FLAGS>::INST_BITMASK |
           FieldTraits<STATUS>::INST_BITMASK): // 1100
-      g_log_file << "sf";
+      g_chunk_code_log << "sf";
       break;
       
     case (FieldTraits<FLAGS>::INST_BITMASK |
           FieldTraits<STATUS>::INST_BITMASK |
           FieldTraits<CONTROL>::INST_BITMASK): // 1101
-      g_log_file << "csf";
+      g_chunk_code_log << "csf";
       break;
       
     case (FieldTraits<FLAGS>::INST_BITMASK |
           FieldTraits<STATUS>::INST_BITMASK |
           FieldTraits<EXTENSION>::INST_BITMASK): // 1110
-      g_log_file << "xsf";
+      g_chunk_code_log << "xsf";
       break;
       
     case (FieldTraits<FLAGS>::INST_BITMASK |
           FieldTraits<STATUS>::INST_BITMASK |
           FieldTraits<EXTENSION>::INST_BITMASK |
           FieldTraits<CONTROL>::INST_BITMASK): // 1111
-      g_log_file << "cxsf";
+      g_chunk_code_log << "cxsf";
       break;
       
     default:
@@ -117,14 +117,14 @@ namespace ARMware
     inline void
     print_code_helper(InstMSR<ImmMSR, use_which_status> const * const msr)
     {
-      g_log_file << msr->Imm();
+      g_chunk_code_log << msr->Imm();
     }
     
     template<UseWhichStatus use_which_status>
     inline void
     print_code_helper(InstMSR<RegMSR, use_which_status> const * const msr)
     {
-      g_log_file << CoreRegName(msr->rm_num());
+      g_chunk_code_log << CoreRegName(msr->rm_num());
     }
   }
   
@@ -135,18 +135,18 @@ namespace ARMware
   {
     m_inst = inst;
     
-    g_log_file << "MSR"
-              << CondName(m_inst)
-              << " "
-              << ((USE_CPSR == use_which_status) ? "CPSR_" : "SPSR_");
+    g_chunk_code_log << "MSR"
+                    << CondName(m_inst)
+                    << " "
+                    << ((USE_CPSR == use_which_status) ? "CPSR_" : "SPSR_");
     
     print_fields();
     
-    g_log_file << ", ";
+    g_chunk_code_log << ", ";
     
     print_code_helper(this);
     
-    g_log_file << std::endl;
+    g_chunk_code_log << std::endl;
   }
 #endif
 }
@@ -61,7 +61,7 @@ namespace ARMware
     void gen_dt_code(Inst const inst, bool const is_last);
 #endif
     
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
     void print_code(Inst const inst);
 #endif
   };
@@ -17,7 +17,7 @@
 
 namespace ARMware
 {
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
   template<IsLong is_long, IsSigned is_signed, IsAccumulate is_accumulate, IsUpdateStatus is_update_status>
   inline void
   InstMulti<is_long, is_signed, is_accumulate, is_update_status>::
@@ -31,33 +31,33 @@ namespace ARMware
       {
         // MUL or MULS
         
-        g_log_file << "MUL"
-                  << CondName(mInst)
-                  << ((NO_UPDATE_STATUS == is_update_status) ? "" : "S")
-                  << " "
-                  << CoreRegName(RdNum())
-                  << ", "
-                  << CoreRegName(RmNum())
-                  << ", "
-                  << CoreRegName(RsNum())
-                  << std::endl;
+        g_chunk_code_log << "MUL"
+                        << CondName(mInst)
+                        << ((NO_UPDATE_STATUS == is_update_status) ? "" : "S")
+                        << " "
+                        << CoreRegName(RdNum())
+                        << ", "
+                        << CoreRegName(RmNum())
+                        << ", "
+                        << CoreRegName(RsNum())
+                        << std::endl;
       }
       else
       {
         // MLA or MLAS
         
-        g_log_file << "MLA"
-                  << CondName(mInst)
-                  << ((NO_UPDATE_STATUS == is_update_status) ? "" : "S")
-                  << " "
-                  << CoreRegName(RdNum())
-                  << ", "
-                  << CoreRegName(RmNum())
-                  << ", "
-                  << CoreRegName(RsNum())
-                  << ", "
-                  << CoreRegName(RnNum())
-                  << std::endl;
+        g_chunk_code_log << "MLA"
+                        << CondName(mInst)
+                        << ((NO_UPDATE_STATUS == is_update_status) ? "" : "S")
+                        << " "
+                        << CoreRegName(RdNum())
+                        << ", "
+                        << CoreRegName(RmNum())
+                        << ", "
+                        << CoreRegName(RsNum())
+                        << ", "
+                        << CoreRegName(RnNum())
+                        << std::endl;
       }
     }
     else
@@ -66,35 +66,35 @@ namespace ARMware
       {
         // UMULL{S} or UMLAL{S}
         
-        g_log_file << ((NO_ACCUMULATE == is_accumulate) ? "UMULL" : "UMLAL")
-                   << CondName(mInst)
-                   << ((NO_UPDATE_STATUS == is_update_status) ? "" : "S")
-                   << " "
-                   << CoreRegName(RdLoNum())
-                   << ", "
-                   << CoreRegName(RdHiNum())
-                   << ", "
-                   << CoreRegName(RmNum())
-                   << ", "
-                   << CoreRegName(RsNum())
-                   << std::endl;
+        g_chunk_code_log << ((NO_ACCUMULATE == is_accumulate) ? "UMULL" : "UMLAL")
+                         << CondName(mInst)
+                         << ((NO_UPDATE_STATUS == is_update_status) ? "" : "S")
+                         << " "
+                         << CoreRegName(RdLoNum())
+                         << ", "
+                         << CoreRegName(RdHiNum())
+                         << ", "
+                         << CoreRegName(RmNum())
+                         << ", "
+                         << CoreRegName(RsNum())
+                         << std::endl;
       }
       else
       {
         // SMULL{S} or SMLAL{S}
         
-        g_log_file << ((NO_ACCUMULATE == is_accumulate) ? "SMULL" : "SMLAL")
-                  << CondName(mInst)
-                  << ((NO_UPDATE_STATUS == is_update_status) ? "" : "S")
-                  << " "
-                  << CoreRegName(RdLoNum())
-                  << ", "
-                  << CoreRegName(RdHiNum())
-                  << ", "
-                  << CoreRegName(RmNum())
-                  << ", "
-                  << CoreRegName(RsNum())
-                  << std::endl;
+        g_chunk_code_log << ((NO_ACCUMULATE == is_accumulate) ? "SMULL" : "SMLAL")
+                        << CondName(mInst)
+                        << ((NO_UPDATE_STATUS == is_update_status) ? "" : "S")
+                        << " "
+                        << CoreRegName(RdLoNum())
+                        << ", "
+                        << CoreRegName(RdHiNum())
+                        << ", "
+                        << CoreRegName(RmNum())
+                        << ", "
+                        << CoreRegName(RsNum())
+                        << std::endl;
       }
     }
   }
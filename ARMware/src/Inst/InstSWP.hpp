@@ -40,6 +40,8 @@ namespace ARMware
     
     uint32_t Rotate(uint32_t const temp, uint32_t const address) const;
     
+    // @T_mode: see Core::virtual_to_physical().
+    template<TranslationModeEnum T_mode>
     void Operation(bool &exception_occur) const;
     
 #if CHECK_UNPREDICTABLE
@@ -50,6 +52,7 @@ namespace ARMware
     
     // Operation
     
+    template<TranslationModeEnum T_mode>
     ExecResultEnum Process(Inst const inst);
     
 #if ENABLE_DYNAMIC_TRANSLATOR
@@ -60,7 +63,7 @@ namespace ARMware
 #endif
 #endif
     
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
     void print_code(Inst const inst);
 #endif
   };
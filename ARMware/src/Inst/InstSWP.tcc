@@ -152,6 +152,7 @@ namespace ARMware
   // the load access, the store access does not occur.
   
   template<DataWidthEnum data_width_enum, UsageEnum T_usage>
+  template<TranslationModeEnum T_mode>
   inline void
   InstSWP<data_width_enum, T_usage>::
   Operation(bool &exception_occur) const
@@ -190,7 +191,7 @@ namespace ARMware
     // However, because of 'temp' is a local variable,
     // thus I choose overwrite its value whether an exception occurs or not.
     typename DataWidthTraits<data_width_enum>::UnsignedType temp =
-      gp_core->template get_data<data_width_enum, DATA>(real_address, gp_core->CurrentMode(), exception_occur);
+      gp_core->template get_data<T_mode, data_width_enum, DATA>(real_address, gp_core->CurrentMode(), exception_occur);
     
     if (true == exception_occur)
     {
@@ -201,7 +202,7 @@ namespace ARMware
     
     uint32_t const store_value = Rm();
     
-    gp_core->template put_data<data_width_enum>(
+    gp_core->template put_data<T_mode, data_width_enum>(
       address,
       static_cast<typename DataWidthTraits<data_width_enum>::UnsignedType>(store_value),
       gp_core->CurrentMode(), exception_occur);
@@ -220,6 +221,7 @@ namespace ARMware
   // Process
   
   template<DataWidthEnum data_width_enum, UsageEnum T_usage>
+  template<TranslationModeEnum T_mode>
   inline ExecResultEnum
   InstSWP<data_width_enum, T_usage>::
   Process(Inst const inst)
@@ -241,7 +243,7 @@ namespace ARMware
     gp_core->dump_cpu_info<false>();
 #endif
     
-    Operation(exception_occur);
+    Operation<T_mode>(exception_occur);
     
     if (true == exception_occur)
     {
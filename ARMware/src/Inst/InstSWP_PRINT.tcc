@@ -17,7 +17,7 @@
 
 namespace ARMware
 {
-#if PRINT_CHUNK_CODE
+#if ENABLE_DYNAMIC_TRANSLATOR
   template<DataWidthEnum data_width_enum, UsageEnum T_usage>
   inline void
   InstSWP<data_width_enum, T_usage>::
@@ -25,17 +25,17 @@ namespace ARMware
   {
     mInst = inst;
     
-    g_log_file << "SWP"
-              << CondName(mInst)
-              << ((BYTE == data_width_enum) ? "B" : "")
-              << " "
-              << CoreRegName(RdNum())
-              << ", "
-              << CoreRegName(RmNum())
-              << ", ["
-              << CoreRegName(RnNum())
-              << "]"
-              << std::endl;
+    g_chunk_code_log << "SWP"
+                    << CondName(mInst)
+                    << ((BYTE == data_width_enum) ? "B" : "")
+                    << " "
+                    << CoreRegName(RdNum())
+                    << ", "
+                    << CoreRegName(RmNum())
+                    << ", ["
+                    << CoreRegName(RnNum())
+                    << "]"
+                    << std::endl;
   }
 #endif
 }
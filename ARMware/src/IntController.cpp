@@ -29,6 +29,18 @@
 
 namespace ARMware
 {
+  //////////////////////////////// Private ////////////////////////////////////
+  //============================== Operation ==================================
+  
+  void
+  IntController::write_ICCR(uint32_t const /* address */, uint32_t const value)
+  {
+    // :SA-1110 Developer's Manual: p.89: Wei 2004-May-09:
+    //
+    // bits[31:1] are reserved.
+    m_ICCR = (value & 0x1);
+  }
+  
   //////////////////////////////// Public /////////////////////////////////////
   //============================== Life cycle =================================
   
@@ -47,9 +59,24 @@ namespace ARMware
       mp_lcd_controller(lcd_controller),
       mp_serial_1(serial_1),
       mp_serial_2(serial_2),
-      mp_serial_3(serial_3)
+      mp_serial_3(serial_3),
+      m_register_bank(this, "int_controller", ICIP, (ICPR + 4) - ICIP)
   {
     init_register();
+    
+    uint32_t const status_flags = (RegisterBankBase::REG_READ | RegisterBankBase::REG_VOLATILE);
+    
+    // :SA-1110 Developer's Manual: Wei 2003-Dec-09:
+    //
+    // ICIP, ICFP & ICPR are read-only registers.
+    m_register_bank.add_plain(ICIP, "ICIP", &m_ICIP, status_flags);
+    m_register_bank.add_plain(ICMR, "ICMR", &m_ICMR);
+    m_register_bank.add_plain(ICLR, "ICLR", &m_ICLR);
+    m_register_bank.add(ICCR, "ICCR",
+                        RegisterBankBase::REG_READ_WRITE | RegisterBankBase::REG_WRITE_SIDE_EFFECT,
+                        &m_ICCR, 0, &IntController::write_ICCR);
+    m_register_bank.add_plain(ICFP, "ICFP", &m_ICFP, status_flags);
+    m_register_bank.add_plain(ICPR, "ICPR", &m_ICPR, status_flags);
   }
   
   //============================== Operation ==================================
@@ -471,74 +498,17 @@ namespace ARMware
   uint32_t
   IntController::get_data(uint32_t const address) const
   {
-    switch (address)
-    {
-    case ICIP: return m_ICIP;
-    case ICMR: return m_ICMR;
-    case ICLR: return m_ICLR;
-    case ICCR: return m_ICCR;
-    case ICFP: return m_ICFP;
-    case ICPR: return m_ICPR;
-      
-    default:
-      assert(!"Should not reach here.");
-      return 0;
-    }
+    return m_register_bank.read(address);
   }
   
   template<>
   void
   IntController::put_data(uint32_t const address, uint32_t const value)
   {
-    switch (address)
-    {
-    case ICIP:
-      // :SA-1110 Developer's Manual: Wei 2003-Dec-09:
-      //
-      // ICIP is a read-only register
-      assert(!"Should not reach here.");
-      break;
-      
-    case ICMR:
 #if TRACE_INTERRUPT
-      g_log_file << "INTR: signal mask = " << std::hex << value << std::endl;
+    g_log_file << "INTR: put " << std::hex << value << " at " << address << std::endl;
 #endif
-      
-      m_ICMR = value;
-      break;
-      
-    case ICLR:
-#if TRACE_INTERRUPT
-      g_log_file << "INTR: signal level = " << std::hex << value << std::endl;
-#endif
-      
-      m_ICLR = value;
-      break;
-      
-    case ICCR:
-      // :SA-1110 Developer's Manual: p.89: Wei 2004-May-09:
-      //
-      // bits[31:1] are reserved.
-      m_ICCR = (value & 0x1);
-      break;
-      
-    case ICFP:
-      // :SA-1110 Developer's Manual: Wei 2003-Dec-09:
-      //
-      // ICFP is a read-only register
-      assert(!"Should not reach here.");
-      break;
-      
-    case ICPR:
-      // :SA-1110 Developer's Manual: Wei 2003-Dec-09:
-      //
-      // ICPR is a read-only register
-      assert(!"Should not reach here.");
-      break;
-      
-    default:
-      assert(!"Should not reach here.");
-      break;
-    }
+    
+    m_register_bank.write(address, value);
   }
 }
@@ -27,6 +27,7 @@
 //
 
 #include "ARMware.hpp"
+#include "RegisterBank.hpp"
 
 namespace ARMware
 {
@@ -130,7 +131,9 @@ namespace ARMware
     uint32_t m_ICCR;
     uint32_t m_ICFP;
     uint32_t m_ICPR;
-        
+    
+    RegisterBank<IntController> m_register_bank;
+    
     enum
     {
       ICCR_DIM_BITMASK = 0x1
@@ -149,6 +152,8 @@ namespace ARMware
       m_ICPR = 0;
     }
     
+    void write_ICCR(uint32_t const address, uint32_t const value);
+    
     template<typename T_serial_port>
     void check_UART_interrupt(Uart<T_serial_port> const &uart);
     
@@ -15,10 +15,215 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 //
 
+#if TRACE_LCD
+#include <iostream>
+#endif
+
 #include "LCDController.hpp"
+#include "Memory.hpp"
+#include "Gtk/MachineScreen.hpp"
 
 namespace ARMware
 {
+  //////////////////////////////// Private ////////////////////////////////////
+  //============================== Operation ==================================
+  
+  void
+  LCDController::write_LCCR0(uint32_t const /* address */, uint32_t const value)
+  {
+#if TRACE_LCD
+    g_log_file << "LCD: LCCR0: " << std::hex << value << std::endl;
+#endif
+    
+    uint32_t const diff = (m_LCCR0 ^ value);
+    
+    if ((diff & LCCR0_LEN) != 0)
+    {
+      if (0 == (value & LCCR0_LEN))
+      {
+#if TRACE_LCD
+        g_log_file << "LCD: disable lcd" << std::endl;
+#endif
+        
+        m_LCSR |= LCSR_LDD;
+        
+        if (mp_machine_screen != 0)
+        {
+          mp_machine_screen->disable_drawing();
+        }
+        mp_memory->disable_drawing();
+        g_frame_capture.disable_drawing();
+      }
+      else
+      {
+#if TRACE_LCD
+        g_log_file << "LCD: enable lcd" << std::endl;
+#endif
+        
+        // :NOTE: Wei 2004-Jun-06:
+        //
+        // ARMware supports only TFT (active) mode now.
+        assert(LCCR0_PAS == (value & LCCR0_PAS));
+        
+        // :SA-1110 Developer's Manual: Wei 2003-Dec-08:
+        //
+        // Value in DBAR1(or 2) is transferred to DCAR1(or 2) when LCD is first enabled (LEN = 0->1).
+        m_DCAR1 = m_DBAR1;
+        m_DCAR2 = m_DBAR2;
+        
+        // :SA-1110 Developer's Manual: p.249: Wei 2004-Jan-15:
+        //
+        // The base address update status (BAU) is a read/write status bit
+        // that is set after the contents of the DMA base address register 1
+        // are transferred to the DMA current Address register 1.
+        m_LCSR |= LCSR_BAU;
+        
+        if (mp_machine_screen != 0)
+        {
+          mp_machine_screen->enable_drawing();
+        }
+        mp_memory->enable_drawing();
+        g_frame_capture.enable_drawing();
+      }
+    }
+    
+    if ((diff & LCCR0_SDS) != 0)
+    {
+      if (0 == (value & LCCR0_SDS))
+      {
+        // singal panel
+        if (mp_machine_screen != 0)
+        {
+          mp_machine_screen->disable_dual_panel();
+        }
+        mp_memory->disable_dual_panel();
+        g_frame_capture.disable_dual_panel();
+      }
+      else
+      {
+        // dual panels
+        if (mp_machine_screen != 0)
+        {
+          mp_machine_screen->enable_dual_panel();
+        }
+        mp_memory->enable_dual_panel();
+        g_frame_capture.enable_dual_panel();
+      }
+    }
+    
+    m_LCCR0 = (value & (0xFFFFF ^ (1 << 6)));
+  }
+  
+  void
+  LCDController::write_LCCR1(uint32_t const /* address */, uint32_t const value)
+  {
+#if TRACE_LCD
+    g_log_file << "LCD: LCCR1: " << std::hex << value << std::endl;
+#endif
+    
+    // :SA-1110 Developer's Manual: Wei 2004-Jan-13:
+    //
+    // Note that the bottom four bits of PPL are not implemented and
+    // therefore are not writable. Reads of these bits return zeros
+    // because the LCD controller only supports displays that are a
+    // multiple of 16 pixels wide.
+    m_LCCR1 = (value & 0xFFFFFFF0);
+  }
+  
+  void
+  LCDController::write_LCCR3(uint32_t const /* address */, uint32_t const value)
+  {
+#if TRACE_LCD
+    g_log_file << "LCD: LCCR3: " << std::hex << value << std::endl;
+#endif
+    
+    m_LCCR3 = (value & 0xFFFFFF);
+  }
+  
+  void
+  LCDController::write_DBAR1(uint32_t const /* address */, uint32_t const value)
+  {
+#if TRACE_LCD
+    g_log_file << "LCD: DBAR1: " << std::hex << value << std::endl;
+#endif
+    
+    // :SA-1110 Developer's Manual: p.245: Wei 2003-Dec-08:
+    //
+    // Addresses programmed in the base address register must be aligned
+    // on quadword boundaries;
+    // the least significant four bits (DBAR1[3:0]) must always be written with zeros.
+    assert(0 == (value & 0xF));
+    
+    // :NOTE: Wei 2004-Jan-15:
+    //
+    // If we want to change the frame buffer address,
+    // we are likely need to update the whole screen.
+    if (m_DBAR1 != value)
+    {
+      m_DBAR1 = value;
+      
+      if (mp_machine_screen != 0)
+      {
+        mp_machine_screen->set_frame_buffer_addr_1(m_DBAR1);
+        mp_machine_screen->update_panel<MachineScreen::PANEL_1>();
+      }
+      
+      mp_memory->set_frame_buffer_addr_1(m_DBAR1);
+      
+      // A guest which flips between 2 frame buffers writes DBAR1 once the
+      // new frame is done, thus this is also the request of the guest to
+      // take a frame.
+      g_frame_capture.set_frame_buffer_addr_1(m_DBAR1);
+      g_frame_capture.frame_flipped();
+    }
+  }
+  
+  void
+  LCDController::write_DBAR2(uint32_t const /* address */, uint32_t const value)
+  {
+#if TRACE_LCD
+    g_log_file << "LCD: DBAR2: " << std::hex << value << std::endl;
+#endif
+    
+    // :SA-1110 Developer's Manual: p.245: Wei 2003-Dec-08:
+    //
+    // Addresses programmed in the base address register must be aligned
+    // on quadword boundaries;
+    // the least significant four bits (DBAR1[3:0]) must always be written with zeros.
+    assert(0 == (value & 0xF));
+    
+    if (m_DBAR2 != value)
+    {
+      m_DBAR2 = value;
+      
+      if (mp_machine_screen != 0)
+      {
+        mp_machine_screen->set_frame_buffer_addr_2(m_DBAR2);
+        mp_machine_screen->update_panel<MachineScreen::PANEL_2>();
+      }
+      
+      mp_memory->set_frame_buffer_addr_2(m_DBAR2);
+      g_frame_capture.set_frame_buffer_addr_2(m_DBAR2);
+    }
+  }
+  
+  void
+  LCDController::write_LCSR(uint32_t const /* address */, uint32_t const value)
+  {
+#if TRACE_LCD
+    g_log_file << "LCD: LCSR: " << std::hex << value << std::endl;
+#endif
+    
+    // :SA-1110 Developer's Manual: p.248: Wei 2004-Jun-06:
+    //
+    // Status bits are referred to as 'sticky' (once set by hardware,
+    // they must be cleared by software). Writing a 1 to a sticky status bit clears it;
+    // writing a zero has no effect.
+    // Read-only flags are set and cleared by hardware; writes have no effect.
+    
+    m_LCSR &= ~(m_LCSR & (value & LCSR_READ_WRITE_BITMASK));
+  }
+  
   //////////////////////////////// Public /////////////////////////////////////
   //============================== Life cycle =================================
   
@@ -27,9 +232,29 @@ namespace ARMware
                                MachineScreen * const machine_screen)
     : mp_core(core),
       mp_memory(memory),
-      mp_machine_screen(machine_screen)
+      mp_machine_screen(machine_screen),
+      m_register_bank(this, "lcd_controller", LCCR0, (LCCR3 + 4) - LCCR0)
   {
     init_register();
+    
+    uint32_t const write_flags = (RegisterBankBase::REG_READ_WRITE | RegisterBankBase::REG_WRITE_SIDE_EFFECT);
+    
+    m_register_bank.add(LCCR0, "LCCR0", write_flags, &m_LCCR0, 0, &LCDController::write_LCCR0);
+    m_register_bank.add(LCSR, "LCSR", write_flags | RegisterBankBase::REG_VOLATILE,
+                        &m_LCSR, 0, &LCDController::write_LCSR);
+    m_register_bank.add(DBAR1, "DBAR1", write_flags, &m_DBAR1, 0, &LCDController::write_DBAR1);
+    m_register_bank.add(DBAR2, "DBAR2", write_flags, &m_DBAR2, 0, &LCDController::write_DBAR2);
+    
+    // :SA-1110 Developer's Manual: p.247: Wei 2004-Jun-06:
+    // :SA-1110 Developer's Manual: p.248: Wei 2004-Jun-06:
+    //
+    // DCAR1 & DCAR2 are read-only registers.
+    m_register_bank.add_plain(DCAR1, "DCAR1", &m_DCAR1, RegisterBankBase::REG_READ);
+    m_register_bank.add_plain(DCAR2, "DCAR2", &m_DCAR2, RegisterBankBase::REG_READ);
+    
+    m_register_bank.add(LCCR1, "LCCR1", write_flags, &m_LCCR1, 0, &LCDController::write_LCCR1);
+    m_register_bank.add_plain(LCCR2, "LCCR2", &m_LCCR2);
+    m_register_bank.add(LCCR3, "LCCR3", write_flags, &m_LCCR3, 0, &LCDController::write_LCCR3);
   }
   
   //============================== Operation ==================================
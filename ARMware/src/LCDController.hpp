@@ -24,6 +24,8 @@
 //
 
 #include "ARMware.hpp"
+#include "FrameCapture.hpp"
+#include "RegisterBank.hpp"
 
 namespace ARMware
 {
@@ -146,6 +148,8 @@ namespace ARMware
     uint32_t m_LCCR2; // LCD controller control register 2
     uint32_t m_LCCR3; // LCD controller control register 3
     
+    RegisterBank<LCDController> m_register_bank;
+    
     // Operation
     
     void
@@ -162,6 +166,13 @@ namespace ARMware
       m_LCCR3 = 0;
     }
     
+    void write_LCCR0(uint32_t const address, uint32_t const value);
+    void write_LCCR1(uint32_t const address, uint32_t const value);
+    void write_LCCR3(uint32_t const address, uint32_t const value);
+    void write_DBAR1(uint32_t const address, uint32_t const value);
+    void write_DBAR2(uint32_t const address, uint32_t const value);
+    void write_LCSR(uint32_t const address, uint32_t const value);
+    
     // Friend
     
     friend class IntController;
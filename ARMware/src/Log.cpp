@@ -21,6 +21,7 @@ namespace ARMware
 {
   SplittedLogStreamBuf g_stream_buf;
   std::ostream g_log_file(&g_stream_buf);
+  std::ostream g_chunk_code_log(&g_stream_buf);
   
   char const *SplittedLogStreamBuf::BASENAME = "armware_log";
 }
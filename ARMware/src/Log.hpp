@@ -29,6 +29,11 @@ namespace ARMware
 {
   extern std::ostream g_log_file;
   
+  // The chunk code printers (the ARM instructions, MIR & LIR of a dynamic
+  // translated chunk) write here. It shares the buffer of g_log_file, and
+  // ChunkInspector points it to its report while recompiling a chunk.
+  extern std::ostream g_chunk_code_log;
+  
   typedef class SplittedLogStreamBuf SplittedLogStreamBuf;
   class SplittedLogStreamBuf : public std::streambuf
   {
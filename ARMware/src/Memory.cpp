@@ -23,9 +23,22 @@
 #include "Memory.hpp"
 #include "ChunkChain.hpp"
 #include "platform_dep.hpp"
+#include "RuntimeStats.hpp"
+#include "Log.hpp"
 
 namespace ARMware
 {
+  namespace
+  {
+    inline uint32_t
+    native_page_aligned_size(uint32_t const size)
+    {
+      uint32_t const page_size = get_native_page_size();
+      
+      return (size + (page_size - 1)) & ~(page_size - 1);
+    }
+  }
+  
   //////////////////////////////// Private ////////////////////////////////////
   
 #if ENABLE_THREADED_CODE
@@ -36,6 +49,8 @@ namespace ARMware
   void
   Memory::segfault_handler()
   {
+    g_runtime_stats.increase(RuntimeStats::SMC_FAULT);
+    
     ms_chunk_chain->flush_chunk(ms_curr_addr);
     
     // :NOTE: Wei 2004-Aug-11:
@@ -73,13 +88,58 @@ namespace ARMware
   }
 #endif
   
+  // :NOTE: Wei 2004-Aug-11:
+  //
+  // According to the POSIX.1b, mprotect() can be used only on regions of memory obtained from mmap().
+  //
+  // Although in the linux platform, large memory allocation will use mmap() to allocate memory.
+  // However, to ensure memory allocation indeed uses mmap(), not just only in the linux platform,
+  // I use mmap() to allocate memory specifically.
+  //
+  // mmap() will allocate page-aligned memory directly from the Linux kernel.
+  //
+  // The DRAM is always allocated by memory_allocate() now (even if it
+  // won't be mprotect()ed), so that it can be backed by the huge pages of
+  // the host (see huge_page_setting()), which takes the 32 MB of DRAM off
+  // the host TLBs.
+  uint8_t *
+  Memory::allocate(uint32_t const size, HugePageEnum &huge_page)
+  {
+#if ENABLE_THREADED_CODE
+    // The detection of the self-modifying codes mprotect()s the native
+    // pages which contain the translated codes.
+    if (HUGE_PAGE_EXPLICIT == huge_page)
+    {
+      g_log_file << "Memory: the explicit huge pages can not be write protected per page, "
+                 << "use the transparent huge pages instead." << std::endl;
+      
+      huge_page = HUGE_PAGE_TRANSPARENT;
+    }
+#endif
+    
+    void *memory = memory_allocate(size, huge_page);
+    
+    if ((0 == memory) && (HUGE_PAGE_EXPLICIT == huge_page))
+    {
+      g_log_file << "Memory: not enough huge pages reserved (see /proc/sys/vm/nr_hugepages), "
+                 << "use the native pages instead." << std::endl;
+      
+      huge_page = HUGE_PAGE_NONE;
+      
+      memory = memory_allocate(size, huge_page);
+    }
+    
+    return static_cast<uint8_t *>(memory);
+  }
+  
   //////////////////////////////// Public /////////////////////////////////////
   //============================== Life cycle =================================
   
   Memory::Memory(uint32_t const size, MachineScreen * const machine_screen)
     : m_size(size),
-#if ENABLE_DRAWING_ASM
+      m_huge_page(huge_page_setting()),
       
+#if ENABLE_DRAWING_ASM
       // :NOTE: Wei 2004-Jul-12:
       //
       // The reason why I need to enlarge the size of the memory when using ENABLE_DRAWING_ASM
@@ -88,31 +148,14 @@ namespace ARMware
       // Thus I have to increment the memory size to avoid the possible segmentation fault.
       //
       // Ex: when the frame buffer is at the end of the memory.
-#if ENABLE_THREADED_CODE
-      // :NOTE: Wei 2004-Aug-11:
-      //
-      // According to the POSIX.1b, mprotect() can be used only on regions of memory obtained from mmap().
-      //
-      // Although in the linux platform, large memory allocation will use mmap() to allocate memory.
-      // However, to ensure memory allocation indeed uses mmap(), not just only in the linux platform,
-      // I use mmap() to allocate memory specifically.
-      //
-      // mmap() will allocate page-aligned memory directly from the Linux kernel.
-      mp_memory(static_cast<uint8_t *>(memory_allocate(page_aligned_size(size + (8 * MachineScreen::BYTES_PER_PIXEL))))),
-#else
-      mp_memory(new uint8_t[size + (8 * MachineScreen::BYTES_PER_PIXEL)]),
-#endif
-      
-#else // ENABLE_DRAWING_ASM
-      
-#if ENABLE_THREADED_CODE
-      mp_memory(static_cast<uint8_t *>(memory_allocate(page_aligned_size(size)))),
+      m_allocated_size(native_page_aligned_size(size + (8 * MachineScreen::BYTES_PER_PIXEL))),
 #else
-      mp_memory(new uint8_t[size]),
+      m_allocated_size(native_page_aligned_size(size)),
 #endif
       
-#endif // ENABLE_DRAWING_ASM
+      mp_memory(allocate(m_allocated_size, m_huge_page)),
       mp_machine_screen(machine_screen),
+      mp_walk_cache(0),
       m_lcd_status(0)
   {
 #if ENABLE_THREADED_CODE || ENABLE_DYNAMIC_TRANSLATOR
@@ -39,6 +39,8 @@
 #include "platform_dep.hpp"
 
 #include "Gtk/MachineScreen.hpp"
+#include "FrameCapture.hpp"
+#include "WalkCache.hpp"
 
 EXCEPTION_HANDLER_PROTOTYPE
 
@@ -81,8 +83,11 @@ namespace ARMware
     // Attribute
     
     uint32_t const m_size;
+    HugePageEnum m_huge_page;
+    uint32_t const m_allocated_size;
     uint8_t * const mp_memory;
     MachineScreen * const mp_machine_screen;
+    WalkCache *mp_walk_cache;
     
     uint32_t m_lcd_status;
     
@@ -102,31 +107,49 @@ namespace ARMware
     
     // Operation
     
+    static uint8_t *allocate(uint32_t const size, HugePageEnum &huge_page);
+    
     template<PanelEnum T_panel>
     uint32_t get_frame_buffer_address() const;
     
-    template<typename T_store>
-    void update_dirty_point_internal(uint32_t const x, uint32_t const y) const;
-    
-    template<PanelEnum T_panel, typename T_store>
+    // The old way computed the (x, y) of every stored pixel right here,
+    // which costs a divide and a modulo per store. Now I only mark the
+    // DIRTY_UNIT_SIZE-byte unit containing 'address' in the dirty bitmap
+    // of MachineScreen, and MachineScreen converts the bitmap into the
+    // dirty rectangle once per frame.
+    //
+    // The frame buffer of the panel 2 covers the right half of the screen,
+    // thus its units follow the ones of the panel 1.
+    template<PanelEnum T_panel>
     inline void
-    update_dirty_point(uint32_t const address) const
+    mark_dirty(uint32_t const address) const
     {
-      // :NOTE: Wei 2004-Jun-30:
-      //
-      // The pixels in the H3600's frame buffer are 2-byte length.
-      //
-      // diff: count how many pixels between the beginning and the address, including the address.
-      uint32_t const diff = (address - get_frame_buffer_address<T_panel>()) >> 1;
-      
-      uint32_t const x = (diff / MachineScreen::DISPLAY_HEIGHT);
-      uint32_t const y = (MachineScreen::DISPLAY_HEIGHT - (diff % MachineScreen::DISPLAY_HEIGHT) - 1);
-      
-#if TRACE_DRAW_SCREEN
-      g_log_file << "SCREEN: update (" << std::dec << x << ", " << y << ")" << std::endl;
-#endif
+      uint32_t const idx = ((address - get_frame_buffer_address<T_panel>()) >> MachineScreen::DIRTY_UNIT_SHIFT);
       
-      update_dirty_point_internal<T_store>(x, y);
+      if (PANEL_1 == T_panel)
+      {
+        if (mp_machine_screen != 0)
+        {
+          mp_machine_screen->mark_dirty_unit(idx);
+        }
+        
+        if (true == g_frame_capture.is_enabled())
+        {
+          g_frame_capture.mark_dirty_unit(idx);
+        }
+      }
+      else
+      {
+        if (mp_machine_screen != 0)
+        {
+          mp_machine_screen->mark_dirty_unit(idx + (MachineScreen::DIRTY_UNIT_NUMBER >> 1));
+        }
+        
+        if (true == g_frame_capture.is_enabled())
+        {
+          g_frame_capture.mark_dirty_unit(idx + (MachineScreen::DIRTY_UNIT_NUMBER >> 1));
+        }
+      }
     }
     
   public:
@@ -139,17 +162,7 @@ namespace ARMware
     {
       if (mp_memory != 0)
       {
-#if ENABLE_THREADED_CODE
-
-#if ENABLE_DRAWING_ASM
-        memory_release(mp_memory, page_aligned_size(m_size + (8 * MachineScreen::BYTES_PER_PIXEL)));
-#else
-        memory_release(mp_memory, page_aligned_size(m_size));
-#endif
-
-#else
-        delete[] mp_memory;
-#endif
+        memory_release(mp_memory, m_allocated_size, m_huge_page);
       }
     }
     
@@ -171,6 +184,10 @@ namespace ARMware
     { ms_chunk_chain = chunk_chain; }
 #endif
     
+    inline void
+    register_walk_cache(WalkCache * const walk_cache)
+    { mp_walk_cache = walk_cache; }
+    
     inline void
     set_frame_buffer_addr_1(uint32_t const address)
     {
@@ -243,6 +260,10 @@ namespace ARMware
         *reinterpret_cast<T_store *>(&(mp_memory[address])) = value;
       EXCEPTION_PROTECTION_BLOCK_END
       
+      assert(mp_walk_cache != 0);
+      
+      mp_walk_cache->dram_written(address);
+      
       switch (m_lcd_status)
       {
       case 0:
@@ -293,7 +314,7 @@ namespace ARMware
                      << value << std::endl;
 #endif
           
-          update_dirty_point<PANEL_1, T_store>(address);
+          mark_dirty<PANEL_1>(address);
         }
         break;
         
@@ -310,7 +331,7 @@ namespace ARMware
             g_log_file << "SCREEN: update<2>: " << std::hex << address << std::endl;
 #endif
             
-            update_dirty_point<PANEL_2, T_store>(address);
+            mark_dirty<PANEL_2>(address);
           }
         }
         else
@@ -319,7 +340,7 @@ namespace ARMware
           g_log_file << "SCREEN: update<1>: " << std::hex << address << std::endl;
 #endif
           
-          update_dirty_point<PANEL_1, T_store>(address);
+          mark_dirty<PANEL_1>(address);
         }
         break;
         
@@ -339,32 +360,6 @@ namespace ARMware
   inline uint32_t
   Memory::get_frame_buffer_address<Memory::PANEL_2>() const
   { return m_fb_2_start_addr; }
-  
-  template<>
-  inline void
-  Memory::update_dirty_point_internal<uint8_t>(uint32_t const /* x */, uint32_t const /* y */) const
-  {
-    // :NOTE: Wei 2004-Jul-8:
-    //
-    // Because the pixel size of H3600 is 2-byte, thus I don't think ARMware will
-    // update frame buffer using 1-byte accessing.
-    assert(!"Should not reach here.");
-  }
-  
-  template<>
-  inline void
-  Memory::update_dirty_point_internal<uint16_t>(uint32_t const x, uint32_t const y) const
-  {
-    mp_machine_screen->update_dirty_point(x, y);
-  }
-  
-  template<>
-  inline void
-  Memory::update_dirty_point_internal<uint32_t>(uint32_t const x, uint32_t const y) const
-  {
-    mp_machine_screen->update_dirty_point(x, y);
-    mp_machine_screen->update_dirty_point(x, y - 1);
-  }
 }
 
 #endif
@@ -25,6 +25,28 @@
 namespace ARMware
 {
   //////////////////////////////// Public /////////////////////////////////////
+  //============================== Life cycle =================================
+  
+  MemoryConf::MemoryConf()
+    : m_register_bank(this, "memory_conf", MDCNFG, (SMCNFG + 4) - MDCNFG)
+  {
+    init_register();
+    
+    m_register_bank.add_plain(MDCNFG,  "MDCNFG",  &mMDCNFG);
+    m_register_bank.add_plain(MDCAS00, "MDCAS00", &mMDCAS00);
+    m_register_bank.add_plain(MDCAS01, "MDCAS01", &mMDCAS01);
+    m_register_bank.add_plain(MDCAS02, "MDCAS02", &mMDCAS02);
+    m_register_bank.add_plain(MSC0,    "MSC0",    &mMSC0);
+    m_register_bank.add_plain(MSC1,    "MSC1",    &mMSC1);
+    m_register_bank.add_plain(MECR,    "MECR",    &mMECR);
+    m_register_bank.add_plain(MDREFR,  "MDREFR",  &mMDREFR);
+    m_register_bank.add_plain(MDCAS20, "MDCAS20", &mMDCAS20);
+    m_register_bank.add_plain(MDCAS21, "MDCAS21", &mMDCAS21);
+    m_register_bank.add_plain(MDCAS22, "MDCAS22", &mMDCAS22);
+    m_register_bank.add_plain(MSC2,    "MSC2",    &mMSC2);
+    m_register_bank.add_plain(SMCNFG,  "SMCNFG",  &mSMCNFG);
+  }
+  
   //============================== Operation ==================================
   
   void
@@ -74,26 +96,7 @@ namespace ARMware
     g_log_file << "MEM CONF: read address: " << std::hex << address << std::endl;
 #endif
     
-    switch (address)
-    {
-    case MDCNFG:  return mMDCNFG;
-    case MDCAS00: return mMDCAS00;
-    case MDCAS01: return mMDCAS01;
-    case MDCAS02: return mMDCAS02;
-    case MSC0:    return mMSC0;
-    case MSC1:    return mMSC1;
-    case MECR:    return mMECR;
-    case MDREFR:  return mMDREFR;
-    case MDCAS20: return mMDCAS20;
-    case MDCAS21: return mMDCAS21;
-    case MDCAS22: return mMDCAS22;
-    case MSC2:    return mMSC2;
-    case SMCNFG:  return mSMCNFG;
-      
-    default:
-      assert(!"Should not reach here.");
-      return 0;
-    }
+    return m_register_bank.read(address);
   }
   
   template<>
@@ -104,22 +107,6 @@ namespace ARMware
     g_log_file << "MEM CONF: write address: " << std::hex << address << ", value: " << value << std::endl;
 #endif
     
-    switch (address)
-    {
-    case MDCNFG:  mMDCNFG = value; break;
-    case MDCAS00: mMDCAS00 = value; break;
-    case MDCAS01: mMDCAS01 = value; break;
-    case MDCAS02: mMDCAS02 = value; break;
-    case MSC0:    mMSC0 = value; break;
-    case MSC1:    mMSC1 = value; break;
-    case MECR:    mMECR = value; break;
-    case MDREFR:  mMDREFR = value; break;
-    case MDCAS20: mMDCAS20 = value; break;
-    case MDCAS21: mMDCAS21 = value; break;
-    case MDCAS22: mMDCAS22 = value; break;
-    case MSC2:    mMSC2 = value; break;
-    case SMCNFG:  mSMCNFG = value; break;
-    default: assert(!"Should not reach here."); break;
-    }
+    m_register_bank.write(address, value);
   }
 }
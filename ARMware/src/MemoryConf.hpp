@@ -22,6 +22,7 @@
 //
 
 #include "ARMware.hpp"
+#include "RegisterBank.hpp"
 
 namespace ARMware
 {
@@ -63,6 +64,9 @@ namespace ARMware
     uint32_t mMSC2;    // Static memory control register 2
     uint32_t mSMCNFG;  // SMROM configuration register
     
+    
+    RegisterBank<MemoryConf> m_register_bank;
+    
     // Operation
     
     void
@@ -87,10 +91,7 @@ namespace ARMware
     
     // Life cycle
     
-    MemoryConf()
-    {
-      init_register();
-    }
+    MemoryConf();
     
     // Operation
     
@@ -0,0 +1,198 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "MmioProfiler.hpp"
+#include "GuestProfiler.hpp"
+#include "RegisterBank.hpp"
+#include "Core.hpp"
+
+namespace ARMware
+{
+  MmioProfiler g_mmio_profiler;
+  
+  ///////////////////////////////// Private ///////////////////////////////////
+  //============================== Operation ==================================
+  
+  void
+  MmioProfiler::record(Core const * const core, uint32_t const pc, uint32_t const address, bool const is_write)
+  {
+    Site site;
+    
+    site.m_pc = pc;
+    site.m_mode = core->CurrentMode();
+    
+    Register &reg = m_registers[address];
+    Count &count = reg.m_sites[site];
+    
+    if (true == is_write)
+    {
+      ++reg.m_count.m_write;
+      ++count.m_write;
+    }
+    else
+    {
+      ++reg.m_count.m_read;
+      ++count.m_read;
+    }
+    
+    ++m_access_number;
+    
+    if (0 == (m_access_number % WRITE_FREQ))
+    {
+      write_output();
+    }
+  }
+  
+  void
+  MmioProfiler::write_output() const
+  {
+    std::vector<std::pair<uint64_t, uint32_t> > hot_registers;
+    uint64_t total = 0;
+    
+    for (std::map<uint32_t, Register>::const_iterator iter = m_registers.begin();
+         iter != m_registers.end();
+         ++iter)
+    {
+      hot_registers.push_back(std::make_pair((*iter).second.m_count.total(), (*iter).first));
+      
+      total += (*iter).second.m_count.total();
+    }
+    
+    std::sort(hot_registers.begin(), hot_registers.end(),
+              std::greater<std::pair<uint64_t, uint32_t> >());
+    
+    if (hot_registers.size() > m_top)
+    {
+      hot_registers.resize(m_top);
+    }
+    
+    std::ofstream output(m_output_file.c_str(), std::ios_base::out | std::ios_base::trunc);
+    
+    output << "# mmio accesses " << std::dec << total << std::endl;
+    
+    for (std::vector<std::pair<uint64_t, uint32_t> >::const_iterator reg_iter = hot_registers.begin();
+         reg_iter != hot_registers.end();
+         ++reg_iter)
+    {
+      uint32_t const address = (*reg_iter).second;
+      Register const &reg = (*(m_registers.find(address))).second;
+      char const *bank = 0;
+      char const *name = 0;
+      
+      output << "0x" << std::hex << address << ' ';
+      
+      if (true == RegisterBankBase::find_register(address, bank, name))
+      {
+        output << bank << '.' << name;
+      }
+      else
+      {
+        output << '-';
+      }
+      
+      output << " read " << std::dec << reg.m_count.m_read
+             << " write " << reg.m_count.m_write << std::endl;
+      
+      std::vector<std::pair<uint64_t, Site> > hot_sites;
+      
+      for (std::map<Site, Count>::const_iterator iter = reg.m_sites.begin();
+           iter != reg.m_sites.end();
+           ++iter)
+      {
+        hot_sites.push_back(std::make_pair((*iter).second.total(), (*iter).first));
+      }
+      
+      // Site has only operator<, thus I sort it ascending and walk it
+      // backward.
+      std::sort(hot_sites.begin(), hot_sites.end());
+      
+      uint32_t site_number = 0;
+      
+      for (std::vector<std::pair<uint64_t, Site> >::const_reverse_iterator iter = hot_sites.rbegin();
+           (iter != hot_sites.rend()) && (site_number < m_top);
+           ++iter, ++site_number)
+      {
+        Site const &site = (*iter).second;
+        Count const &count = (*(reg.m_sites.find(site))).second;
+        
+        // The device registers are accessed by the kernel, whose symbols
+        // are not bound to any FCSE PID.
+        output << "  " << GuestProfiler::mode_name(site.m_mode)
+               << " 0x" << std::hex << site.m_pc
+               << ' ' << g_guest_profiler.symbolize(site.m_pc, 0)
+               << " read " << std::dec << count.m_read
+               << " write " << count.m_write << std::endl;
+      }
+    }
+  }
+  
+  ///////////////////////////////// Public ////////////////////////////////////
+  //============================== Life cycle =================================
+  
+  MmioProfiler::MmioProfiler()
+    : m_enable(false),
+      m_top(DEFAULT_TOP),
+      m_access_number(0)
+  { }
+  
+  //============================== Operation ==================================
+  
+  void
+  MmioProfiler::init()
+  {
+    char const * const output_file = getenv("ARMWARE_MMIO_PROFILE");
+    
+    if (0 == output_file)
+    {
+      return;
+    }
+    
+    m_output_file = output_file;
+    
+    char const * const top = getenv("ARMWARE_MMIO_PROFILE_TOP");
+    
+    if (top != 0)
+    {
+      m_top = strtoul(top, 0, 10);
+      
+      if (0 == m_top)
+      {
+        m_top = DEFAULT_TOP;
+      }
+    }
+    
+    m_enable = true;
+  }
+  
+  void
+  MmioProfiler::finish()
+  {
+    if (true == m_enable)
+    {
+      write_output();
+      
+      m_enable = false;
+    }
+  }
+}
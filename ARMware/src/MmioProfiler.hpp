@@ -0,0 +1,156 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+#ifndef MmioProfiler_hpp
+#define MmioProfiler_hpp
+
+#include <map>
+#include <string>
+
+#include "ARMware.hpp"
+
+namespace ARMware
+{
+  class Core;
+  
+  // Heat map of the device register accesses, to find out which registers
+  // the guest hammers (ex: polling OSCR or GPLR in a busy loop), and thus
+  // deserve a lazy evaluation or a fast path in the translated code.
+  //
+  // ARMWARE_MMIO_PROFILE=<file> turns it on. Every access which goes through
+  // AddressSpace::get_device_data() or put_device_data() (i.e. everything
+  // except DRAM and the flash in the read array mode) is counted per
+  // physical address, and per guest PC & core mode.
+  //
+  // The guest PC is the address of the instruction doing the access, which
+  // AddressSpace takes from Core::access_pc(). In the dynamic translated
+  // chunks, it is located by the index of that instruction in the chunk,
+  // thus it is exact in all the execution modes.
+  //
+  // The report lists the ARMWARE_MMIO_PROFILE_TOP (16 by default) hottest
+  // registers, each with its hottest code sites, which are symbolized
+  // against ARMWARE_GUEST_SYMBOLS (see GuestProfiler). It is rewritten once
+  // every WRITE_FREQ accesses and when the machine stops.
+  //
+  // When it is off, the cost is one test of m_enable in the device path.
+  typedef class MmioProfiler MmioProfiler;
+  class MmioProfiler
+  {
+  private:
+    
+    static uint32_t const DEFAULT_TOP = 16;
+    static uint32_t const WRITE_FREQ = (1 << 20);
+    
+    struct Count
+    {
+      uint64_t m_read;
+      uint64_t m_write;
+      
+      Count()
+        : m_read(0),
+          m_write(0)
+      { }
+      
+      inline uint64_t
+      total() const
+      { return m_read + m_write; }
+    };
+    typedef struct Count Count;
+    
+    struct Site
+    {
+      uint32_t m_pc;
+      CoreMode m_mode;
+      
+      inline bool
+      operator<(Site const &other) const
+      {
+        if (m_pc != other.m_pc) return m_pc < other.m_pc;
+        return m_mode < other.m_mode;
+      }
+    };
+    typedef struct Site Site;
+    
+    struct Register
+    {
+      Count m_count;
+      std::map<Site, Count> m_sites;
+    };
+    typedef struct Register Register;
+    
+    // Attribute
+    
+    bool m_enable;
+    
+    uint32_t m_top;
+    uint32_t m_access_number;
+    
+    std::string m_output_file;
+    
+    std::map<uint32_t, Register> m_registers;
+    
+    // Operation
+    
+    void record(Core const * const core, uint32_t const pc, uint32_t const address, bool const is_write);
+    
+    void write_output() const;
+    
+  public:
+    
+    // Life cycle
+    
+    MmioProfiler();
+    
+    // Operation
+    
+    void init();
+    
+    // Writes the final report. It has to be called while the devices (and
+    // thus their RegisterBanks) are still alive, not from a destructor of a
+    // global object.
+    void finish();
+    
+    // @pc: the address of the instruction doing the access.
+    inline void
+    record_read(Core const * const core, uint32_t const pc, uint32_t const address)
+    {
+      if (true == m_enable)
+      {
+        record(core, pc, address, false);
+      }
+    }
+    
+    inline void
+    record_write(Core const * const core, uint32_t const pc, uint32_t const address)
+    {
+      if (true == m_enable)
+      {
+        record(core, pc, address, true);
+      }
+    }
+    
+    // Inquery
+    
+    inline bool
+    is_enabled() const
+    { return m_enable; }
+  };
+  
+  extern MmioProfiler g_mmio_profiler;
+}
+
+#endif
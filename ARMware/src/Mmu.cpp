@@ -19,23 +19,64 @@
 //
 
 #include <cassert>
+#include <cstdlib>
 
 #include "Mmu.hpp"
 #include "SysCoProc.hpp"
 #include "AddressSpace.hpp"
 #include "Exception.hpp"
+#include "Log.hpp"
+#include "Utils/Number.hpp"
 
 #include "AddressSpace.tcc"
 
 namespace ARMware
 {
+  namespace
+  {
+    // ARMWARE_TLB_SETS=<n> and ARMWARE_TLB_WAYS=<n> set the geometry of both
+    // TLBs, i.e. the bucket number and the bucket size of Tlb.
+    uint32_t
+    tlb_geometry(char const * const name, uint32_t const default_value, uint32_t const max_value)
+    {
+      char const * const value = getenv(name);
+      
+      if (0 == value)
+      {
+        return default_value;
+      }
+      
+      uint32_t const number = strtoul(value, 0, 0);
+      
+      if ((0 == number) || (number > max_value) || (false == power_of_two(number)))
+      {
+        g_log_file << name << ": " << number << " is not a power of 2 in [1, " << max_value
+                   << "], use " << default_value << std::endl;
+        
+        return default_value;
+      }
+      
+      return number;
+    }
+    
+    inline uint32_t
+    tlb_sets()
+    { return tlb_geometry("ARMWARE_TLB_SETS", Tlb::DEFAULT_BUCKET_NUMBER, Tlb::MAX_BUCKET_NUMBER); }
+    
+    inline uint32_t
+    tlb_ways()
+    { return tlb_geometry("ARMWARE_TLB_WAYS", Tlb::DEFAULT_BUCKET_SIZE, 64); }
+  }
+  
   ////////////////////////////////// Public ///////////////////////////////////
   //============================== Life cycle =================================
   
-  Mmu::Mmu(Core * const core, SysCoProc * const sysCoProc, AddressSpace * const addressSpace)
-    : mp_core(core),
-      mpSysCoProc(sysCoProc),
-      mpAddressSpace(addressSpace)
+  Mmu::Mmu(SysCoProc * const sysCoProc, AddressSpace * const addressSpace)
+    : mpSysCoProc(sysCoProc),
+      mpAddressSpace(addressSpace),
+      m_inst_TLB(tlb_sets(), tlb_ways()),
+      m_data_TLB(tlb_sets(), tlb_ways()),
+      m_generation(1)
   { }
   
   ////////////////////////////////// Private //////////////////////////////////
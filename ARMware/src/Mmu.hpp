@@ -25,7 +25,10 @@
 //
 
 #include "Tlb.hpp"
+#include "WalkCache.hpp"
+#include "ShadowTlb.hpp"
 #include "MmuBlockType.hpp"
+#include "RuntimeStats.hpp"
 
 namespace ARMware
 {
@@ -34,7 +37,6 @@ namespace ARMware
   
   class AddressSpace;
   class SysCoProc;
-  class Core;
   
   typedef class Mmu Mmu;
   class Mmu
@@ -109,42 +111,93 @@ namespace ARMware
     template<AccessTypeEnum access_type_enum>
     Tlb &get_tlb() FASTCALL;
     
+    inline uint32_t read_descriptor(uint32_t const paddr, bool &exception_occur);
+    
     // Attribute
     
     uint32_t mCurrVaddr;
     CoreMode mCurrCoreMode;
     
-    Core         * const mp_core;
+    // The physical addresses of the descriptors of the current walk, for
+    // ShadowTlb.
+    uint32_t mCurrL1Addr;
+    uint32_t mCurrL2Addr;
+    
     SysCoProc    * const mpSysCoProc;
     AddressSpace * const mpAddressSpace;
     
     Tlb m_inst_TLB;
     Tlb m_data_TLB;
     
+    WalkCache m_walk_cache;
+    ShadowTlb m_shadow_tlb;
+    
+    // Bumped whenever a translation made before may not hold any more
+    // (a TLB is flushed, or the control, translation table base, domain
+    // access control or PID register of CP15 is written).
+    //
+    // Whoever caches a translation outside the TLBs records the generation
+    // at that time, and treats it as stale once it differs.
+    uint32_t m_generation;
+    
   public:
     
     // Life cycle
     
-    Mmu(Core * const core, SysCoProc * const sysCoProc, AddressSpace * const addressSpace);
+    Mmu(SysCoProc * const sysCoProc, AddressSpace * const addressSpace);
     
     // Operation
     
     inline void
     flush_inst_tlb()
-    { m_inst_TLB.flush_all(); }
+    {
+      m_inst_TLB.flush_all();
+      
+      ++m_generation;
+    }
     
     inline void
     flush_data_tlb()
-    { m_data_TLB.flush_all(); }
+    {
+      m_data_TLB.flush_all();
+      
+      ++m_generation;
+    }
     
     inline void
     flush_data_tlb_single_entry(uint32_t const address)
-    { m_data_TLB.flush_single_entry(address); }
+    {
+      m_data_TLB.flush_single_entry(address);
+      
+      ++m_generation;
+    }
+    
+    inline void
+    bump_generation()
+    { ++m_generation; }
+    
+    inline void
+    flush_walk_cache()
+    { m_walk_cache.flush_all(); }
     
     template<AccessTypeEnum access_type_enum, RWType rw_type>
     uint32_t translate_access(uint32_t const vaddr,
                               CoreMode const currentMode,
                               bool &exception_occur);
+    
+    // Inquery
+    
+    inline uint32_t
+    generation() const
+    { return m_generation; }
+    
+    inline WalkCache *
+    walk_cache()
+    { return &m_walk_cache; }
+    
+    inline ShadowTlb *
+    shadow_tlb()
+    { return &m_shadow_tlb; }
   };
   
   template<>
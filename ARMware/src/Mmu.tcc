@@ -83,7 +83,7 @@ namespace ARMware
     g_log_file << "MMU: TranslationFault: <Page> " << std::hex << mCurrVaddr << std::endl;
 #endif
     
-    mp_core->update_FSR_FAR(FS_TRANSLATION_PAGE, domain_num, mCurrVaddr);
+    mpSysCoProc->update_FSR_FAR(FS_TRANSLATION_PAGE, domain_num, mCurrVaddr);
     
     assert(false == exception_occur);
     
@@ -98,7 +98,7 @@ namespace ARMware
     g_log_file << "MMU: TranslationFault: <Section> " << std::hex << mCurrVaddr << std::endl;
 #endif
     
-    mp_core->update_FSR_FAR(FS_TRANSLATION_SECTION, domain_num, mCurrVaddr);
+    mpSysCoProc->update_FSR_FAR(FS_TRANSLATION_SECTION, domain_num, mCurrVaddr);
     
     assert(false == exception_occur);
     
@@ -115,7 +115,7 @@ namespace ARMware
     g_log_file << "MMU: DomainFault: Page."<< std::endl;
 #endif
     
-    mp_core->update_FSR_FAR(FS_DOMAIN_PAGE, domain_num, mCurrVaddr);
+    mpSysCoProc->update_FSR_FAR(FS_DOMAIN_PAGE, domain_num, mCurrVaddr);
     
     assert(false == exception_occur);
     
@@ -130,7 +130,7 @@ namespace ARMware
     g_log_file << "MMU: DomainFault: Section."<< std::endl;
 #endif
     
-    mp_core->update_FSR_FAR(FS_DOMAIN_SECTION, domain_num, mCurrVaddr);
+    mpSysCoProc->update_FSR_FAR(FS_DOMAIN_SECTION, domain_num, mCurrVaddr);
     
     assert(false == exception_occur);
     
@@ -147,7 +147,7 @@ namespace ARMware
     g_log_file << "MMU: PermissionFault: <Page> " << std::hex << mCurrVaddr << std::endl;
 #endif
     
-    mp_core->update_FSR_FAR(FS_PERMISSION_PAGE, domain_num, mCurrVaddr);
+    mpSysCoProc->update_FSR_FAR(FS_PERMISSION_PAGE, domain_num, mCurrVaddr);
     
     assert(false == exception_occur);
     
@@ -162,7 +162,7 @@ namespace ARMware
     g_log_file << "MMU: PermissionFault: <Section> " << std::hex << mCurrVaddr << std::endl;
 #endif
     
-    mp_core->update_FSR_FAR(FS_PERMISSION_SECTION, domain_num, mCurrVaddr);
+    mpSysCoProc->update_FSR_FAR(FS_PERMISSION_SECTION, domain_num, mCurrVaddr);
     
     assert(false == exception_occur);
     
@@ -395,17 +395,54 @@ namespace ARMware
     entry->set_table_idx(mCurrVaddr & MmuBlockTypeTraits<mmu_block_type_enum>::TABLE_INDEX_BITMASK);
     entry->set_phy_base(level_two_descriptor & MmuBlockTypeTraits<mmu_block_type_enum>::BLOCK_BASE_BITMASK);
     
+    m_shadow_tlb.insert(mpSysCoProc->get_TTB_reg(),
+                        mCurrVaddr,
+                        mCurrL1Addr,
+                        level_one_descriptor,
+                        mCurrL2Addr,
+                        level_two_descriptor,
+                        *entry);
+    
     return phy_addr;
   }
   
   /////////////////////////////////////////////////////////////////////////////
   
+  inline uint32_t
+  Mmu::read_descriptor(uint32_t const paddr, bool &exception_occur)
+  {
+    uint32_t descriptor;
+    
+    if (true == m_walk_cache.find(paddr, descriptor))
+    {
+      return descriptor;
+    }
+    
+    descriptor = mpAddressSpace->get_data<uint32_t>(paddr, exception_occur);
+    
+    if (false == exception_occur)
+    {
+      m_walk_cache.insert(paddr, descriptor);
+    }
+    
+    return descriptor;
+  }
+  
   template<AccessTypeEnum access_type_enum, RWType rw_type>
   uint32_t
   Mmu::translate(bool &exception_occur)
   {
+    if (true == g_runtime_stats.is_enabled())
+    {
+      g_runtime_stats.increase(RuntimeStats::PAGE_TABLE_WALK);
+    }
+    
     uint32_t const level_one_addr = ((mpSysCoProc->get_TTB_reg() & 0xFFFFC000) | ((mCurrVaddr & 0xFFF00000) >> 18));
-    uint32_t const level_one_descriptor = mpAddressSpace->template get_data<uint32_t>(level_one_addr, exception_occur);
+    
+    mCurrL1Addr = level_one_addr;
+    mCurrL2Addr = ShadowTlb::NO_LEVEL_TWO;
+    
+    uint32_t const level_one_descriptor = read_descriptor(level_one_addr, exception_occur);
     
     // :NOTE: Wei 2004-Jul-30:
     //
@@ -426,7 +463,10 @@ namespace ARMware
       // coarse page table.
       {
         uint32_t const level_two_addr = ((level_one_descriptor & 0xFFFFFC00) | ((mCurrVaddr & 0xFF000) >> 10));
-        uint32_t const level_two_descriptor = mpAddressSpace->template get_data<uint32_t>(level_two_addr, exception_occur);
+        
+        mCurrL2Addr = level_two_addr;
+        
+        uint32_t const level_two_descriptor = read_descriptor(level_two_addr, exception_occur);
         
         // :NOTE: Wei 2004-Jul-30:
         //
@@ -490,7 +530,10 @@ namespace ARMware
       // fine page table
       {
         uint32_t const level_two_addr = ((level_one_descriptor & 0xFFFFF000) | ((mCurrVaddr & 0xFFC00) >> 8));
-        uint32_t const level_two_descriptor = mpAddressSpace->template get_data<uint32_t>(level_two_addr, exception_occur);
+        
+        mCurrL2Addr = level_two_addr;
+        
+        uint32_t const level_two_descriptor = read_descriptor(level_two_addr, exception_occur);
         
         // :NOTE: Wei 2004-Jul-30:
         //
@@ -541,40 +584,58 @@ namespace ARMware
   uint32_t
   Mmu::find_phy_addr(bool &exception_occur)
   {
-    TlbEntry * const entry = get_tlb<access_type_enum>().find_entry(mCurrVaddr);
+    TlbEntry *entry = get_tlb<access_type_enum>().find_entry(mCurrVaddr);
     
     if (0 == entry)
     {
-      return translate<access_type_enum, rw_type>(exception_occur);
-    }
-    else
-    {
-      switch (entry->block_type())
+      if (true == g_runtime_stats.is_enabled())
       {
-      case SECTION:
-        check_access_right<SECTION, rw_type>(entry->access_perm(), entry->domain_num(), exception_occur);
-        break;
-        
-      case LARGE_PAGE:
-        check_access_right<LARGE_PAGE, rw_type>(entry->access_perm(), entry->domain_num(), exception_occur);
-        break;
-        
-      case SMALL_PAGE:
-        check_access_right<SMALL_PAGE, rw_type>(entry->access_perm(), entry->domain_num(), exception_occur);
-        break;
-        
-      case TINY_PAGE:
-#if ASSUME_NOT_USE_TINY_PAGE
-        assert(!"Should not reach here.");
-#endif
-        check_access_right<TINY_PAGE, rw_type>(entry->access_perm(), entry->domain_num(), exception_occur);
-        break;
+        g_runtime_stats.increase((INST == access_type_enum) ? RuntimeStats::ITLB_MISS : RuntimeStats::DTLB_MISS);
       }
       
-      if (true == exception_occur)
+      TlbEntry const * const shadow_entry = m_shadow_tlb.find(mpSysCoProc->get_TTB_reg(), mCurrVaddr);
+      
+      if (0 == shadow_entry)
       {
-        return 0;
+        return translate<access_type_enum, rw_type>(exception_occur);
       }
+      
+      // The descriptors are unchanged, refill the TLB without a walk, and
+      // the access right is checked below as a TLB hit.
+      entry = get_tlb<access_type_enum>().find_empty_entry(mCurrVaddr);
+      
+      *entry = *shadow_entry;
+    }
+    else if (true == g_runtime_stats.is_enabled())
+    {
+      g_runtime_stats.increase((INST == access_type_enum) ? RuntimeStats::ITLB_HIT : RuntimeStats::DTLB_HIT);
+    }
+    
+    switch (entry->block_type())
+    {
+    case SECTION:
+      check_access_right<SECTION, rw_type>(entry->access_perm(), entry->domain_num(), exception_occur);
+      break;
+      
+    case LARGE_PAGE:
+      check_access_right<LARGE_PAGE, rw_type>(entry->access_perm(), entry->domain_num(), exception_occur);
+      break;
+      
+    case SMALL_PAGE:
+      check_access_right<SMALL_PAGE, rw_type>(entry->access_perm(), entry->domain_num(), exception_occur);
+      break;
+      
+    case TINY_PAGE:
+#if ASSUME_NOT_USE_TINY_PAGE
+      assert(!"Should not reach here.");
+#endif
+      check_access_right<TINY_PAGE, rw_type>(entry->access_perm(), entry->domain_num(), exception_occur);
+      break;
+    }
+    
+    if (true == exception_occur)
+    {
+      return 0;
     }
     
     assert(entry != 0);
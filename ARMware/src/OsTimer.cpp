@@ -19,12 +19,77 @@
 
 namespace ARMware
 {
+  //////////////////////////////// Private ////////////////////////////////////
+  //============================== Operation ==================================
+  
+  void
+  OsTimer::write_OSSR(uint32_t const /* address */, uint32_t const value)
+  {
+    // :SA-1110 Developer's Manual: p.97: Wei 2004-Apr-24:
+    //
+    // bits 0 ~ 3 of OSSR register are cleared by writing a one to the
+    // proper bit position. Writing zeros to this register has no effect.
+    // All reserved bits read as zeros and are unaffected by writes;
+    m_OSSR &= ~(value & (OSMRTraits<OSMR0>::BITMASK |
+                         OSMRTraits<OSMR1>::BITMASK |
+                         OSMRTraits<OSMR2>::BITMASK |
+                         OSMRTraits<OSMR3>::BITMASK));
+  }
+  
+  void
+  OsTimer::write_OWER(uint32_t const /* address */, uint32_t const value)
+  {
+    // :SA-1110 Developer's Manual: p.96: Wei 2004-Apr-24:
+    //
+    // WME (Watchdog Match Enable) bit is set by writing a one to it.
+    // It can only be cleared by one of the reset functions (hardware reset,
+    // software reset) and by entering sleep mode.
+    // A watchdog reset also clears the watchdog enable bit.
+    if (false == m_has_enabled_watchdog_timer)
+    {
+      if (WME_BITMASK == (value & WME_BITMASK))
+      {
+        // :SA-1110 Developer's Manual: p.98: Wei 2004-Apr-25:
+        //
+        // The user must clear OSSR:M3 before setting up a watchdog reset.
+        assert(0 == (m_OSSR & OSMRTraits<OSMR3>::BITMASK));
+        
+        m_OWER |= WME_BITMASK;
+        m_has_enabled_watchdog_timer = true;
+      }
+    }
+  }
+  
+  void
+  OsTimer::write_OIER(uint32_t const /* address */, uint32_t const value)
+  {
+    // :NOTE: Wei 2004-Apr-24:
+    //
+    // According to OSSR register: All reserved bits read as zeros and are unaffected by writes
+    // I think OIER is the same with OSSR.
+    m_OIER = (value & 0xF);
+  }
+  
   //////////////////////////////// Public /////////////////////////////////////
   //=========================== Life cycle ====================================
   
   OsTimer::OsTimer()
+    : m_register_bank(this, "os_timer", OSMR0, (OIER + 4) - OSMR0)
   {
     init_register();
+    
+    uint32_t const write_flags = (RegisterBankBase::REG_READ_WRITE | RegisterBankBase::REG_WRITE_SIDE_EFFECT);
+    
+    m_register_bank.add_plain(OSMR0, "OSMR0", &(m_OSMR[OSMRTraits<OSMR0>::INDEX]));
+    m_register_bank.add_plain(OSMR1, "OSMR1", &(m_OSMR[OSMRTraits<OSMR1>::INDEX]));
+    m_register_bank.add_plain(OSMR2, "OSMR2", &(m_OSMR[OSMRTraits<OSMR2>::INDEX]));
+    m_register_bank.add_plain(OSMR3, "OSMR3", &(m_OSMR[OSMRTraits<OSMR3>::INDEX]));
+    m_register_bank.add_plain(OSCR, "OSCR", &m_OSCR,
+                              RegisterBankBase::REG_READ_WRITE | RegisterBankBase::REG_VOLATILE);
+    m_register_bank.add(OSSR, "OSSR", write_flags | RegisterBankBase::REG_VOLATILE,
+                        &m_OSSR, 0, &OsTimer::write_OSSR);
+    m_register_bank.add(OWER, "OWER", write_flags, &m_OWER, 0, &OsTimer::write_OWER);
+    m_register_bank.add(OIER, "OIER", write_flags, &m_OIER, 0, &OsTimer::write_OIER);
   }
   
   //============================== Operation ==================================
@@ -161,247 +226,23 @@ namespace ARMware
   uint32_t
   OsTimer::get_data(uint32_t const address) const
   {
-    switch (address)
-    {
-    case OSMR0:
-#if TRACE_OS_TIMER
-      g_log_file << "OsTimer: get timer[0]: " << std::hex << m_OSMR[OSMRTraits<OSMR0>::INDEX] << std::endl;
-#endif
-      return m_OSMR[OSMRTraits<OSMR0>::INDEX];
-      
-    case OSMR1:
-#if TRACE_OS_TIMER
-      g_log_file << "OsTimer: get timer[1]: " << std::hex << m_OSMR[OSMRTraits<OSMR1>::INDEX] << std::endl;
-#endif
-      return m_OSMR[OSMRTraits<OSMR1>::INDEX];
-      
-    case OSMR2:
-#if TRACE_OS_TIMER
-      g_log_file << "OsTimer: get timer[2]: " << std::hex << m_OSMR[OSMRTraits<OSMR2>::INDEX] << std::endl;
-#endif
-      return m_OSMR[OSMRTraits<OSMR2>::INDEX];
-      
-    case OSMR3:
-#if TRACE_OS_TIMER
-      g_log_file << "OsTimer: get timer[3]: " << std::hex << m_OSMR[OSMRTraits<OSMR3>::INDEX] << std::endl;
-#endif
-      return m_OSMR[OSMRTraits<OSMR3>::INDEX];
-      
-    case OSCR:
-#if TRACE_OS_TIMER
-      g_log_file << "OsTimer: get OSCR: " << std::hex << m_OSCR << std::endl;
-#endif
-      return m_OSCR;
-      
-    case OSSR:
-#if TRACE_OS_TIMER
-      g_log_file << "OsTimer: get OSSR: " << std::hex << m_OSSR << std::endl;
-#endif
-      return m_OSSR;
-      
-    case OWER:
-#if TRACE_OS_TIMER
-      g_log_file << "OsTimer: get OWER: " << std::hex << m_OWER << std::endl;
-#endif
-      return m_OWER;
-      
-    case OIER:
+    uint32_t const value = m_register_bank.read(address);
+    
 #if TRACE_OS_TIMER
-      g_log_file << "OsTimer: get OIER: " << std::hex << m_OIER << std::endl;
+    g_log_file << "OsTimer: get " << std::hex << address << ": " << value << std::endl;
 #endif
-      return m_OIER;
-      
-    default:
-      assert(!"Should not reach here.");
-      return 0;
-    }
+    
+    return value;
   }
   
   template<>
   void
   OsTimer::put_data(uint32_t const address, uint32_t const value)
   {
-    switch (address)
-    {
-    case OSMR0:
-#if TRACE_OS_TIMER
-      g_log_file << "OsTimer: set timer[0]: " << std::hex << value << std::endl;
-#endif
-      
-      m_OSMR[OSMRTraits<OSMR0>::INDEX] = value;
-      break;
-      
-    case OSMR1:
-#if TRACE_OS_TIMER
-      g_log_file << "OsTimer: set timer[1]: " << std::hex << value << std::endl;
-#endif
-      
-      m_OSMR[OSMRTraits<OSMR1>::INDEX] = value;
-      break;
-      
-    case OSMR2:
 #if TRACE_OS_TIMER
-      g_log_file << "OsTimer: set timer[2]: " << std::hex << value << std::endl;
+    g_log_file << "OsTimer: set " << std::hex << address << ": " << value << std::endl;
 #endif
-      
-      m_OSMR[OSMRTraits<OSMR2>::INDEX] = value;
-      break;
-      
-    case OSMR3:
-#if TRACE_OS_TIMER
-      g_log_file << "OsTimer: set timer[3]: " << std::hex << value << std::endl;
-#endif
-      
-      m_OSMR[OSMRTraits<OSMR3>::INDEX] = value;
-      break;
-      
-    case OSCR:
-#if TRACE_OS_TIMER
-      g_log_file << "OsTimer: set OSCR: " << std::hex << value << std::endl;
-#endif
-      
-      m_OSCR = value;
-      break;
-      
-    case OSSR:
-#if TRACE_OS_TIMER
-      g_log_file << "OsTimer: set OSSR: " << std::hex << value << std::endl;
-#endif
-      
-      // :SA-1110 Developer's Manual: p.97: Wei 2004-Apr-24:
-      //
-      // bits 0 ~ 3 of OSSR register are cleared by writing a one to the
-      // proper bit position. Writing zeros to this register has no effect.
-      // All reserved bits read as zeros and are unaffected by writes;
-      switch (value & 0xF)
-      {
-      case 0x0: // 0000
-        break;
-        
-      case 0x1: // 0001
-        m_OSSR &= ~OSMRTraits<OSMR0>::BITMASK;
-        break;
-        
-      case 0x2: // 0010
-        m_OSSR &= ~OSMRTraits<OSMR1>::BITMASK;
-        break;
-        
-      case 0x3: // 0011
-        m_OSSR &= ~(OSMRTraits<OSMR0>::BITMASK |
-                    OSMRTraits<OSMR1>::BITMASK);
-        break;
-        
-      case 0x4: // 0100
-        m_OSSR &= ~OSMRTraits<OSMR2>::BITMASK;
-        break;
-        
-      case 0x5: // 0101
-        m_OSSR &= ~(OSMRTraits<OSMR0>::BITMASK |
-                    OSMRTraits<OSMR2>::BITMASK);
-        break;
-        
-      case 0x6: // 0110
-        m_OSSR &= ~(OSMRTraits<OSMR1>::BITMASK |
-                    OSMRTraits<OSMR2>::BITMASK);
-        break;
-        
-      case 0x7: // 0111
-        m_OSSR &= ~(OSMRTraits<OSMR0>::BITMASK |
-                    OSMRTraits<OSMR1>::BITMASK |
-                    OSMRTraits<OSMR2>::BITMASK);
-        break;
-        
-      case 0x8: // 1000
-        m_OSSR &= ~OSMRTraits<OSMR3>::BITMASK;
-        break;
-        
-      case 0x9: // 1001
-        m_OSSR &= ~(OSMRTraits<OSMR0>::BITMASK |
-                    OSMRTraits<OSMR3>::BITMASK);
-        break;
-        
-      case 0xA: // 1010
-        m_OSSR &= ~(OSMRTraits<OSMR1>::BITMASK |
-                    OSMRTraits<OSMR3>::BITMASK);
-        break;
-        
-      case 0xB: // 1011
-        m_OSSR &= ~(OSMRTraits<OSMR0>::BITMASK |
-                    OSMRTraits<OSMR1>::BITMASK |
-                    OSMRTraits<OSMR3>::BITMASK);
-        break;
-        
-      case 0xC: // 1100
-        m_OSSR &= ~(OSMRTraits<OSMR2>::BITMASK |
-                    OSMRTraits<OSMR3>::BITMASK);
-        break;
-        
-      case 0xD: // 1101
-        m_OSSR &= ~(OSMRTraits<OSMR0>::BITMASK |
-                    OSMRTraits<OSMR2>::BITMASK |
-                    OSMRTraits<OSMR3>::BITMASK);
-        break;
-        
-      case 0xE: // 1110
-        m_OSSR &= ~(OSMRTraits<OSMR1>::BITMASK |
-                    OSMRTraits<OSMR2>::BITMASK |
-                    OSMRTraits<OSMR3>::BITMASK);
-        break;
-        
-      case 0xF: // 1111
-        m_OSSR &= ~(OSMRTraits<OSMR0>::BITMASK |
-                    OSMRTraits<OSMR1>::BITMASK |
-                    OSMRTraits<OSMR2>::BITMASK |
-                    OSMRTraits<OSMR3>::BITMASK);
-        break;
-        
-      default:
-        assert(!"Should not reach here.");
-        break;
-      }
-      break;
-      
-    case OWER:
-#if TRACE_OS_TIMER
-      g_log_file << "OsTimer: set OWER: " << std::hex << value << std::endl;
-#endif
-      
-      // :SA-1110 Developer's Manual: p.96: Wei 2004-Apr-24:
-      //
-      // WME (Watchdog Match Enable) bit is set by writing a one to it.
-      // It can only be cleared by one of the reset functions (hardware reset,
-      // software reset) and by entering sleep mode.
-      // A watchdog reset also clears the watchdog enable bit.
-      if (false == m_has_enabled_watchdog_timer)
-      {
-        if (WME_BITMASK == (value & WME_BITMASK))
-        {
-          // :SA-1110 Developer's Manual: p.98: Wei 2004-Apr-25:
-          //
-          // The user must clear OSSR:M3 before setting up a watchdog reset.
-          assert(0 == (m_OSSR & OSMRTraits<OSMR3>::BITMASK));
-          
-          m_OWER |= WME_BITMASK;
-          m_has_enabled_watchdog_timer = true;
-        }
-      }
-      break;
-      
-    case OIER:
-#if TRACE_OS_TIMER
-      g_log_file << "OsTimer: set OIER: " << std::hex << value << std::endl;
-#endif
-      
-      // :NOTE: Wei 2004-Apr-24:
-      //
-      // According to OSSR register: All reserved bits read as zeros and are unaffected by writes
-      // I think OIER is the same with OSSR.
-      m_OIER = (value & 0xF);
-      break;
-      
-    default:
-      assert(!"Should not reach here.");
-      break;
-    }
+    
+    m_register_bank.write(address, value);
   }
 }
@@ -29,6 +29,7 @@
 //
 
 #include "ARMware.hpp"
+#include "RegisterBank.hpp"
 
 namespace ARMware
 {
@@ -51,6 +52,8 @@ namespace ARMware
     uint32_t m_OWER; // OS timer watchdog enable register
     uint32_t m_OIER; // OS timer interrupt enable register
     
+    RegisterBank<OsTimer> m_register_bank;
+    
     // Operation
     
     void
@@ -67,6 +70,10 @@ namespace ARMware
       m_OIER = 0;
     }
     
+    void write_OSSR(uint32_t const address, uint32_t const value);
+    void write_OWER(uint32_t const address, uint32_t const value);
+    void write_OIER(uint32_t const address, uint32_t const value);
+    
     template<typename OsmrTraits>
     inline void
     compare_and_set_status()
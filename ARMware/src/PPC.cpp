@@ -15,12 +15,120 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 //
 
+#if TRACE_PPC
+#include <iostream>
+#endif
+
 #include <cassert>
 #include "PPC.hpp"
 
 namespace ARMware
 {
+  //////////////////////////////// Private ////////////////////////////////////
+  //============================== Operation ==================================
+  
+  void
+  PPC::write_PPDR(uint32_t const /* address */, uint32_t const value)
+  {
+#if TRACE_PPC
+    g_log_file << "PPC: PPDR: " << std::hex << value << std::endl;
+#endif
+    
+    // :SA-1110 Developer's Manual: Wei 2003-Dec-14:
+    //
+    // For reserved bits, writes are ignored and reads return "ones".
+    //
+    // :NOTE: Wei 2004-Jan-13:
+    //
+    // I have already put 'ones' in the upper 10 bits in reset(),
+    // thus I only need to prevent the upper 10 bits from writing,
+    // then I can meet the requirement stated above.
+    m_PPDR = (value & 0x3FFFFF);
+  }
+  
+  void
+  PPC::write_PPSR(uint32_t const /* address */, uint32_t const value)
+  {
+#if TRACE_PPC
+    g_log_file << "PPC: PPSR: " << std::hex << value << std::endl;
+#endif
+    
+    // :SA-1110 Developer's Manual: Wei 2003-Dec-14:
+    //
+    // For reserved bits, writes are ignored and reads return "ones".
+    m_PPSR = (value & 0x3FFFFF);
+  }
+  
+  void
+  PPC::write_PPAR(uint32_t const /* address */, uint32_t const value)
+  {
+#if TRACE_PPC
+    g_log_file << "PPC: PPAR: " << std::hex << value << std::endl;
+#endif
+    
+    // :NOTE: Wei 2004-Jan-03:
+    //
+    // Only bits 12, 18 are not reserved.
+    m_PPAR = (value & ((1 << 18) | (1 << 12)));
+  }
+  
+  void
+  PPC::write_PSDR(uint32_t const /* address */, uint32_t const value)
+  {
+#if TRACE_PPC
+    g_log_file << "PPC: PSDR: " << std::hex << value << std::endl;
+#endif
+    
+    // :SA-1110 Developer's Manual: Wei 2003-Dec-14:
+    //
+    // For reserved bits, writes are ignored and reads return "zeros".
+    m_PSDR = (value & 0x3FFFFF);
+  }
+  
+  void
+  PPC::write_PPFR(uint32_t const /* address */, uint32_t const value)
+  {
+#if TRACE_PPC
+    g_log_file << "PPC: PPFR: " << std::hex << value << std::endl;
+#endif
+    
+    // :NOTE: Wei 2004-Jan-03:
+    //
+    // Only bits 0, 12, 13, 14, 15, 16, 17, 18 are not reserved.
+    m_PPFR = (value & ((1 << 18) | (1 << 17) | (1 << 16) | (1 << 15) | (1 << 14) | (1 << 13) | (1 << 12) | (1 << 0)));
+  }
+  
+  void
+  PPC::write_HSCR2(uint32_t const /* address */, uint32_t const value)
+  {
+#if TRACE_PPC
+    g_log_file << "PPC: HSCR2: " << std::hex << value << std::endl;
+#endif
+    
+    // :NOTE: Wei 2004-Jan-03:
+    //
+    // Only bits 18, 19 are not reserved.
+    m_HSCR2 = (value & ((1 << 19) | (1 << 18)));
+  }
+  
   //////////////////////////////// Public /////////////////////////////////////
+  //============================== Life cycle =================================
+  
+  PPC::PPC()
+    : m_register_bank(this, "ppc", PPDR, (HSCR2 + 4) - PPDR)
+  {
+    init_register();
+    
+    uint32_t const flags = (RegisterBankBase::REG_READ_WRITE | RegisterBankBase::REG_WRITE_SIDE_EFFECT);
+    
+    m_register_bank.add(PPDR,  "PPDR",  flags, &m_PPDR,  0, &PPC::write_PPDR);
+    m_register_bank.add(PPSR,  "PPSR",  flags, &m_PPSR,  0, &PPC::write_PPSR);
+    m_register_bank.add(PPAR,  "PPAR",  flags, &m_PPAR,  0, &PPC::write_PPAR);
+    m_register_bank.add(PSDR,  "PSDR",  flags, &m_PSDR,  0, &PPC::write_PSDR);
+    m_register_bank.add(PPFR,  "PPFR",  flags, &m_PPFR,  0, &PPC::write_PPFR);
+    m_register_bank.add(HSCR2, "HSCR2", flags, &m_HSCR2, 0, &PPC::write_HSCR2);
+  }
+  
   //============================== Operation ==================================
   
   void
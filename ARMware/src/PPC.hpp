@@ -22,6 +22,7 @@
 //
 
 #include "ARMware.hpp"
+#include "RegisterBank.hpp"
 
 namespace ARMware
 {
@@ -51,6 +52,10 @@ namespace ARMware
     
     uint32_t m_HSCR2; // Serial 2 HSSP Control Register 2
     
+    RegisterBank<PPC> m_register_bank;
+    
+    // Operation
+    
     void
     init_register()
     {
@@ -63,6 +68,13 @@ namespace ARMware
       m_HSCR2 = 0;
     }
     
+    void write_PPDR(uint32_t const address, uint32_t const value);
+    void write_PPSR(uint32_t const address, uint32_t const value);
+    void write_PPAR(uint32_t const address, uint32_t const value);
+    void write_PSDR(uint32_t const address, uint32_t const value);
+    void write_PPFR(uint32_t const address, uint32_t const value);
+    void write_HSCR2(uint32_t const address, uint32_t const value);
+    
   public:
     
     // Bit definition
@@ -75,10 +87,7 @@ namespace ARMware
     
     // Operation
     
-    PPC()
-    {
-      init_register();
-    }
+    PPC();
     
     void reset();
     
@@ -121,112 +130,14 @@ namespace ARMware
     g_log_file << "PPC: get value at address = " << std::hex << address << std::endl;
 #endif
     
-    switch (address)
-    {
-    case PPDR:  return m_PPDR;
-    case PPSR:  return m_PPSR;
-    case PPAR:  return m_PPAR;
-    case PSDR:  return m_PSDR;
-    case PPFR:  return m_PPFR;
-    case HSCR2: return m_HSCR2;
-    default: assert(!"Should not reach here."); return 0;
-    }
+    return m_register_bank.read(address);
   }
   
   template<typename T_store>
   void
   PPC::put_data(uint32_t const address, T_store const value)
   {
-    switch (address)
-    {
-    case PPDR:
-#if TRACE_PPC
-      g_log_file << "PPC: PPDR: " << std::hex << value << std::endl;
-#endif
-      
-      // :SA-1110 Developer's Manual: Wei 2003-Dec-14:
-      //
-      // For reserved bits, writes are ignored and reads return "ones".
-      //
-      // :NOTE: Wei 2004-Jan-13:
-      //
-      // I have already put 'ones' in the upper 10 bits in reset(),
-      // thus I only need to prevent the upper 10 bits from writing,
-      // then I can meet the requirement stated above.
-      m_PPDR = (value & 0x3FFFFF);
-      break;
-      
-    case PPSR:
-#if TRACE_PPC
-      g_log_file << "PPC: PPSR: " << std::hex << value << std::endl;
-#endif
-      
-      // :SA-1110 Developer's Manual: Wei 2003-Dec-14:
-      //
-      // For reserved bits, writes are ignored and reads return "ones".
-      //
-      // :NOTE: Wei 2004-Jan-13:
-      //
-      // I have already put 'ones' in the upper 10 bits in reset(),
-      // thus I only need to prevent the upper 10 bits from writing,
-      // then I can meet the requirement stated above.
-      m_PPSR = (value & 0x3FFFFF);
-      break;
-      
-    case PPAR:
-#if TRACE_PPC
-      g_log_file << "PPC: PPAR: " << std::hex << value << std::endl;
-#endif
-      
-      // :NOTE: Wei 2004-Jan-03:
-      //
-      // Only bits 12, 18 are not reserved.
-      m_PPAR = (value & ((1 << 18) | (1 << 12)));
-      break;
-      
-    case PSDR:
-#if TRACE_PPC
-      g_log_file << "PPC: PSDR: " << std::hex << value << std::endl;
-#endif
-      
-      // :SA-1110 Developer's Manual: Wei 2003-Dec-14:
-      //
-      // For reserved bits, writes are ignored and reads return "zeros".
-      //
-      // :NOTE: Wei 2004-Jan-13:
-      //
-      // I have already put 'zeros' in the upper 10 bits in reset(),
-      // thus I only need to prevent the upper 10 bits from writing,
-      // then I can meet the requirement stated above.
-      m_PSDR = (value & 0x3FFFFF);
-      break;
-      
-    case PPFR:
-#if TRACE_PPC
-      g_log_file << "PPC: PPFR: " << std::hex << value << std::endl;
-#endif
-      
-      // :NOTE: Wei 2004-Jan-03:
-      //
-      // Only bits 0, 12, 13, 14, 15, 16, 17, 18 are not reserved.
-      m_PPFR = (value & ((1 << 18) | (1 << 17) | (1 << 16) | (1 << 15) | (1 << 14) | (1 << 13) | (1 << 12) | (1 << 0)));
-      break;
-      
-    case HSCR2:
-#if TRACE_PPC
-      g_log_file << "PPC: HSCR2: " << std::hex << value << std::endl;
-#endif
-      
-      // :NOTE: Wei 2004-Jan-03:
-      //
-      // Only bits 18, 19 are not reserved.
-      m_HSCR2 = (value & ((1 << 19) | (1 << 18)));
-      break;
-      
-    default:
-      assert(!"Should not reach here.");
-      break;
-    }
+    m_register_bank.write(address, value);
   }
 }
 
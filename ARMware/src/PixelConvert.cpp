@@ -0,0 +1,547 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <vector>
+
+#include "PixelConvert.hpp"
+#include "Log.hpp"
+#include "platform_dep.hpp"
+
+// The SIMD kernels are written in intrinsics rather than inline assembly,
+// all of them are compiled with the target attribute, thus the rest of
+// ARMware is still built for the CPU specified in CFLAGS (in the debug mode
+// as well), and whether a kernel is used depends only on CPUID (see
+// is_supported()). The intrinsics can be used with the target attribute
+// since gcc-4.9.
+#if ENABLE_DRAWING_ASM && defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__)) && \
+  ((__GNUC__ > 4) || ((4 == __GNUC__) && (__GNUC_MINOR__ >= 9)))
+#define PIXEL_CONVERT_SSE2 1
+#define PIXEL_CONVERT_AVX2 1
+#include <emmintrin.h>
+#include <immintrin.h>
+#endif
+
+namespace ARMware
+{
+  PixelConvert g_pixel_convert;
+  
+  namespace
+  {
+    inline uint32_t
+    convert_pixel_16bpp(uint32_t const pixel)
+    {
+      return (0xFF000000 |
+              ((pixel & 0x001F) << 19) | // blue
+              ((pixel & 0x07E0) << 5) |  // green
+              ((pixel & 0xF800) >> 8));  // red
+    }
+    
+    inline uint32_t
+    nibble_at(uint8_t const * const src, uint32_t const idx)
+    {
+      return ((src[idx >> 1] >> ((idx & 1) << 2)) & 0xF);
+    }
+    
+    void
+    convert_16bpp_scalar(uint16_t const * const src, uint32_t * const dest, uint32_t const count)
+    {
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        dest[i] = convert_pixel_16bpp(src[i]);
+      }
+    }
+    
+    void
+    convert_8bpp_scalar(uint8_t const * const src,
+                        uint32_t * const dest,
+                        uint32_t const count,
+                        uint32_t const * const lut)
+    {
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        dest[i] = lut[src[i]];
+      }
+    }
+    
+    void
+    convert_4bpp_scalar(uint8_t const * const src,
+                        uint32_t const first,
+                        uint32_t * const dest,
+                        uint32_t const count,
+                        uint32_t const * const lut)
+    {
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        dest[i] = lut[nibble_at(src, first + i)];
+      }
+    }
+    
+#if PIXEL_CONVERT_SSE2
+    // 8 pixels:
+    //
+    // {red, green, blue} are expanded into 8 bits in each 16-bit lane,
+    // then {green, red} & {alpha, blue} are interleaved into RGBA.
+    __attribute__((target("sse2"))) inline void
+    convert_8_pixels_16bpp_sse2(uint16_t const * const src, uint32_t * const dest)
+    {
+      __m128i const pixels = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src));
+      
+      __m128i const red = _mm_srli_epi16(_mm_and_si128(pixels, _mm_set1_epi16(static_cast<short>(0xF800))), 8);
+      __m128i const green = _mm_srli_epi16(_mm_and_si128(pixels, _mm_set1_epi16(0x07E0)), 3);
+      __m128i const blue = _mm_slli_epi16(_mm_and_si128(pixels, _mm_set1_epi16(0x001F)), 3);
+      
+      __m128i const green_red = _mm_or_si128(red, _mm_slli_epi16(green, 8));
+      __m128i const alpha_blue = _mm_or_si128(blue, _mm_set1_epi16(static_cast<short>(0xFF00)));
+      
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(dest), _mm_unpacklo_epi16(green_red, alpha_blue));
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + 4), _mm_unpackhi_epi16(green_red, alpha_blue));
+    }
+    
+    __attribute__((target("sse2"))) void
+    convert_16bpp_sse2(uint16_t const * const src, uint32_t * const dest, uint32_t const count)
+    {
+      uint32_t i = 0;
+      
+      for (; (i + 8) <= count; i += 8)
+      {
+        convert_8_pixels_16bpp_sse2(src + i, dest + i);
+      }
+      
+      convert_16bpp_scalar(src + i, dest + i, count - i);
+    }
+    
+    // SSE2 has neither a byte shuffle nor a gather,
+    // thus the LUT lookups are still scalar loads,
+    // only the stores are 4 pixels wide.
+    __attribute__((target("sse2"))) void
+    convert_8bpp_sse2(uint8_t const * const src,
+                      uint32_t * const dest,
+                      uint32_t const count,
+                      uint32_t const * const lut)
+    {
+      uint32_t i = 0;
+      
+      for (; (i + 4) <= count; i += 4)
+      {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + i),
+                         _mm_setr_epi32(lut[src[i]],
+                                        lut[src[i + 1]],
+                                        lut[src[i + 2]],
+                                        lut[src[i + 3]]));
+      }
+      
+      convert_8bpp_scalar(src + i, dest + i, count - i, lut);
+    }
+    
+    __attribute__((target("sse2"))) void
+    convert_4bpp_sse2(uint8_t const * const src,
+                      uint32_t const first,
+                      uint32_t * const dest,
+                      uint32_t const count,
+                      uint32_t const * const lut)
+    {
+      uint32_t i = 0;
+      
+      if ((first & 1) && (count != 0))
+      {
+        dest[0] = lut[nibble_at(src, first)];
+        
+        i = 1;
+      }
+      
+      uint8_t const *curr = src + ((first + i) >> 1);
+      
+      for (; (i + 4) <= count; i += 4, curr += 2)
+      {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + i),
+                         _mm_setr_epi32(lut[curr[0] & 0xF],
+                                        lut[curr[0] >> 4],
+                                        lut[curr[1] & 0xF],
+                                        lut[curr[1] >> 4]));
+      }
+      
+      convert_4bpp_scalar(src, first + i, dest + i, count - i, lut);
+    }
+#endif
+    
+#if PIXEL_CONVERT_AVX2
+    // 16 pixels, the same as the SSE2 one, however, vpunpck{l,h}wd work
+    // in each 128-bit half, thus the results are in the order of
+    // {0-3, 8-11} & {4-7, 12-15}, and have to be permuted back.
+    __attribute__((target("avx2"))) void
+    convert_16bpp_avx2(uint16_t const * const src, uint32_t * const dest, uint32_t const count)
+    {
+      __m256i const red_mask = _mm256_set1_epi16(static_cast<short>(0xF800));
+      __m256i const green_mask = _mm256_set1_epi16(0x07E0);
+      __m256i const blue_mask = _mm256_set1_epi16(0x001F);
+      __m256i const alpha = _mm256_set1_epi16(static_cast<short>(0xFF00));
+      
+      uint32_t i = 0;
+      
+      for (; (i + 16) <= count; i += 16)
+      {
+        __m256i const pixels = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(src + i));
+        
+        __m256i const red = _mm256_srli_epi16(_mm256_and_si256(pixels, red_mask), 8);
+        __m256i const green = _mm256_srli_epi16(_mm256_and_si256(pixels, green_mask), 3);
+        __m256i const blue = _mm256_slli_epi16(_mm256_and_si256(pixels, blue_mask), 3);
+        
+        __m256i const green_red = _mm256_or_si256(red, _mm256_slli_epi16(green, 8));
+        __m256i const alpha_blue = _mm256_or_si256(blue, alpha);
+        
+        __m256i const low = _mm256_unpacklo_epi16(green_red, alpha_blue);
+        __m256i const high = _mm256_unpackhi_epi16(green_red, alpha_blue);
+        
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dest + i), _mm256_permute2x128_si256(low, high, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dest + i + 8), _mm256_permute2x128_si256(low, high, 0x31));
+      }
+      
+      if ((i + 8) <= count)
+      {
+        convert_8_pixels_16bpp_sse2(src + i, dest + i);
+        
+        i += 8;
+      }
+      
+      convert_16bpp_scalar(src + i, dest + i, count - i);
+    }
+    
+    __attribute__((target("avx2"))) void
+    convert_8bpp_avx2(uint8_t const * const src,
+                      uint32_t * const dest,
+                      uint32_t const count,
+                      uint32_t const * const lut)
+    {
+      uint32_t i = 0;
+      
+      for (; (i + 8) <= count; i += 8)
+      {
+        __m256i const idx = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<__m128i const *>(src + i)));
+        
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dest + i),
+                            _mm256_i32gather_epi32(reinterpret_cast<int const *>(lut), idx, 4));
+      }
+      
+      convert_8bpp_scalar(src + i, dest + i, count - i, lut);
+    }
+    
+    // The 16-entry LUT is held in 2 registers, and looked up by vpermd
+    // rather than a gather.
+    __attribute__((target("avx2"))) void
+    convert_4bpp_avx2(uint8_t const * const src,
+                      uint32_t const first,
+                      uint32_t * const dest,
+                      uint32_t const count,
+                      uint32_t const * const lut)
+    {
+      uint32_t i = 0;
+      
+      if ((first & 1) && (count != 0))
+      {
+        dest[0] = lut[nibble_at(src, first)];
+        
+        i = 1;
+      }
+      
+      __m256i const lut_low = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(lut));
+      __m256i const lut_high = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(lut + 8));
+      __m128i const nibble_mask = _mm_set1_epi8(0x0F);
+      __m256i const seven = _mm256_set1_epi32(7);
+      
+      uint8_t const *curr = src + ((first + i) >> 1);
+      
+      for (; (i + 8) <= count; i += 8, curr += 4)
+      {
+        int32_t packed;
+        
+        memcpy(&packed, curr, sizeof(packed));
+        
+        __m128i const bytes = _mm_cvtsi32_si128(packed);
+        __m128i const low = _mm_and_si128(bytes, nibble_mask);
+        __m128i const high = _mm_and_si128(_mm_srli_epi16(bytes, 4), nibble_mask);
+        
+        __m256i const idx = _mm256_cvtepu8_epi32(_mm_unpacklo_epi8(low, high));
+        
+        __m256i const from_low = _mm256_permutevar8x32_epi32(lut_low, idx);
+        __m256i const from_high = _mm256_permutevar8x32_epi32(lut_high, idx);
+        
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dest + i),
+                            _mm256_blendv_epi8(from_low, from_high, _mm256_cmpgt_epi32(idx, seven)));
+      }
+      
+      convert_4bpp_scalar(src, first + i, dest + i, count - i, lut);
+    }
+#endif
+    
+    PixelConvert::Kernel const KERNELS[PixelConvert::KERNEL_NUMBER] =
+    {
+      { "scalar", convert_16bpp_scalar, convert_8bpp_scalar, convert_4bpp_scalar },
+#if PIXEL_CONVERT_SSE2
+      { "sse2", convert_16bpp_sse2, convert_8bpp_sse2, convert_4bpp_sse2 },
+#else
+      { "sse2", 0, 0, 0 },
+#endif
+#if PIXEL_CONVERT_AVX2
+      { "avx2", convert_16bpp_avx2, convert_8bpp_avx2, convert_4bpp_avx2 }
+#else
+      { "avx2", 0, 0, 0 }
+#endif
+    };
+    
+    uint32_t const BENCH_WIDTH = 240;
+    uint32_t const BENCH_HEIGHT = 320;
+    uint32_t const BENCH_ROUND = 200;
+    
+    struct BenchArea
+    {
+      char const *mp_name;
+      
+      uint32_t m_left;
+      uint32_t m_width;
+      uint32_t m_first_pixel;
+      uint32_t m_pixel_number;
+    };
+    typedef struct BenchArea BenchArea;
+    
+    // The partial rectangle starts at an odd pixel to cover the 4 bpp
+    // unaligned prologue.
+    BenchArea const BENCH_AREAS[] =
+    {
+      { "full screen", 0, BENCH_WIDTH, 0, BENCH_HEIGHT },
+      { "partial 48x37", 97, 48, 133, 37 }
+    };
+    
+    // Converts one area the way MachineScreen::draw_panel() does,
+    // one frame buffer line (one screen column) at a time.
+    void
+    convert_area(PixelConvert::Kernel const &kernel,
+                 uint32_t const bpp,
+                 BenchArea const &area,
+                 uint8_t const * const frame,
+                 uint32_t const * const lut,
+                 uint32_t * const span,
+                 uint32_t * const pixbuf)
+    {
+      uint32_t const bytes_per_line = ((BENCH_HEIGHT * bpp) >> 3);
+      
+      for (uint32_t x = area.m_left; x < (area.m_left + area.m_width); ++x)
+      {
+        uint8_t const * const line = frame + (x * bytes_per_line);
+        
+        switch (bpp)
+        {
+        case 16:
+          kernel.mp_16bpp(reinterpret_cast<uint16_t const *>(line) + area.m_first_pixel, span, area.m_pixel_number);
+          break;
+        
+        case 8:
+          kernel.mp_8bpp(line + area.m_first_pixel, span, area.m_pixel_number, lut);
+          break;
+        
+        case 4:
+          kernel.mp_4bpp(line, area.m_first_pixel, span, area.m_pixel_number, lut);
+          break;
+        }
+        
+        uint32_t *dest = pixbuf + ((BENCH_HEIGHT - 1 - area.m_first_pixel) * BENCH_WIDTH) + x;
+        
+        for (uint32_t i = 0; i < area.m_pixel_number; ++i)
+        {
+          *dest = span[i];
+          
+          dest -= BENCH_WIDTH;
+        }
+      }
+    }
+  }
+  
+  ///////////////////////////////// Private ///////////////////////////////////
+  
+  void
+  PixelConvert::select_kernel(KernelEnum const kernel)
+  {
+    m_kernel = kernel;
+    mp_kernel = &(KERNELS[kernel]);
+  }
+  
+  ///////////////////////////////// Public ////////////////////////////////////
+  //============================== Life cycle =================================
+  
+  PixelConvert::PixelConvert()
+    : m_kernel(KERNEL_SCALAR),
+      mp_kernel(&(KERNELS[KERNEL_SCALAR]))
+  { }
+  
+  //============================== Operation ==================================
+  
+  void
+  PixelConvert::init()
+  {
+    KernelEnum best = KERNEL_SCALAR;
+    
+    for (uint32_t kernel = KERNEL_SCALAR; kernel < KERNEL_NUMBER; ++kernel)
+    {
+      if (true == is_supported(static_cast<KernelEnum>(kernel)))
+      {
+        best = static_cast<KernelEnum>(kernel);
+      }
+    }
+    
+    char const * const forced = getenv("ARMWARE_PIXEL_CONVERT");
+    
+    if (forced != 0)
+    {
+      for (uint32_t kernel = KERNEL_SCALAR; kernel < best; ++kernel)
+      {
+        if (0 == strcmp(forced, KERNELS[kernel].mp_name))
+        {
+          best = static_cast<KernelEnum>(kernel);
+          break;
+        }
+      }
+    }
+    
+    select_kernel(best);
+  }
+  
+  void
+  PixelConvert::run_benchmark() const
+  {
+    uint32_t seed = 0x13579BDF;
+    
+    std::vector<uint8_t> frame(BENCH_WIDTH * BENCH_HEIGHT * 2);
+    
+    for (uint32_t i = 0; i < frame.size(); ++i)
+    {
+      seed = (seed * 1103515245) + 12345;
+      
+      frame[i] = static_cast<uint8_t>(seed >> 16);
+    }
+    
+    uint16_t palette[256];
+    
+    memcpy(palette, &(frame[0]), sizeof(palette));
+    
+    uint32_t lut[256];
+    
+    build_lut(palette, 256, lut);
+    
+    uint32_t span[BENCH_HEIGHT];
+    
+    std::vector<uint32_t> expected(BENCH_WIDTH * BENCH_HEIGHT);
+    std::vector<uint32_t> pixbuf(BENCH_WIDTH * BENCH_HEIGHT);
+    
+    uint32_t const bpps[] = { 16, 8, 4 };
+    
+    g_log_file << "Pixel convert benchmark: " << BENCH_ROUND << " rounds, TSC cycles per pixel" << std::endl;
+    
+    for (uint32_t b = 0; b < (sizeof(bpps) / sizeof(bpps[0])); ++b)
+    {
+      for (uint32_t a = 0; a < (sizeof(BENCH_AREAS) / sizeof(BENCH_AREAS[0])); ++a)
+      {
+        BenchArea const &area = BENCH_AREAS[a];
+        
+        convert_area(KERNELS[KERNEL_SCALAR], bpps[b], area, &(frame[0]), lut, span, &(expected[0]));
+        
+        for (uint32_t kernel = KERNEL_SCALAR; kernel < KERNEL_NUMBER; ++kernel)
+        {
+          if (false == is_supported(static_cast<KernelEnum>(kernel)))
+          {
+            continue;
+          }
+          
+          convert_area(KERNELS[kernel], bpps[b], area, &(frame[0]), lut, span, &(pixbuf[0]));
+          
+          bool const match = (0 == memcmp(&(expected[0]), &(pixbuf[0]), pixbuf.size() * sizeof(uint32_t)));
+          
+          uint64_t const begin = read_time_stamp_counter();
+          
+          for (uint32_t round = 0; round < BENCH_ROUND; ++round)
+          {
+            convert_area(KERNELS[kernel], bpps[b], area, &(frame[0]), lut, span, &(pixbuf[0]));
+          }
+          
+          uint64_t const cycles = read_time_stamp_counter() - begin;
+          
+          g_log_file << "  " << std::setw(2) << bpps[b] << " bpp, "
+                     << std::setw(13) << area.mp_name << ", "
+                     << std::setw(6) << KERNELS[kernel].mp_name << ": "
+                     << std::fixed << std::setprecision(3)
+                     << (static_cast<double>(cycles) / (static_cast<double>(BENCH_ROUND) *
+                                                        area.m_width *
+                                                        area.m_pixel_number))
+                     << ((true == match) ? "" : "  MISMATCH")
+                     << std::endl;
+        }
+      }
+    }
+  }
+  
+  // SA-1110 palette entry:
+  //
+  // bit 11-8: red, bit 7-4: green, bit 3-0: blue.
+  // (bit 13-12 of entry 0 is the pixel size, see MachineScreen)
+  void
+  PixelConvert::build_lut(uint16_t const * const palette,
+                          uint32_t const entry_number,
+                          uint32_t * const lut)
+  {
+    for (uint32_t i = 0; i < entry_number; ++i)
+    {
+      uint32_t const entry = palette[i];
+      
+      lut[i] = (0xFF000000 |
+                (((entry & 0xF) * 0x11) << 16) |
+                ((((entry >> 4) & 0xF) * 0x11) << 8) |
+                (((entry >> 8) & 0xF) * 0x11));
+    }
+  }
+  
+  bool
+  PixelConvert::is_supported(KernelEnum const kernel)
+  {
+    switch (kernel)
+    {
+    case KERNEL_SCALAR:
+      return true;
+    
+    case KERNEL_SSE2:
+#if PIXEL_CONVERT_SSE2
+      __builtin_cpu_init();
+      return (0 != __builtin_cpu_supports("sse2"));
+#else
+      return false;
+#endif
+    
+    case KERNEL_AVX2:
+#if PIXEL_CONVERT_AVX2
+      __builtin_cpu_init();
+      return (0 != __builtin_cpu_supports("avx2"));
+#else
+      return false;
+#endif
+    
+    default:
+      assert(!"Should not reach here.");
+      return false;
+    }
+  }
+}
@@ -0,0 +1,139 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+#ifndef PixelConvert_hpp
+#define PixelConvert_hpp
+
+#include "Type.hpp"
+
+namespace ARMware
+{
+  // Converts a span of LCD frame buffer pixels into the 32-bit RGBA layout
+  // of the Gdk pixbuf used by MachineScreen.
+  //
+  // * 16 bpp: rrrr rggg gggb bbbb, each field is moved to the top bits of
+  //   its byte, the same as the old MMX & SSE2 drawing codes did.
+  // * 8 bpp & 4 bpp: each pixel is an index into a LUT, which is built from
+  //   the SA-1110 palette entries by build_lut(). In 4 bpp mode, the first
+  //   pixel is in the low nibble of a byte.
+  //
+  // Each format has a scalar, an SSE2 and an AVX2 kernel, the best one
+  // supported by the running CPU is chosen once in init() through CPUID.
+  // ARMWARE_PIXEL_CONVERT=scalar|sse2 forces a lower one.
+  //
+  // ARMWARE_PIXEL_BENCH=1 runs run_benchmark() instead of the emulated
+  // machine.
+  typedef class PixelConvert PixelConvert;
+  class PixelConvert
+  {
+  public:
+    
+    enum KernelEnum
+    {
+      KERNEL_SCALAR,
+      KERNEL_SSE2,
+      KERNEL_AVX2,
+      
+      KERNEL_NUMBER
+    };
+    typedef enum KernelEnum KernelEnum;
+    
+    typedef void (*Convert16bpp)(uint16_t const * const src,
+                                 uint32_t * const dest,
+                                 uint32_t const count);
+    
+    typedef void (*Convert8bpp)(uint8_t const * const src,
+                                uint32_t * const dest,
+                                uint32_t const count,
+                                uint32_t const * const lut);
+    
+    // @first: the index of the first pixel, counted from 'src'.
+    typedef void (*Convert4bpp)(uint8_t const * const src,
+                                uint32_t const first,
+                                uint32_t * const dest,
+                                uint32_t const count,
+                                uint32_t const * const lut);
+    
+    struct Kernel
+    {
+      char const *mp_name;
+      
+      Convert16bpp mp_16bpp;
+      Convert8bpp mp_8bpp;
+      Convert4bpp mp_4bpp;
+    };
+    typedef struct Kernel Kernel;
+  
+  private:
+    
+    // Attribute
+    
+    KernelEnum m_kernel;
+    Kernel const *mp_kernel;
+    
+    // Operation
+    
+    void select_kernel(KernelEnum const kernel);
+  
+  public:
+    
+    // Life cycle
+    
+    PixelConvert();
+    
+    // Operation
+    
+    void init();
+    
+    void run_benchmark() const;
+    
+    static void build_lut(uint16_t const * const palette,
+                          uint32_t const entry_number,
+                          uint32_t * const lut);
+    
+    inline void
+    convert_16bpp(uint16_t const * const src, uint32_t * const dest, uint32_t const count) const
+    { mp_kernel->mp_16bpp(src, dest, count); }
+    
+    inline void
+    convert_8bpp(uint8_t const * const src,
+                 uint32_t * const dest,
+                 uint32_t const count,
+                 uint32_t const * const lut) const
+    { mp_kernel->mp_8bpp(src, dest, count, lut); }
+    
+    inline void
+    convert_4bpp(uint8_t const * const src,
+                 uint32_t const first,
+                 uint32_t * const dest,
+                 uint32_t const count,
+                 uint32_t const * const lut) const
+    { mp_kernel->mp_4bpp(src, first, dest, count, lut); }
+    
+    // Inquery
+    
+    static bool is_supported(KernelEnum const kernel);
+    
+    inline KernelEnum
+    kernel() const
+    { return m_kernel; }
+  };
+  
+  extern PixelConvert g_pixel_convert;
+}
+
+#endif
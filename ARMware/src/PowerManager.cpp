@@ -25,6 +25,33 @@
 namespace ARMware
 {
   //////////////////////////////// Public /////////////////////////////////////
+  //============================== Life cycle =================================
+  
+  PowerManager::PowerManager()
+    : m_register_bank(this, "power_manager", PMCR, (POSR + 4) - PMCR)
+  {
+    init_register();
+    
+    m_register_bank.add_plain(PMCR, "PMCR", &mPMCR);
+    m_register_bank.add_plain(PSSR, "PSSR", &mPSSR);
+    m_register_bank.add_plain(PSPR, "PSPR", &mPSPR);
+    m_register_bank.add_plain(PWER, "PWER", &mPWER);
+    m_register_bank.add_plain(PCFR, "PCFR", &mPCFR);
+    
+    // :SA-1110 Developer's Manual: Wei 2004-Jan-11:
+    //
+    // The PPCR contains bits used to configure the core operating frequency generated by the PLL.
+    //
+    // :NOTE: Wei 2004-Jan-11:
+    //
+    // However, I enforce the core operating frequency as 206 MHz.
+    // Thus, this register is no use to me.
+    m_register_bank.add_plain(PPCR, "PPCR", &mPPCR);
+    
+    m_register_bank.add_plain(PGSR, "PGSR", &mPGSR);
+    m_register_bank.add_plain(POSR, "POSR", &mPOSR, RegisterBankBase::REG_READ);
+  }
+  
   //============================== Operation ==================================
   
   void
@@ -56,21 +83,7 @@ namespace ARMware
     g_log_file << "POWER MGR: get value at address: " << std::hex << address << std::endl;
 #endif
     
-    switch (address)
-    {
-    case PMCR: return mPMCR;
-    case PSSR: return mPSSR;
-    case PSPR: return mPSPR;
-    case PWER: return mPWER;
-    case PCFR: return mPCFR;
-    case PPCR: return mPPCR;
-    case PGSR: return mPGSR;
-    case POSR: return mPOSR;
-      
-    default:
-      assert(!"Should not reach here.");
-      return 0;
-    }
+    return m_register_bank.read(address);
   }
   
   template<>
@@ -81,29 +94,6 @@ namespace ARMware
     g_log_file << "POWER MGR: put value " << std::hex << value << " at address " << address << std::endl;
 #endif
     
-    switch (address)
-    {
-    case PMCR: mPMCR = value; break;
-    case PSSR: mPSSR = value; break;
-    case PSPR: mPSPR = value; break;
-    case PWER: mPWER = value; break;
-    case PCFR: mPCFR = value; break;
-      
-    case PPCR:
-      // :SA-1110 Developer's Manual: Wei 2004-Jan-11:
-      //
-      // The PPCR contains bits used to configure the core operating frequency generated by the PLL.
-      //
-      // :NOTE: Wei 2004-Jan-11:
-      //
-      // However, I enforce the core operating frequency as 206 MHz.
-      // Thus, this register is no use to me.
-      mPPCR = value;
-      break;
-      
-    case PGSR: mPGSR = value; break;
-    case POSR: assert(!"Should not reach here."); break;
-    default: assert(!"Should not reach here."); break;
-    }
+    m_register_bank.write(address, value);
   }
 }
@@ -22,6 +22,7 @@
 //
 
 #include "ARMware.hpp"
+#include "RegisterBank.hpp"
 
 namespace ARMware
 {
@@ -58,6 +59,8 @@ namespace ARMware
     uint32_t mPGSR; // Power manager GPIO sleep state register
     uint32_t mPOSR; // Power manager oscillator status register
     
+    RegisterBank<PowerManager> m_register_bank;
+    
     // Operation
     
     void
@@ -75,10 +78,7 @@ namespace ARMware
     
   public:
     
-    PowerManager()
-    {
-      init_register();
-    }
+    PowerManager();
     
     void reset();
     
@@ -21,12 +21,63 @@
 
 namespace ARMware
 {
+  //////////////////////////////// Private ////////////////////////////////////
+  //============================== Operation ==================================
+  
+  void
+  RTC::write_RTTR(uint32_t const /* address */, uint32_t const value)
+  {
+    // :NOTE: Wei 2004-Jun-06:
+    //
+    // I don't support RTC Trim Procedure yet.
+    // Thus just let it pass by.
+#if TRACE_RTC
+    g_log_file << "RTC: Trim Procedure, using " << value << std::endl;
+#endif
+    
+    m_RTTR = (value & 0x3FFFFFF);
+  }
+  
+  void
+  RTC::write_RTSR(uint32_t const /* address */, uint32_t const value)
+  {
+#if TRACE_RTC
+    g_log_file << "RTC: setting RTSR: orig: " << std::hex << m_RTSR << ", value: " << value << std::endl;
+#endif
+    
+    // :SA-1110 Developer's Manual: p.90, p.91: Wei 2003-Dec-09:
+    //
+    // Each status bit may be cleared by writing a one to the status register in the desired bit position.
+    // ...
+    // The AL & HZ bits (bit 0 & 1) are cleared by writing ones to them.
+    // ...
+    // All reserved bits are read as 0s and are unaffected by writes.
+    m_RTSR &= ~(value & STATUS_VALID_BIT_MASK);
+    
+#if TRACE_RTC
+    g_log_file << "RTC: setting RTSR: new: " << std::hex << m_RTSR << std::endl;
+#endif
+  }
+  
   //////////////////////////////// Public /////////////////////////////////////
   //============================== Life cycle =================================
   
   RTC::RTC()
+    : m_register_bank(this, "rtc", RTAR, (RTSR + 4) - RTAR)
   {
     init_register();
+    
+    m_register_bank.add_plain(RTAR, "RTAR", &m_RTAR);
+    m_register_bank.add_plain(RCNR, "RCNR", &m_RCNR,
+                              RegisterBankBase::REG_READ_WRITE | RegisterBankBase::REG_VOLATILE);
+    m_register_bank.add(RTTR, "RTTR",
+                        RegisterBankBase::REG_READ_WRITE | RegisterBankBase::REG_WRITE_SIDE_EFFECT,
+                        &m_RTTR, 0, &RTC::write_RTTR);
+    m_register_bank.add(RTSR, "RTSR",
+                        (RegisterBankBase::REG_READ_WRITE |
+                         RegisterBankBase::REG_WRITE_SIDE_EFFECT |
+                         RegisterBankBase::REG_VOLATILE),
+                        &m_RTSR, 0, &RTC::write_RTSR);
   }
   
   //============================== Operation ==================================
@@ -106,75 +157,17 @@ namespace ARMware
     g_log_file << "RTC: get value at " << std::hex << address << std::endl;
 #endif
     
-    switch (address)
-    {
-    case RTAR: return m_RTAR;
-    case RCNR: return m_RCNR;
-    case RTTR: return m_RTTR;
-    case RTSR: return m_RTSR;
-      
-    default:
-      assert(!"Should not reach here.");
-      return 0;
-    }
+    return m_register_bank.read(address);
   }
   
   template<>
   void
   RTC::put_data(uint32_t const address, uint32_t const value)
   {
-    switch (address)
-    {
-    case RTAR:
 #if TRACE_RTC
-      g_log_file << "RTC: set alarm: " << std::hex << value << std::endl;
+    g_log_file << "RTC: put value " << std::hex << value << " at " << address << std::endl;
 #endif
-      
-      m_RTAR = value;
-      break;
-      
-    case RCNR:
-#if TRACE_RTC
-      g_log_file << "RTC: set RCNR: " << std::hex << value << std::endl;
-#endif
-      
-      m_RCNR = value;
-      break;
-      
-    case RTTR:
-      // :NOTE: Wei 2004-Jun-06:
-      //
-      // I don't support RTC Trim Procedure yet.
-      // Thus just let it pass by.
-#if TRACE_RTC
-      g_log_file << "RTC: Trim Procedure, using " << value << std::endl;
-#endif
-      
-      m_RTTR = (value & 0x3FFFFFF);
-      break;
-      
-    case RTSR:
-#if TRACE_RTC
-      g_log_file << "RTC: setting RTSR: orig: " << std::hex << m_RTSR << ", value: " << value << std::endl;
-#endif
-      
-      // :SA-1110 Developer's Manual: p.90, p.91: Wei 2003-Dec-09:
-      //
-      // Each status bit may be cleared by writing a one to the status register in the desired bit position.
-      // ...
-      // The AL & HZ bits (bit 0 & 1) are cleared by writing ones to them.
-      // ...
-      // All reserved bits are read as 0s and are unaffected by writes.
-      m_RTSR &= ~(value & STATUS_VALID_BIT_MASK);
-      
-#if TRACE_RTC
-      g_log_file << "RTC: setting RTSR: new: " << std::hex << m_RTSR << std::endl;
-#endif
-      break;
-      
-    default:
-      assert(!"Should not reach here.");
-      break;
-    }
+    
+    m_register_bank.write(address, value);
   }
 }
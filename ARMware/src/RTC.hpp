@@ -27,6 +27,7 @@
 //
 
 #include "ARMware.hpp"
+#include "RegisterBank.hpp"
 
 namespace ARMware
 {
@@ -68,6 +69,8 @@ namespace ARMware
     uint32_t m_RTTR; // RTC timer trim register
     uint32_t m_RTSR; // RTC status register
     
+    RegisterBank<RTC> m_register_bank;
+    
     // Operation
     
     void
@@ -79,6 +82,9 @@ namespace ARMware
       m_RTSR = 0;
     }
     
+    void write_RTTR(uint32_t const address, uint32_t const value);
+    void write_RTSR(uint32_t const address, uint32_t const value);
+    
     // Friend
     
     friend class IntController;
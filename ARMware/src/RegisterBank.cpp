@@ -0,0 +1,95 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+#include "RegisterBank.hpp"
+
+namespace ARMware
+{
+  RegisterBankBase *RegisterBankBase::msp_first = 0;
+  
+  ///////////////////////////////// Public ////////////////////////////////////
+  //============================== Life cycle =================================
+  
+  RegisterBankBase::RegisterBankBase(char const * const name,
+                                     uint32_t const base,
+                                     uint32_t const count)
+    : mp_name(name),
+      mp_next(msp_first),
+      m_base(base),
+      m_count(count)
+  {
+    msp_first = this;
+  }
+  
+  RegisterBankBase::~RegisterBankBase()
+  {
+    for (RegisterBankBase **curr = &msp_first; *curr != 0; curr = &((*curr)->mp_next))
+    {
+      if (this == *curr)
+      {
+        *curr = mp_next;
+        break;
+      }
+    }
+  }
+  
+  //============================== Operation ==================================
+  
+  void
+  RegisterBankBase::dump_all(std::ostream &os)
+  {
+    os << std::dec;
+    
+    for (RegisterBankBase const *curr = msp_first; curr != 0; curr = curr->mp_next)
+    {
+      curr->dump_register(os);
+    }
+  }
+  
+  bool
+  RegisterBankBase::find_register(uint32_t const address, char const *&bank, char const *&reg)
+  {
+    for (RegisterBankBase const *curr = msp_first; curr != 0; curr = curr->mp_next)
+    {
+      char const * const name = curr->register_name(address);
+      
+      if (name != 0)
+      {
+        bank = curr->mp_name;
+        reg = name;
+        
+        return true;
+      }
+    }
+    
+    return false;
+  }
+  
+  RegisterBankBase *
+  RegisterBankBase::find_bank(uint32_t const address, uint32_t const flags)
+  {
+    for (RegisterBankBase *curr = msp_first; curr != 0; curr = curr->mp_next)
+    {
+      if ((curr->register_flags(address) & flags) == flags)
+      {
+        return curr;
+      }
+    }
+    
+    return 0;
+  }
+}
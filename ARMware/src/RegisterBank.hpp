@@ -0,0 +1,372 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+#ifndef RegisterBank_hpp
+#define RegisterBank_hpp
+
+#include <cassert>
+#include <iostream>
+#include <vector>
+
+#include "Type.hpp"
+
+namespace ARMware
+{
+  // The registers of a device, which are word aligned and start at the
+  // base address of the device, are declared into a RegisterBank in the
+  // constructor of the device, and get_data() & put_data() of the device
+  // become an indexed dispatch through the bank.
+  //
+  // A register is either a plain storage register, which is read from (and
+  // written to, if it has no write callback) its storage directly, or it
+  // has a read and/or write callback of the device.
+  //
+  // Every bank counts the reads & writes of each register, and
+  // RuntimeStats::dump() reports them as mmio.<bank>.<register>.read|write.
+  typedef class RegisterBankBase RegisterBankBase;
+  class RegisterBankBase
+  {
+  public:
+    
+    enum FlagEnum
+    {
+      REG_READ  = (1 << 0),
+      REG_WRITE = (1 << 1),
+      REG_READ_WRITE = (REG_READ | REG_WRITE),
+      
+      // Reading it changes the state of the device (ex: popping a FIFO).
+      REG_READ_SIDE_EFFECT = (1 << 2),
+      
+      // Writing it does more than storing the value.
+      REG_WRITE_SIDE_EFFECT = (1 << 3),
+      
+      // Its value changes without being written by the guest
+      // (ex: counters, status & pin level registers).
+      REG_VOLATILE = (1 << 4)
+    };
+    typedef enum FlagEnum FlagEnum;
+    
+  private:
+    
+    // Attribute
+    
+    char const * const mp_name;
+    
+    RegisterBankBase *mp_next;
+    
+    static RegisterBankBase *msp_first;
+    
+  protected:
+    
+    uint32_t const m_base;
+    uint32_t const m_count;
+    
+    // Operation
+    
+    virtual void dump_register(std::ostream &os) const = 0;
+    
+    virtual char const *register_name(uint32_t const address) const = 0;
+    virtual uint32_t register_flags(uint32_t const address) const = 0;
+    
+  public:
+    
+    // Life cycle
+    
+    RegisterBankBase(char const * const name, uint32_t const base, uint32_t const count);
+    virtual ~RegisterBankBase();
+    
+    // Operation
+    
+    static void dump_all(std::ostream &os);
+    
+    // Finds the bank & the name of the register at 'address'.
+    //
+    // @false: no bank declares a register there.
+    static bool find_register(uint32_t const address, char const *&bank, char const *&reg);
+    
+    // Finds the bank which declares a register at 'address' with all of
+    // 'flags', or 0.
+    static RegisterBankBase *find_bank(uint32_t const address, uint32_t const flags);
+    
+    // The same as read() & write() of RegisterBank, for the callers which
+    // don't know the device type.
+    virtual uint32_t read_register(uint32_t const address) const = 0;
+    virtual void write_register(uint32_t const address, uint32_t const value) const = 0;
+    
+    // Inquery
+    
+    inline char const *
+    name() const
+    { return mp_name; }
+    
+    inline bool
+    contains(uint32_t const address) const
+    { return ((address - m_base) >> 2) < m_count; }
+  };
+  
+  template<typename T_device>
+  class RegisterBank : public RegisterBankBase
+  {
+  public:
+    
+    typedef uint32_t (T_device::*ReadFunc)(uint32_t const address);
+    typedef void (T_device::*WriteFunc)(uint32_t const address, uint32_t const value);
+    
+  private:
+    
+    struct Register
+    {
+      char const *mp_name;
+      uint32_t m_flags;
+      
+      uint32_t *mp_storage;
+      ReadFunc m_read;
+      WriteFunc m_write;
+      
+      uint64_t m_read_count;
+      uint64_t m_write_count;
+    };
+    typedef struct Register Register;
+    
+    // Attribute
+    
+    T_device * const mp_device;
+    
+    // The counters are updated by the const get_data() of the devices.
+    mutable std::vector<Register> m_register;
+    
+    // Operation
+    
+    inline Register &
+    lookup(uint32_t const address) const
+    {
+      uint32_t const idx = ((address - m_base) >> 2);
+      
+      assert(0 == (address & 3));
+      assert(idx < m_count);
+      
+      return m_register[idx];
+    }
+    
+    // The guest can access any offset in the region of the device, thus
+    // unlike lookup(), the register is checked here in the release build
+    // as well. An undeclared register or a wrong access reads as 0 and
+    // ignores the writes, as the old switch defaults did.
+    inline Register *
+    find(uint32_t const address, uint32_t const flag) const
+    {
+      uint32_t const idx = ((address - m_base) >> 2);
+      
+      assert(0 == (address & 3));
+      assert(idx < m_count);
+      
+      if ((address & 3) || (idx >= m_count))
+      {
+        return 0;
+      }
+      
+      Register &reg = m_register[idx];
+      
+      assert(reg.mp_name != 0);
+      assert(reg.m_flags & flag);
+      
+      if ((0 == reg.mp_name) || (0 == (reg.m_flags & flag)))
+      {
+        return 0;
+      }
+      
+      return &reg;
+    }
+    
+    virtual void
+    dump_register(std::ostream &os) const
+    {
+      for (typename std::vector<Register>::const_iterator iter = m_register.begin();
+           iter != m_register.end();
+           ++iter)
+      {
+        if (0 == iter->mp_name)
+        {
+          continue;
+        }
+        
+        if (iter->m_read_count != 0)
+        {
+          os << "mmio." << name() << '.' << iter->mp_name << ".read " << iter->m_read_count << std::endl;
+        }
+        
+        if (iter->m_write_count != 0)
+        {
+          os << "mmio." << name() << '.' << iter->mp_name << ".write " << iter->m_write_count << std::endl;
+        }
+      }
+    }
+    
+    virtual char const *
+    register_name(uint32_t const address) const
+    {
+      if ((address & 3) || (false == contains(address)))
+      {
+        return 0;
+      }
+      
+      return m_register[(address - m_base) >> 2].mp_name;
+    }
+    
+    virtual uint32_t
+    register_flags(uint32_t const address) const
+    {
+      if ((address & 3) || (false == contains(address)))
+      {
+        return 0;
+      }
+      
+      return m_register[(address - m_base) >> 2].m_flags;
+    }
+    
+  public:
+    
+    // Life cycle
+    
+    RegisterBank(T_device * const device,
+                 char const * const name,
+                 uint32_t const base,
+                 uint32_t const size)
+      : RegisterBankBase(name, base, size >> 2),
+        mp_device(device),
+        m_register(size >> 2)
+    {
+      for (typename std::vector<Register>::iterator iter = m_register.begin();
+           iter != m_register.end();
+           ++iter)
+      {
+        iter->mp_name = 0;
+        iter->m_flags = 0;
+        iter->mp_storage = 0;
+        iter->m_read = 0;
+        iter->m_write = 0;
+        iter->m_read_count = 0;
+        iter->m_write_count = 0;
+      }
+    }
+    
+    // Operation
+    
+    // A plain storage register, which needs no callback at all.
+    inline void
+    add_plain(uint32_t const address,
+              char const * const name,
+              uint32_t * const storage,
+              uint32_t const flags = REG_READ_WRITE)
+    { add(address, name, flags, storage, 0, 0); }
+    
+    // If 'read' is 0, the register is read from 'storage' directly.
+    // If 'write' is 0, the register is written to 'storage' directly.
+    void
+    add(uint32_t const address,
+        char const * const name,
+        uint32_t const flags,
+        uint32_t * const storage,
+        ReadFunc const read,
+        WriteFunc const write)
+    {
+      Register &reg = lookup(address);
+      
+      assert(0 == reg.mp_name);
+      assert((0 == (flags & REG_READ)) || (storage != 0) || (read != 0));
+      assert((0 == (flags & REG_WRITE)) || (storage != 0) || (write != 0));
+      
+      reg.mp_name = name;
+      reg.m_flags = flags;
+      reg.mp_storage = storage;
+      reg.m_read = read;
+      reg.m_write = write;
+    }
+    
+    inline uint32_t
+    read(uint32_t const address) const
+    {
+      Register * const reg = find(address, REG_READ);
+      
+      if (0 == reg)
+      {
+        return 0;
+      }
+      
+      ++reg->m_read_count;
+      
+      if (0 == reg->m_read)
+      {
+        return *(reg->mp_storage);
+      }
+      else
+      {
+        return (mp_device->*(reg->m_read))(address);
+      }
+    }
+    
+    inline void
+    write(uint32_t const address, uint32_t const value) const
+    {
+      Register * const reg = find(address, REG_WRITE);
+      
+      if (0 == reg)
+      {
+        return;
+      }
+      
+      ++reg->m_write_count;
+      
+      if (0 == reg->m_write)
+      {
+        *(reg->mp_storage) = value;
+      }
+      else
+      {
+        (mp_device->*(reg->m_write))(address, value);
+      }
+    }
+    
+    virtual uint32_t
+    read_register(uint32_t const address) const
+    { return read(address); }
+    
+    virtual void
+    write_register(uint32_t const address, uint32_t const value) const
+    { write(address, value); }
+    
+    // Inquery
+    
+    inline uint32_t
+    flags(uint32_t const address) const
+    { return lookup(address).m_flags; }
+    
+    inline uint32_t const *
+    storage(uint32_t const address) const
+    { return lookup(address).mp_storage; }
+    
+    inline uint64_t
+    read_count(uint32_t const address) const
+    { return lookup(address).m_read_count; }
+    
+    inline uint64_t
+    write_count(uint32_t const address) const
+    { return lookup(address).m_write_count; }
+  };
+}
+
+#endif
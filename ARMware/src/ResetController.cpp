@@ -25,6 +25,20 @@
 namespace ARMware
 {
   //////////////////////////////// Public /////////////////////////////////////
+  //============================== Life cycle =================================
+  
+  ResetController::ResetController()
+    : m_register_bank(this, "reset_controller", RSRR, (RCSR + 4) - RSRR)
+  {
+    init_register();
+    
+    // :SA-1110 Developer's Manual: Wei 2003-Dec-11:
+    //
+    // RSRR is write-only.
+    m_register_bank.add_plain(RSRR, "RSRR", &mRSRR, RegisterBankBase::REG_WRITE);
+    m_register_bank.add_plain(RCSR, "RCSR", &mRCSR);
+  }
+  
   //============================== Operation ==================================
   
   void
@@ -42,22 +56,7 @@ namespace ARMware
     g_log_file << "RESET CTRL: get value at address " << std::hex << address << std::endl;
 #endif
     
-    switch (address)
-    {
-    case RSRR:
-      // :SA-1110 Developer's Manual: Wei 2003-Dec-11:
-      //
-      // RSRR is write-only.
-      assert(!"Should not reach here.");
-      return 0;
-      
-    case RCSR:
-      return mRCSR;
-      
-    default:
-      assert(!"Should not reach here.");
-      return 0;
-    }
+    return m_register_bank.read(address);
   }
   
   template<>
@@ -68,11 +67,6 @@ namespace ARMware
     g_log_file << "RESET CTRL: put " << std::hex << value << " at address " << address << std::endl;
 #endif
     
-    switch (address)
-    {
-    case RSRR: mRSRR = value; break;
-    case RCSR: mRCSR = value; break;
-    default: assert(!"Should not reach here."); break;
-    }
+    m_register_bank.write(address, value);
   }
 }
@@ -22,6 +22,7 @@
 //
 
 #include "ARMware.hpp"
+#include "RegisterBank.hpp"
 
 namespace ARMware
 {
@@ -41,6 +42,8 @@ namespace ARMware
     uint32_t mRSRR; // Reset controller software reset register
     uint32_t mRCSR; // Reset controller status register
     
+    RegisterBank<ResetController> m_register_bank;
+    
     // Operation
     
     void
@@ -54,10 +57,7 @@ namespace ARMware
     
     // Life cycle
     
-    ResetController()
-    {
-      init_register();
-    }
+    ResetController();
     
     // Operation
     
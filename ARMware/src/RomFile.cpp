@@ -18,12 +18,23 @@
 #include <iostream>
 
 #include <cassert>
+#include <cstdlib>
+#include <cstring>
+
+#if LOAD_ROM_INTO_MEMORY && LINUX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 #include "Log.hpp"
 #include "RomFile.hpp"
 #include "Egpio.hpp"
 #include "Core.hpp"
+#include "AddressSpace.hpp"
 #include "MachineType.hpp"
+#include "platform_dep.hpp"
 
 #include "RomFile.tcc"
 
@@ -33,6 +44,163 @@ namespace ARMware
   //============================== Operation ==================================
   
 #if LOAD_ROM_INTO_MEMORY
+#if LINUX
+  void
+  RomFile::map_rom(std::string const &filename)
+  {
+    if (m_write_back != WRITE_BACK_NONE)
+    {
+      m_fd = open(filename.c_str(), O_RDWR);
+      
+      if (-1 == m_fd)
+      {
+        g_log_file << "WARNING: Can not open the flash ROM file " << filename
+                   << " for writing, the changes will not be written back." << std::endl;
+        
+        m_write_back = WRITE_BACK_NONE;
+      }
+    }
+    
+    if (-1 == m_fd)
+    {
+      m_fd = open(filename.c_str(), O_RDONLY);
+    }
+    
+    struct stat file_stat;
+    
+    if (-1 == m_fd)
+    {
+      g_log_file << "ERROR: Can not open the flash ROM file " << filename
+                 << ", the flash ROM will be blank." << std::endl;
+      
+      file_stat.st_size = 0;
+    }
+    else if (fstat(m_fd, &file_stat) != 0)
+    {
+      g_log_file << "ERROR: Can not stat the flash ROM file " << filename
+                 << ", the flash ROM will be blank." << std::endl;
+      
+      close(m_fd);
+      m_fd = -1;
+      
+      file_stat.st_size = 0;
+    }
+    
+    if (-1 == m_fd)
+    {
+      m_write_back = WRITE_BACK_NONE;
+    }
+    
+    // Check whether the provided image is larger than the size of our partition or not.
+    if (file_stat.st_size > static_cast<off_t>(MachineType::FLASH_SIZE))
+    {
+      g_log_file << "WARNING: The size of flash ROM file is larger than the that of flash ROM device." << std::endl;
+    }
+    
+    // The image file of the user is never grown to the size of the flash
+    // ROM device, the part of the device past the end of a smaller image
+    // couldn't be written back, thus the changes are thrown away instead.
+    if ((m_write_back != WRITE_BACK_NONE) &&
+        (file_stat.st_size < static_cast<off_t>(MachineType::FLASH_SIZE)))
+    {
+      g_log_file << "WARNING: The size of flash ROM file is smaller than that of flash ROM device, "
+                 << "the changes will not be written back." << std::endl;
+      
+      m_write_back = WRITE_BACK_NONE;
+    }
+    
+    // A file mapping can't be backed by the huge pages, thus the image is
+    // read into a region backed by them instead, unless the changes have to
+    // reach the image file.
+    m_huge_page = ((WRITE_BACK_NONE == m_write_back) ? huge_page_setting() : HUGE_PAGE_NONE);
+    
+    // Reserve the whole flash ROM with zero pages first (the old codes
+    // memset() it to 0), and then map the image over the beginning of it.
+    // A page past the end of the image file would raise SIGBUS if it was
+    // mapped from the file.
+    void *base = memory_allocate(MachineType::FLASH_SIZE, m_huge_page);
+    
+    if ((0 == base) && (HUGE_PAGE_EXPLICIT == m_huge_page))
+    {
+      g_log_file << "RomFile: not enough huge pages reserved (see /proc/sys/vm/nr_hugepages), "
+                 << "use the native pages instead." << std::endl;
+      
+      m_huge_page = HUGE_PAGE_NONE;
+      
+      base = memory_allocate(MachineType::FLASH_SIZE, m_huge_page);
+    }
+    
+    if (0 == base)
+    {
+      g_log_file << "ERROR: Can not allocate memory for the flash ROM." << std::endl;
+      
+      exit(EXIT_FAILURE);
+    }
+    
+    uint32_t const page_size = get_native_page_size();
+    uint32_t const mapped_size = ((file_stat.st_size >= static_cast<off_t>(MachineType::FLASH_SIZE))
+                                  ? MachineType::FLASH_SIZE
+                                  : ((static_cast<uint32_t>(file_stat.st_size) + page_size - 1) & ~(page_size - 1)));
+    
+    if (mapped_size != 0)
+    {
+      void * const image = ((HUGE_PAGE_NONE == m_huge_page)
+                            ? mmap(base,
+                                   mapped_size,
+                                   PROT_READ | PROT_WRITE,
+                                   ((WRITE_BACK_NONE == m_write_back) ? MAP_PRIVATE : MAP_SHARED) | MAP_FIXED,
+                                   m_fd,
+                                   0)
+                            : MAP_FAILED);
+      
+      if (image != base)
+      {
+        // Read the image instead, the same as the non-Linux builds.
+        if (HUGE_PAGE_NONE == m_huge_page)
+        {
+          g_log_file << "WARNING: Can not map the flash ROM file " << filename
+                     << ", the changes will not be written back." << std::endl;
+        }
+        
+        m_write_back = WRITE_BACK_NONE;
+        
+        uint32_t const size = ((file_stat.st_size >= static_cast<off_t>(MachineType::FLASH_SIZE))
+                               ? MachineType::FLASH_SIZE
+                               : static_cast<uint32_t>(file_stat.st_size));
+        uint32_t offset = 0;
+        
+        while (offset < size)
+        {
+          ssize_t const count = pread(m_fd, static_cast<uint8_t *>(base) + offset, size - offset, offset);
+          
+          if (count <= 0)
+          {
+            g_log_file << "ERROR: Can not read the flash ROM file " << filename << std::endl;
+            break;
+          }
+          
+          offset += count;
+        }
+      }
+    }
+    
+    mp_rom_data = static_cast<uint8_t *>(base);
+  }
+  
+  void
+  RomFile::write_back(uint32_t const address, uint32_t const size)
+  {
+    if (m_write_back != WRITE_BACK_BLOCK)
+    {
+      return;
+    }
+    
+    uint32_t const page_size = get_native_page_size();
+    uint32_t const begin = (address & ~(page_size - 1));
+    
+    msync(&(mp_rom_data[begin]), (address + size) - begin, MS_SYNC);
+  }
+#else
   void
   RomFile::read_rom_into_memory()
   {
@@ -51,6 +219,23 @@ namespace ARMware
     m_file_stream.read(reinterpret_cast<char *>(mp_rom_data), MachineType::FLASH_SIZE);
   }
 #endif
+#endif
+  
+  void
+  RomFile::change_mode(MachineType::FlashInfo::Mode const mode)
+  {
+    bool const was_read_array = (MachineType::FlashInfo::READ_ARRAY_MODE == mMode);
+    
+    mMode = mode;
+    
+    // AddressSpace loads from the flash ROM directly only in the read array
+    // mode.
+    if ((mp_address_space != 0) &&
+        (was_read_array != (MachineType::FlashInfo::READ_ARRAY_MODE == mode)))
+    {
+      mp_address_space->update_rom_region();
+    }
+  }
   
   ////////////////////////////////// Public ///////////////////////////////////
   //============================== Life cycle =================================
@@ -58,9 +243,16 @@ namespace ARMware
   RomFile::RomFile(Core * const core, Egpio * const egpio, std::string const &filename)
     : mp_core(core),
       mpEgpio(egpio),
-#if LOAD_ROM_INTO_MEMORY
+      mp_address_space(0),
+#if LOAD_ROM_INTO_MEMORY && LINUX
+      m_fd(-1),
+      m_write_back(WRITE_BACK_NONE),
+      m_huge_page(HUGE_PAGE_NONE),
+      mp_rom_data(0),
+#elif LOAD_ROM_INTO_MEMORY
       mp_rom_data(new uint8_t[MachineType::FLASH_SIZE]),
 #endif
+      mMode(MachineType::FlashInfo::READ_ARRAY_MODE),
       // :NOTE: Wei 2004-May-25:
       //
       // In the soft emulator, I think the write buffer will always be ready,
@@ -68,6 +260,25 @@ namespace ARMware
       // and initialize it here.
       mExtStatusReg(MachineType::FlashInfo::WRITE_BUFFER_READY_BIT)
   {
+#if LOAD_ROM_INTO_MEMORY && LINUX
+    char const * const write_back = getenv("ARMWARE_ROM_WRITE_BACK");
+    
+    if (write_back != 0)
+    {
+      if (0 == strcmp(write_back, "exit"))
+      {
+        m_write_back = WRITE_BACK_EXIT;
+      }
+      else if (0 == strcmp(write_back, "block"))
+      {
+        m_write_back = WRITE_BACK_BLOCK;
+      }
+    }
+    
+    reset();
+    
+    map_rom(filename);
+#else
 #if LOAD_ROM_INTO_MEMORY
     memset(mp_rom_data, 0, MachineType::FLASH_SIZE); // initialize to 0
 #endif
@@ -80,12 +291,28 @@ namespace ARMware
     
 #if LOAD_ROM_INTO_MEMORY
     read_rom_into_memory();
+#endif
 #endif
   }
   
   RomFile::~RomFile()
   {
-#if LOAD_ROM_INTO_MEMORY
+#if LOAD_ROM_INTO_MEMORY && LINUX
+    if (mp_rom_data != 0)
+    {
+      if (m_write_back != WRITE_BACK_NONE)
+      {
+        msync(mp_rom_data, MachineType::FLASH_SIZE, MS_SYNC);
+      }
+      
+      memory_release(mp_rom_data, MachineType::FLASH_SIZE, m_huge_page);
+    }
+    
+    if (m_fd != -1)
+    {
+      close(m_fd);
+    }
+#elif LOAD_ROM_INTO_MEMORY
     if (mp_rom_data != 0)
     {
       delete[] mp_rom_data;
@@ -103,7 +330,7 @@ namespace ARMware
     //
     // Upon initial device power-up and after exit from reset/power-down mode,
     // the device defaults to read array mode.
-    mMode = MachineType::FlashInfo::READ_ARRAY_MODE;
+    change_mode(MachineType::FlashInfo::READ_ARRAY_MODE);
     
     m_status_reg = static_cast<uint8_t>(0);
     SetWSMReady(); // Initialize WSM in ready mode.
@@ -716,7 +943,7 @@ namespace ARMware
       // ...
       // The CUI will remain in Read Status Register mode until a new command
       // is issued.
-      mMode = MachineType::FlashInfo::READ_STATUS_REG_MODE;
+      change_mode(MachineType::FlashInfo::READ_STATUS_REG_MODE);
       break;
       
     case MachineType::FlashInfo::BYTE_WORD_PROGRAM_MODE:
@@ -747,6 +974,10 @@ namespace ARMware
 #endif
           
           write_to_rom(address, value);
+          
+#if LOAD_ROM_INTO_MEMORY && LINUX
+          write_back(address, sizeof(value));
+#endif
         }
         else
         {
@@ -767,7 +998,7 @@ namespace ARMware
       //
       // After the program sequence is written, the device automatically outputs
       // SRD (status register data)when read.
-      mMode = MachineType::FlashInfo::READ_STATUS_REG_MODE;
+      change_mode(MachineType::FlashInfo::READ_STATUS_REG_MODE);
       break;
       
     case MachineType::FlashInfo::WRITE_TO_BUFFER_MODE_BEGIN:
@@ -775,7 +1006,7 @@ namespace ARMware
       
       mDataCount = (value & MachineType::BANK_BITMASK) + 1;
       
-      mMode = MachineType::FlashInfo::WRITE_TO_BUFFER_MODE_DATA;
+      change_mode(MachineType::FlashInfo::WRITE_TO_BUFFER_MODE_DATA);
       
       mWriteBufferCurrIndex = 0; // Initialize to 0
       break;
@@ -798,7 +1029,7 @@ namespace ARMware
       
       if (mWriteBufferCurrIndex == mDataCount)
       {
-        mMode = MachineType::FlashInfo::WRITE_TO_BUFFER_MODE_CONFIRM;
+        change_mode(MachineType::FlashInfo::WRITE_TO_BUFFER_MODE_CONFIRM);
       }
       break;
       
@@ -860,6 +1091,10 @@ namespace ARMware
               memcpy(&(mp_rom_data[mWriteBufferAddr[0]]),
                      &(mWriteBufferData[0]),
                      mDataCount * sizeof(MachineType::DataBusWidth));
+              
+#if LINUX
+              write_back(mWriteBufferAddr[0], mDataCount * sizeof(MachineType::DataBusWidth));
+#endif
 #else
 #error "TODO"
 #endif
@@ -905,7 +1140,7 @@ namespace ARMware
       
       SetWSMReady();
       
-      mMode = MachineType::FlashInfo::READ_STATUS_REG_MODE;
+      change_mode(MachineType::FlashInfo::READ_STATUS_REG_MODE);
       break;
       
     case MachineType::FlashInfo::BLOCK_ERASE_MODE:
@@ -944,6 +1179,10 @@ namespace ARMware
             memset(&(mp_rom_data[mCurrentAddress & MachineType::BLOCK_ADDR_BITMASK]),
                    0xFF,
                    MachineType::BLOCK_SIZE);
+            
+#if LINUX
+            write_back(mCurrentAddress & MachineType::BLOCK_ADDR_BITMASK, MachineType::BLOCK_SIZE);
+#endif
 #else
 #error "TODO"
 #endif
@@ -973,7 +1212,7 @@ namespace ARMware
       
       SetWSMReady();
       
-      mMode = MachineType::FlashInfo::READ_STATUS_REG_MODE;
+      change_mode(MachineType::FlashInfo::READ_STATUS_REG_MODE);
       break;
       
     default:
@@ -994,7 +1233,7 @@ namespace ARMware
       switch (value & MachineType::BANK_BITMASK)
       {
       case MachineType::FlashInfo::READ_ARRAY_COMMAND_INTEL:
-        mMode = MachineType::FlashInfo::READ_ARRAY_MODE;
+        change_mode(MachineType::FlashInfo::READ_ARRAY_MODE);
         return;
         
       case MachineType::FlashInfo::READ_ARRAY_COMMAND_AMD:
@@ -1007,7 +1246,7 @@ namespace ARMware
         return;
         
       case MachineType::FlashInfo::READ_ID_CODES_COMMAND:
-        mMode = MachineType::FlashInfo::READ_ID_CODES_MODE;
+        change_mode(MachineType::FlashInfo::READ_ID_CODES_MODE);
         return;
         
       case MachineType::FlashInfo::READ_QUERY_COMMAND:
@@ -1029,11 +1268,11 @@ namespace ARMware
         
         //assert(BuildCFICpuAddress(0x55) == address);
         
-        mMode = MachineType::FlashInfo::READ_QUERY_MODE;
+        change_mode(MachineType::FlashInfo::READ_QUERY_MODE);
         return;
         
       case MachineType::FlashInfo::READ_STATUS_REG_COMMAND:
-        mMode = MachineType::FlashInfo::READ_STATUS_REG_MODE;
+        change_mode(MachineType::FlashInfo::READ_STATUS_REG_MODE);
         return;
         
       case MachineType::FlashInfo::CLEAR_STATUS_REG_COMMAND:
@@ -1058,7 +1297,7 @@ namespace ARMware
           // functionality in ARMware in the near future.
           SetWSMBusy();
           
-          mMode = MachineType::FlashInfo::BLOCK_LOCK_BIT_MODE;
+          change_mode(MachineType::FlashInfo::BLOCK_LOCK_BIT_MODE);
           
           // :NOTE: Wei 2004-May-05:
           //
@@ -1081,7 +1320,7 @@ namespace ARMware
         {
           SetWSMBusy();
           
-          mMode = MachineType::FlashInfo::BYTE_WORD_PROGRAM_MODE;
+          change_mode(MachineType::FlashInfo::BYTE_WORD_PROGRAM_MODE);
           
           mCurrentAddress = address;
         }
@@ -1112,7 +1351,7 @@ namespace ARMware
           default:
             SetWSMBusy();
             
-            mMode = MachineType::FlashInfo::WRITE_TO_BUFFER_MODE_BEGIN;
+            change_mode(MachineType::FlashInfo::WRITE_TO_BUFFER_MODE_BEGIN);
             
             mCurrentAddress = address;
             break;
@@ -1133,7 +1372,7 @@ namespace ARMware
         {
           SetWSMBusy();
           
-          mMode = MachineType::FlashInfo::BLOCK_ERASE_MODE;
+          change_mode(MachineType::FlashInfo::BLOCK_ERASE_MODE);
           
           mCurrentAddress = address;
         }
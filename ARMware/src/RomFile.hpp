@@ -37,6 +37,7 @@
 //
 
 #include "MachineType.hpp"
+#include "platform_dep.hpp"
 
 namespace ARMware
 {
@@ -44,21 +45,58 @@ namespace ARMware
   //
   class Core;
   class Egpio;
+  class AddressSpace;
   
   typedef class RomFile RomFile;
   class RomFile
   {
   private:
     
+#if LOAD_ROM_INTO_MEMORY && LINUX
+    // The flash ROM image is mapped into memory rather than read into it,
+    // ARMWARE_ROM_WRITE_BACK chooses how the programs & erases of the guest
+    // reach the image file:
+    //
+    // * none (default): MAP_PRIVATE, the changes are thrown away when ARMware
+    //   exits. The pages never written by the guest are the page cache pages
+    //   of the image file, thus they are shared by all the ARMware instances
+    //   running the same ROM image.
+    // * exit: MAP_SHARED, msync() once when ARMware exits.
+    // * block: MAP_SHARED, msync() the touched block after every program or
+    //   erase, thus the image survives a crash of ARMware.
+    //
+    // The MAP_SHARED modes fall back to none when the image can not be
+    // opened for writing or is smaller than the flash ROM device, the image
+    // file is never extended to FLASH_SIZE.
+    //
+    // In none, ARMWARE_HUGE_PAGES (see huge_page_setting()) reads the image
+    // into a region backed by the host huge pages instead of mapping it,
+    // which gives up the sharing of the page cache pages.
+    enum WriteBackEnum
+    {
+      WRITE_BACK_NONE,
+      WRITE_BACK_EXIT,
+      WRITE_BACK_BLOCK
+    };
+    typedef enum WriteBackEnum WriteBackEnum;
+#endif
+    
     // Attribute
     
     Core * const mp_core;
     Egpio * const mpEgpio;
+    AddressSpace *mp_address_space;
     
+#if LOAD_ROM_INTO_MEMORY && LINUX
+    int m_fd;
+    WriteBackEnum m_write_back;
+    HugePageEnum m_huge_page;
+#else
     std::fstream m_file_stream;
+#endif
     
 #if LOAD_ROM_INTO_MEMORY
-    uint8_t * const mp_rom_data;
+    uint8_t *mp_rom_data;
 #endif
     
     MachineType::FlashInfo::Mode mMode;
@@ -90,8 +128,15 @@ namespace ARMware
     // Operation
     
 #if LOAD_ROM_INTO_MEMORY
+#if LINUX
+    void map_rom(std::string const &filename);
+    void write_back(uint32_t const address, uint32_t const size);
+#else
     void read_rom_into_memory();
 #endif
+#endif
+    
+    void change_mode(MachineType::FlashInfo::Mode const mode);
     
     template<typename T_return>
     T_return read_from_rom(uint32_t const address) const;
@@ -181,11 +226,31 @@ namespace ARMware
     
     void reset();
     
+    inline void
+    register_address_space(AddressSpace * const address_space)
+    { mp_address_space = address_space; }
+    
     template<typename T_return>
     T_return FASTCALL get_data(uint32_t const address) const;
     
     template<typename T_store>
     void FASTCALL put_data(uint32_t const address, T_store const value);
+    
+    // Inquery
+    
+#if LOAD_ROM_INTO_MEMORY
+    // The host address of the flash ROM contents while the flash is in the
+    // read array mode, so that AddressSpace can load from it directly.
+    //
+    // @0: the flash is in one of the command modes, use get_data().
+    inline uint8_t const *
+    read_array_data() const
+    {
+      return ((MachineType::FlashInfo::READ_ARRAY_MODE == mMode)
+              ? mp_rom_data
+              : 0);
+    }
+#endif
   };
   
   // :NOTE: Wei 2004-May-07:
@@ -0,0 +1,245 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+
+#if LINUX
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "RuntimeStats.hpp"
+#include "RegisterBank.hpp"
+#include "Log.hpp"
+
+namespace ARMware
+{
+  RuntimeStats g_runtime_stats;
+  
+  namespace
+  {
+    char const * const COUNTER_NAME[RuntimeStats::COUNTER_TOTAL] =
+    {
+      "inst.interpreter",
+      "inst.threaded_code",
+      "inst.dynamic",
+      
+      "chunk.create",
+      "chunk.gen_threaded_code",
+      "chunk.gen_dynamic",
+      "chunk.recompile",
+      "chunk.flush",
+      "chunk.smc_fault",
+      
+      "cycles.gen_threaded_code",
+      "cycles.gen_dynamic",
+      
+      "mmu.itlb_hit",
+      "mmu.itlb_miss",
+      "mmu.dtlb_hit",
+      "mmu.dtlb_miss",
+      "mmu.page_table_walk",
+      "mmu.walk_cache_hit",
+      "mmu.walk_cache_miss",
+      "mmu.walk_cache_invalidate",
+      "mmu.walk_cache_flush",
+      "mmu.shadow_tlb_hit",
+      "mmu.shadow_tlb_miss",
+      "mmu.shadow_tlb_stale",
+      "mmu.fastmem_hit",
+      "mmu.fastmem_miss",
+      
+      "exception.und",
+      "exception.swi",
+      "exception.prefetch_abort",
+      "exception.data_abort",
+      "exception.irq",
+      "exception.fiq"
+    };
+  }
+  
+  ///////////////////////////////// Private ///////////////////////////////////
+  
+  void
+  RuntimeStats::open_socket(char const * const path)
+  {
+#if LINUX
+    struct sockaddr_un addr;
+    
+    if (strlen(path) >= sizeof(addr.sun_path))
+    {
+      g_log_file << "Runtime stats: socket path too long: " << path << std::endl;
+      return;
+    }
+    
+    int const fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    
+    if (-1 == fd)
+    {
+      return;
+    }
+    
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
+    
+    // Remove the stale socket left by the previous ARMware process.
+    unlink(path);
+    
+    if ((bind(fd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) != 0) ||
+        (listen(fd, 4) != 0) ||
+        (fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK) != 0))
+    {
+      g_log_file << "Runtime stats: can not listen on " << path << std::endl;
+      
+      close(fd);
+      return;
+    }
+    
+    m_socket_fd = fd;
+    m_socket_path = path;
+#else
+    (void)path;
+#endif
+  }
+  
+  void
+  RuntimeStats::poll_real()
+  {
+    if (m_dump_interval != 0)
+    {
+      time_t const now = time(0);
+      
+      if (now >= m_next_dump_time)
+      {
+        dump(g_log_file);
+        
+        m_next_dump_time = now + m_dump_interval;
+      }
+    }
+    
+#if LINUX
+    if (m_socket_fd != -1)
+    {
+      // The listening socket is non-blocking, thus if there is no client
+      // waiting, accept() returns -1 immediately.
+      int const client_fd = accept(m_socket_fd, 0, 0);
+      
+      if (client_fd != -1)
+      {
+        std::ostringstream os;
+        
+        dump(os);
+        
+        std::string const text = os.str();
+        char const *curr = text.data();
+        size_t remain = text.size();
+        
+        while (remain != 0)
+        {
+          // MSG_NOSIGNAL: a client going away shouldn't kill ARMware by
+          // SIGPIPE.
+          ssize_t const written = send(client_fd, curr, remain, MSG_NOSIGNAL);
+          
+          if (written <= 0)
+          {
+            break;
+          }
+          
+          curr += written;
+          remain -= written;
+        }
+        
+        close(client_fd);
+      }
+    }
+#endif
+  }
+  
+  ///////////////////////////////// Public ////////////////////////////////////
+  //============================== Life cycle =================================
+  
+  RuntimeStats::RuntimeStats()
+    : m_need_poll(false),
+      m_dump_interval(0),
+      m_next_dump_time(0),
+      m_socket_fd(-1)
+  {
+    memset(m_counter, 0, sizeof(m_counter));
+  }
+  
+  RuntimeStats::~RuntimeStats()
+  {
+#if LINUX
+    if (m_socket_fd != -1)
+    {
+      close(m_socket_fd);
+      unlink(m_socket_path.c_str());
+    }
+#endif
+  }
+  
+  //============================== Operation ==================================
+  
+  void
+  RuntimeStats::init()
+  {
+    char const * const interval = getenv("ARMWARE_STATS_INTERVAL");
+    
+    if (interval != 0)
+    {
+      m_dump_interval = strtoul(interval, 0, 10);
+      m_next_dump_time = time(0) + m_dump_interval;
+    }
+    
+    char const * const path = getenv("ARMWARE_STATS_SOCKET");
+    
+    if ((path != 0) && (-1 == m_socket_fd))
+    {
+      open_socket(path);
+    }
+    
+    m_need_poll = ((m_dump_interval != 0) || (m_socket_fd != -1));
+  }
+  
+  void
+  RuntimeStats::finish()
+  {
+    // The last period is dumped as well.
+    if (m_dump_interval != 0)
+    {
+      dump(g_log_file);
+    }
+  }
+  
+  void
+  RuntimeStats::dump(std::ostream &os) const
+  {
+    os << std::dec;
+    
+    for (uint32_t i = 0; i < COUNTER_TOTAL; ++i)
+    {
+      os << COUNTER_NAME[i] << ' ' << m_counter[i] << std::endl;
+    }
+    
+    RegisterBankBase::dump_all(os);
+  }
+}
@@ -0,0 +1,174 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+#ifndef RuntimeStats_hpp
+#define RuntimeStats_hpp
+
+#include <cassert>
+#include <ctime>
+#include <iostream>
+#include <string>
+
+#include "Type.hpp"
+
+namespace ARMware
+{
+  // Counters of the execution engine which are always available,
+  // even in the optimized build.
+  //
+  // Every counter is a plain increment on the emulation thread, and
+  // nobody else touches them, thus I don't need any locking.
+  //
+  // The counters can be observed in 2 ways, both of them are serviced on
+  // the emulation thread from Core::check_periphery():
+  //
+  // ARMWARE_STATS_INTERVAL=<seconds>: dump all counters into the log file
+  // periodically.
+  //
+  // ARMWARE_STATS_SOCKET=<path>: listen on a local Unix socket, every
+  // client connecting to it will receive a dump of all counters.
+  // (Ex: socat - UNIX-CONNECT:<path>)
+  //
+  // The register access counters of the RegisterBanks are dumped along with
+  // them.
+  //
+  // The TLB and page table walk counters sit on the path of every guest
+  // memory access, thus they are only counted when one of the above is
+  // turned on (see is_enabled()). All the others count rare events and are
+  // always counted.
+  typedef class RuntimeStats RuntimeStats;
+  class RuntimeStats
+  {
+  public:
+    
+    // If I modify this enumeration, I have to also modify the
+    // COUNTER_NAME[] array in RuntimeStats.cpp as well.
+    enum CounterEnum
+    {
+      INST_INTERPRETER,
+      INST_THREADED_CODE,
+      INST_DYNAMIC,
+      
+      CHUNK_CREATE,
+      CHUNK_GEN_THREADED_CODE,
+      CHUNK_GEN_DYNAMIC,
+      CHUNK_RECOMPILE,
+      CHUNK_FLUSH,
+      SMC_FAULT,
+      
+      CYCLES_GEN_THREADED_CODE,
+      CYCLES_GEN_DYNAMIC,
+      
+      ITLB_HIT,
+      ITLB_MISS,
+      DTLB_HIT,
+      DTLB_MISS,
+      PAGE_TABLE_WALK,
+      WALK_CACHE_HIT,
+      WALK_CACHE_MISS,
+      WALK_CACHE_INVALIDATE,
+      WALK_CACHE_FLUSH,
+      SHADOW_TLB_HIT,
+      SHADOW_TLB_MISS,
+      SHADOW_TLB_STALE,
+      FASTMEM_HIT,
+      FASTMEM_MISS,
+      
+      EXCEPTION_UND_RAISED,
+      EXCEPTION_SWI_RAISED,
+      EXCEPTION_PREFETCH_RAISED,
+      EXCEPTION_DATA_RAISED,
+      IRQ_DELIVERED,
+      FIQ_DELIVERED,
+      
+      COUNTER_TOTAL
+    };
+    typedef enum CounterEnum CounterEnum;
+  
+  private:
+    
+    // Attribute
+    
+    uint64_t m_counter[COUNTER_TOTAL];
+    
+    // Someone observes the counters.
+    bool m_need_poll;
+    
+    uint32_t m_dump_interval;
+    time_t m_next_dump_time;
+    
+    int m_socket_fd;
+    std::string m_socket_path;
+    
+    // Operation
+    
+    void open_socket(char const * const path);
+    void poll_real();
+  
+  public:
+    
+    // Life cycle
+    
+    RuntimeStats();
+    ~RuntimeStats();
+    
+    // Operation
+    
+    void init();
+    
+    inline void
+    increase(CounterEnum const counter, uint64_t const value = 1)
+    {
+      assert(counter < COUNTER_TOTAL);
+      
+      m_counter[counter] += value;
+    }
+    
+    inline void
+    poll()
+    {
+      if (true == m_need_poll)
+      {
+        poll_real();
+      }
+    }
+    
+    void dump(std::ostream &os) const;
+    
+    // Called when the machine is stopped.
+    void finish();
+    
+    // Inquery
+    
+    // The per-access counters check this first.
+    inline bool
+    is_enabled() const
+    { return m_need_poll; }
+    
+    inline uint64_t
+    counter(CounterEnum const counter) const
+    {
+      assert(counter < COUNTER_TOTAL);
+      
+      return m_counter[counter];
+    }
+  };
+  
+  extern RuntimeStats g_runtime_stats;
+}
+
+#endif
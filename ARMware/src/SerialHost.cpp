@@ -0,0 +1,577 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+
+#if LINUX
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <sys/un.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+#endif
+
+#include "SerialHost.hpp"
+#include "Log.hpp"
+
+namespace ARMware
+{
+  ///////////////////////////////// Private ///////////////////////////////////
+  //============================== Operation ==================================
+  
+  bool
+  SerialHost::open_pty()
+  {
+#if LINUX
+    int const fd = posix_openpt(O_RDWR | O_NOCTTY);
+    
+    if (-1 == fd)
+    {
+      return false;
+    }
+    
+    char const * const slave_name = (((0 == grantpt(fd)) && (0 == unlockpt(fd)))
+                                     ? ptsname(fd)
+                                     : 0);
+    int const slave_fd = ((slave_name != 0)
+                          ? open(slave_name, O_RDWR | O_NOCTTY)
+                          : -1);
+    
+    if (-1 == slave_fd)
+    {
+      close(fd);
+      return false;
+    }
+    
+    // The guest talks to the host tools byte by byte, neither line editing
+    // nor echo should be done by the host.
+    struct termios tio;
+    
+    if (0 == tcgetattr(slave_fd, &tio))
+    {
+      cfmakeraw(&tio);
+      
+      tcsetattr(slave_fd, TCSANOW, &tio);
+    }
+    
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    
+    m_path = slave_name;
+    m_rx_fd = fd;
+    m_tx_fd = fd;
+    m_slave_fd = slave_fd;
+    
+    if (false == m_link.empty())
+    {
+      unlink(m_link.c_str());
+      
+      if (symlink(m_path.c_str(), m_link.c_str()) != 0)
+      {
+        g_log_file << m_port_name << ": can not link " << m_link << " to " << m_path << std::endl;
+        
+        m_link.clear();
+      }
+    }
+    
+    return true;
+#else
+    return false;
+#endif
+  }
+  
+  bool
+  SerialHost::open_unix_socket()
+  {
+#if LINUX
+    struct sockaddr_un addr;
+    
+    if (m_path.size() >= sizeof(addr.sun_path))
+    {
+      return false;
+    }
+    
+    int const fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    
+    if (-1 == fd)
+    {
+      return false;
+    }
+    
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, m_path.c_str());
+    
+    // Remove the stale socket left by the previous ARMware process.
+    unlink(m_path.c_str());
+    
+    if ((bind(fd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) != 0) ||
+        (listen(fd, 1) != 0) ||
+        (fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK) != 0))
+    {
+      close(fd);
+      return false;
+    }
+    
+    m_listen_fd = fd;
+    
+    return true;
+#else
+    return false;
+#endif
+  }
+  
+  bool
+  SerialHost::open_fifo()
+  {
+#if LINUX
+    std::string const rx_path = m_path + ".in";
+    std::string const tx_path = m_path + ".out";
+    
+    if (((mkfifo(rx_path.c_str(), 0600) != 0) && (errno != EEXIST)) ||
+        ((mkfifo(tx_path.c_str(), 0600) != 0) && (errno != EEXIST)))
+    {
+      return false;
+    }
+    
+    // Both pipes are opened for reading and writing (Linux allows this on a
+    // FIFO), thus opening them never blocks waiting for the host tool, and
+    // the host tool can come and go without ARMware seeing an end of file.
+    int const rx_fd = open(rx_path.c_str(), O_RDWR | O_NONBLOCK);
+    int const tx_fd = open(tx_path.c_str(), O_RDWR | O_NONBLOCK);
+    
+    if ((-1 == rx_fd) || (-1 == tx_fd))
+    {
+      if (rx_fd != -1)
+      {
+        close(rx_fd);
+      }
+      
+      if (tx_fd != -1)
+      {
+        close(tx_fd);
+      }
+      
+      return false;
+    }
+    
+    m_rx_fd = rx_fd;
+    m_tx_fd = tx_fd;
+    
+    return true;
+#else
+    return false;
+#endif
+  }
+  
+  void
+  SerialHost::disconnect()
+  {
+#if LINUX
+    if (m_rx_fd != -1)
+    {
+      close(m_rx_fd);
+      
+      m_rx_fd = -1;
+      m_tx_fd = -1;
+      
+      queue_log("client disconnected");
+    }
+#endif
+  }
+  
+  void
+  SerialHost::queue_log(std::string const &message)
+  {
+    Glib::Mutex::Lock lock(m_log_lock);
+    
+    m_log_queue.push_back(message);
+    
+    m_log_pending = 1;
+  }
+  
+  void
+  SerialHost::write_log()
+  {
+    std::vector<std::string> messages;
+    
+    {
+      Glib::Mutex::Lock lock(m_log_lock);
+      
+      messages.swap(m_log_queue);
+      
+      m_log_pending = 0;
+    }
+    
+    for (std::vector<std::string>::const_iterator iter = messages.begin();
+         iter != messages.end();
+         ++iter)
+    {
+      g_log_file << m_port_name << ": " << (*iter) << std::endl;
+    }
+  }
+  
+  void
+  SerialHost::receive()
+  {
+#if LINUX
+    uint8_t *first;
+    uint8_t *second;
+    uint32_t first_size;
+    uint32_t const size = m_rx_fifo.write_spans(first, first_size, second);
+    
+    if (0 == size)
+    {
+      return;
+    }
+    
+    struct iovec iov[2];
+    
+    iov[0].iov_base = first;
+    iov[0].iov_len = first_size;
+    iov[1].iov_base = second;
+    iov[1].iov_len = size - first_size;
+    
+    ssize_t const received = readv(m_rx_fd, iov, (size == first_size) ? 1 : 2);
+    
+    if (received > 0)
+    {
+      m_rx_fifo.commit(static_cast<uint32_t>(received));
+    }
+    else if ((KIND_UNIX_SOCKET == m_kind) &&
+             ((0 == received) || ((errno != EAGAIN) && (errno != EINTR))))
+    {
+      disconnect();
+    }
+#endif
+  }
+  
+  void
+  SerialHost::transmit()
+  {
+#if LINUX
+    uint8_t const *first;
+    uint8_t const *second;
+    uint32_t first_size;
+    uint32_t size;
+    
+    while ((size = m_tx_fifo.read_spans(first, first_size, second)) != 0)
+    {
+      if (-1 == m_tx_fd)
+      {
+        // Nobody is connected to the Unix socket.
+        m_tx_fifo.consume(size);
+        continue;
+      }
+      
+      struct iovec iov[2];
+      
+      iov[0].iov_base = const_cast<uint8_t *>(first);
+      iov[0].iov_len = first_size;
+      iov[1].iov_base = const_cast<uint8_t *>(second);
+      iov[1].iov_len = size - first_size;
+      
+      ssize_t sent;
+      
+      if (KIND_UNIX_SOCKET == m_kind)
+      {
+        struct msghdr msg;
+        
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_iov = iov;
+        msg.msg_iovlen = (size == first_size) ? 1 : 2;
+        
+        // MSG_NOSIGNAL: a client going away shouldn't kill ARMware by SIGPIPE.
+        sent = sendmsg(m_tx_fd, &msg, MSG_NOSIGNAL);
+      }
+      else
+      {
+        sent = writev(m_tx_fd, iov, (size == first_size) ? 1 : 2);
+      }
+      
+      if (sent > 0)
+      {
+        m_tx_fifo.consume(static_cast<uint32_t>(sent));
+      }
+      else if ((KIND_UNIX_SOCKET == m_kind) && (errno != EAGAIN) && (errno != EINTR))
+      {
+        disconnect();
+      }
+      else
+      {
+        // The host side is full, wait for POLLOUT.
+        break;
+      }
+    }
+#endif
+  }
+  
+  void
+  SerialHost::wake()
+  {
+#if LINUX
+    char const ch = 0;
+    
+    // The pipe is non-blocking, if it is full, the I/O thread has enough
+    // to wake up anyway.
+    (void)write(m_wake_pipe[1], &ch, 1);
+#endif
+  }
+  
+  void
+  SerialHost::io_thread()
+  {
+#if LINUX
+    while (true == m_running)
+    {
+      struct pollfd fds[3];
+      nfds_t fd_number = 1;
+      int timeout = POLL_TIMEOUT;
+      
+      fds[0].fd = m_wake_pipe[0];
+      fds[0].events = POLLIN;
+      
+      if (m_rx_fd != -1)
+      {
+        if (false == m_rx_fifo.full())
+        {
+          fds[fd_number].fd = m_rx_fd;
+          fds[fd_number].events = POLLIN;
+          
+          ++fd_number;
+        }
+        else
+        {
+          // The emulation thread doesn't wake me up after it consumes the
+          // RX FIFO, thus I check it again soon.
+          timeout = RX_FULL_POLL_TIMEOUT;
+        }
+        
+        if (false == m_tx_fifo.empty())
+        {
+          fds[fd_number].fd = m_tx_fd;
+          fds[fd_number].events = POLLOUT;
+          
+          ++fd_number;
+        }
+      }
+      else if (m_listen_fd != -1)
+      {
+        fds[fd_number].fd = m_listen_fd;
+        fds[fd_number].events = POLLIN;
+        
+        ++fd_number;
+      }
+      
+      fds[0].revents = 0;
+      
+      if (poll(fds, fd_number, timeout) > 0)
+      {
+        if (fds[0].revents & POLLIN)
+        {
+          char buffer[64];
+          
+          while (read(m_wake_pipe[0], buffer, sizeof(buffer)) > 0)
+          { }
+        }
+      }
+      
+      m_tx_wake_pending = 0;
+      
+      memory_barrier();
+      
+      if ((-1 == m_rx_fd) && (m_listen_fd != -1))
+      {
+        int const client_fd = accept(m_listen_fd, 0, 0);
+        
+        if (client_fd != -1)
+        {
+          fcntl(client_fd, F_SETFL, fcntl(client_fd, F_GETFL) | O_NONBLOCK);
+          
+          m_rx_fd = client_fd;
+          m_tx_fd = client_fd;
+          
+          queue_log("client connected");
+        }
+      }
+      
+      if (m_rx_fd != -1)
+      {
+        receive();
+      }
+      
+      transmit();
+    }
+#endif
+  }
+  
+  ///////////////////////////////// Public ////////////////////////////////////
+  //============================== Life cycle =================================
+  
+  SerialHost::SerialHost(std::string const &port_name, UartFifo &rx_fifo, UartFifo &tx_fifo)
+    : m_port_name(port_name),
+      m_rx_fifo(rx_fifo),
+      m_tx_fifo(tx_fifo),
+      m_kind(KIND_PTY),
+      m_rx_fd(-1),
+      m_tx_fd(-1),
+      m_slave_fd(-1),
+      m_listen_fd(-1),
+      m_tx_wake_pending(0),
+      m_running(false),
+      mp_io_thread(0),
+      m_log_pending(0)
+  {
+    m_wake_pipe[0] = -1;
+    m_wake_pipe[1] = -1;
+  }
+  
+  SerialHost::~SerialHost()
+  {
+    if (mp_io_thread != 0)
+    {
+      m_running = false;
+      
+      wake();
+      
+      mp_io_thread->join();
+      mp_io_thread = 0;
+    }
+    
+    write_log();
+    
+#if LINUX
+    if (m_rx_fd != -1)
+    {
+      close(m_rx_fd);
+    }
+    
+    if ((m_tx_fd != -1) && (m_tx_fd != m_rx_fd))
+    {
+      close(m_tx_fd);
+    }
+    
+    if (m_slave_fd != -1)
+    {
+      close(m_slave_fd);
+    }
+    
+    if (m_listen_fd != -1)
+    {
+      close(m_listen_fd);
+      unlink(m_path.c_str());
+    }
+    
+    if (false == m_link.empty())
+    {
+      unlink(m_link.c_str());
+    }
+    
+    if ((KIND_FIFO == m_kind) && (m_rx_fd != -1))
+    {
+      unlink((m_path + ".in").c_str());
+      unlink((m_path + ".out").c_str());
+    }
+    
+    if (m_wake_pipe[0] != -1)
+    {
+      close(m_wake_pipe[0]);
+      close(m_wake_pipe[1]);
+    }
+#endif
+  }
+  
+  //============================== Operation ==================================
+  
+  bool
+  SerialHost::attach(char const * const spec)
+  {
+    assert(0 == mp_io_thread);
+    
+    std::string const spec_str(spec);
+    bool opened = false;
+    
+    if (0 == spec_str.compare(0, 3, "pty"))
+    {
+      if (spec_str.size() > 3)
+      {
+        if (spec_str[3] != ':')
+        {
+          g_log_file << m_port_name << ": invalid host device: " << spec_str << std::endl;
+          
+          return false;
+        }
+        
+        m_link = spec_str.substr(4);
+      }
+      
+      m_kind = KIND_PTY;
+      opened = open_pty();
+    }
+    else if (0 == spec_str.compare(0, 5, "unix:"))
+    {
+      m_kind = KIND_UNIX_SOCKET;
+      m_path = spec_str.substr(5);
+      opened = open_unix_socket();
+    }
+    else if (0 == spec_str.compare(0, 5, "fifo:"))
+    {
+      m_kind = KIND_FIFO;
+      m_path = spec_str.substr(5);
+      opened = open_fifo();
+    }
+    else
+    {
+      g_log_file << m_port_name << ": invalid host device: " << spec_str << std::endl;
+      
+      return false;
+    }
+    
+    if (false == opened)
+    {
+      g_log_file << m_port_name << ": can not open host device: " << spec_str << std::endl;
+      
+      return false;
+    }
+    
+#if LINUX
+    if (pipe(m_wake_pipe) != 0)
+    {
+      return false;
+    }
+    
+    fcntl(m_wake_pipe[0], F_SETFL, fcntl(m_wake_pipe[0], F_GETFL) | O_NONBLOCK);
+    fcntl(m_wake_pipe[1], F_SETFL, fcntl(m_wake_pipe[1], F_GETFL) | O_NONBLOCK);
+    
+    m_running = true;
+    
+    mp_io_thread = Glib::Thread::create(sigc::mem_fun(*this, &SerialHost::io_thread),
+                                        true // joinable
+                                        );
+    
+    g_log_file << m_port_name << ": attached to " << m_path << std::endl;
+    
+    return true;
+#else
+    return false;
+#endif
+  }
+}
@@ -0,0 +1,175 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+#ifndef SerialHost_hpp
+#define SerialHost_hpp
+
+#include <string>
+#include <vector>
+
+#include <glibmm/thread.h>
+
+#include "Type.hpp"
+#include "Uart.hpp"
+
+namespace ARMware
+{
+  // Attaches a serial port to the host, in place of the device normally
+  // behind it (SerialConsole for Serial_3, AtmelMicro for Serial_1).
+  //
+  // ARMWARE_SERIAL_1, ARMWARE_SERIAL_3:
+  //
+  // * pty[:<link>]: a host pseudo-terminal, the path of its slave side is
+  //   written to the log file, and is symlinked to <link> if given.
+  //   (Ex: screen <link>)
+  // * unix:<path>: a Unix socket listening on <path>, one client at a time.
+  //   (Ex: socat - UNIX-CONNECT:<path>)
+  // * fifo:<prefix>: a pair of named pipes, the host writes into
+  //   <prefix>.in to send data to the guest, and reads from <prefix>.out to
+  //   receive data from the guest. (Ex: cat file > <prefix>.in)
+  //
+  // They replace the out-of-tree soft_serial kernel module.
+  //
+  // The data is moved between the UART FIFOs and the host by an I/O thread,
+  // thus the emulation thread never blocks on the host, nor on the GUI.
+  // Attaching Serial_1 on H3600 detaches the Atmel micro, i.e. the touch
+  // panel and the buttons.
+  //
+  // Each read and write moves everything the UART FIFO can take or has,
+  // straight from/to the FIFO storage by readv()/writev().
+  //
+  // When nobody is connected to the Unix socket, the transmitted data is
+  // dropped. The pseudo-terminal and the named pipes keep the data until
+  // somebody reads it, and once both their buffers and the TX FIFO are full,
+  // the guest waits.
+  typedef class SerialHost SerialHost;
+  class SerialHost
+  {
+  private:
+    
+    enum KindEnum
+    {
+      KIND_PTY,
+      KIND_UNIX_SOCKET,
+      KIND_FIFO
+    };
+    typedef enum KindEnum KindEnum;
+    
+    static int const POLL_TIMEOUT = 100; // ms
+    static int const RX_FULL_POLL_TIMEOUT = 10; // ms
+    
+    // Attribute
+    
+    std::string const m_port_name;
+    
+    UartFifo &m_rx_fifo; // producer side
+    UartFifo &m_tx_fifo; // consumer side
+    
+    KindEnum m_kind;
+    std::string m_path;
+    std::string m_link;
+    
+    // m_rx_fd and m_tx_fd are both the master side of the pseudo-terminal,
+    // or both the connected client of the Unix socket (-1 if none), or the
+    // <prefix>.in and <prefix>.out named pipes respectively.
+    //
+    // m_slave_fd keeps the slave side of the pseudo-terminal opened, otherwise
+    // the master side reports POLLHUP whenever no one opens the slave side.
+    int m_rx_fd;
+    int m_tx_fd;
+    int m_slave_fd;
+    int m_listen_fd;
+    int m_wake_pipe[2];
+    
+    uint32_t volatile m_tx_wake_pending;
+    bool volatile m_running;
+    
+    Glib::Thread *mp_io_thread;
+    
+    // The I/O thread doesn't write the log file by itself (g_log_file is
+    // not thread safe), it queues the messages here instead, and
+    // flush_log() writes them out on the emulation thread.
+    Glib::Mutex m_log_lock;
+    std::vector<std::string> m_log_queue;
+    uint32_t volatile m_log_pending;
+    
+    // Operation
+    
+    bool open_pty();
+    bool open_unix_socket();
+    bool open_fifo();
+    
+    void disconnect();
+    void receive();
+    void transmit();
+    void wake();
+    
+    void queue_log(std::string const &message);
+    void write_log();
+    
+    void io_thread();
+  
+  public:
+    
+    // Life cycle
+    
+    SerialHost(std::string const &port_name, UartFifo &rx_fifo, UartFifo &tx_fifo);
+    ~SerialHost();
+    
+    // Operation
+    
+    // @false: <spec> is invalid, or the host device can not be created.
+    bool attach(char const * const spec);
+    
+    // Called by the UART whenever the TX FIFO isn't empty.
+    //
+    // The I/O thread clears m_tx_wake_pending before draining the TX FIFO,
+    // so I only write to the wake pipe once per drain. If this load is
+    // reordered before the store which fills the TX FIFO, the wake up is
+    // missed only until the next call.
+    inline void
+    notify_tx()
+    {
+      if (0 == m_tx_wake_pending)
+      {
+        m_tx_wake_pending = 1;
+        
+        wake();
+      }
+    }
+    
+    // Called by the UART on the emulation thread.
+    inline void
+    flush_log()
+    {
+      if (m_log_pending != 0)
+      {
+        write_log();
+      }
+    }
+    
+    // Inquery
+    
+    // The slave side of the pseudo-terminal, the Unix socket, or the prefix
+    // of the named pipes.
+    inline std::string const &
+    path() const
+    { return m_path; }
+  };
+}
+
+#endif
@@ -19,11 +19,13 @@
 //
 
 #include <cassert>
+#include <cstdlib>
 
 #include "Serial_1.hpp"
 #include "Core.hpp"
 #include "PPC.hpp"
 #include "AtmelMicro.hpp"
+#include "SerialHost.hpp"
 #include "Gtk/MachineScreen.hpp"
 
 #include "Uart.tcc"
@@ -42,9 +44,31 @@ namespace ARMware
     
     m_UART.register_output_device(reinterpret_cast<void * const>(mp_atmel_micro.get()));
     
-    machine_screen->register_atmel_micro(mp_atmel_micro.get());
+    if (machine_screen != 0)
+    {
+      machine_screen->register_atmel_micro(mp_atmel_micro.get());
+    }
+    
+    char const * const host_device = getenv("ARMWARE_SERIAL_1");
+    
+    if (host_device != 0)
+    {
+      mp_host_device.reset(new SerialHost("Serial_1", m_UART.rx_fifo(), m_UART.tx_fifo()));
+      
+      if (true == mp_host_device->attach(host_device))
+      {
+        m_UART.register_host_device(mp_host_device.get());
+      }
+      else
+      {
+        mp_host_device.reset();
+      }
+    }
   }
   
+  Serial_1::~Serial_1()
+  { }
+  
   //================================ Operation ================================
   
   // :NOTE: Wei 2004-Jun-11:
@@ -54,7 +78,7 @@ namespace ARMware
   //
   // However, ARMware doesn't support audio output at the present time,
   // thus I don't implement GPCLK functionality currently.
-  void
+  uint32_t
   Serial_1::run()
   {
     // :NOTE: Wei 2004-Jun-11:
@@ -70,7 +94,11 @@ namespace ARMware
     // otherwise, serial 1 acts as UART.
     if ((mp_PPC->get_PPAR() & PPC::PPAR_UPR) || (m_GPCLKR0 & GPCLKR0_SUS))
     {
-      m_UART.run();
+      return m_UART.run();
+    }
+    else
+    {
+      return m_UART.service_period();
     }
   }
 }
@@ -42,6 +42,7 @@ namespace ARMware
   class PPC;
   class AtmelMicro;
   class MachineScreen;
+  class SerialHost;
   
   typedef class Serial_1 Serial_1;
   class Serial_1
@@ -67,6 +68,7 @@ namespace ARMware
     
     Uart<Serial_1> m_UART;
     std::auto_ptr<AtmelMicro> const mp_atmel_micro;
+    std::auto_ptr<SerialHost> mp_host_device;
     
     uint8_t m_GPCLKR0; // GPCLK Control Register 0
     uint8_t m_GPCLKR1; // GPCLK Control Register 1
@@ -97,6 +99,7 @@ namespace ARMware
     // Life cycle
     
     Serial_1(Core * const core, PPC * const ppc, MachineScreen * const machine_screen);
+    ~Serial_1();
     
     // Access
     
@@ -116,7 +119,7 @@ namespace ARMware
       m_UART.reset();
     }
     
-    void run();
+    uint32_t run();
     
     // :SA-1110 Developer's Manual: Wei 2003-Dec-14:
     //
@@ -18,7 +18,10 @@
 // Serial port 3
 //
 
+#include <cstdlib>
+
 #include "Serial_3.hpp"
+#include "SerialHost.hpp"
 #include "Gtk/SerialConsole.hpp"
 
 #include "Uart.tcc"
@@ -28,10 +31,32 @@ namespace ARMware
   ////////////////////////////////// Public ///////////////////////////////////
   //=============================== Life cycle ================================
   
-  Serial_3::Serial_3(SerialConsole &serial_console)
+  Serial_3::Serial_3(SerialConsole * const serial_console)
   {
-    m_UART.register_output_device(reinterpret_cast<void * const>(&serial_console));
+    if (serial_console != 0)
+    {
+      m_UART.register_output_device(reinterpret_cast<void * const>(serial_console));
+      
+      serial_console->register_rx_fifo(&(m_UART.rx_fifo()));
+    }
+    
+    char const * const host_device = getenv("ARMWARE_SERIAL_3");
     
-    serial_console.register_rx_fifo(&(m_UART.rx_fifo()));
+    if (host_device != 0)
+    {
+      mp_host_device.reset(new SerialHost("Serial_3", m_UART.rx_fifo(), m_UART.tx_fifo()));
+      
+      if (true == mp_host_device->attach(host_device))
+      {
+        m_UART.register_host_device(mp_host_device.get());
+      }
+      else
+      {
+        mp_host_device.reset();
+      }
+    }
   }
+  
+  Serial_3::~Serial_3()
+  { }
 }
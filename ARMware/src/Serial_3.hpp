@@ -21,6 +21,11 @@
 #ifndef Serial_3_hpp
 #define Serial_3_hpp
 
+// System include
+//
+
+#include <memory>
+
 // Project include
 //
 
@@ -37,6 +42,7 @@ namespace ARMware
   //
   
   class SerialConsole;
+  class SerialHost;
   
   typedef class Serial_3 Serial_3;
   class Serial_3
@@ -44,12 +50,14 @@ namespace ARMware
   private:
     
     Uart<Serial_3> m_UART;
+    std::auto_ptr<SerialHost> mp_host_device;
     
   public:
     
     // Life cycle
     
-    Serial_3(SerialConsole &serial_console);
+    Serial_3(SerialConsole * const serial_console);
+    ~Serial_3();
     
     // Access
     
@@ -63,9 +71,9 @@ namespace ARMware
     reset()
     { m_UART.reset(); }
     
-    inline void
+    inline uint32_t
     run()
-    { m_UART.run(); }
+    { return m_UART.run(); }
     
     template<typename T_return>
     inline T_return FASTCALL
@@ -0,0 +1,72 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+#include <cstdlib>
+
+#include "ShadowTlb.hpp"
+#include "Log.hpp"
+#include "Utils/Number.hpp"
+
+namespace ARMware
+{
+  ///////////////////////////////// Public ////////////////////////////////////
+  //============================== Life cycle =================================
+  
+  ShadowTlb::ShadowTlb()
+    : m_entry_number(DEFAULT_ENTRY_NUMBER),
+      mp_entries(0),
+      mp_memory(0)
+  {
+    char const * const entry_number = getenv("ARMWARE_SHADOW_TLB");
+    
+    if (entry_number != 0)
+    {
+      m_entry_number = strtoul(entry_number, 0, 0);
+      
+      if ((m_entry_number != 0) && (false == power_of_two(m_entry_number)))
+      {
+        g_log_file << "Shadow TLB: " << m_entry_number << " is not a power of 2, use "
+                   << DEFAULT_ENTRY_NUMBER << std::endl;
+        
+        m_entry_number = DEFAULT_ENTRY_NUMBER;
+      }
+    }
+    
+    if (m_entry_number != 0)
+    {
+      mp_entries = new Entry[m_entry_number];
+    }
+    
+    flush_all();
+  }
+  
+  ShadowTlb::~ShadowTlb()
+  {
+    delete[] mp_entries;
+  }
+  
+  //============================== Operation ==================================
+  
+  void
+  ShadowTlb::flush_all()
+  {
+    for (uint32_t i = 0; i < m_entry_number; ++i)
+    {
+      mp_entries[i].m_page = INVALID_PAGE;
+    }
+  }
+}
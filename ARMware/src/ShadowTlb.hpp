@@ -0,0 +1,181 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+#ifndef ShadowTlb_hpp
+#define ShadowTlb_hpp
+
+#include <cassert>
+
+#include "Type.hpp"
+#include "MachineType.hpp"
+#include "RuntimeStats.hpp"
+#include "TlbEntry.hpp"
+
+namespace ARMware
+{
+  // The guest flushes both TLBs on every context switch, and the walks
+  // after that mostly give back what the TLBs had before the flush.
+  //
+  // The shadow TLB is not flushed with the TLBs. Each entry is a copy of
+  // a TLB entry, tagged by the translation table base and the 4 KB page of
+  // the modified virtual address (which already contains the FCSE PID),
+  // and it remembers the DRAM offsets and the values of the descriptors it
+  // was made from. On a TLB miss, Mmu looks here first, and an entry is
+  // used to refill the TLB only if its descriptors in DRAM still hold the
+  // same values. Thus whatever writes the page tables, the entry never
+  // outlives its descriptors, and the revalidation costs 1 or 2 loads
+  // from DRAM instead of a walk through AddressSpace.
+  //
+  // Only the translations whose descriptors are in DRAM are kept, and tiny
+  // pages are not kept, because they are smaller than the tag.
+  //
+  // ARMWARE_SHADOW_TLB=<n> sets the number of entries (a power of 2,
+  // DEFAULT_ENTRY_NUMBER by default, 0 turns it off).
+  typedef class ShadowTlb ShadowTlb;
+  class ShadowTlb
+  {
+  private:
+    
+    struct Entry
+    {
+      uint32_t m_ttb;
+      uint32_t m_page;
+      
+      uint32_t m_l1_offset;
+      uint32_t m_l1_descriptor;
+      uint32_t m_l2_offset;
+      uint32_t m_l2_descriptor;
+      
+      TlbEntry m_tlb_entry;
+    };
+    typedef struct Entry Entry;
+    
+    static uint32_t const PAGE_SHIFT = 12;
+    static uint32_t const INVALID_PAGE = 0xFFFFFFFF;
+    static uint32_t const DEFAULT_ENTRY_NUMBER = 1024;
+    
+    // Attribute
+    
+    uint32_t m_entry_number;
+    Entry *mp_entries;
+    
+    uint8_t const *mp_memory;
+    
+    // Inquery
+    
+    static inline bool
+    is_in_dram(uint32_t const paddr)
+    {
+      // DRAM is mirrored in 0xC0000000 - 0xC7FFFFFF.
+      return (MachineType::DRAM_BASE == (paddr & 0xF8000000));
+    }
+    
+    inline uint32_t
+    dram_word(uint32_t const offset) const
+    { return *reinterpret_cast<uint32_t const *>(&(mp_memory[offset])); }
+    
+    inline Entry &
+    entry_of(uint32_t const ttb, uint32_t const page) const
+    { return mp_entries[(page ^ (ttb >> 14)) & (m_entry_number - 1)]; }
+    
+  public:
+    
+    static uint32_t const NO_LEVEL_TWO = 0xFFFFFFFF;
+    
+    // Life cycle
+    
+    ShadowTlb();
+    ~ShadowTlb();
+    
+    // Operation
+    
+    inline void
+    register_memory(uint8_t const * const memory)
+    { mp_memory = memory; }
+    
+    void flush_all();
+    
+    // 'l2_paddr' is NO_LEVEL_TWO for a section.
+    inline void
+    insert(uint32_t const ttb,
+           uint32_t const mva,
+           uint32_t const l1_paddr,
+           uint32_t const l1_descriptor,
+           uint32_t const l2_paddr,
+           uint32_t const l2_descriptor,
+           TlbEntry const &tlb_entry)
+    {
+      if ((0 == m_entry_number) ||
+          (TINY_PAGE == tlb_entry.block_type()) ||
+          (false == is_in_dram(l1_paddr)) ||
+          ((l2_paddr != NO_LEVEL_TWO) && (false == is_in_dram(l2_paddr))))
+      {
+        return;
+      }
+      
+      uint32_t const page = (mva >> PAGE_SHIFT);
+      Entry &entry = entry_of(ttb, page);
+      
+      entry.m_ttb = ttb;
+      entry.m_page = page;
+      entry.m_l1_offset = (l1_paddr & MachineType::DRAM_SIZE);
+      entry.m_l1_descriptor = l1_descriptor;
+      entry.m_l2_offset = ((NO_LEVEL_TWO == l2_paddr) ? NO_LEVEL_TWO : (l2_paddr & MachineType::DRAM_SIZE));
+      entry.m_l2_descriptor = l2_descriptor;
+      entry.m_tlb_entry = tlb_entry;
+    }
+    
+    // @0: there is no entry for (ttb, mva), or its descriptors have been
+    // changed since then.
+    inline TlbEntry const *
+    find(uint32_t const ttb, uint32_t const mva)
+    {
+      if (0 == m_entry_number)
+      {
+        return 0;
+      }
+      
+      uint32_t const page = (mva >> PAGE_SHIFT);
+      Entry &entry = entry_of(ttb, page);
+      
+      if ((entry.m_page != page) || (entry.m_ttb != ttb))
+      {
+        g_runtime_stats.increase(RuntimeStats::SHADOW_TLB_MISS);
+        
+        return 0;
+      }
+      
+      assert(mp_memory != 0);
+      
+      if ((dram_word(entry.m_l1_offset) != entry.m_l1_descriptor) ||
+          ((entry.m_l2_offset != NO_LEVEL_TWO) && (dram_word(entry.m_l2_offset) != entry.m_l2_descriptor)))
+      {
+        g_runtime_stats.increase(RuntimeStats::SHADOW_TLB_STALE);
+        
+        entry.m_page = INVALID_PAGE;
+        
+        return 0;
+      }
+      
+      g_runtime_stats.increase(RuntimeStats::SHADOW_TLB_HIT);
+      
+      return &(entry.m_tlb_entry);
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,217 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+#ifndef SpscRing_hpp
+#define SpscRing_hpp
+
+#include <cassert>
+
+#include "Type.hpp"
+#include "platform_dep.hpp"
+
+namespace ARMware
+{
+  // A bounded single-producer/single-consumer ring buffer. The producer and
+  // the consumer may be on different threads without any lock, as long as
+  // there is only one of each.
+  //
+  // The read and write indexes run freely and are masked only when the
+  // storage is accessed, thus T_size has to be a power of 2, and
+  // (m_write - m_read) is always the number of the elements inside.
+  //
+  // write_span()/commit() and read_span()/consume() hand out the contiguous
+  // part of the storage directly, so that a read() or write() system call
+  // can fill or drain the ring without an intermediate copy. The
+  // write_spans()/read_spans() also hand out the part wrapped around to the
+  // beginning of the storage, for readv() and writev().
+  template<typename T, uint32_t T_size>
+  class SpscRing
+  {
+  private:
+    
+    static uint32_t const MASK = (T_size - 1);
+    
+    // Attribute
+    
+    T m_data[T_size];
+    
+    // m_read is written by the consumer only, and m_write is written by the
+    // producer only.
+    uint32_t volatile m_read;
+    uint32_t volatile m_write;
+    
+  public:
+    
+    // Life cycle
+    
+    SpscRing()
+      : m_read(0),
+        m_write(0)
+    {
+      assert((T_size != 0) && (0 == (T_size & MASK)));
+    }
+    
+    // Operation (producer)
+    
+    inline bool
+    push(T const value)
+    {
+      uint32_t const write = m_write;
+      
+      if (T_size == (write - m_read))
+      {
+        return false;
+      }
+      
+      m_data[write & MASK] = value;
+      
+      memory_barrier();
+      
+      m_write = write + 1;
+      
+      return true;
+    }
+    
+    // Returns the number of the free elements which are contiguous from
+    // *span.
+    inline uint32_t
+    write_span(T *&span)
+    {
+      uint32_t const write = m_write;
+      uint32_t const free = T_size - (write - m_read);
+      uint32_t const contiguous = T_size - (write & MASK);
+      
+      span = &(m_data[write & MASK]);
+      
+      return (free < contiguous) ? free : contiguous;
+    }
+    
+    // Returns the number of all the free elements, the first
+    // 'first_size' of them are contiguous from *first, and the rest are
+    // contiguous from *second.
+    inline uint32_t
+    write_spans(T *&first, uint32_t &first_size, T *&second)
+    {
+      uint32_t const write = m_write;
+      uint32_t const free = T_size - (write - m_read);
+      uint32_t const contiguous = T_size - (write & MASK);
+      
+      first = &(m_data[write & MASK]);
+      first_size = (free < contiguous) ? free : contiguous;
+      second = &(m_data[0]);
+      
+      return free;
+    }
+    
+    inline void
+    commit(uint32_t const count)
+    {
+      memory_barrier();
+      
+      m_write = m_write + count;
+    }
+    
+    // Operation (consumer)
+    
+    inline bool
+    pop(T &value)
+    {
+      uint32_t const read = m_read;
+      
+      if (read == m_write)
+      {
+        return false;
+      }
+      
+      memory_barrier();
+      
+      value = m_data[read & MASK];
+      
+      memory_barrier();
+      
+      m_read = read + 1;
+      
+      return true;
+    }
+    
+    // Returns the number of the elements which are contiguous from *span.
+    inline uint32_t
+    read_span(T const *&span)
+    {
+      uint32_t const read = m_read;
+      uint32_t const used = m_write - read;
+      uint32_t const contiguous = T_size - (read & MASK);
+      
+      memory_barrier();
+      
+      span = &(m_data[read & MASK]);
+      
+      return (used < contiguous) ? used : contiguous;
+    }
+    
+    // Returns the number of all the elements, the first 'first_size' of
+    // them are contiguous from *first, and the rest are contiguous from
+    // *second.
+    inline uint32_t
+    read_spans(T const *&first, uint32_t &first_size, T const *&second)
+    {
+      uint32_t const read = m_read;
+      uint32_t const used = m_write - read;
+      uint32_t const contiguous = T_size - (read & MASK);
+      
+      memory_barrier();
+      
+      first = &(m_data[read & MASK]);
+      first_size = (used < contiguous) ? used : contiguous;
+      second = &(m_data[0]);
+      
+      return used;
+    }
+    
+    inline void
+    consume(uint32_t const count)
+    {
+      memory_barrier();
+      
+      m_read = m_read + count;
+    }
+    
+    inline void
+    clear()
+    { m_read = m_write; }
+    
+    // Inquery
+    
+    inline uint32_t
+    size() const
+    { return m_write - m_read; }
+    
+    inline bool
+    empty() const
+    { return m_write == m_read; }
+    
+    inline bool
+    full() const
+    { return T_size == (m_write - m_read); }
+    
+    static inline uint32_t
+    capacity()
+    { return T_size; }
+  };
+}
+
+#endif
@@ -19,12 +19,22 @@
 #include <csignal>
 #endif
 
+#include <cstdlib>
 #include <memory>
 
 #include "StartMachine.hpp"
 #include "Core.hpp"
+#include "RuntimeStats.hpp"
+#include "GuestProfiler.hpp"
+#include "MmioProfiler.hpp"
+#include "FrameCapture.hpp"
+#include "ChunkInspector.hpp"
+#include "PixelConvert.hpp"
 
 #include "Compiler/x86/Register.hpp"
+#include "Compiler/CodeCache.hpp"
+#include "Compiler/JitSymbolExport.hpp"
+#include "Compiler/MmioSite.hpp"
 
 namespace ARMware
 {
@@ -32,7 +42,7 @@ namespace ARMware
   start_machine(MachineImpl const &machineImpl,
                 MachineScreen * const machine_screen,
                 SoftKeyboard * const soft_keyboard,
-                SerialConsole &serialConsole)
+                SerialConsole * const serialConsole)
   {
 #if ENABLE_THREADED_CODE || ENABLE_DYNAMIC_TRANSLATOR
     // Check the value of NATIVE_PAGE_SIZE
@@ -48,6 +58,19 @@ namespace ARMware
     
     gp_core = p_core.get();
     
+    g_runtime_stats.init();
+    g_guest_profiler.init();
+    g_mmio_profiler.init();
+    g_pixel_convert.init();
+    g_frame_capture.init();
+    
+#if ENABLE_DYNAMIC_TRANSLATOR
+    MmioSite::init();
+    g_code_cache.init();
+    g_jit_symbol_export.init();
+    g_chunk_inspector.init();
+#endif
+    
 #if PRINT_CHUNKS_LENGTH
     struct sigaction sa;
     
@@ -62,8 +85,23 @@ namespace ARMware
     Register::register_init();
 #endif
     
+    // Measure the pixel convert kernels instead of running the emulated
+    // machine.
+    if (getenv("ARMWARE_PIXEL_BENCH") != 0)
+    {
+      g_pixel_convert.run_benchmark();
+      
+      return 0;
+    }
+    
+    // run() only returns when the machine is stopped by a batch mode
+    // (Ex: ARMWARE_CAPTURE_FRAMES), and then p_core is deleted on the way
+    // out, which stops the render thread & the serial I/O threads.
     p_core->run();
     
+    g_mmio_profiler.finish();
+    g_runtime_stats.finish();
+    
     return 0;
   }
 }
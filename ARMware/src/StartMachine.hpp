@@ -36,7 +36,7 @@ namespace ARMware
   uint32_t start_machine(MachineImpl const &machineImpl,
                          MachineScreen * const machine_screen,
                          SoftKeyboard * const soft_keyboard,
-                         SerialConsole &serialConsole);
+                         SerialConsole * const serialConsole);
 }
 
 #endif
@@ -245,6 +245,7 @@ namespace ARMware
 #endif
       
       m_reg[CPR_1] = mp_core->CurReg(CRTRdNum(inst));
+      mp_core->invalidate_translation();
       break;
       
     case CPR_2:
@@ -254,11 +255,14 @@ namespace ARMware
       //
       // Bits [13:0] are undefined on read, ignored on write.
       m_reg[CPR_2] = (mp_core->CurReg(CRTRdNum(inst))) & 0xFFFFC000;
+      mp_core->invalidate_translation();
+      mp_core->flush_walk_cache();
       break;
       
     case CPR_3:
       // Register 3 - Domain Access Control
       m_reg[CPR_3] = mp_core->CurReg(CRTRdNum(inst));
+      mp_core->invalidate_translation();
       break;
       
     case CPR_4:
@@ -377,6 +381,7 @@ namespace ARMware
         //
         // Reserved bits must be written as zero.
         m_reg[CPR_13] = (mp_core->CurReg(CRTRdNum(inst)) & (0x7E << 25));
+        mp_core->invalidate_translation();
       }
       break;
       
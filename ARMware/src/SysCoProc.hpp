@@ -165,6 +165,14 @@ namespace ARMware
       return ((m_reg[CPR_1] & (1 << 13)) ? true : false);
     }
     
+    // Sets a register without any side effect on the core, for
+    // Utils/ShadowTlbCheck, which drives Mmu without a Core.
+    inline void
+    set_reg_value(CoProcRegNum const index, uint32_t const value)
+    {
+      m_reg[static_cast<uint32_t>(index)] = value;
+    }
+    
     // Inquiry method
     
     inline uint32_t
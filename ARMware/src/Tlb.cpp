@@ -28,22 +28,24 @@ namespace ARMware
   ////////////////////////////////// Public ///////////////////////////////////
   //============================== Life cycle =================================
   
-  Tlb::Tlb()
-    : mp_entries(new TlbEntry[HASH_TABLE_BUCKET_NUMBER * HASH_TABLE_BUCKET_SIZE]),
-      mp_bucket_start(new uint32_t[HASH_TABLE_BUCKET_NUMBER]),
-      mp_bucket_index(new uint32_t[HASH_TABLE_BUCKET_NUMBER])
+  Tlb::Tlb(uint32_t const bucket_number, uint32_t const bucket_size)
+    : m_bucket_size(bucket_size),
+      m_bucket_number(bucket_number),
+      mp_entries(new TlbEntry[bucket_number * bucket_size]),
+      mp_bucket_start(new uint32_t[bucket_number]),
+      mp_bucket_index(new uint32_t[bucket_number])
   {
     // See the notes about Tlb::find_entry().
     // The tlbEntryCount has to be the the power of 2.
     // (i.e. tlbEntryCount == 2^n)
-    assert(true == power_of_two(HASH_TABLE_BUCKET_NUMBER));
-    assert(true == power_of_two(HASH_TABLE_BUCKET_SIZE));
+    assert(true == power_of_two(m_bucket_number));
+    assert(true == power_of_two(m_bucket_size));
     
     flush_all();
     
-    for (uint32_t i = 0; i < HASH_TABLE_BUCKET_NUMBER; ++i)
+    for (uint32_t i = 0; i < m_bucket_number; ++i)
     {
-      mp_bucket_start[i] = HASH_TABLE_BUCKET_SIZE * i;
+      mp_bucket_start[i] = m_bucket_size * i;
     }
   }
   
@@ -72,14 +74,14 @@ namespace ARMware
     // (i.e. bit 10)
     // there will be duplicate tlb entries in the tlb table.
     uint32_t const bucket = ((vaddr >> MmuBlockTypeTraits<SECTION>::TABLE_INDEX_FIELD_SMALLEST_BIT_LOCATION) &
-                             (HASH_TABLE_BUCKET_NUMBER - 1));
+                             (m_bucket_number - 1));
     
     uint32_t const start = mp_bucket_start[bucket];
     uint32_t index = mp_bucket_index[bucket];
-    assert(index < HASH_TABLE_BUCKET_SIZE);
+    assert(index < m_bucket_size);
     uint32_t position;
     
-    for (uint32_t i = 0; i < HASH_TABLE_BUCKET_SIZE; ++i)
+    for (uint32_t i = 0; i < m_bucket_size; ++i)
     {
       position = start + index;
       
@@ -162,7 +164,7 @@ namespace ARMware
       
       --index;
       
-      index = (index & (HASH_TABLE_BUCKET_SIZE - 1));
+      index = (index & (m_bucket_size - 1));
     }
     
     return 0;
@@ -172,18 +174,18 @@ namespace ARMware
   Tlb::find_empty_entry(uint32_t const vaddr)
   {
     uint32_t const bucket = ((vaddr >> MmuBlockTypeTraits<SECTION>::TABLE_INDEX_FIELD_SMALLEST_BIT_LOCATION) &
-                             (HASH_TABLE_BUCKET_NUMBER - 1));
+                             (m_bucket_number - 1));
     
     uint32_t const start = mp_bucket_start[bucket];
     uint32_t index = mp_bucket_index[bucket];
-    assert(index < HASH_TABLE_BUCKET_SIZE);
+    assert(index < m_bucket_size);
     bool find = false;
     
-    for (uint32_t i = 0; i < HASH_TABLE_BUCKET_SIZE; ++i)
+    for (uint32_t i = 0; i < m_bucket_size; ++i)
     {
       ++index;
       
-      index = (index & (HASH_TABLE_BUCKET_SIZE - 1));
+      index = (index & (m_bucket_size - 1));
       
       if (false == mp_entries[start + index].is_valid())
       {
@@ -196,7 +198,7 @@ namespace ARMware
     {
       ++index;
       
-      index = (index & (HASH_TABLE_BUCKET_SIZE - 1));
+      index = (index & (m_bucket_size - 1));
     }
     
     mp_bucket_index[bucket] = index;
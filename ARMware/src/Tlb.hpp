@@ -38,9 +38,7 @@ namespace ARMware
   typedef class Tlb Tlb;
   class Tlb
   {
-  private:
-    
-    // Attribute
+  public:
     
     // :NOTE: Wei 2004-Jan-15:
     //
@@ -52,8 +50,22 @@ namespace ARMware
     // See the notes about Tlb::find_entry().
     // The tlbEntryCount has to be the the power of 2.
     // (i.e. tlbEntryCount == 2^n)
-    static uint32_t const HASH_TABLE_BUCKET_SIZE = 2;
-    static uint32_t const HASH_TABLE_BUCKET_NUMBER = 256;
+    //
+    // The geometry is decided at run time now (see Mmu::Mmu()), these are
+    // the defaults.
+    //
+    // The bucket is indexed by the bits[31:20] of the virtual address,
+    // thus more than MAX_BUCKET_NUMBER buckets are useless.
+    static uint32_t const DEFAULT_BUCKET_SIZE = 2;
+    static uint32_t const DEFAULT_BUCKET_NUMBER = 256;
+    static uint32_t const MAX_BUCKET_NUMBER = 4096;
+    
+  private:
+    
+    // Attribute
+    
+    uint32_t const m_bucket_size;
+    uint32_t const m_bucket_number;
     
     TlbEntry * const mp_entries;
     uint32_t * const mp_bucket_start;
@@ -63,7 +75,7 @@ namespace ARMware
     
     // Life cycle
     
-    Tlb();
+    Tlb(uint32_t const bucket_number, uint32_t const bucket_size);
     ~Tlb();
     
     // Operation
@@ -71,8 +83,8 @@ namespace ARMware
     inline void
     flush_all()
     {
-      memset(mp_entries, 0, sizeof(TlbEntry) * (HASH_TABLE_BUCKET_NUMBER * HASH_TABLE_BUCKET_SIZE));
-      memset(mp_bucket_index, 0, sizeof(uint32_t) * HASH_TABLE_BUCKET_NUMBER);
+      memset(mp_entries, 0, sizeof(TlbEntry) * (m_bucket_number * m_bucket_size));
+      memset(mp_bucket_index, 0, sizeof(uint32_t) * m_bucket_number);
     }
     
     inline void
@@ -98,6 +110,16 @@ namespace ARMware
     
     TlbEntry *find_entry(uint32_t const vaddr) FASTCALL;
     TlbEntry *find_empty_entry(uint32_t const vaddr) FASTCALL;
+    
+    // Inquery
+    
+    inline uint32_t
+    bucket_number() const
+    { return m_bucket_number; }
+    
+    inline uint32_t
+    bucket_size() const
+    { return m_bucket_size; }
   };
 }
 
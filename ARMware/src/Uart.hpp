@@ -18,11 +18,6 @@
 #ifndef Uart_hpp
 #define Uart_hpp
 
-// System include
-//
-
-#include <deque>
-
 // Project include
 //
 
@@ -31,8 +26,27 @@
 // Local include
 //
 
+#include "SpscRing.hpp"
+#include "RegisterBank.hpp"
+
 namespace ARMware
 {
+  // Forward declaration
+  //
+  
+  class SerialHost;
+  
+  // The hardware FIFOs of the SA-1110 UART are only 12 (RX) and 8 (TX)
+  // entries deep, but the devices behind the UART (ex: a host
+  // pseudo-terminal) move the data in much larger bursts, thus the software
+  // FIFOs are deeper than them. They stand for the serial line and the
+  // device, and the hardware FIFOs are modelled by the Uart itself.
+  //
+  // The UART (i.e. the emulation thread) is the producer of the TX FIFO and
+  // the consumer of the RX FIFO; the device is the other side, and it may
+  // run on its own thread.
+  typedef SpscRing<uint8_t, 4096> UartFifo;
+  
   template<typename T_serial_port>
   class Uart
   {
@@ -72,33 +86,81 @@ namespace ARMware
       UTSR1_ROR = (1 << 5)  // Receive FIFO overrun
     };
     
+    enum
+    {
+      UTCR0_PE  = (1 << 0), // Parity enable.
+      UTCR0_OES = (1 << 1), // Odd/even parity select.
+      UTCR0_SBS = (1 << 2), // Stop bit select.
+      UTCR0_DSS = (1 << 3)  // Data size select.
+    };
+    
     static uint32_t const RX_FIFO_SIZE = 12;
     static uint32_t const TX_FIFO_SIZE = 8;
     
+    // ARMWARE_UART_TIMING selects how the UART moves the characters between
+    // its hardware FIFOs and the serial line:
+    //
+    // * turbo (default): the whole FIFO contents every TURBO_PERIOD clocks,
+    //   the service requests are risen once per burst.
+    // * baud: one character per character time, which is derived from the
+    //   baud rate and the frame format programmed by the guest.
+    enum TimingEnum
+    {
+      TIMING_TURBO,
+      TIMING_BAUD
+    };
+    typedef enum TimingEnum TimingEnum;
+    
   private:
     
+    static uint32_t const CORE_FREQ = 206000000;
+    static uint32_t const UART_CLOCK_FREQ = 3686400;
+    
+    // :NOTE: Wei 2004-Jun-09:
+    //
+    // The bps (bits per second) for serial port 3 is 115200
+    // (i.e. 14400 bytes per second)
+    //
+    // However, 115200 seems too slow for ARMware,
+    // Thus I increment this frequency.
+    static uint32_t const TURBO_PERIOD = (CORE_FREQ / 14400) / 100;
+    
     // Attribute
     
-    uint8_t m_UTCR0; // UART control register 0
-    uint8_t m_UTCR1; // UART control register 1
-    uint8_t m_UTCR2; // UART control register 2
-    uint8_t m_UTCR3; // UART control register 3
-    uint8_t m_UTDR;  // UART data register
-    uint8_t m_UTSR0; // UART status register 0
-    uint8_t m_UTSR1; // UART status register 1
+    uint32_t m_UTCR0; // UART control register 0
+    uint32_t m_UTCR1; // UART control register 1
+    uint32_t m_UTCR2; // UART control register 2
+    uint32_t m_UTCR3; // UART control register 3
+    uint32_t m_UTDR;  // UART data register
+    uint32_t m_UTSR0; // UART status register 0
+    uint32_t m_UTSR1; // UART status register 1
     
-    // :NOTE: Wei 2005-May-29:
-    //
-    // SerialConsole needs m_tx_fifo be in a continus memory space,
-    // thus I use std::vector here.
-    std::vector<uint8_t> m_tx_fifo;
-    std::deque<uint8_t> m_rx_fifo;
+    UartFifo m_tx_fifo;
+    UartFifo m_rx_fifo;
+    
+    TimingEnum m_timing;
+    
+    // The transmit FIFO holds what the guest wrote but is not on the line
+    // (i.e. in m_tx_fifo) yet. The receive FIFO is the first
+    // m_rx_hw_fifo_size entries of m_rx_fifo, the rest are still on the line.
+    uint8_t m_tx_hw_fifo[TX_FIFO_SIZE];
+    uint32_t m_tx_hw_fifo_size;
+    uint32_t m_rx_hw_fifo_size;
+    
+    // The core clocks per character in the baud-accurate timing.
+    uint32_t m_char_clocks;
     
     // :NOTE: Wei 2004-Mar-22:
     //
     // For now, this mp_output_device is only used in Uart<Serial_3> to output to SerialConsole.
     void *mp_output_device;
     
+    // When it is not 0, the port is attached to the host, and it replaces
+    // mp_output_device.
+    SerialHost *mp_host_device;
+    
+    RegisterBank<Uart<T_serial_port> > m_register_bank;
+    
     // Operation
     
     void
@@ -117,6 +179,17 @@ namespace ARMware
     void tx_data();
     void rx_data();
     
+    void update_char_clocks();
+    
+    uint32_t read_UTDR(uint32_t const address);
+    
+    void write_UTCR0(uint32_t const address, uint32_t const value);
+    void write_UTCR1(uint32_t const address, uint32_t const value);
+    void write_UTCR2(uint32_t const address, uint32_t const value);
+    void write_UTCR3(uint32_t const address, uint32_t const value);
+    void write_UTDR(uint32_t const address, uint32_t const value);
+    void write_UTSR0(uint32_t const address, uint32_t const value);
+    
   public:
     
     // Life cycle
@@ -131,7 +204,20 @@ namespace ARMware
     register_output_device(void * const output_device)
     { mp_output_device = output_device; }
     
-    void run();
+    inline void
+    register_host_device(SerialHost * const host_device)
+    { mp_host_device = host_device; }
+    
+    // Returns the core clocks until the next service.
+    uint32_t run();
+    
+    inline uint32_t
+    service_period() const
+    {
+      return ((TIMING_TURBO == m_timing)
+              ? TURBO_PERIOD
+              : m_char_clocks);
+    }
     
     inline uint32_t
     get_interrupt_status() const
@@ -155,9 +241,13 @@ namespace ARMware
     
     // Access
     
-    inline std::deque<uint8_t> &
+    inline UartFifo &
     rx_fifo()
     { return m_rx_fifo; }
+    
+    inline UartFifo &
+    tx_fifo()
+    { return m_tx_fifo; }
   };
 }
 
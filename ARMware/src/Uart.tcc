@@ -16,6 +16,8 @@
 //
 
 #include <cassert>
+#include <cstdlib>
+#include <cstring>
 
 #if TRACE_UART
 #include <iostream>
@@ -23,6 +25,7 @@
 
 #include "UartTraits.hpp"
 #include "AtmelMicro.hpp"
+#include "SerialHost.hpp"
 #include "Gtk/SerialConsole.hpp"
 
 namespace ARMware
@@ -66,10 +69,15 @@ namespace ARMware
   inline void
   Uart<Serial_3>::tx_data()
   {
-    // :NOTE: Wei 2004-Jun-10:
-    //
-    // Becuase of using fifo[0], fifo has to reside in a consecutive memory blocks.
-    // This is why I use std::vector rather than std::deque for m_tx_fifo.
+    // Without the GUI there is no serial console, and the output is
+    // dropped (ARMWARE_SERIAL_3 can attach the port to the host instead).
+    if (0 == mp_output_device)
+    {
+      m_tx_fifo.clear();
+      
+      return;
+    }
+    
     reinterpret_cast<SerialConsole *>(mp_output_device)->put_char_to_serial_console(m_tx_fifo);
   }
   
@@ -80,7 +88,221 @@ namespace ARMware
     // :TODO: Wei 2004-Jun-29:
     //
     // Receives data from serial console
-    reinterpret_cast<SerialConsole *>(mp_output_device)->get_char_from_serial_console();
+    if (mp_output_device != 0)
+    {
+      reinterpret_cast<SerialConsole *>(mp_output_device)->get_char_from_serial_console();
+    }
+  }
+  
+  // SA-1110 Developer's Manual, p.331:
+  //
+  // BaudRate = 3.6864 MHz / (16 x (BRD + 1)), BRD is UTCR1[3:0]:UTCR2[7:0].
+  //
+  // A frame is a start bit, 7 or 8 data bits, an optional parity bit, and
+  // 1 or 2 stop bits.
+  template<typename T_serial_port>
+  void
+  Uart<T_serial_port>::update_char_clocks()
+  {
+    uint32_t const brd = (((m_UTCR1 & 0xF) << 8) | m_UTCR2);
+    uint32_t const frame_bits = (1 +
+                                 ((m_UTCR0 & UTCR0_DSS) ? 8 : 7) +
+                                 ((m_UTCR0 & UTCR0_PE) ? 1 : 0) +
+                                 ((m_UTCR0 & UTCR0_SBS) ? 2 : 1));
+    
+    m_char_clocks = static_cast<uint32_t>((static_cast<uint64_t>(CORE_FREQ) * frame_bits * 16 * (brd + 1))
+                                          / UART_CLOCK_FREQ);
+  }
+  
+  template<typename T_serial_port>
+  uint32_t
+  Uart<T_serial_port>::read_UTDR(uint32_t const /* address */)
+  {
+    if (0 == m_rx_hw_fifo_size)
+    {
+      assert(0 == (m_UTSR1 & UTSR1_RNE));
+      
+#if TRACE_UART
+      g_log_file << "UART<" << UartTraits<T_serial_port>::PORT_NUMBER
+                 << ">: "
+                 << "WARNING: Get data from UART when its RX fifo is empty." << std::endl;
+#endif
+      
+      return 0;
+    }
+    
+    assert(UTSR1_RNE == (m_UTSR1 & UTSR1_RNE));
+    
+    uint8_t ch;
+    
+    m_rx_fifo.pop(ch);
+    
+    --m_rx_hw_fifo_size;
+    
+    switch (m_rx_hw_fifo_size)
+    {
+    case 0:
+      m_UTSR0 &= ~(UTSR0_RID | UTSR0_RFS);
+      
+      m_UTSR1 &= ~UTSR1_RNE;
+      break;
+      
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+      m_UTSR0 &= ~UTSR0_RFS;
+      break;
+      
+    case 8:
+    case 9:
+    case 10:
+    case 11:
+    case 12:
+    default:
+      break;
+    }
+    
+#if TRACE_UART
+    g_log_file << "UART<" << UartTraits<T_serial_port>::PORT_NUMBER
+               << ">: rx fifo size = "
+               << m_rx_hw_fifo_size
+               << ", UTSR0: "
+               << m_UTSR0 << std::endl;
+#endif
+    
+    return ch;
+  }
+  
+  template<typename T_serial_port>
+  void
+  Uart<T_serial_port>::write_UTCR0(uint32_t const /* address */, uint32_t const value)
+  {
+    // :NOTE: Wei 2004-Jan-03:
+    //
+    // Bit 7 is reserved.
+    m_UTCR0 = (value & 0x7F);
+    
+    update_char_clocks();
+  }
+  
+  template<typename T_serial_port>
+  void
+  Uart<T_serial_port>::write_UTCR1(uint32_t const /* address */, uint32_t const value)
+  {
+    // :NOTE: Wei 2004-Jan-03:
+    //
+    // Bit 4, 5, 6, 7 are reserved.
+    m_UTCR1 = (value & 0xF);
+    
+    update_char_clocks();
+  }
+  
+  template<typename T_serial_port>
+  void
+  Uart<T_serial_port>::write_UTCR2(uint32_t const /* address */, uint32_t const value)
+  {
+    m_UTCR2 = (value & 0xFF);
+    
+    update_char_clocks();
+  }
+  
+  template<typename T_serial_port>
+  void
+  Uart<T_serial_port>::write_UTCR3(uint32_t const /* address */, uint32_t const value)
+  {
+    uint32_t const diff = (m_UTCR3 ^ value);
+    
+    if ((diff & UTCR3_TXE) && (0 == (value & UTCR3_TXE)))
+    {
+      if (m_tx_hw_fifo_size != 0)
+      {
+        // :SA-1110 Developer's Manual: p.332: Wei 2003-Jun-29:
+        //
+        // If the TXE bit is cleared to zero, all entries within the transmit FIFO are reset.
+        //
+        // What is already on the line (m_tx_fifo) has left the UART.
+        m_tx_hw_fifo_size = 0;
+        
+        m_UTSR0 |= UTSR0_TFS; // Enable Transmit FIFO service request
+        m_UTSR1 |= UTSR1_TNF; // Transmit FIFO not full
+      }
+    }
+    
+    if ((diff & UTCR3_RXE) && (0 == (value & UTCR3_RXE)))
+    {
+      // :SA-1110 Developer's Manual: p.332: Wei 2003-Jun-29:
+      //
+      // If the RXE bit is cleared to zero, all entries within the receive FIFO are reset
+      if (false == m_rx_fifo.empty())
+      {
+        m_rx_fifo.clear();
+        m_rx_hw_fifo_size = 0;
+        
+        m_UTSR0 &= ~(UTSR0_RID | UTSR0_RFS);
+        m_UTSR1 &= ~UTSR1_RNE;
+      }
+    }
+    
+    // :NOTE: Wei 2004-Jan-03:
+    //
+    // Bit 6, 7 are reserved.
+    m_UTCR3 = (value & 0x3F);
+  }
+  
+  template<typename T_serial_port>
+  void
+  Uart<T_serial_port>::write_UTDR(uint32_t const /* address */, uint32_t const value)
+  {
+    if (4 == m_tx_hw_fifo_size)
+    {
+      m_UTSR0 &= ~UTSR0_TFS; // disable 'Transmit FIFO service request'
+    }
+    
+    // ARMware used to have unlimited UART buffer and never rose down the TNF
+    // (Transmit FIFO Not Full) bit. The transmit FIFO is modelled now, thus
+    // TNF is risen down when it is full, until run() shifts it out to the
+    // line. If the line is full as well, the guest waits for the device
+    // (ex: a slow reader on the host pseudo-terminal) as if it is the
+    // hardware flow control.
+    if (m_tx_hw_fifo_size < TX_FIFO_SIZE)
+    {
+      m_tx_hw_fifo[m_tx_hw_fifo_size] = static_cast<uint8_t>(value & 0xFF);
+      
+      ++m_tx_hw_fifo_size;
+      
+      if (TX_FIFO_SIZE == m_tx_hw_fifo_size)
+      {
+        m_UTSR1 &= ~UTSR1_TNF;
+      }
+    }
+    else
+    {
+#if TRACE_UART
+      g_log_file << "UART<" << UartTraits<T_serial_port>::PORT_NUMBER
+                 << ">: "
+                 << "WARNING: Put data to UART when its TX fifo is full." << std::endl;
+#endif
+    }
+  }
+  
+  template<typename T_serial_port>
+  void
+  Uart<T_serial_port>::write_UTSR0(uint32_t const /* address */, uint32_t const value)
+  {
+    // :SA-1110 Developer's Manual: p.336: Wei 2003-Jun-07:
+    //
+    // Writing a one to a sticky status bit clears it; writing a zero has no effect.
+    // Read-only flags are set and cleared by hardware; writes have no effect.
+    
+    // :NOTE: Wei 2004-Jan-03:
+    //
+    // Bit 6, 7 are reserved.
+    // bits 0, 1, 5 are read-only.
+    m_UTSR0 &= ~(value & UTSR0_READ_WRITE_BITS);
   }
   
   ////////////////////////////////// Public ///////////////////////////////////
@@ -88,24 +310,118 @@ namespace ARMware
   
   template<typename T_serial_port>
   Uart<T_serial_port>::Uart()
+    : m_timing(TIMING_TURBO),
+      m_tx_hw_fifo_size(0),
+      m_rx_hw_fifo_size(0),
+      mp_output_device(0),
+      mp_host_device(0),
+      m_register_bank(this,
+                      UartTraits<T_serial_port>::bank_name(),
+                      UartTraits<T_serial_port>::UTCR0,
+                      (UartTraits<T_serial_port>::UTSR1 + 4) - UartTraits<T_serial_port>::UTCR0)
   {
     init_register();
+    
+    typedef UartTraits<T_serial_port> Traits;
+    
+    m_register_bank.add(Traits::UTCR0, "UTCR0",
+                        RegisterBankBase::REG_READ_WRITE | RegisterBankBase::REG_WRITE_SIDE_EFFECT,
+                        &m_UTCR0, 0, &Uart::write_UTCR0);
+    m_register_bank.add(Traits::UTCR1, "UTCR1",
+                        RegisterBankBase::REG_READ_WRITE | RegisterBankBase::REG_WRITE_SIDE_EFFECT,
+                        &m_UTCR1, 0, &Uart::write_UTCR1);
+    m_register_bank.add(Traits::UTCR2, "UTCR2",
+                        RegisterBankBase::REG_READ_WRITE | RegisterBankBase::REG_WRITE_SIDE_EFFECT,
+                        &m_UTCR2, 0, &Uart::write_UTCR2);
+    m_register_bank.add(Traits::UTCR3, "UTCR3",
+                        RegisterBankBase::REG_READ_WRITE | RegisterBankBase::REG_WRITE_SIDE_EFFECT,
+                        &m_UTCR3, 0, &Uart::write_UTCR3);
+    m_register_bank.add(Traits::UTDR, "UTDR",
+                        (RegisterBankBase::REG_READ_WRITE |
+                         RegisterBankBase::REG_READ_SIDE_EFFECT |
+                         RegisterBankBase::REG_WRITE_SIDE_EFFECT |
+                         RegisterBankBase::REG_VOLATILE),
+                        0, &Uart::read_UTDR, &Uart::write_UTDR);
+    m_register_bank.add(Traits::UTSR0, "UTSR0",
+                        (RegisterBankBase::REG_READ_WRITE |
+                         RegisterBankBase::REG_WRITE_SIDE_EFFECT |
+                         RegisterBankBase::REG_VOLATILE),
+                        &m_UTSR0, 0, &Uart::write_UTSR0);
+    
+    // :NOTE: Wei 2004-Jan-03:
+    //
+    // Bit 6, 7 are reserved.
+    //
+    // However, this is a read-only register, thus I don't have to do the mask operation.
+    m_register_bank.add_plain(Traits::UTSR1, "UTSR1", &m_UTSR1,
+                              RegisterBankBase::REG_READ | RegisterBankBase::REG_VOLATILE);
+    
+    update_char_clocks();
+    
+    char const * const timing = getenv("ARMWARE_UART_TIMING");
+    
+    if ((timing != 0) && (0 == strcmp(timing, "baud")))
+    {
+      m_timing = TIMING_BAUD;
+    }
   }
   
   //================================ Operation ================================
   
   template<typename T_serial_port>
-  inline void
+  inline uint32_t
   Uart<T_serial_port>::run()
   {
-    if ((m_UTCR3 & UTCR3_TXE) && (m_tx_fifo.size() != 0))
+    if (mp_host_device != 0)
     {
-      tx_data();
+      mp_host_device->flush_log();
+    }
+    
+    if (m_UTCR3 & UTCR3_TXE)
+    {
+      // Shift the transmit FIFO out to the line, the whole FIFO in the turbo
+      // timing, one character in the baud-accurate timing. If the line is
+      // full (i.e. the device is slower than the guest), the rest waits.
+      uint32_t const burst = ((TIMING_TURBO == m_timing) ? m_tx_hw_fifo_size : 1);
+      uint32_t shifted = 0;
       
-      m_tx_fifo.clear();
+      while ((shifted < burst) &&
+             (shifted < m_tx_hw_fifo_size) &&
+             (true == m_tx_fifo.push(m_tx_hw_fifo[shifted])))
+      {
+        ++shifted;
+      }
+      
+      if (shifted != 0)
+      {
+        m_tx_hw_fifo_size -= shifted;
+        
+        memmove(m_tx_hw_fifo, m_tx_hw_fifo + shifted, m_tx_hw_fifo_size);
+      }
       
-      m_UTSR0 |= UTSR0_TFS; // Enable Transmit FIFO service request
-      m_UTSR1 |= UTSR1_TNF; // Transmit FIFO not full
+      if (false == m_tx_fifo.empty())
+      {
+        if (mp_host_device != 0)
+        {
+          // The I/O thread of the host device drains m_tx_fifo by itself,
+          // I only have to wake it up.
+          mp_host_device->notify_tx();
+        }
+        else
+        {
+          tx_data();
+        }
+      }
+      
+      if (m_tx_hw_fifo_size <= (TX_FIFO_SIZE >> 1))
+      {
+        m_UTSR0 |= UTSR0_TFS; // Enable Transmit FIFO service request
+      }
+      
+      if (m_tx_hw_fifo_size < TX_FIFO_SIZE)
+      {
+        m_UTSR1 |= UTSR1_TNF; // Transmit FIFO not full
+      }
     }
     
     if (m_UTCR3 & UTCR3_RXE)
@@ -113,9 +429,25 @@ namespace ARMware
       // :NOTE: Wei 2004-Jul-1:
       //
       // Try to get more data.
-      rx_data();
+      //
+      // The I/O thread of the host device fills m_rx_fifo by itself.
+      if (0 == mp_host_device)
+      {
+        rx_data();
+      }
       
-      switch (m_rx_fifo.size())
+      // Shift the line into the receive FIFO, as many as it can take in the
+      // turbo timing, one character in the baud-accurate timing.
+      uint32_t const line_size = m_rx_fifo.size();
+      uint32_t const limit = ((TIMING_TURBO == m_timing)
+                              ? RX_FIFO_SIZE
+                              : (m_rx_hw_fifo_size + 1));
+      
+      m_rx_hw_fifo_size = ((line_size < limit)
+                           ? line_size
+                           : ((limit < RX_FIFO_SIZE) ? limit : RX_FIFO_SIZE));
+      
+      switch (m_rx_hw_fifo_size)
       {
       case  0:
         m_UTSR1 &= ~UTSR1_RNE;
@@ -164,8 +496,8 @@ namespace ARMware
       
 #if TRACE_UART
       g_log_file << "UART<" << UartTraits<T_serial_port>::PORT_NUMBER
-                 << ">: receive: m_rx_fifo.size() = " 
-                 << m_rx_fifo.size()
+                 << ">: receive: m_rx_hw_fifo_size = " 
+                 << m_rx_hw_fifo_size
                  << ", UTSR0: " << std::hex
                  << m_UTSR0
                  << ", UTSR1: "
@@ -173,6 +505,8 @@ namespace ARMware
                  << std::endl;
 #endif
     }
+    
+    return service_period();
   }
   
   template<typename T_serial_port>
@@ -200,138 +534,14 @@ namespace ARMware
   T_return
   Uart<T_serial_port>::get_data(uint32_t const address)
   {
-    switch (address)
-    {
-    case UartTraits<T_serial_port>::UTCR0:
-#if TRACE_UART
-      g_log_file << "UART<" << UartTraits<T_serial_port>::PORT_NUMBER
-                << ">: get UTCR0: " << std::hex
-                << static_cast<T_return>(m_UTCR0) << std::endl;
-#endif
-      
-      return static_cast<T_return>(m_UTCR0);
-      
-    case UartTraits<T_serial_port>::UTCR1:
-#if TRACE_UART
-      g_log_file << "UART<" << UartTraits<T_serial_port>::PORT_NUMBER
-                << ">: get UTCR1: " << std::hex
-                << static_cast<T_return>(m_UTCR1) << std::endl;
-#endif
-      
-      return static_cast<T_return>(m_UTCR1);
-      
-    case UartTraits<T_serial_port>::UTCR2:
-#if TRACE_UART
-      g_log_file << "UART<" << UartTraits<T_serial_port>::PORT_NUMBER
-                << ">: get UTCR2: " << std::hex
-                << static_cast<T_return>(m_UTCR2) << std::endl;
-#endif
-      
-      return static_cast<T_return>(m_UTCR2);
-      
-    case UartTraits<T_serial_port>::UTCR3:
-#if TRACE_UART
-      g_log_file << "UART<" << UartTraits<T_serial_port>::PORT_NUMBER
-                << ">: get UTCR3: " << std::hex
-                << static_cast<T_return>(m_UTCR3) << std::endl;
-#endif
-      
-      return static_cast<T_return>(m_UTCR3);
-      
-    case UartTraits<T_serial_port>::UTDR:
-      {
-        if (true == m_rx_fifo.empty())
-        {
-          assert(0 == (m_UTSR1 & UTSR1_RNE));
-          
-#if TRACE_UART
-          g_log_file << "UART<" << UartTraits<T_serial_port>::PORT_NUMBER
-                     << ">: "
-                     << "WARNING: Get data from UART when its RX fifo is empty." << std::endl;
-#endif
-          
-          return static_cast<T_return>(0);
-        }
-        else
-        {
-          assert(UTSR1_RNE == (m_UTSR1 & UTSR1_RNE));
-          
-#if TRACE_UART
-          g_log_file << "UART<" << UartTraits<T_serial_port>::PORT_NUMBER
-                     << ">: get UTDR: " << std::hex
-                     << static_cast<T_return>(m_rx_fifo.front()) << std::endl;
-#endif
-          
-          uint8_t const ch = m_rx_fifo.front();
-          
-          m_rx_fifo.pop_front();
-          
-          switch (m_rx_fifo.size())
-          {
-          case 0:
-            m_UTSR0 &= ~(UTSR0_RID | UTSR0_RFS);
-            
-            m_UTSR1 &= ~UTSR1_RNE;
-            break;
-            
-          case 1:
-          case 2:
-          case 3:
-          case 4:
-          case 5:
-          case 6:
-          case 7:
-            m_UTSR0 &= ~UTSR0_RFS;
-            break;
-            
-          case 8:
-          case 9:
-          case 10:
-          case 11:
-          case 12:
-          default:
-            break;
-          }
-          
-#if TRACE_UART
-          g_log_file << "UART<" << UartTraits<T_serial_port>::PORT_NUMBER
-                     << ">: rx fifo size = "
-                     << m_rx_fifo.size()
-                     << ", UTSR0: "
-                     << m_UTSR0 << std::endl;
-#endif
-          
-          return static_cast<T_return>(ch);
-        }
-      }
-      
-    case UartTraits<T_serial_port>::UTSR0:
-#if TRACE_UART
-      g_log_file << "UART<" << UartTraits<T_serial_port>::PORT_NUMBER
-                << ">: get UTSR0: " << std::hex
-                << static_cast<T_return>(m_UTSR0) << std::endl;
-#endif
-      
-      return static_cast<T_return>(m_UTSR0);
-      
-    case UartTraits<T_serial_port>::UTSR1:
+    uint32_t const value = m_register_bank.read(address);
+    
 #if TRACE_UART
-      g_log_file << "UART<" << UartTraits<T_serial_port>::PORT_NUMBER
-                << ">: get UTSR1: " << std::hex
-                << static_cast<T_return>(m_UTSR1) << std::endl;
+    g_log_file << "UART<" << UartTraits<T_serial_port>::PORT_NUMBER
+               << ">: get " << std::hex << address << ": " << value << std::endl;
 #endif
-      
-      // :NOTE: Wei 2004-Jan-03:
-      //
-      // Bit 6, 7 are reserved.
-      //
-      // However, this is a read-only register, thus I don't have to do the mask operation.
-      return static_cast<T_return>(m_UTSR1);
-      
-    default:
-      assert(!"Should not reach here.");
-      return 0;
-    }
+    
+    return static_cast<T_return>(value);
   }
   
   template<typename T_serial_port>
@@ -339,153 +549,11 @@ namespace ARMware
   void
   Uart<T_serial_port>::put_data(uint32_t const address, T_store const value)
   {
-    switch (address)
-    {
-    case UartTraits<T_serial_port>::UTCR0:
 #if TRACE_UART
-      g_log_file << "UART<" << UartTraits<T_serial_port>::PORT_NUMBER
-                << ">: put UTCR0: " << std::hex << value << std::endl;
+    g_log_file << "UART<" << UartTraits<T_serial_port>::PORT_NUMBER
+               << ">: put " << std::hex << address << ": " << value << std::endl;
 #endif
-      
-      // :NOTE: Wei 2004-Jan-03:
-      //
-      // Bit 7 is reserved.
-      m_UTCR0 = static_cast<uint8_t>(value & ~(1 << 7));
-      break;
-      
-    case UartTraits<T_serial_port>::UTCR1:
-#if TRACE_UART
-      g_log_file << "UART<" << UartTraits<T_serial_port>::PORT_NUMBER
-                << ">: put UTCR1: " << std::hex << value << std::endl;
-#endif
-      
-      // :NOTE: Wei 2004-Jan-03:
-      //
-      // Bit 4, 5, 6, 7 are reserved.
-      m_UTCR1 = static_cast<uint8_t>(value & ~((1 << 7) | (1 << 6) | (1 << 5) | (1 << 4)));
-      break;
-      
-    case UartTraits<T_serial_port>::UTCR2:
-#if TRACE_UART
-      g_log_file << "UART<" << UartTraits<T_serial_port>::PORT_NUMBER
-                << ">: put UTCR2: " << std::hex << value << std::endl;
-#endif
-      
-      m_UTCR2 = static_cast<uint8_t>(value);
-      break;
-      
-    case UartTraits<T_serial_port>::UTCR3:
-      {
-#if TRACE_UART
-        g_log_file << "UART<" << UartTraits<T_serial_port>::PORT_NUMBER
-                  << ">: put UTCR3: " << std::hex << value << std::endl;
-#endif
-        
-        uint8_t const diff = (m_UTCR3 ^ value);
-        
-        if ((diff & UTCR3_TXE) && (0 == (value & UTCR3_TXE)))
-        {
-          if (m_tx_fifo.size() != 0)
-          {
-            // :SA-1110 Developer's Manual: p.332: Wei 2003-Jun-29:
-            //
-            // If the TXE bit is cleared to zero, all entries within the transmit FIFO are reset.
-            m_tx_fifo.clear();
-            
-            m_UTSR0 |= UTSR0_TFS; // Enable Transmit FIFO service request
-            m_UTSR1 |= UTSR1_TNF; // Transmit FIFO not full
-          }
-        }
-        
-        if ((diff & UTCR3_RXE) && (0 == (value & UTCR3_RXE)))
-        {
-          // :SA-1110 Developer's Manual: p.332: Wei 2003-Jun-29:
-          //
-          // If the RXE bit is cleared to zero, all entries within the receive FIFO are reset
-          if (false == m_rx_fifo.empty())
-          {
-            m_rx_fifo.clear();
-            
-            m_UTSR0 &= ~(UTSR0_RID | UTSR0_RFS);
-            m_UTSR1 &= ~UTSR1_RNE;
-          }
-        }
-        
-        // :NOTE: Wei 2004-Jan-03:
-        //
-        // Bit 6, 7 are reserved.
-        m_UTCR3 = static_cast<uint8_t>(value & ~((1 << 7) | (1 << 6)));
-      }
-      break;
-      
-    case UartTraits<T_serial_port>::UTDR:
-#if TRACE_UART
-      g_log_file << "UART<" << UartTraits<T_serial_port>::PORT_NUMBER
-                 << ">: put UTDR: " << static_cast<char>(value)
-                 << " (" << std::hex << static_cast<uint32_t>(value) << ")" << std::endl;
-#endif
-      
-      switch (m_tx_fifo.size())
-      {
-      case 0:
-      case 1:
-      case 2:
-      case 3:
-        break;
-        
-      case 4:
-        m_UTSR0 &= ~UTSR0_TFS; // disable 'Transmit FIFO service request'
-        break;
-        
-      case 5:
-      case 6:
-        break;        
-        
-      case 7:
-        // :NOTE: Wei 2005-May-29:
-        //
-        // Because the ARMware has unlimited UART buffer,
-        // thus I will never rise down the TNF (Transmit FIFO Not Full) bit.
-        //
-        // m_UTSR1 &= ~(Uart<T_serial_port>::UTSR1_TNF);
-        break;
-        
-      case 8:
-      default:
-        break;
-      }
-      
-      m_tx_fifo.push_back(static_cast<uint8_t>(value & 0xFF));
-      break;
-      
-    case UartTraits<T_serial_port>::UTSR0:
-#if TRACE_UART
-      g_log_file << "UART<" << UartTraits<T_serial_port>::PORT_NUMBER
-                 << ">: put UTSR0: " << std::hex << value << std::endl;
-#endif
-      
-      // :SA-1110 Developer's Manual: p.336: Wei 2003-Jun-07:
-      //
-      // Writing a one to a sticky status bit clears it; writing a zero has no effect.
-      // Read-only flags are set and cleared by hardware; writes have no effect.
-      
-      // :NOTE: Wei 2004-Jan-03:
-      //
-      // Bit 6, 7 are reserved.
-      // bits 0, 1, 5 are read-only.
-      m_UTSR0 &= ~(value & UTSR0_READ_WRITE_BITS);
-      break;
-      
-    case UartTraits<T_serial_port>::UTSR1:
-      // :NOTE: Wei 2004-Jan-01:
-      //
-      // read-only register.
-      assert(!"Should not reach here.");
-      return;
-      
-    default:
-      assert(!"Should not reach here.");
-      break;
-    }
+    
+    m_register_bank.write(address, static_cast<uint32_t>(value));
   }
 }
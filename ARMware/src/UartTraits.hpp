@@ -36,6 +36,11 @@ namespace ARMware
   struct UartTraits<Serial_1>
   {
     static uint32_t const PORT_NUMBER = 1;
+    
+    static inline char const *
+    bank_name()
+    { return "uart1"; }
+    
     static IntController::IntCtrlBitMaskEnum const INT_CTRL_BIT_MASK = IntController::SERIAL_1_BIT_MASK;
     
     enum
@@ -54,6 +59,11 @@ namespace ARMware
   struct UartTraits<Serial_2>
   {
     static uint32_t const PORT_NUMBER = 2;
+    
+    static inline char const *
+    bank_name()
+    { return "uart2"; }
+    
     static IntController::IntCtrlBitMaskEnum const INT_CTRL_BIT_MASK = IntController::SERIAL_2_BIT_MASK;
     
     enum
@@ -72,6 +82,11 @@ namespace ARMware
   struct UartTraits<Serial_3>
   {
     static uint32_t const PORT_NUMBER = 3;
+    
+    static inline char const *
+    bank_name()
+    { return "uart3"; }
+    
     static IntController::IntCtrlBitMaskEnum const INT_CTRL_BIT_MASK = IntController::SERIAL_3_BIT_MASK;
     
     enum
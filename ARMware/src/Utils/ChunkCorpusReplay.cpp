@@ -0,0 +1,75 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+
+#include "ChunkCorpusReplay.hpp"
+
+#if ENABLE_DYNAMIC_TRANSLATOR && PROFILE_DT_COMPILE
+#include "../Core.hpp"
+#include "../Database/MachineImpl.hpp"
+#include "../Compiler/x86/Register.hpp"
+#endif
+
+namespace ARMware
+{
+  ///////////////////////////////// Public ////////////////////////////////////
+  //============================== Operation ==================================
+  
+  int
+  ChunkCorpusReplay::command_line(int const argc, char const * const * const argv)
+  {
+#if ENABLE_DYNAMIC_TRANSLATOR && PROFILE_DT_COMPILE
+    if (argc != 1)
+    {
+      std::cerr << "usage: armware --replay-chunk-corpus <corpus file>" << std::endl;
+      
+      return EXIT_FAILURE;
+    }
+    
+    MachineImpl machine;
+    
+    // No widgets, thus GTK doesn't have to be initialized.
+    std::auto_ptr<Core> p_core(new Core(machine, 0, 0, 0));
+    
+    gp_core = p_core.get();
+    
+    Register::register_init();
+    
+    bool const done = p_core->replay_chunk_corpus(argv[0]);
+    
+    if (false == done)
+    {
+      std::cerr << "can not open the chunk corpus " << argv[0] << std::endl;
+      
+      return EXIT_FAILURE;
+    }
+    
+    return EXIT_SUCCESS;
+#else
+    (void)argc;
+    (void)argv;
+    
+    std::cerr << "--replay-chunk-corpus needs a build with ENABLE_DYNAMIC_TRANSLATOR & PROFILE_DT_COMPILE" << std::endl;
+    
+    return EXIT_FAILURE;
+#endif
+  }
+}
@@ -0,0 +1,48 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+
+#ifndef ChunkCorpusReplay_hpp
+#define ChunkCorpusReplay_hpp
+
+#include "../Type.hpp"
+
+namespace ARMware
+{
+  // Feeds a chunk corpus captured by CompileProfiler
+  // (ARMWARE_DT_CAPTURE_CORPUS) through the threaded code generator and the
+  // dynamic compiler again, without running a guest, and then dumps the
+  // compile profile into the log file (see Core::replay_chunk_corpus()).
+  //
+  // The chunks are compiled by a Core of an empty machine (no flash ROM
+  // image) without any widget, thus it runs without GTK and a display.
+  // Only the builds with ENABLE_DYNAMIC_TRANSLATOR & PROFILE_DT_COMPILE can
+  // replay a corpus.
+  //
+  //   armware --replay-chunk-corpus <corpus file>
+  typedef class ChunkCorpusReplay ChunkCorpusReplay;
+  class ChunkCorpusReplay
+  {
+  public:
+    
+    // Operation
+    
+    static int command_line(int const argc, char const * const * const argv);
+  };
+}
+
+#endif
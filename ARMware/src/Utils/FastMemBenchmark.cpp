@@ -0,0 +1,313 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <iostream>
+
+#include "FastMemBenchmark.hpp"
+
+#include "../Core.hpp"
+#include "../RuntimeStats.hpp"
+
+#include "../AddressSpace.tcc"
+#include "../Mmu.tcc"
+
+namespace ARMware
+{
+  namespace
+  {
+    double
+    ns_per_access(clock_t const elapsed, size_t const access_number)
+    {
+      if (0 == access_number)
+      {
+        return 0;
+      }
+      
+      return ((static_cast<double>(elapsed) * 1000000000.0) / CLOCKS_PER_SEC) / access_number;
+    }
+  }
+  
+  ///////////////////////////////// Private ///////////////////////////////////
+  //============================== Operation ==================================
+  
+  uint32_t
+  FastMemBenchmark::random()
+  {
+    // xorshift32
+    m_random ^= (m_random << 13);
+    m_random ^= (m_random >> 17);
+    m_random ^= (m_random << 5);
+    
+    return m_random;
+  }
+  
+  void
+  FastMemBenchmark::build_tables()
+  {
+    for (uint32_t process = 0; process < PROCESS_NUMBER; ++process)
+    {
+      for (uint32_t i = 0; i < 4096; ++i)
+      {
+        // Coarse page tables in domain 0.
+        uint32_t const descriptor =
+          (i < WINDOW_SECTIONS)
+          ? ((MachineType::DRAM_BASE + L2_TABLE_OFFSET + (((process * WINDOW_SECTIONS) + i) << 10)) | 0x10 | 0x1)
+          : 0;
+        
+        m_memory.put_data<uint32_t>(TTB_OFFSET + (process << 14) + (i << 2), descriptor);
+      }
+      
+      for (uint32_t section = 0; section < WINDOW_SECTIONS; ++section)
+      {
+        for (uint32_t i = 0; i < 256; ++i)
+        {
+          // Small pages, read/write in all modes.
+          uint32_t const descriptor =
+            ((MachineType::DRAM_BASE + DATA_OFFSET + ((random() % DATA_PAGE_NUMBER) << 12)) | 0xFF0 | 0x2);
+          
+          m_memory.put_data<uint32_t>(L2_TABLE_OFFSET + (((process * WINDOW_SECTIONS) + section) << 10) + (i << 2),
+                                      descriptor);
+        }
+      }
+    }
+  }
+  
+  void
+  FastMemBenchmark::build_accesses(uint32_t const round_number,
+                                   uint32_t const access_per_round,
+                                   uint32_t const page_per_section)
+  {
+    m_processes.resize(round_number);
+    m_accesses.resize(round_number * access_per_round);
+    
+    std::vector<Access>::iterator iter = m_accesses.begin();
+    
+    for (uint32_t round = 0; round < round_number; ++round)
+    {
+      m_processes[round] = (random() % PROCESS_NUMBER);
+      
+      for (uint32_t i = 0; i < access_per_round; ++i, ++iter)
+      {
+        iter->m_vaddr = (((random() % WINDOW_SECTIONS) << 20) |
+                         ((random() % page_per_section) << 12) |
+                         (random() & 0xFFC));
+        
+        // Mostly the user mode, with a few system calls.
+        iter->m_mode = (0 == (random() & 0x7)) ? MODE_SVC : MODE_USR;
+        iter->m_is_store = (0 == (random() & 0x3));
+      }
+    }
+  }
+  
+  void
+  FastMemBenchmark::clear_data()
+  {
+    // No page table lives there, thus the walk cache doesn't need to see
+    // this.
+    memset(m_memory.get_memory_buffer() + DATA_OFFSET, 0, DATA_PAGE_NUMBER << 12);
+  }
+  
+  void
+  FastMemBenchmark::switch_process(uint32_t const process)
+  {
+    // The same as writing CP15 register 2 (see SysCoProc::exec_CRT()),
+    // and then flushing both TLBs, as the guest does.
+    m_sys_co_proc.set_reg_value(CPR_2, MachineType::DRAM_BASE + TTB_OFFSET + (process << 14));
+    m_mmu.bump_generation();
+    m_mmu.flush_walk_cache();
+    
+    m_mmu.flush_inst_tlb();
+    m_mmu.flush_data_tlb();
+  }
+  
+  uint32_t
+  FastMemBenchmark::access_by_tlb(Access const &access, uint32_t const value, uint32_t &paddr)
+  {
+    bool exception_occur = false;
+    
+    if (true == access.m_is_store)
+    {
+      paddr = m_mmu.translate_access<DATA, WRITE>(access.m_vaddr, access.m_mode, exception_occur);
+      
+      assert(false == exception_occur);
+      
+      m_address_space.put_data<uint32_t>(paddr, value);
+      
+      return 0;
+    }
+    else
+    {
+      paddr = m_mmu.translate_access<DATA, READ>(access.m_vaddr, access.m_mode, exception_occur);
+      
+      assert(false == exception_occur);
+      
+      return m_address_space.get_data<uint32_t>(paddr, exception_occur);
+    }
+  }
+  
+  // The same as Core::get_data() & Core::put_data().
+  uint32_t
+  FastMemBenchmark::access_by_fast_mem(Access const &access, uint32_t const value)
+  {
+    if (true == access.m_is_store)
+    {
+      uint32_t dram_offset;
+      
+      if (true == m_fast_mem.store(access.m_vaddr, access.m_mode, m_mmu.generation(), dram_offset))
+      {
+        m_address_space.put_dram_data<uint32_t>(dram_offset, value);
+        
+        return 0;
+      }
+    }
+    else
+    {
+      uint32_t loaded;
+      
+      if (true == m_fast_mem.load(access.m_vaddr, access.m_mode, m_mmu.generation(), loaded))
+      {
+        return loaded;
+      }
+    }
+    
+    uint32_t paddr;
+    uint32_t const loaded = access_by_tlb(access, value, paddr);
+    
+    m_fast_mem.fill(access.m_vaddr,
+                    access.m_mode,
+                    m_mmu.generation(),
+                    paddr,
+                    m_address_space.host_addr(paddr),
+                    access.m_is_store);
+    
+    return loaded;
+  }
+  
+  uint32_t
+  FastMemBenchmark::run(bool const use_fast_mem, uint32_t const access_per_round)
+  {
+    uint32_t checksum = 0;
+    uint32_t paddr;
+    
+    clear_data();
+    
+    std::vector<Access>::const_iterator iter = m_accesses.begin();
+    
+    for (std::vector<uint32_t>::const_iterator process = m_processes.begin();
+         process != m_processes.end();
+         ++process)
+    {
+      switch_process(*process);
+      
+      for (uint32_t i = 0; i < access_per_round; ++i, ++iter)
+      {
+        // Stores the running checksum, so that a store going to the wrong
+        // place shows up in the later loads.
+        uint32_t const loaded = (true == use_fast_mem)
+          ? access_by_fast_mem(*iter, checksum)
+          : access_by_tlb(*iter, checksum, paddr);
+        
+        checksum = ((checksum << 1) | (checksum >> 31)) ^ loaded ^ iter->m_vaddr;
+      }
+    }
+    
+    return checksum;
+  }
+  
+  //============================== Life cycle =================================
+  
+  FastMemBenchmark::FastMemBenchmark()
+    : m_random(1),
+      m_memory(MachineType::DRAM_SIZE + 1, 0),
+      m_address_space(0, 0),
+      m_sys_co_proc(0),
+      m_mmu(&m_sys_co_proc, &m_address_space),
+      m_fast_mem(true)
+  {
+    m_address_space.RegisterMemory(&m_memory);
+    
+    m_memory.register_walk_cache(m_mmu.walk_cache());
+    m_mmu.shadow_tlb()->register_memory(m_memory.get_memory_buffer());
+    
+    // MMU on, all the domains are clients.
+    m_sys_co_proc.set_reg_value(CPR_3, 0x55555555);
+    m_sys_co_proc.set_reg_value(CPR_1, 0x1);
+  }
+  
+  ///////////////////////////////// Public ////////////////////////////////////
+  //============================== Operation ==================================
+  
+  int
+  FastMemBenchmark::command_line(int const argc, char const * const * const argv)
+  {
+    uint32_t const round_number = (argc >= 1) ? strtoul(argv[0], 0, 0) : DEFAULT_ROUND_NUMBER;
+    uint32_t const access_per_round = (argc >= 2) ? strtoul(argv[1], 0, 0) : DEFAULT_ACCESS_PER_ROUND;
+    uint32_t const page_per_section = (argc >= 3) ? strtoul(argv[2], 0, 0) : DEFAULT_PAGE_PER_SECTION;
+    
+    if ((0 == page_per_section) || (page_per_section > 256))
+    {
+      std::cerr << "pages per section should be 1 ~ 256" << std::endl;
+      
+      return EXIT_FAILURE;
+    }
+    
+    FastMemBenchmark benchmark;
+    
+    benchmark.build_tables();
+    benchmark.build_accesses(round_number, access_per_round, page_per_section);
+    
+    size_t const access_number = benchmark.m_accesses.size();
+    
+    // Warm up the shadow TLB & the walk cache, which survive the context
+    // switches, so that both paths below start from the same state.
+    (void)benchmark.run(false, access_per_round);
+    
+    clock_t const tlb_begin = clock();
+    uint32_t const tlb_checksum = benchmark.run(false, access_per_round);
+    clock_t const tlb_elapsed = clock() - tlb_begin;
+    
+    uint64_t const hit_begin = g_runtime_stats.counter(RuntimeStats::FASTMEM_HIT);
+    uint64_t const miss_begin = g_runtime_stats.counter(RuntimeStats::FASTMEM_MISS);
+    
+    clock_t const fast_mem_begin = clock();
+    uint32_t const fast_mem_checksum = benchmark.run(true, access_per_round);
+    clock_t const fast_mem_elapsed = clock() - fast_mem_begin;
+    
+    uint64_t const hit_number = g_runtime_stats.counter(RuntimeStats::FASTMEM_HIT) - hit_begin;
+    uint64_t const miss_number = g_runtime_stats.counter(RuntimeStats::FASTMEM_MISS) - miss_begin;
+    
+    std::cerr << round_number << " context switches, "
+              << access_number << " accesses, "
+              << page_per_section << " pages per section" << std::endl
+              << "TLB path:     " << ns_per_access(tlb_elapsed, access_number) << " ns per access" << std::endl
+              << "FastMem path: " << ns_per_access(fast_mem_elapsed, access_number) << " ns per access, "
+              << hit_number << " hits (mmu.fastmem_hit), "
+              << miss_number << " misses (mmu.fastmem_miss)" << std::endl;
+    
+    if (tlb_checksum != fast_mem_checksum)
+    {
+      std::cerr << "FAIL: the loaded values differ" << std::endl;
+      
+      return EXIT_FAILURE;
+    }
+    
+    return EXIT_SUCCESS;
+  }
+}
@@ -0,0 +1,131 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+#ifndef FastMemBenchmark_hpp
+#define FastMemBenchmark_hpp
+
+#include <vector>
+
+#include "../Type.hpp"
+#include "../ARMware.hpp"
+#include "../Memory.hpp"
+#include "../AddressSpace.hpp"
+#include "../SysCoProc.hpp"
+#include "../Mmu.hpp"
+#include "../FastMem.hpp"
+
+namespace ARMware
+{
+  // Compares the data accesses through FastMem with the ones through the
+  // TLBs of Mmu, on a workload which switches the context often, without
+  // the GUI and without a guest.
+  //
+  // It builds the page tables of PROCESS_NUMBER processes in DRAM, all of
+  // them mapping the same virtual window onto different DRAM pages. Then
+  // round after round it switches to a random process the way the guest
+  // does (writes the translation table base, and flushes both TLBs), and
+  // does a number of loads & stores in that process.
+  //
+  // The same accesses are done twice, from the same DRAM contents:
+  //
+  // * the TLB path: Mmu::translate_access() and AddressSpace, which is what
+  //   Core does when FastMem is off,
+  // * the FastMem path: FastMem first, and the TLB path and FastMem::fill()
+  //   when it misses, which is what Core does when ARMWARE_FASTMEM=1.
+  //
+  // It prints the time per access of both, and the hits & misses of
+  // FastMem (mmu.fastmem_hit & mmu.fastmem_miss). The loaded values of
+  // both have to be the same, or it fails.
+  //
+  // A round with fewer accesses, or a larger working set, switches more
+  // often than it reuses FastMem entries.
+  //
+  //   armware --fastmem-benchmark [<rounds> [<accesses per round> [<pages per section>]]]
+  typedef class FastMemBenchmark FastMemBenchmark;
+  class FastMemBenchmark
+  {
+  private:
+    
+    struct Access
+    {
+      uint32_t m_vaddr;
+      CoreMode m_mode;
+      bool m_is_store;
+    };
+    typedef struct Access Access;
+    
+    static uint32_t const DEFAULT_ROUND_NUMBER = 20000;
+    static uint32_t const DEFAULT_ACCESS_PER_ROUND = 64;
+    static uint32_t const DEFAULT_PAGE_PER_SECTION = 16;
+    
+    static uint32_t const PROCESS_NUMBER = 4;
+    static uint32_t const TTB_OFFSET = 0x4000;
+    static uint32_t const L2_TABLE_OFFSET = 0x20000;
+    
+    // Only the first WINDOW_SECTIONS MB of the virtual address space are
+    // mapped, each section by a coarse page table.
+    static uint32_t const WINDOW_SECTIONS = 4;
+    
+    // The pages the windows are mapped onto.
+    static uint32_t const DATA_OFFSET = 0x100000;
+    static uint32_t const DATA_PAGE_NUMBER = 1024;
+    
+    // Attribute
+    
+    uint32_t m_random;
+    
+    Memory m_memory;
+    AddressSpace m_address_space;
+    SysCoProc m_sys_co_proc;
+    Mmu m_mmu;
+    FastMem m_fast_mem;
+    
+    std::vector<uint32_t> m_processes;
+    std::vector<Access> m_accesses;
+    
+    // Operation
+    
+    uint32_t random();
+    
+    void build_tables();
+    void build_accesses(uint32_t const round_number,
+                        uint32_t const access_per_round,
+                        uint32_t const page_per_section);
+    void clear_data();
+    void switch_process(uint32_t const process);
+    
+    // @paddr: where the access went.
+    uint32_t access_by_tlb(Access const &access, uint32_t const value, uint32_t &paddr);
+    uint32_t access_by_fast_mem(Access const &access, uint32_t const value);
+    
+    // @use_fast_mem: which path to go through.
+    // @return: the checksum of all the loaded values.
+    uint32_t run(bool const use_fast_mem, uint32_t const access_per_round);
+    
+    // Life cycle
+    
+    FastMemBenchmark();
+    
+  public:
+    
+    // Operation
+    
+    static int command_line(int const argc, char const * const * const argv);
+  };
+}
+
+#endif
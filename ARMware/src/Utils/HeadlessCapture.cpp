@@ -0,0 +1,60 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+#include <cstdlib>
+#include <iostream>
+
+#include "HeadlessCapture.hpp"
+
+#include "../StartMachine.hpp"
+#include "../Database/Database.hpp"
+#include "../Database/MachineImpl.hpp"
+
+namespace ARMware
+{
+  ///////////////////////////////// Public ////////////////////////////////////
+  //============================== Operation ==================================
+  
+  int
+  HeadlessCapture::run(char const * const machine_name)
+  {
+    Database * const database = Database::get_database();
+    
+    for (uint32_t i = 0; i < database->machine_count(); ++i)
+    {
+      if (database->machine_name(i) == machine_name)
+      {
+        // The same as MainWindow, keep a copy of the machine, and release
+        // the database before powering it on.
+        MachineImpl const machine = (*database)[i];
+        
+        Database::put_database();
+        
+        // No widgets, thus GTK doesn't have to be initialized.
+        start_machine(machine, 0, 0, 0);
+        
+        return EXIT_SUCCESS;
+      }
+    }
+    
+    Database::put_database();
+    
+    std::cerr << "can not find the machine " << machine_name << " in the machine database" << std::endl;
+    
+    return EXIT_FAILURE;
+  }
+}
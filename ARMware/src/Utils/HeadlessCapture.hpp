@@ -13,18 +13,32 @@
 // 
 // You should have received a copy of the GNU General Public License
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
-//
+// 
+
+#ifndef HeadlessCapture_hpp
+#define HeadlessCapture_hpp
 
-#include "ColorTableTraits.hpp"
+#include "../Type.hpp"
 
 namespace ARMware
 {
-  // :NOTE: Wei 2004-Apr-14:
+  // Powers a machine of the machine database on for the frame capture
+  // (see FrameCapture.hpp), without MainWindow & MachineScreen, thus it
+  // runs without GTK and a display.
   //
-  // The pixel arrangement of the internal buffer of GtkPixbuf is as following:
+  //   ARMWARE_CAPTURE=<directory> ARMWARE_CAPTURE_MACHINE=<machine name> armware
   //
-  // ABGR
-  ColorTableTraits<0> mRedTable;
-  ColorTableTraits<8> mGreenTable;
-  ColorTableTraits<16> mBlueTable;
+  // The machine is selected by the name shown in the machine list of
+  // MainWindow, and it runs until ARMWARE_CAPTURE_FRAMES frames are taken.
+  typedef class HeadlessCapture HeadlessCapture;
+  class HeadlessCapture
+  {
+  public:
+    
+    // Operation
+    
+    static int run(char const * const machine_name);
+  };
 }
+
+#endif
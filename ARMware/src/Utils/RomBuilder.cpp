@@ -0,0 +1,289 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#if WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "RomBuilder.hpp"
+
+#if LINUX && defined(__GLIBC__) && ((__GLIBC__ > 2) || ((__GLIBC__ == 2) && (__GLIBC_MINOR__ >= 27)))
+#define HAVE_COPY_FILE_RANGE 1
+#else
+#define HAVE_COPY_FILE_RANGE 0
+#endif
+
+#ifndef O_BINARY
+#define O_BINARY 0
+#endif
+
+namespace ARMware
+{
+  namespace
+  {
+    typedef class ConsoleProgress ConsoleProgress;
+    class ConsoleProgress : public RomBuilder::Progress
+    {
+    public:
+      
+      virtual bool
+      report(std::string const &image_file, double const fraction)
+      {
+        std::cerr << "\r" << image_file << ": " << static_cast<uint32_t>(fraction * 100) << "%";
+        
+        if (fraction >= 1.0)
+        {
+          std::cerr << std::endl;
+        }
+        
+        return true;
+      }
+    };
+    
+    bool
+    write_all(int const fd, char const *data, uint32_t size)
+    {
+      while (size != 0)
+      {
+        int const written = write(fd, data, size);
+        
+        if (written <= 0)
+        {
+          return false;
+        }
+        
+        data += written;
+        size -= written;
+      }
+      
+      return true;
+    }
+  }
+  
+  ///////////////////////////////// Private ///////////////////////////////////
+  //============================== Operation ==================================
+  
+  RomBuilder::ResultEnum
+  RomBuilder::copy_partition(Partition const &partition,
+                             int const rom_fd,
+                             std::vector<char> &buffer,
+                             Progress * const progress)
+  {
+    int const image_fd = open(partition.m_image_file.c_str(), O_RDONLY | O_BINARY);
+    
+    if (-1 == image_fd)
+    {
+      m_error_file = partition.m_image_file;
+      
+      return RESULT_INPUT_ERROR;
+    }
+    
+    struct stat image_stat;
+    
+    fstat(image_fd, &image_stat);
+    
+    uint32_t const image_size = static_cast<uint32_t>(image_stat.st_size);
+    uint32_t copied = 0;
+    ResultEnum result = RESULT_DONE;
+    
+#if HAVE_COPY_FILE_RANGE
+    bool use_copy_file_range = true;
+#endif
+    
+    if (lseek(rom_fd, partition.m_addr, SEEK_SET) != static_cast<off_t>(partition.m_addr))
+    {
+      m_error_file = m_rom_file;
+      
+      close(image_fd);
+      
+      return RESULT_OUTPUT_ERROR;
+    }
+    
+    if (progress != 0)
+    {
+      (void)progress->report(partition.m_image_file, (0 == image_size) ? 1.0 : 0.0);
+    }
+    
+    while (copied < image_size)
+    {
+      uint32_t const block_size = (((image_size - copied) < COPY_BLOCK_SIZE)
+                                   ? (image_size - copied)
+                                   : COPY_BLOCK_SIZE);
+      uint32_t done = 0;
+      
+#if HAVE_COPY_FILE_RANGE
+      // copy_file_range() lets the kernel copy (or even share the extents
+      // of) the data without bringing it into the user space. It isn't
+      // supported across some file systems, fall back to the block buffer
+      // for the rest of this partition then.
+      if (true == use_copy_file_range)
+      {
+        ssize_t const size = copy_file_range(image_fd, 0, rom_fd, 0, block_size, 0);
+        
+        if (size > 0)
+        {
+          done = static_cast<uint32_t>(size);
+        }
+        else
+        {
+          use_copy_file_range = false;
+        }
+      }
+      
+      if (0 == done)
+#endif
+      {
+        int const size = read(image_fd, &(buffer[0]), block_size);
+        
+        if (size <= 0)
+        {
+          m_error_file = partition.m_image_file;
+          result = RESULT_INPUT_ERROR;
+          break;
+        }
+        
+        if (false == write_all(rom_fd, &(buffer[0]), size))
+        {
+          m_error_file = m_rom_file;
+          result = RESULT_OUTPUT_ERROR;
+          break;
+        }
+        
+        done = static_cast<uint32_t>(size);
+      }
+      
+      copied += done;
+      
+      if ((progress != 0) &&
+          (false == progress->report(partition.m_image_file,
+                                     static_cast<double>(copied) / static_cast<double>(image_size))))
+      {
+        result = RESULT_CANCEL;
+        break;
+      }
+    }
+    
+    close(image_fd);
+    
+    return result;
+  }
+  
+  ///////////////////////////////// Public ////////////////////////////////////
+  //============================== Life cycle =================================
+  
+  RomBuilder::RomBuilder(std::string const &rom_file)
+    : m_rom_file(rom_file)
+  { }
+  
+  //============================== Operation ==================================
+  
+  RomBuilder::ResultEnum
+  RomBuilder::build(Progress * const progress)
+  {
+    int const rom_fd = open(m_rom_file.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_BINARY, 0666);
+    
+    if (-1 == rom_fd)
+    {
+      m_error_file = m_rom_file;
+      
+      return RESULT_OUTPUT_ERROR;
+    }
+    
+    std::vector<char> buffer(COPY_BLOCK_SIZE);
+    ResultEnum result = RESULT_DONE;
+    
+    for (std::vector<Partition>::const_iterator iter = m_partitions.begin();
+         iter != m_partitions.end();
+         ++iter)
+    {
+      result = copy_partition(*iter, rom_fd, buffer, progress);
+      
+      if (result != RESULT_DONE)
+      {
+        break;
+      }
+    }
+    
+    if (close(rom_fd) != 0)
+    {
+      if (RESULT_DONE == result)
+      {
+        m_error_file = m_rom_file;
+        result = RESULT_OUTPUT_ERROR;
+      }
+    }
+    
+    return result;
+  }
+  
+  int
+  RomBuilder::command_line(int const argc, char const * const * const argv)
+  {
+    if (argc < 2)
+    {
+      std::cerr << "usage: armware --build-rom <ROM file> <hex address>=<image file> ..." << std::endl;
+      
+      return EXIT_FAILURE;
+    }
+    
+    RomBuilder builder(argv[0]);
+    
+    for (int i = 1; i < argc; ++i)
+    {
+      char *end;
+      uint32_t const addr = strtoul(argv[i], &end, 16);
+      
+      if ((end == argv[i]) || (*end != '='))
+      {
+        std::cerr << "invalid partition: " << argv[i] << std::endl;
+        
+        return EXIT_FAILURE;
+      }
+      
+      builder.add_partition(addr, end + 1);
+    }
+    
+    ConsoleProgress progress;
+    
+    switch (builder.build(&progress))
+    {
+    case RESULT_DONE:
+      return EXIT_SUCCESS;
+      
+    case RESULT_INPUT_ERROR:
+      std::cerr << std::endl << "can not read " << builder.error_file() << std::endl;
+      return EXIT_FAILURE;
+      
+    case RESULT_OUTPUT_ERROR:
+      std::cerr << std::endl << "can not write " << builder.error_file() << std::endl;
+      return EXIT_FAILURE;
+      
+    case RESULT_CANCEL:
+    default:
+      return EXIT_FAILURE;
+    }
+  }
+}
@@ -0,0 +1,119 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+#ifndef RomBuilder_hpp
+#define RomBuilder_hpp
+
+#include <string>
+#include <vector>
+
+#include "../Type.hpp"
+
+namespace ARMware
+{
+  // Assembles a flash ROM image from partition image files, each of which
+  // is copied to its starting address in the ROM image. The gaps between
+  // partitions are left as holes (read back as 0).
+  //
+  // The partitions are copied in COPY_BLOCK_SIZE blocks, through
+  // copy_file_range() when the platform has it, otherwise through a block
+  // buffer, and the progress is reported once per block.
+  //
+  // It is used by the partition table of the new machine dialog, and by
+  // the command line:
+  //
+  //   armware --build-rom <ROM file> <hex address>=<image file> ...
+  typedef class RomBuilder RomBuilder;
+  class RomBuilder
+  {
+  public:
+    
+    enum ResultEnum
+    {
+      RESULT_DONE,
+      RESULT_CANCEL,
+      RESULT_INPUT_ERROR,
+      RESULT_OUTPUT_ERROR
+    };
+    typedef enum ResultEnum ResultEnum;
+    
+    class Progress
+    {
+    public:
+      
+      virtual ~Progress()
+      { }
+      
+      // @false: cancel the building.
+      virtual bool report(std::string const &image_file, double const fraction) = 0;
+    };
+  
+  private:
+    
+    struct Partition
+    {
+      uint32_t m_addr;
+      std::string m_image_file;
+    };
+    typedef struct Partition Partition;
+    
+    static uint32_t const COPY_BLOCK_SIZE = 1024 * 1024;
+    
+    // Attribute
+    
+    std::string const m_rom_file;
+    std::vector<Partition> m_partitions;
+    
+    std::string m_error_file;
+    
+    // Operation
+    
+    ResultEnum copy_partition(Partition const &partition,
+                              int const rom_fd,
+                              std::vector<char> &buffer,
+                              Progress * const progress);
+  
+  public:
+    
+    // Life cycle
+    
+    RomBuilder(std::string const &rom_file);
+    
+    // Operation
+    
+    inline void
+    add_partition(uint32_t const addr, std::string const &image_file)
+    {
+      Partition const partition = { addr, image_file };
+      
+      m_partitions.push_back(partition);
+    }
+    
+    ResultEnum build(Progress * const progress);
+    
+    static int command_line(int const argc, char const * const * const argv);
+    
+    // Inquery
+    
+    // The file which can not be read or written when build() fails.
+    inline std::string const &
+    error_file() const
+    { return m_error_file; }
+  };
+}
+
+#endif
@@ -0,0 +1,319 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#if LINUX
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+#include <glibmm/thread.h>
+
+#include "SerialBenchmark.hpp"
+
+namespace ARMware
+{
+  namespace
+  {
+    // 251 is a prime, thus the pattern doesn't line up with any block or
+    // FIFO size, and a lost or duplicated chunk is caught.
+    inline uint8_t
+    pattern(uint64_t const offset)
+    {
+      return static_cast<uint8_t>(offset % 251);
+    }
+  }
+  
+  ///////////////////////////////// Private ///////////////////////////////////
+  //============================== Operation ==================================
+  
+  void
+  SerialBenchmark::loopback_thread()
+  {
+#if LINUX
+    while (true == m_running)
+    {
+      uint8_t const *rx_span;
+      uint8_t *tx_span;
+      uint32_t const rx_size = m_rx_fifo.read_span(rx_span);
+      uint32_t const tx_size = m_tx_fifo.write_span(tx_span);
+      uint32_t const size = (rx_size < tx_size) ? rx_size : tx_size;
+      
+      if (0 == size)
+      {
+        if (false == m_tx_fifo.empty())
+        {
+          m_host.notify_tx();
+        }
+        
+        usleep(100);
+        continue;
+      }
+      
+      memcpy(tx_span, rx_span, size);
+      
+      m_tx_fifo.commit(size);
+      m_rx_fifo.consume(size);
+      
+      m_host.notify_tx();
+    }
+#endif
+  }
+  
+  bool
+  SerialBenchmark::open_host_side(char const * const spec, int &rx_fd, int &tx_fd)
+  {
+#if LINUX
+    std::string const spec_str(spec);
+    
+    if (0 == spec_str.compare(0, 3, "pty"))
+    {
+      rx_fd = open(m_host.path().c_str(), O_RDWR | O_NOCTTY);
+      tx_fd = rx_fd;
+    }
+    else if (0 == spec_str.compare(0, 5, "unix:"))
+    {
+      struct sockaddr_un addr;
+      
+      memset(&addr, 0, sizeof(addr));
+      addr.sun_family = AF_UNIX;
+      strcpy(addr.sun_path, m_host.path().c_str());
+      
+      rx_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+      
+      if ((rx_fd != -1) &&
+          (connect(rx_fd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) != 0))
+      {
+        close(rx_fd);
+        rx_fd = -1;
+      }
+      
+      tx_fd = rx_fd;
+    }
+    else
+    {
+      // The host side receives from <prefix>.out, and transmits into
+      // <prefix>.in.
+      rx_fd = open((m_host.path() + ".out").c_str(), O_RDONLY);
+      tx_fd = open((m_host.path() + ".in").c_str(), O_WRONLY);
+    }
+    
+    if ((-1 == rx_fd) || (-1 == tx_fd))
+    {
+      return false;
+    }
+    
+    fcntl(rx_fd, F_SETFL, fcntl(rx_fd, F_GETFL) | O_NONBLOCK);
+    fcntl(tx_fd, F_SETFL, fcntl(tx_fd, F_GETFL) | O_NONBLOCK);
+    
+    return true;
+#else
+    (void)spec;
+    (void)rx_fd;
+    (void)tx_fd;
+    
+    return false;
+#endif
+  }
+  
+  bool
+  SerialBenchmark::transfer(int const rx_fd, int const tx_fd, uint64_t const size)
+  {
+#if LINUX
+    std::vector<uint8_t> tx_block(BLOCK_SIZE);
+    std::vector<uint8_t> rx_block(BLOCK_SIZE);
+    uint64_t sent = 0;
+    uint64_t received = 0;
+    
+    while (received < size)
+    {
+      struct pollfd fds[2];
+      nfds_t fd_number = 1;
+      
+      fds[0].fd = rx_fd;
+      fds[0].events = POLLIN;
+      
+      if (sent < size)
+      {
+        fds[1].fd = tx_fd;
+        fds[1].events = POLLOUT;
+        
+        ++fd_number;
+      }
+      
+      // Nothing moves in 5 seconds, something is broken.
+      if (poll(fds, fd_number, 5000) <= 0)
+      {
+        std::cerr << "stalled after " << received << " bytes" << std::endl;
+        
+        return false;
+      }
+      
+      if ((fd_number > 1) && (fds[1].revents & POLLOUT))
+      {
+        uint32_t const block_size = (((size - sent) < BLOCK_SIZE)
+                                     ? static_cast<uint32_t>(size - sent)
+                                     : BLOCK_SIZE);
+        
+        for (uint32_t i = 0; i < block_size; ++i)
+        {
+          tx_block[i] = pattern(sent + i);
+        }
+        
+        ssize_t const written = write(tx_fd, &(tx_block[0]), block_size);
+        
+        if (written > 0)
+        {
+          sent += written;
+        }
+      }
+      
+      if (fds[0].revents & POLLIN)
+      {
+        ssize_t const read_size = read(rx_fd, &(rx_block[0]), BLOCK_SIZE);
+        
+        for (ssize_t i = 0; i < read_size; ++i)
+        {
+          if (rx_block[i] != pattern(received + i))
+          {
+            std::cerr << "corrupted at byte " << (received + i) << std::endl;
+            
+            return false;
+          }
+        }
+        
+        if (read_size > 0)
+        {
+          received += read_size;
+        }
+      }
+    }
+    
+    return true;
+#else
+    (void)rx_fd;
+    (void)tx_fd;
+    (void)size;
+    
+    return false;
+#endif
+  }
+  
+  //============================== Life cycle =================================
+  
+  SerialBenchmark::SerialBenchmark()
+    : m_host("benchmark", m_rx_fifo, m_tx_fifo),
+      m_running(false)
+  { }
+  
+  ///////////////////////////////// Public ////////////////////////////////////
+  //============================== Operation ==================================
+  
+  int
+  SerialBenchmark::command_line(int const argc, char const * const * const argv)
+  {
+#if LINUX
+    if (argc < 1)
+    {
+      std::cerr << "usage: armware --serial-benchmark <pty | unix:<path> | fifo:<prefix>> [<MB>]" << std::endl;
+      
+      return EXIT_FAILURE;
+    }
+    
+    uint64_t const size = (static_cast<uint64_t>((argc >= 2) ? strtoul(argv[1], 0, 10) : DEFAULT_SIZE)
+                           * 1024 * 1024);
+    
+    std::auto_ptr<SerialBenchmark> benchmark(new SerialBenchmark());
+    
+    if (false == benchmark->m_host.attach(argv[0]))
+    {
+      std::cerr << "can not attach to " << argv[0] << std::endl;
+      
+      return EXIT_FAILURE;
+    }
+    
+    int rx_fd;
+    int tx_fd;
+    
+    if (false == benchmark->open_host_side(argv[0], rx_fd, tx_fd))
+    {
+      std::cerr << "can not open " << benchmark->m_host.path() << std::endl;
+      
+      return EXIT_FAILURE;
+    }
+    
+    benchmark->m_running = true;
+    
+    Glib::Thread * const loopback_thread =
+      Glib::Thread::create(sigc::mem_fun(*benchmark, &SerialBenchmark::loopback_thread),
+                           true // joinable
+                           );
+    
+    struct timeval begin;
+    struct timeval end;
+    
+    gettimeofday(&begin, 0);
+    
+    bool const done = benchmark->transfer(rx_fd, tx_fd, size);
+    
+    gettimeofday(&end, 0);
+    
+    benchmark->m_running = false;
+    
+    loopback_thread->join();
+    
+    close(rx_fd);
+    
+    if (tx_fd != rx_fd)
+    {
+      close(tx_fd);
+    }
+    
+    if (false == done)
+    {
+      return EXIT_FAILURE;
+    }
+    
+    double const seconds = ((end.tv_sec - begin.tv_sec) +
+                            ((end.tv_usec - begin.tv_usec) / 1000000.0));
+    double const mb = static_cast<double>(size) / (1024 * 1024);
+    
+    std::cout << argv[0] << " (SerialHost loopback, no UART): " << mb << " MB each way in " << seconds << " s, "
+              << (mb / seconds) << " MB/s" << std::endl;
+    
+    return EXIT_SUCCESS;
+#else
+    (void)argc;
+    (void)argv;
+    
+    std::cerr << "--serial-benchmark is only supported on Linux" << std::endl;
+    
+    return EXIT_FAILURE;
+#endif
+  }
+}
@@ -0,0 +1,76 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+#ifndef SerialBenchmark_hpp
+#define SerialBenchmark_hpp
+
+#include "../Type.hpp"
+#include "../Uart.hpp"
+#include "../SerialHost.hpp"
+
+namespace ARMware
+{
+  // Measures the sustained throughput of SerialHost and the host device
+  // (pty, Unix socket or FIFOs) alone, without a guest and without the
+  // UART. A loopback thread takes the place of the UART: it drains the RX
+  // ring filled by SerialHost and pushes everything back into the TX ring,
+  // while the host side writes the data through the host device and reads
+  // it back.
+  //
+  // This is the ceiling of the host side, not what a guest will get: the
+  // UART moves at most its FIFO contents every TURBO_PERIOD clocks in the
+  // turbo timing, or one character per character time in the baud timing
+  // (see ARMWARE_UART_TIMING in Uart.hpp).
+  //
+  //   armware --serial-benchmark <pty | unix:<path> | fifo:<prefix>> [<MB>]
+  typedef class SerialBenchmark SerialBenchmark;
+  class SerialBenchmark
+  {
+  private:
+    
+    static uint32_t const BLOCK_SIZE = 64 * 1024;
+    static uint32_t const DEFAULT_SIZE = 64; // MB
+    
+    // Attribute
+    
+    UartFifo m_rx_fifo;
+    UartFifo m_tx_fifo;
+    
+    SerialHost m_host;
+    
+    bool volatile m_running;
+    
+    // Operation
+    
+    void loopback_thread();
+    
+    bool open_host_side(char const * const spec, int &rx_fd, int &tx_fd);
+    bool transfer(int const rx_fd, int const tx_fd, uint64_t const size);
+    
+    // Life cycle
+    
+    SerialBenchmark();
+  
+  public:
+    
+    // Operation
+    
+    static int command_line(int const argc, char const * const * const argv);
+  };
+}
+
+#endif
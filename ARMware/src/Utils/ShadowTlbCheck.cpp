@@ -0,0 +1,416 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+#include <cstdlib>
+#include <iostream>
+
+#include "ShadowTlbCheck.hpp"
+
+#include "../Core.hpp"
+#include "../RuntimeStats.hpp"
+
+#include "../AddressSpace.tcc"
+#include "../Mmu.tcc"
+
+namespace ARMware
+{
+  namespace
+  {
+    inline bool
+    permitted(uint32_t const ap_bits, uint32_t const s_r_bits, CoreMode const mode, RWType const rw_type)
+    {
+      bool const user = (MODE_USR == mode);
+      bool const write = (WRITE == rw_type);
+      
+      switch (ap_bits)
+      {
+      case 0x0:
+        switch (s_r_bits)
+        {
+        case 0x1: return ((false == user) && (false == write)); // S
+        case 0x2: return (false == write);                      // R
+        default:  return false;
+        }
+        
+      case 0x1: return (false == user);
+      case 0x2: return ((false == user) || (false == write));
+      default:  return true;
+      }
+    }
+    
+    char const *
+    mode_name(CoreMode const mode)
+    {
+      return (MODE_USR == mode) ? "usr" : "svc";
+    }
+  }
+  
+  ///////////////////////////////// Private ///////////////////////////////////
+  //============================== Operation ==================================
+  
+  uint32_t
+  ShadowTlbCheck::random()
+  {
+    // xorshift32
+    m_random ^= (m_random << 13);
+    m_random ^= (m_random >> 17);
+    m_random ^= (m_random << 5);
+    
+    return m_random;
+  }
+  
+  void
+  ShadowTlbCheck::put_descriptor(uint32_t const offset, uint32_t const descriptor)
+  {
+    m_memory.put_data<uint32_t>(offset, descriptor);
+  }
+  
+  uint32_t
+  ShadowTlbCheck::random_ap_bits()
+  {
+    return (random() & 0x3);
+  }
+  
+  uint32_t
+  ShadowTlbCheck::random_level_one_descriptor()
+  {
+    uint32_t const domain_num = (random() & 0xF);
+    
+    switch (random() & 0x7)
+    {
+    case 0:
+      // fault
+      return 0;
+      
+    case 1:
+    case 2:
+    case 3:
+      // coarse page table
+      return ((MachineType::DRAM_BASE + L2_TABLE_OFFSET + ((random() % L2_TABLE_NUMBER) << 10)) |
+              (domain_num << 5) | 0x10 | 0x1);
+      
+    default:
+      // section
+      return ((random() & 0xFFF00000) | (random_ap_bits() << 10) | (domain_num << 5) | 0x10 | 0x2);
+    }
+  }
+  
+  uint32_t
+  ShadowTlbCheck::random_level_two_descriptor()
+  {
+    uint32_t const ap_bits = random_ap_bits();
+    uint32_t const ap_fields = ((ap_bits | (ap_bits << 2) | (ap_bits << 4) | (ap_bits << 6)) << 4);
+    
+    switch (random() & 0x3)
+    {
+    case 0:
+      // fault
+      return 0;
+      
+    case 1:
+      // large page
+      return ((random() & 0xFFFF0000) | ap_fields | 0x1);
+      
+    default:
+      // small page
+      return ((random() & 0xFFFFF000) | ap_fields | 0x2);
+    }
+  }
+  
+  void
+  ShadowTlbCheck::build_tables()
+  {
+    for (uint32_t ttb = 0; ttb < TTB_NUMBER; ++ttb)
+    {
+      for (uint32_t i = 0; i < 4096; ++i)
+      {
+        put_descriptor(TTB_OFFSET + (ttb << 14) + (i << 2),
+                       (i < WINDOW_SECTIONS) ? random_level_one_descriptor() : 0);
+      }
+    }
+    
+    for (uint32_t table = 0; table < L2_TABLE_NUMBER; ++table)
+    {
+      for (uint32_t i = 0; i < 256; ++i)
+      {
+        put_descriptor(L2_TABLE_OFFSET + (table << 10) + (i << 2), random_level_two_descriptor());
+      }
+    }
+  }
+  
+  void
+  ShadowTlbCheck::mutate_tables()
+  {
+    for (uint32_t i = 0; i < MUTATION_PER_ROUND; ++i)
+    {
+      if (0 == (random() & 0x3))
+      {
+        put_descriptor(TTB_OFFSET + ((random() % TTB_NUMBER) << 14) + ((random() % WINDOW_SECTIONS) << 2),
+                       random_level_one_descriptor());
+      }
+      else
+      {
+        put_descriptor(L2_TABLE_OFFSET + ((random() % L2_TABLE_NUMBER) << 10) + ((random() % PAGE_PER_SECTION) << 2),
+                       random_level_two_descriptor());
+      }
+    }
+  }
+  
+  void
+  ShadowTlbCheck::set_context()
+  {
+    uint32_t const ttb = (MachineType::DRAM_BASE + TTB_OFFSET + ((random() % TTB_NUMBER) << 14));
+    
+    if (ttb != m_sys_co_proc.get_TTB_reg())
+    {
+      // The same as writing CP15 register 2 (see SysCoProc::exec_CRT()).
+      m_sys_co_proc.set_reg_value(CPR_2, ttb);
+      m_mmu.flush_walk_cache();
+    }
+    
+    uint32_t dac = 0;
+    
+    for (uint32_t domain_num = 0; domain_num < 16; ++domain_num)
+    {
+      uint32_t access = (random() & 0x3);
+      
+      if (0x2 == access)
+      {
+        // reserved
+        access = 0x1;
+      }
+      
+      dac |= (access << (domain_num << 1));
+    }
+    
+    m_sys_co_proc.set_reg_value(CPR_3, dac);
+    
+    // MMU on, and S & R bits are 00, 01 or 10.
+    m_sys_co_proc.set_reg_value(CPR_1, 0x1 | ((random() % 3) << 8));
+    
+    m_mmu.flush_inst_tlb();
+    m_mmu.flush_data_tlb();
+  }
+  
+  ShadowTlbCheck::Result
+  ShadowTlbCheck::walk(uint32_t const vaddr, CoreMode const mode, RWType const rw_type) const
+  {
+    Result result = { true, 0, 0 };
+    
+    uint32_t const level_one_descriptor =
+      dram_word((m_sys_co_proc.get_TTB_reg() & MachineType::DRAM_SIZE & 0xFFFFC000) + ((vaddr >> 20) << 2));
+    uint32_t const domain_num = ((level_one_descriptor >> 5) & 0xF);
+    bool section;
+    uint32_t ap_bits;
+    
+    switch (level_one_descriptor & 0x3)
+    {
+    case 0x2:
+      section = true;
+      ap_bits = ((level_one_descriptor >> 10) & 0x3);
+      result.m_paddr = ((level_one_descriptor & 0xFFF00000) | (vaddr & 0x000FFFFF));
+      break;
+      
+    case 0x1:
+      {
+        uint32_t const level_two_descriptor =
+          dram_word((level_one_descriptor & MachineType::DRAM_SIZE & 0xFFFFFC00) + (((vaddr >> 12) & 0xFF) << 2));
+        
+        section = false;
+        
+        switch (level_two_descriptor & 0x3)
+        {
+        case 0x1:
+          ap_bits = ((level_two_descriptor >> (4 + (((vaddr >> 14) & 0x3) << 1))) & 0x3);
+          result.m_paddr = ((level_two_descriptor & 0xFFFF0000) | (vaddr & 0x0000FFFF));
+          break;
+          
+        case 0x2:
+          ap_bits = ((level_two_descriptor >> (4 + (((vaddr >> 10) & 0x3) << 1))) & 0x3);
+          result.m_paddr = ((level_two_descriptor & 0xFFFFF000) | (vaddr & 0x00000FFF));
+          break;
+          
+        default:
+          result.m_status = (FS_TRANSLATION_PAGE | (domain_num << 4));
+          return result;
+        }
+      }
+      break;
+      
+    default:
+      result.m_status = FS_TRANSLATION_SECTION;
+      return result;
+    }
+    
+    switch ((m_sys_co_proc.get_DAC_reg() >> (domain_num << 1)) & 0x3)
+    {
+    case 0x0:
+      // no access
+      result.m_paddr = 0;
+      result.m_status = ((section ? FS_DOMAIN_SECTION : FS_DOMAIN_PAGE) | (domain_num << 4));
+      return result;
+      
+    case 0x1:
+      // client
+      if (false == permitted(ap_bits, (m_sys_co_proc.get_ctrl_reg() >> 8) & 0x3, mode, rw_type))
+      {
+        result.m_paddr = 0;
+        result.m_status = ((section ? FS_PERMISSION_SECTION : FS_PERMISSION_PAGE) | (domain_num << 4));
+        return result;
+      }
+      break;
+      
+    default:
+      // manager
+      break;
+    }
+    
+    result.m_fault = false;
+    
+    return result;
+  }
+  
+  ShadowTlbCheck::Result
+  ShadowTlbCheck::translate(uint32_t const vaddr,
+                            CoreMode const mode,
+                            AccessTypeEnum const access_type,
+                            RWType const rw_type)
+  {
+    Result result = { false, 0, 0 };
+    bool exception_occur = false;
+    
+    if (INST == access_type)
+    {
+      result.m_paddr = m_mmu.translate_access<INST, READ>(vaddr, mode, exception_occur);
+    }
+    else if (READ == rw_type)
+    {
+      result.m_paddr = m_mmu.translate_access<DATA, READ>(vaddr, mode, exception_occur);
+    }
+    else
+    {
+      result.m_paddr = m_mmu.translate_access<DATA, WRITE>(vaddr, mode, exception_occur);
+    }
+    
+    if (true == exception_occur)
+    {
+      result.m_fault = true;
+      result.m_paddr = 0;
+      result.m_status = m_sys_co_proc.get_reg_value(CPR_5);
+    }
+    
+    return result;
+  }
+  
+  bool
+  ShadowTlbCheck::run(uint32_t const round_number)
+  {
+    build_tables();
+    
+    for (uint32_t round = 0; round < round_number; ++round)
+    {
+      set_context();
+      
+      for (uint32_t i = 0; i < ACCESS_PER_ROUND; ++i)
+      {
+        // A few pages of each section, so that the same translations are
+        // asked again and again across the rounds.
+        uint32_t const vaddr = (((random() % WINDOW_SECTIONS) << 20) |
+                                ((random() % PAGE_PER_SECTION) << 12) |
+                                (random() & 0xFFC));
+        CoreMode const mode = (random() & 0x1) ? MODE_USR : MODE_SVC;
+        uint32_t const kind = (random() % 3);
+        AccessTypeEnum const access_type = (0 == kind) ? INST : DATA;
+        RWType const rw_type = (2 == kind) ? WRITE : READ;
+        
+        Result const expected = walk(vaddr, mode, rw_type);
+        Result const actual = translate(vaddr, mode, access_type, rw_type);
+        
+        ++m_checked_number;
+        
+        if (true == expected.m_fault)
+        {
+          ++m_fault_number;
+        }
+        
+        if ((expected.m_fault != actual.m_fault) ||
+            (expected.m_paddr != actual.m_paddr) ||
+            (expected.m_status != actual.m_status))
+        {
+          std::cerr << std::hex
+                    << "round " << std::dec << round << std::hex
+                    << ": " << ((INST == access_type) ? "inst" : ((READ == rw_type) ? "read" : "write"))
+                    << " 0x" << vaddr << " in " << mode_name(mode)
+                    << " (TTB 0x" << m_sys_co_proc.get_TTB_reg()
+                    << ", DAC 0x" << m_sys_co_proc.get_DAC_reg()
+                    << ", control 0x" << m_sys_co_proc.get_ctrl_reg() << ")" << std::endl
+                    << "  expected: " << (expected.m_fault ? "fault 0x" : "paddr 0x")
+                    << (expected.m_fault ? expected.m_status : expected.m_paddr) << std::endl
+                    << "  got:      " << (actual.m_fault ? "fault 0x" : "paddr 0x")
+                    << (actual.m_fault ? actual.m_status : actual.m_paddr)
+                    << std::dec << std::endl;
+          
+          return false;
+        }
+      }
+      
+      mutate_tables();
+    }
+    
+    return true;
+  }
+  
+  //============================== Life cycle =================================
+  
+  ShadowTlbCheck::ShadowTlbCheck(uint32_t const seed)
+    : m_random((0 == seed) ? 1 : seed),
+      m_memory(MachineType::DRAM_SIZE + 1, 0),
+      m_address_space(0, 0),
+      m_sys_co_proc(0),
+      m_mmu(&m_sys_co_proc, &m_address_space),
+      m_checked_number(0),
+      m_fault_number(0)
+  {
+    m_address_space.RegisterMemory(&m_memory);
+    
+    m_memory.register_walk_cache(m_mmu.walk_cache());
+    m_mmu.shadow_tlb()->register_memory(m_memory.get_memory_buffer());
+  }
+  
+  ///////////////////////////////// Public ////////////////////////////////////
+  //============================== Operation ==================================
+  
+  int
+  ShadowTlbCheck::command_line(int const argc, char const * const * const argv)
+  {
+    uint32_t const round_number = (argc >= 1) ? strtoul(argv[0], 0, 0) : DEFAULT_ROUND_NUMBER;
+    uint32_t const seed = (argc >= 2) ? strtoul(argv[1], 0, 0) : 1;
+    
+    ShadowTlbCheck check(seed);
+    
+    bool const pass = check.run(round_number);
+    
+    std::cerr << (pass ? "PASS: " : "FAIL: ")
+              << check.m_checked_number << " translations checked ("
+              << check.m_fault_number << " faults), shadow TLB "
+              << g_runtime_stats.counter(RuntimeStats::SHADOW_TLB_HIT) << " hits, "
+              << g_runtime_stats.counter(RuntimeStats::SHADOW_TLB_STALE) << " stale, walk cache "
+              << g_runtime_stats.counter(RuntimeStats::WALK_CACHE_HIT) << " hits" << std::endl;
+    
+    return pass ? EXIT_SUCCESS : EXIT_FAILURE;
+  }
+}
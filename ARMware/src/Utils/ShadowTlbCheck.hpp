@@ -0,0 +1,130 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+#ifndef ShadowTlbCheck_hpp
+#define ShadowTlbCheck_hpp
+
+#include <string>
+
+#include "../Type.hpp"
+#include "../ARMware.hpp"
+#include "../Memory.hpp"
+#include "../AddressSpace.hpp"
+#include "../SysCoProc.hpp"
+#include "../Mmu.hpp"
+
+namespace ARMware
+{
+  // Correctness check of the shadow TLB (and the walk cache) of Mmu.
+  //
+  // It builds level 1 & coarse level 2 page tables in DRAM, then round
+  // after round it:
+  //
+  // * picks a translation table base, a domain access control register and
+  //   the S & R bits,
+  // * flushes both TLBs, as the guest does on a context switch,
+  // * translates random addresses through Mmu::translate_access(), and
+  //   compares each result (the physical address, or the fault status &
+  //   domain) with a walk of the page tables in DRAM done here,
+  // * rewrites random descriptors through Memory::put_data(), the path of
+  //   the guest stores, without flushing anything.
+  //
+  // Thus every translation kept by the shadow TLB across the flushes is
+  // checked against the page tables which have changed behind it.
+  //
+  // The four AP fields of a page descriptor are always the same, because
+  // a TLB entry keeps only one of them (as the Linux page tables do).
+  //
+  //   armware --check-shadow-tlb [<rounds> [<seed>]]
+  typedef class ShadowTlbCheck ShadowTlbCheck;
+  class ShadowTlbCheck
+  {
+  private:
+    
+    struct Result
+    {
+      bool m_fault;
+      uint32_t m_paddr;
+      uint32_t m_status; // the FSR value if m_fault
+    };
+    typedef struct Result Result;
+    
+    static uint32_t const DEFAULT_ROUND_NUMBER = 2000;
+    static uint32_t const ACCESS_PER_ROUND = 256;
+    static uint32_t const MUTATION_PER_ROUND = 8;
+    
+    // The translation table bases, and the coarse page tables.
+    static uint32_t const TTB_NUMBER = 2;
+    static uint32_t const TTB_OFFSET = 0x4000;
+    static uint32_t const L2_TABLE_NUMBER = 16;
+    static uint32_t const L2_TABLE_OFFSET = 0x10000;
+    
+    // Only the first WINDOW_SECTIONS MB of the virtual address space are
+    // mapped, so that the accesses keep hitting the same descriptors.
+    static uint32_t const WINDOW_SECTIONS = 8;
+    static uint32_t const PAGE_PER_SECTION = 8;
+    
+    // Attribute
+    
+    uint32_t m_random;
+    
+    Memory m_memory;
+    AddressSpace m_address_space;
+    SysCoProc m_sys_co_proc;
+    Mmu m_mmu;
+    
+    uint64_t m_checked_number;
+    uint64_t m_fault_number;
+    
+    // Operation
+    
+    uint32_t random();
+    
+    void put_descriptor(uint32_t const offset, uint32_t const descriptor);
+    
+    uint32_t random_ap_bits();
+    uint32_t random_level_one_descriptor();
+    uint32_t random_level_two_descriptor();
+    
+    void build_tables();
+    void mutate_tables();
+    void set_context();
+    
+    Result walk(uint32_t const vaddr, CoreMode const mode, RWType const rw_type) const;
+    Result translate(uint32_t const vaddr, CoreMode const mode, AccessTypeEnum const access_type, RWType const rw_type);
+    
+    bool run(uint32_t const round_number);
+    
+    // Inquery
+    
+    inline uint32_t
+    dram_word(uint32_t const offset) const
+    { return *reinterpret_cast<uint32_t const *>(&(m_memory.get_memory_buffer()[offset])); }
+    
+    // Life cycle
+    
+    ShadowTlbCheck(uint32_t const seed);
+    
+  public:
+    
+    // Operation
+    
+    static int command_line(int const argc, char const * const * const argv);
+  };
+}
+
+#endif
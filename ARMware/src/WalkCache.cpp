@@ -0,0 +1,98 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+#include <cstdlib>
+#include <cstring>
+
+#include "WalkCache.hpp"
+#include "Log.hpp"
+#include "Utils/Number.hpp"
+
+namespace ARMware
+{
+  ///////////////////////////////// Private ///////////////////////////////////
+  //============================== Operation ==================================
+  
+  void
+  WalkCache::unit_written(uint32_t const offset)
+  {
+    uint32_t const unit = (offset >> WATCH_UNIT_SHIFT);
+    
+    for (uint32_t i = 0; i < m_entry_number; ++i)
+    {
+      if ((mp_entries[i].m_offset != INVALID_OFFSET) &&
+          (unit == (mp_entries[i].m_offset >> WATCH_UNIT_SHIFT)))
+      {
+        mp_entries[i].m_offset = INVALID_OFFSET;
+      }
+    }
+    
+    m_watch_bitmap[unit >> 5] &= ~(1 << (unit & 31));
+    
+    g_runtime_stats.increase(RuntimeStats::WALK_CACHE_INVALIDATE);
+  }
+  
+  ///////////////////////////////// Public ////////////////////////////////////
+  //============================== Life cycle =================================
+  
+  WalkCache::WalkCache()
+    : m_entry_number(DEFAULT_ENTRY_NUMBER),
+      mp_entries(0)
+  {
+    char const * const entry_number = getenv("ARMWARE_WALK_CACHE");
+    
+    if (entry_number != 0)
+    {
+      m_entry_number = strtoul(entry_number, 0, 0);
+      
+      if ((m_entry_number != 0) && (false == power_of_two(m_entry_number)))
+      {
+        g_log_file << "Walk cache: " << m_entry_number << " is not a power of 2, use "
+                   << DEFAULT_ENTRY_NUMBER << std::endl;
+        
+        m_entry_number = DEFAULT_ENTRY_NUMBER;
+      }
+    }
+    
+    if (m_entry_number != 0)
+    {
+      mp_entries = new Entry[m_entry_number];
+    }
+    
+    flush_all();
+  }
+  
+  WalkCache::~WalkCache()
+  {
+    delete[] mp_entries;
+  }
+  
+  //============================== Operation ==================================
+  
+  void
+  WalkCache::flush_all()
+  {
+    for (uint32_t i = 0; i < m_entry_number; ++i)
+    {
+      mp_entries[i].m_offset = INVALID_OFFSET;
+    }
+    
+    memset(m_watch_bitmap, 0, sizeof(m_watch_bitmap));
+    
+    g_runtime_stats.increase(RuntimeStats::WALK_CACHE_FLUSH);
+  }
+}
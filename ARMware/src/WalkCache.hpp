@@ -0,0 +1,161 @@
+// ARMware - an ARM emulator
+// Copyright (C) <2007>  Wei Hu <wei.hu.tw@gmail.com>
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+#ifndef WalkCache_hpp
+#define WalkCache_hpp
+
+#include <cassert>
+
+#include "Type.hpp"
+#include "MachineType.hpp"
+#include "RuntimeStats.hpp"
+
+namespace ARMware
+{
+  // A direct mapped cache of the level 1 and level 2 descriptors read by
+  // the page table walk of Mmu, so that a TLB miss doesn't have to go
+  // through AddressSpace for the descriptors every time.
+  //
+  // Only the descriptors in DRAM are cached, and they are tagged by their
+  // DRAM offset. Every 1 KB unit of DRAM which holds a cached descriptor is
+  // marked in the watch bitmap (1 KB is the size of a coarse page table),
+  // and Memory::put_data() calls dram_written(), which drops every cached
+  // descriptor of a marked unit once that unit is written.
+  //
+  // The whole cache is flushed when the translation table base register is
+  // written, but it survives the TLB flushes, because the descriptors
+  // themselves don't change by a TLB flush.
+  //
+  // ARMWARE_WALK_CACHE=<n> sets the number of entries (a power of 2,
+  // DEFAULT_ENTRY_NUMBER by default, 0 turns it off).
+  typedef class WalkCache WalkCache;
+  class WalkCache
+  {
+  private:
+    
+    struct Entry
+    {
+      uint32_t m_offset;
+      uint32_t m_descriptor;
+    };
+    typedef struct Entry Entry;
+    
+    static uint32_t const INVALID_OFFSET = 0xFFFFFFFF;
+    static uint32_t const DEFAULT_ENTRY_NUMBER = 256;
+    
+    static uint32_t const WATCH_UNIT_SHIFT = 10;
+    static uint32_t const WATCH_UNIT_NUMBER = ((MachineType::DRAM_SIZE + 1) >> WATCH_UNIT_SHIFT);
+    
+    // Attribute
+    
+    uint32_t m_entry_number;
+    Entry *mp_entries;
+    
+    uint32_t m_watch_bitmap[WATCH_UNIT_NUMBER >> 5];
+    
+    // Operation
+    
+    void unit_written(uint32_t const offset);
+    
+    // Inquery
+    
+    inline bool
+    is_cacheable(uint32_t const paddr) const
+    {
+      // DRAM is mirrored in 0xC0000000 - 0xC7FFFFFF.
+      return ((m_entry_number != 0) &&
+              (MachineType::DRAM_BASE == (paddr & 0xF8000000)));
+    }
+    
+    inline Entry &
+    entry_of(uint32_t const offset) const
+    { return mp_entries[(offset >> 2) & (m_entry_number - 1)]; }
+    
+  public:
+    
+    // Life cycle
+    
+    WalkCache();
+    ~WalkCache();
+    
+    // Operation
+    
+    void flush_all();
+    
+    inline bool
+    find(uint32_t const paddr, uint32_t &descriptor) const
+    {
+      if (false == is_cacheable(paddr))
+      {
+        return false;
+      }
+      
+      uint32_t const offset = (paddr & MachineType::DRAM_SIZE);
+      Entry const &entry = entry_of(offset);
+      
+      if (entry.m_offset != offset)
+      {
+        g_runtime_stats.increase(RuntimeStats::WALK_CACHE_MISS);
+        
+        return false;
+      }
+      
+      g_runtime_stats.increase(RuntimeStats::WALK_CACHE_HIT);
+      
+      descriptor = entry.m_descriptor;
+      
+      return true;
+    }
+    
+    inline void
+    insert(uint32_t const paddr, uint32_t const descriptor)
+    {
+      if (false == is_cacheable(paddr))
+      {
+        return;
+      }
+      
+      uint32_t const offset = (paddr & MachineType::DRAM_SIZE);
+      Entry &entry = entry_of(offset);
+      
+      entry.m_offset = offset;
+      entry.m_descriptor = descriptor;
+      
+      m_watch_bitmap[offset >> (WATCH_UNIT_SHIFT + 5)] |= (1 << ((offset >> WATCH_UNIT_SHIFT) & 31));
+    }
+    
+    // 'offset' is the DRAM offset of a store.
+    inline void
+    dram_written(uint32_t const offset)
+    {
+      assert(offset <= MachineType::DRAM_SIZE);
+      
+      if (m_watch_bitmap[offset >> (WATCH_UNIT_SHIFT + 5)] & (1 << ((offset >> WATCH_UNIT_SHIFT) & 31)))
+      {
+        unit_written(offset);
+      }
+    }
+    
+    // Inquery
+    
+    inline uint32_t
+    entry_number() const
+    { return m_entry_number; }
+  };
+}
+
+#endif
@@ -16,6 +16,8 @@
 //
 
 #include <cassert>
+#include <cstdlib>
+#include <cstring>
 #include "platform_dep.hpp"
 
 #if WIN32
@@ -25,6 +27,7 @@
 
 #elif LINUX
 
+#include <stdint.h>
 #include <sys/mman.h>
 #include <unistd.h>
 #include <csignal>
@@ -253,9 +256,61 @@ memory_unprotect(
 #endif
 }
 
+namespace
+{
+  // The huge page of x86 is 4 MB without PAE, and 2 MB with PAE,
+  // a multiple of both works for either.
+  size_t const HUGE_PAGE_ALIGNMENT = 4 * 1024 * 1024;
+  
+  inline size_t
+  huge_page_aligned_size(size_t const size)
+  {
+    return (size + (HUGE_PAGE_ALIGNMENT - 1)) & ~(HUGE_PAGE_ALIGNMENT - 1);
+  }
+}
+
+HugePageEnum
+huge_page_setting()
+{
+  char const * const setting = getenv("ARMWARE_HUGE_PAGES");
+  
+  if (0 == setting)
+  {
+    return HUGE_PAGE_NONE;
+  }
+  else if (0 == strcmp(setting, "transparent"))
+  {
+    return HUGE_PAGE_TRANSPARENT;
+  }
+  else if (0 == strcmp(setting, "explicit"))
+  {
+    return HUGE_PAGE_EXPLICIT;
+  }
+  else
+  {
+    return HUGE_PAGE_NONE;
+  }
+}
+
+void
+memory_advise_huge_page(
+  void * const addr,
+  size_t const size)
+{
+#if LINUX && defined(MADV_HUGEPAGE)
+  // Only an advice, the region works the same if the kernel doesn't take it.
+  (void)madvise(addr, size, MADV_HUGEPAGE);
+#else
+  (void)addr;
+  (void)size;
+#endif
+}
+
 void *
 memory_allocate(
-  size_t const size)
+  size_t const size,
+  HugePageEnum const huge_page,
+  bool const executable)
 {
 #if LINUX
   // :NOTE: Wei 2004-Aug-11:
@@ -270,9 +325,68 @@ memory_allocate(
   //
   // mmap() will allocate page-aligned memory directly from the Linux
   // kernel.
+  int const prot = (PROT_READ | PROT_WRITE | ((true == executable) ? PROT_EXEC : 0));
+  
+  if (HUGE_PAGE_EXPLICIT == huge_page)
+  {
+#if defined(MAP_HUGETLB)
+    void * const result = mmap(0,
+                               huge_page_aligned_size(size),
+                               prot,
+                               MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB,
+                               -1,
+                               0);
+    
+    return ((MAP_FAILED == result) ? 0 : result);
+#else
+    return 0;
+#endif
+  }
+  
+  if (HUGE_PAGE_TRANSPARENT == huge_page)
+  {
+    // The kernel only backs the huge page aligned parts of a region by the
+    // transparent huge pages, and mmap() only aligns to the native page.
+    // Thus I map one more huge page, and unmap the unaligned head & the
+    // tail around the aligned region.
+    size_t const aligned_size = huge_page_aligned_size(size);
+    void * const reserved = mmap(0,
+                                 aligned_size + HUGE_PAGE_ALIGNMENT,
+                                 prot,
+                                 MAP_PRIVATE | MAP_ANONYMOUS,
+                                 -1,
+                                 0);
+    
+    if (MAP_FAILED == reserved)
+    {
+      return 0;
+    }
+    
+    char * const begin = static_cast<char *>(reserved);
+    char * const result =
+      reinterpret_cast<char *>((reinterpret_cast<uintptr_t>(begin) + (HUGE_PAGE_ALIGNMENT - 1)) &
+                               ~static_cast<uintptr_t>(HUGE_PAGE_ALIGNMENT - 1));
+    size_t const head_size = (result - begin);
+    size_t const tail_size = (HUGE_PAGE_ALIGNMENT - head_size);
+    
+    if (head_size != 0)
+    {
+      munmap(begin, head_size);
+    }
+    
+    if (tail_size != 0)
+    {
+      munmap(result + aligned_size, tail_size);
+    }
+    
+    memory_advise_huge_page(result, aligned_size);
+    
+    return result;
+  }
+  
   void *result = mmap(0,
                       size,
-                      PROT_READ | PROT_WRITE,
+                      prot,
                       MAP_PRIVATE | MAP_ANONYMOUS,
                       0,
                       0);
@@ -285,6 +399,9 @@ memory_allocate(
     return result;
   }
 #elif WIN32
+  (void)huge_page;
+  (void)executable;
+  
   return VirtualAlloc(NULL,
                       size,
                       MEM_COMMIT | MEM_RESERVE,
@@ -297,13 +414,16 @@ memory_allocate(
 void
 memory_release(
   ARMware::uint8_t * const memory,
-  size_t const size)
+  size_t const size,
+  HugePageEnum const huge_page)
 {
   assert(memory != 0);
-
+  
 #if LINUX
-  munmap(memory, size);
+  munmap(memory, ((HUGE_PAGE_NONE == huge_page) ? size : huge_page_aligned_size(size)));
 #elif WIN32
+  (void)huge_page;
+  
   VirtualFree(memory, size, MEM_RELEASE);
 #else
 #error "Platform doesn't support mmap and we have no implementation."
@@ -24,6 +24,8 @@
 
 #if WIN32
 
+#include <intrin.h>
+
 #define NORETURN
 #define GTK_FONT_ENCODING_NAME "UTF-8"
 
@@ -68,15 +70,15 @@ extern int library_free(
 extern void *library_get_symbol(
   void * const library,
   char const * const name);
-
+  
 #if LINUX
-
+  
 #define EXCEPTION_PROTECTION_BLOCK_BEGIN
 #define EXCEPTION_PROTECTION_BLOCK_END
 #define EXCEPTION_HANDLER_PROTOTYPE
-
+  
 #elif WIN32
-
+  
   // The unhandled exception handling on win32 platform
   // after vc++2005 is changed:
   //
@@ -99,13 +101,13 @@ extern void *library_get_symbol(
 #define EXCEPTION_PROTECTION_BLOCK_BEGIN \
   __try                                  \
   {
-
+    
 #define EXCEPTION_PROTECTION_BLOCK_END                        \
   }                                                           \
   __except(::segfault_handler(GetExceptionInformation()))     \
   {                                                           \
   }
-
+  
 #define EXCEPTION_HANDLER_PROTOTYPE             \
   extern LONG WINAPI                            \
   segfault_handler(                             \
@@ -126,13 +128,90 @@ extern int memory_unprotect(
   void *addr,
   size_t len);
 
+// How a region from memory_allocate() is backed by the huge pages of the
+// host (only on Linux, they are ignored elsewhere):
+//
+// * HUGE_PAGE_TRANSPARENT: madvise(MADV_HUGEPAGE) on a region aligned to
+//   the huge page. The region can still be mprotect()ed per native page,
+//   the kernel splits the huge page then.
+// * HUGE_PAGE_EXPLICIT: MAP_HUGETLB, from the pool reserved in
+//   /proc/sys/vm/nr_hugepages. The region can NOT be mprotect()ed per
+//   native page, and memory_allocate() returns 0 when the pool is short.
+enum HugePageEnum
+{
+  HUGE_PAGE_NONE,
+  HUGE_PAGE_TRANSPARENT,
+  HUGE_PAGE_EXPLICIT
+};
+typedef enum HugePageEnum HugePageEnum;
+
+// ARMWARE_HUGE_PAGES=transparent or explicit, HUGE_PAGE_NONE otherwise.
+extern HugePageEnum huge_page_setting();
+
+// @executable: the host can execute codes in the region (the code cache).
 extern void *memory_allocate(
-  size_t const size);
+  size_t const size,
+  HugePageEnum const huge_page = HUGE_PAGE_NONE,
+  bool const executable = false);
 
 extern void memory_release(
   ARMware::uint8_t * const memory,
+  size_t const size,
+  HugePageEnum const huge_page = HUGE_PAGE_NONE);
+
+extern void memory_advise_huge_page(
+  void * const addr,
   size_t const size);
 
 extern ARMware::uint32_t get_native_page_size();
 
+// The host CPU time stamp counter, used to measure the time spent
+// in the dynamic compiler and so on.
+inline ARMware::uint64_t
+read_time_stamp_counter()
+{
+#if LINUX
+  ARMware::uint64_t tsc;
+  
+  asm volatile ("rdtsc" : "=A" (tsc));
+  
+  return tsc;
+#elif WIN32
+  return __rdtsc();
+#else
+#error "Platform doesn't support rdtsc and we have no implementation."
+#endif
+}
+
+// Keeps the memory accesses before it from being reordered with the ones
+// after it, for the data shared between threads without a lock (ex:
+// SpscRing). x86 never reorders a store with an older store, nor a load
+// with an older load or a younger store, so only the compiler has to be
+// stopped here.
+inline void
+memory_barrier()
+{
+#if LINUX
+  asm volatile ("" : : : "memory");
+#elif WIN32
+  _ReadWriteBarrier();
+#else
+#error "Platform doesn't support memory barrier and we have no implementation."
+#endif
+}
+
+// Replace *addr with 'value' atomically, and return the previous value.
+inline ARMware::uint32_t
+atomic_exchange(ARMware::uint32_t * const addr, ARMware::uint32_t const value)
+{
+#if LINUX
+  return __sync_lock_test_and_set(addr, value);
+#elif WIN32
+  return static_cast<ARMware::uint32_t>(_InterlockedExchange(reinterpret_cast<long volatile *>(addr),
+                                                             static_cast<long>(value)));
+#else
+#error "Platform doesn't support atomic exchange and we have no implementation."
+#endif
+}
+
 #endif